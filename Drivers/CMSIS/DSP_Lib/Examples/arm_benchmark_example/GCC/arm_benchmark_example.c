@@ -0,0 +1,1978 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2016 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2016
+* $Revision:    V1.4.5
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_benchmark_example.c
+*
+* Description:  Host-side throughput benchmark for the CMSIS DSP kernels.
+*
+* Target Processor: Host (generic C code paths, ARM_MATH_CM0)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup Benchmark Kernel Benchmark Example
+ *
+ * \par Description
+ * \par
+ * Measures the throughput of the library kernels on the build host, using
+ * the generic C code paths of the library (<code>ARM_MATH_CM0</code>).
+ * Each kernel is run over a sweep of block sizes for each data type it
+ * supports, and the result is printed as one CSV record per run:
+ * <pre>
+ *     group,kernel,type,size,samples_per_sec,cycles_per_sample
+ * </pre>
+ * Lines starting with '#' carry the platform description and the results
+ * of the correctness oracles, so the output can be diffed release to release.
+ *
+ * \par Algorithm:
+ * \par
+ * A kernel is called repeatedly on the same block until at least
+ * <code>BENCH_MIN_TIME_NS</code> has elapsed. Cycles are read from the time
+ * stamp counter on x86 hosts; on other hosts they are derived from the
+ * elapsed time and <code>BENCH_CPU_MHZ</code>.
+ * \par
+ * Before timing, a small set of oracles cross-checks kernels against
+ * straightforward double-precision references, the same checks the
+ * FIR and FFT Bin examples perform on the target.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c benchTable lists every benchmarked kernel, its group and type
+ * \li \c blockSizes is the default block size sweep
+ * \li \c fftSizes is the sweep used by the transform kernels
+ * \li \c matDims is the sweep of square matrix dimensions; the
+ *     <code>_solve</code> kernels solve A * X = B for a symmetric
+ *     positive-definite A and \c BENCH_SOLVE_RHS right-hand sides, and
+ *     <code>arm_mat_inverse_mult</code> does the same with
+ *     arm_mat_inverse_f32() followed by arm_mat_mult_f32()
+ * \li \c mixedSizes and \c mixedRealSizes are the non power-of-two frame
+ *     lengths; the <code>_padded</code> kernels time the power-of-two
+ *     transform of the same frame zero-padded, for comparison
+ * \li \c longTaps is the filter length sweep of the direct and FFT-based
+ *     FIR filters, which shows where arm_fir_fft_init_f32() switches path;
+ *     the partitioned filter runs the same block in partitions of
+ *     \c BENCH_PART_BLOCK samples, i.e. with that much latency
+ * \li \c channelCounts is the channel sweep of the multichannel biquads,
+ *     each channel \c BENCH_CHANNEL_BLOCK samples long; the <code>_xN</code>
+ *     kernels run one single-channel instance per channel, for comparison
+ * \li the Kalman kernels replay an IMU trace through a 6-state attitude
+ *     filter (roll, pitch, yaw and the three gyro biases), one predict and
+ *     one 3-measurement update per sample; size is the number of samples.
+ *     The trace is read from the CSV file given as second argument, one
+ *     sample per line: gx,gy,gz (rad/s),ax,ay,az,mx,my,mz as read from the
+ *     L3GD20 and LSM303DLHC, at \c BENCH_IMU_DT intervals.  Without it a
+ *     trace of the same sensors is synthesized.
+ * \li the Goertzel kernels analyze \c BENCH_GOERTZEL_BINS DTMF frequencies
+ *     over a frame of \c fftSizes samples; a closing comment gives, per
+ *     size, the number of bins above which arm_rfft_fast_f32() followed by
+ *     arm_cmplx_mag_squared_f32() is cheaper
+ *
+ * <b> Refer  </b>
+ * \link arm_benchmark_example.c \endlink
+ *
+ */
+
+
+/** \example arm_benchmark_example.c
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/* ----------------------------------------------------------------------
+* Benchmark configuration
+* ------------------------------------------------------------------- */
+#ifndef BENCH_MIN_TIME_NS
+#define BENCH_MIN_TIME_NS   20000000ull     /* 20 ms per measurement */
+#endif
+
+#ifndef BENCH_CPU_MHZ
+#define BENCH_CPU_MHZ       1000u           /* used when no cycle counter */
+#endif
+
+#define BENCH_MAX_SAMPLES   4096u
+#define BENCH_NUM_TAPS      32u
+#define BENCH_NUM_STAGES    4u
+#define BENCH_LONG_BLOCK    256u            /* block size of the long FIR sweep */
+#define BENCH_LONG_TAPS     1024u
+#define BENCH_PART_BLOCK    64u             /* partition size of the partitioned FIR */
+#define BENCH_MAX_CHANNELS  8u
+#define BENCH_CHANNEL_BLOCK 256u            /* samples per channel of the channel sweep */
+#define BENCH_RESAMPLE_L    147u            /* 48 kHz to 44.1 kHz */
+#define BENCH_RESAMPLE_M    160u
+#define BENCH_RESAMPLE_TAPS (8u * BENCH_RESAMPLE_L)
+#define BENCH_WINDOW_LEN    256u            /* window of the sliding statistics */
+#define BENCH_SOLVE_RHS     1u              /* right-hand sides of the matrix solves */
+#define BENCH_IMU_DT        0.01f           /* IMU sample period (s) */
+#define BENCH_IMU_STATES    6u              /* roll, pitch, yaw, gyro bias x, y, z */
+#define BENCH_IMU_BIAS_SHIFT 8u             /* Q31 bias states are scaled up by 2^8 */
+#define BENCH_GOERTZEL_BINS 8u              /* DTMF row and column tones */
+#define BENCH_SDFT_LEN      256u            /* window of the sliding DFT */
+
+/* ----------------------------------------------------------------------
+* Bit reversal for the host build.
+* On target these come from arm_bitreversal2.S, which cannot be assembled
+* for the build host. The semantics are identical: swap the 32-bit (or
+* 16-bit) complex elements at the byte offsets given by the table pairs.
+* ------------------------------------------------------------------- */
+#if !defined(__arm__)
+void arm_bitreversal_32(uint32_t * pSrc, const uint16_t bitRevLen, const uint16_t * pBitRevTab)
+{
+  uint32_t i, a, b, tmp;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    a = pBitRevTab[i] >> 2;
+    b = pBitRevTab[i + 1u] >> 2;
+
+    tmp = pSrc[a];      pSrc[a] = pSrc[b];           pSrc[b] = tmp;
+    tmp = pSrc[a + 1u]; pSrc[a + 1u] = pSrc[b + 1u]; pSrc[b + 1u] = tmp;
+  }
+}
+
+void arm_bitreversal_16(uint16_t * pSrc, const uint16_t bitRevLen, const uint16_t * pBitRevTab)
+{
+  uint32_t i, a, b, tmp;
+  uint32_t *p = (uint32_t *) pSrc;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    a = pBitRevTab[i] >> 3;
+    b = pBitRevTab[i + 1u] >> 3;
+
+    tmp = p[a]; p[a] = p[b]; p[b] = tmp;
+  }
+}
+#endif
+
+/* ----------------------------------------------------------------------
+* Working buffers shared by all kernels (complex sized)
+* ------------------------------------------------------------------- */
+static float32_t srcA_f32[2u * BENCH_MAX_SAMPLES], srcB_f32[2u * BENCH_MAX_SAMPLES];
+static float32_t dst_f32[4u * BENCH_MAX_SAMPLES];
+static q31_t srcA_q31[2u * BENCH_MAX_SAMPLES], srcB_q31[2u * BENCH_MAX_SAMPLES];
+static q31_t dst_q31[4u * BENCH_MAX_SAMPLES];
+static q15_t srcA_q15[2u * BENCH_MAX_SAMPLES], srcB_q15[2u * BENCH_MAX_SAMPLES];
+static q15_t dst_q15[4u * BENCH_MAX_SAMPLES];
+static q7_t srcA_q7[2u * BENCH_MAX_SAMPLES], srcB_q7[2u * BENCH_MAX_SAMPLES];
+static q7_t dst_q7[4u * BENCH_MAX_SAMPLES];
+
+static float32_t state_f32[BENCH_MAX_SAMPLES + BENCH_NUM_TAPS];
+static q31_t state_q31[BENCH_MAX_SAMPLES + BENCH_NUM_TAPS];
+static q15_t state_q15[BENCH_MAX_SAMPLES + BENCH_NUM_TAPS];
+static q7_t state_q7[BENCH_MAX_SAMPLES + BENCH_NUM_TAPS];
+
+static float32_t longState_f32[BENCH_LONG_TAPS + BENCH_LONG_BLOCK];
+static float32_t fftFirState_f32[4u * 2048u];
+static float32_t partFirState_f32[((2u * BENCH_LONG_TAPS / BENCH_PART_BLOCK) + 4u) * 2u * BENCH_PART_BLOCK];
+
+static float32_t coef_f32[BENCH_NUM_TAPS];
+static q31_t coef_q31[BENCH_NUM_TAPS];
+static q15_t coef_q15[BENCH_NUM_TAPS];
+static q7_t coef_q7[BENCH_NUM_TAPS];
+
+static float32_t slideHistory_f32[BENCH_WINDOW_LEN];
+static q31_t slideHistory_q31[BENCH_WINDOW_LEN];
+static q15_t slideHistory_q15[BENCH_WINDOW_LEN];
+static uint16_t slideQueue[2u * BENCH_WINDOW_LEN];
+
+static const float32_t goertzelFreqs[BENCH_GOERTZEL_BINS] =
+{
+  697.0f / 8000.0f, 770.0f / 8000.0f, 852.0f / 8000.0f, 941.0f / 8000.0f,
+  1209.0f / 8000.0f, 1336.0f / 8000.0f, 1477.0f / 8000.0f, 1633.0f / 8000.0f
+};
+static const uint16_t sdftBins[BENCH_GOERTZEL_BINS] = { 22u, 25u, 27u, 30u, 39u, 43u, 47u, 52u };
+static float32_t goertzelCoef_f32[BENCH_GOERTZEL_BINS + 2u], goertzelState_f32[2u * (BENCH_GOERTZEL_BINS + 2u)];
+static q31_t goertzelCoef_q31[BENCH_GOERTZEL_BINS + 2u], goertzelState_q31[2u * (BENCH_GOERTZEL_BINS + 2u)];
+static float32_t sdftTwiddle_f32[2u * BENCH_GOERTZEL_BINS], sdftState_f32[2u * BENCH_GOERTZEL_BINS];
+static float32_t sdftHistory_f32[BENCH_SDFT_LEN];
+
+/* IMU trace, as per-sample filter inputs: gyro rates and the roll, pitch and
+ * heading measured by the accelerometer and magnetometer */
+static float32_t imuGyro_f32[3u * BENCH_MAX_SAMPLES], imuMeas_f32[3u * BENCH_MAX_SAMPLES];
+static q31_t imuGyro_q31[3u * BENCH_MAX_SAMPLES], imuMeas_q31[3u * BENCH_MAX_SAMPLES];
+static float32_t imuTruth_f32[3u * BENCH_MAX_SAMPLES];
+static float32_t imuEst_f32[3u * BENCH_MAX_SAMPLES], imuEst_q31[3u * BENCH_MAX_SAMPLES];
+static uint32_t imuLen;
+static int imuSynthetic;
+
+static float32_t kalX_f32[BENCH_IMU_STATES], kalP_f32[BENCH_IMU_STATES * (BENCH_IMU_STATES + 1u) / 2u];
+static float32_t kalScratch_f32[2u * BENCH_IMU_STATES * BENCH_IMU_STATES + BENCH_IMU_STATES];
+static float32_t kalF_f32[BENCH_IMU_STATES * BENCH_IMU_STATES], kalH_f32[3u * BENCH_IMU_STATES];
+static float32_t kalQ_f32[BENCH_IMU_STATES * (BENCH_IMU_STATES + 1u) / 2u];
+static float32_t kalP0_f32[BENCH_IMU_STATES * (BENCH_IMU_STATES + 1u) / 2u], kalR_f32[3u];
+static q31_t kalX_q31[BENCH_IMU_STATES], kalP_q31[BENCH_IMU_STATES * (BENCH_IMU_STATES + 1u) / 2u];
+static q31_t kalScratch_q31[2u * BENCH_IMU_STATES * BENCH_IMU_STATES + BENCH_IMU_STATES];
+static q31_t kalF_q31[BENCH_IMU_STATES * BENCH_IMU_STATES], kalH_q31[3u * BENCH_IMU_STATES];
+static q31_t kalQ_q31[BENCH_IMU_STATES * (BENCH_IMU_STATES + 1u) / 2u];
+static q31_t kalP0_q31[BENCH_IMU_STATES * (BENCH_IMU_STATES + 1u) / 2u], kalR_q31[3u];
+static uint16_t kalIndex[BENCH_IMU_STATES];
+
+static float32_t biquadCoef_f32[5u * BENCH_NUM_STAGES];
+static q31_t biquadCoef_q31[5u * BENCH_NUM_STAGES];
+static q15_t biquadCoef_q15[6u * BENCH_NUM_STAGES];
+
+/* Scalar results, volatile so the kernels are not optimised away */
+static volatile float32_t sink_f32;
+static volatile q63_t sink_q63;
+static volatile q31_t sink_q31;
+static uint32_t sinkIndex;
+
+/* ----------------------------------------------------------------------
+* Timing
+* ------------------------------------------------------------------- */
+static uint64_t bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
+
+static uint64_t bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return bench_now_ns() * BENCH_CPU_MHZ / 1000u;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+* Kernel wrappers. Each one runs a single block of n samples
+* (n is the matrix dimension for MatrixFunctions).
+* ------------------------------------------------------------------- */
+#define BENCH_BINARY(fn, t) \
+  static void bench_##fn(uint32_t n) { fn(srcA_##t, srcB_##t, dst_##t, n); }
+#define BENCH_UNARY(fn, t) \
+  static void bench_##fn(uint32_t n) { fn(srcA_##t, dst_##t, n); }
+
+BENCH_BINARY(arm_add_f32, f32)
+BENCH_BINARY(arm_add_q31, q31)
+BENCH_BINARY(arm_add_q15, q15)
+BENCH_BINARY(arm_add_q7, q7)
+BENCH_BINARY(arm_mult_f32, f32)
+BENCH_BINARY(arm_mult_q31, q31)
+BENCH_BINARY(arm_mult_q15, q15)
+BENCH_BINARY(arm_mult_q7, q7)
+BENCH_UNARY(arm_abs_f32, f32)
+BENCH_UNARY(arm_abs_q31, q31)
+BENCH_UNARY(arm_abs_q15, q15)
+BENCH_UNARY(arm_abs_q7, q7)
+
+static void bench_arm_scale_f32(uint32_t n) { arm_scale_f32(srcA_f32, 0.5f, dst_f32, n); }
+static void bench_arm_scale_q31(uint32_t n) { arm_scale_q31(srcA_q31, 0x40000000, 0, dst_q31, n); }
+static void bench_arm_scale_q15(uint32_t n) { arm_scale_q15(srcA_q15, 0x4000, 0, dst_q15, n); }
+static void bench_arm_scale_q7(uint32_t n)  { arm_scale_q7(srcA_q7, 0x40, 0, dst_q7, n); }
+
+static void bench_arm_dot_prod_f32(uint32_t n)
+{
+  float32_t r;
+  arm_dot_prod_f32(srcA_f32, srcB_f32, n, &r);
+  sink_f32 = r;
+}
+static void bench_arm_dot_prod_q31(uint32_t n)
+{
+  q63_t r;
+  arm_dot_prod_q31(srcA_q31, srcB_q31, n, &r);
+  sink_q63 = r;
+}
+static void bench_arm_dot_prod_q15(uint32_t n)
+{
+  q63_t r;
+  arm_dot_prod_q15(srcA_q15, srcB_q15, n, &r);
+  sink_q63 = r;
+}
+static void bench_arm_dot_prod_q7(uint32_t n)
+{
+  q31_t r;
+  arm_dot_prod_q7(srcA_q7, srcB_q7, n, &r);
+  sink_q31 = r;
+}
+
+/* Complex math */
+static void bench_arm_cmplx_mult_cmplx_f32(uint32_t n) { arm_cmplx_mult_cmplx_f32(srcA_f32, srcB_f32, dst_f32, n); }
+static void bench_arm_cmplx_mult_cmplx_q31(uint32_t n) { arm_cmplx_mult_cmplx_q31(srcA_q31, srcB_q31, dst_q31, n); }
+static void bench_arm_cmplx_mult_cmplx_q15(uint32_t n) { arm_cmplx_mult_cmplx_q15(srcA_q15, srcB_q15, dst_q15, n); }
+static void bench_arm_cmplx_mag_f32(uint32_t n) { arm_cmplx_mag_f32(srcA_f32, dst_f32, n); }
+static void bench_arm_cmplx_mag_q31(uint32_t n) { arm_cmplx_mag_q31(srcA_q31, dst_q31, n); }
+static void bench_arm_cmplx_mag_q15(uint32_t n) { arm_cmplx_mag_q15(srcA_q15, dst_q15, n); }
+
+/* Filtering */
+static void bench_arm_fir_f32(uint32_t n)
+{
+  arm_fir_instance_f32 S;
+  arm_fir_init_f32(&S, BENCH_NUM_TAPS, coef_f32, state_f32, n);
+  arm_fir_f32(&S, srcA_f32, dst_f32, n);
+}
+static void bench_arm_fir_q31(uint32_t n)
+{
+  arm_fir_instance_q31 S;
+  arm_fir_init_q31(&S, BENCH_NUM_TAPS, coef_q31, state_q31, n);
+  arm_fir_q31(&S, srcA_q31, dst_q31, n);
+}
+static void bench_arm_fir_q15(uint32_t n)
+{
+  arm_fir_instance_q15 S;
+  arm_fir_init_q15(&S, BENCH_NUM_TAPS, coef_q15, state_q15, n);
+  arm_fir_q15(&S, srcA_q15, dst_q15, n);
+}
+static void bench_arm_fir_q7(uint32_t n)
+{
+  arm_fir_instance_q7 S;
+  arm_fir_init_q7(&S, BENCH_NUM_TAPS, coef_q7, state_q7, n);
+  arm_fir_q7(&S, srcA_q7, dst_q7, n);
+}
+
+static void bench_arm_biquad_cascade_df1_f32(uint32_t n)
+{
+  arm_biquad_casd_df1_inst_f32 S;
+  arm_biquad_cascade_df1_init_f32(&S, BENCH_NUM_STAGES, biquadCoef_f32, state_f32);
+  arm_biquad_cascade_df1_f32(&S, srcA_f32, dst_f32, n);
+}
+static void bench_arm_biquad_cascade_df1_q31(uint32_t n)
+{
+  arm_biquad_casd_df1_inst_q31 S;
+  arm_biquad_cascade_df1_init_q31(&S, BENCH_NUM_STAGES, biquadCoef_q31, state_q31, 1);
+  arm_biquad_cascade_df1_q31(&S, srcA_q31, dst_q31, n);
+}
+static void bench_arm_biquad_cascade_df1_q15(uint32_t n)
+{
+  arm_biquad_casd_df1_inst_q15 S;
+  arm_biquad_cascade_df1_init_q15(&S, BENCH_NUM_STAGES, biquadCoef_q15, state_q15, 1);
+  arm_biquad_cascade_df1_q15(&S, srcA_q15, dst_q15, n);
+}
+static void bench_arm_biquad_cascade_df2T_f32(uint32_t n)
+{
+  arm_biquad_cascade_df2T_instance_f32 S;
+  arm_biquad_cascade_df2T_init_f32(&S, BENCH_NUM_STAGES, biquadCoef_f32, state_f32);
+  arm_biquad_cascade_df2T_f32(&S, srcA_f32, dst_f32, n);
+}
+
+/* L/M resampler; srcB holds the polyphase filter */
+static void bench_arm_fir_resample_f32(uint32_t n)
+{
+  arm_fir_resample_instance_f32 S;
+  arm_fir_resample_init_f32(&S, BENCH_RESAMPLE_L, BENCH_RESAMPLE_M, BENCH_RESAMPLE_TAPS, srcB_f32, state_f32, n);
+  sinkIndex = arm_fir_resample_f32(&S, srcA_f32, dst_f32, n);
+}
+static void bench_arm_fir_resample_q15(uint32_t n)
+{
+  arm_fir_resample_instance_q15 S;
+  arm_fir_resample_init_q15(&S, BENCH_RESAMPLE_L, BENCH_RESAMPLE_M, BENCH_RESAMPLE_TAPS, srcB_q15, state_q15, n);
+  sinkIndex = arm_fir_resample_q15(&S, srcA_q15, dst_q15, n);
+}
+
+/* Multichannel biquads (n is the number of channels), against one instance per channel */
+static void bench_arm_biquad_cascade_multichannel_df2T_f32(uint32_t n)
+{
+  arm_biquad_cascade_multichannel_df2T_instance_f32 S;
+  arm_biquad_cascade_multichannel_df2T_init_f32(&S, BENCH_NUM_STAGES, (uint8_t) n, biquadCoef_f32, state_f32);
+  arm_biquad_cascade_multichannel_df2T_f32(&S, srcA_f32, dst_f32, BENCH_CHANNEL_BLOCK);
+}
+static void bench_arm_biquad_cascade_df2T_xN_f32(uint32_t n)
+{
+  arm_biquad_cascade_df2T_instance_f32 S[BENCH_MAX_CHANNELS];
+  uint32_t c;
+
+  for (c = 0u; c < n; c++)
+  {
+    arm_biquad_cascade_df2T_init_f32(&S[c], BENCH_NUM_STAGES, biquadCoef_f32, state_f32 + (2u * BENCH_NUM_STAGES * c));
+  }
+  for (c = 0u; c < n; c++)
+  {
+    arm_biquad_cascade_df2T_f32(&S[c], srcA_f32 + (BENCH_CHANNEL_BLOCK * c), dst_f32 + (BENCH_CHANNEL_BLOCK * c), BENCH_CHANNEL_BLOCK);
+  }
+}
+static void bench_arm_biquad_cascade_multichannel_df1_q31(uint32_t n)
+{
+  arm_biquad_cascade_multichannel_df1_instance_q31 S;
+  arm_biquad_cascade_multichannel_df1_init_q31(&S, BENCH_NUM_STAGES, (uint8_t) n, biquadCoef_q31, state_q31, 1);
+  arm_biquad_cascade_multichannel_df1_q31(&S, srcA_q31, dst_q31, BENCH_CHANNEL_BLOCK);
+}
+static void bench_arm_biquad_cascade_df1_xN_q31(uint32_t n)
+{
+  arm_biquad_casd_df1_inst_q31 S[BENCH_MAX_CHANNELS];
+  uint32_t c;
+
+  for (c = 0u; c < n; c++)
+  {
+    arm_biquad_cascade_df1_init_q31(&S[c], BENCH_NUM_STAGES, biquadCoef_q31, state_q31 + (4u * BENCH_NUM_STAGES * c), 1);
+  }
+  for (c = 0u; c < n; c++)
+  {
+    arm_biquad_cascade_df1_q31(&S[c], srcA_q31 + (BENCH_CHANNEL_BLOCK * c), dst_q31 + (BENCH_CHANNEL_BLOCK * c), BENCH_CHANNEL_BLOCK);
+  }
+}
+
+/* Long FIR, direct and FFT-based (n is the number of taps, srcB holds the taps) */
+static void bench_arm_fir_long_f32(uint32_t n)
+{
+  arm_fir_instance_f32 S;
+  arm_fir_init_f32(&S, (uint16_t) n, srcB_f32, longState_f32, BENCH_LONG_BLOCK);
+  arm_fir_f32(&S, srcA_f32, dst_f32, BENCH_LONG_BLOCK);
+}
+static void bench_arm_fir_fft_f32(uint32_t n)
+{
+  static arm_fir_fft_instance_f32 S;
+  static uint32_t numTaps = 0u;
+
+  /* The spectrum is computed once per tap count, as an application would */
+  if (numTaps != n)
+  {
+    arm_fir_fft_init_f32(&S, (uint16_t) n, srcB_f32, fftFirState_f32, BENCH_LONG_BLOCK);
+    numTaps = n;
+  }
+  arm_fir_fft_f32(&S, srcA_f32, dst_f32, BENCH_LONG_BLOCK);
+}
+static void bench_arm_fir_partitioned_f32(uint32_t n)
+{
+  static arm_fir_partitioned_instance_f32 S;
+  static uint32_t numTaps = 0u;
+  uint32_t i;
+
+  if (numTaps != n)
+  {
+    arm_fir_partitioned_init_f32(&S, (uint16_t) n, srcB_f32, partFirState_f32, BENCH_PART_BLOCK);
+    numTaps = n;
+  }
+  for (i = 0u; i < BENCH_LONG_BLOCK; i += BENCH_PART_BLOCK)
+  {
+    arm_fir_partitioned_f32(&S, srcA_f32 + i, dst_f32 + i);
+  }
+}
+
+static void bench_arm_conv_f32(uint32_t n) { arm_conv_f32(srcA_f32, n, coef_f32, BENCH_NUM_TAPS, dst_f32); }
+static void bench_arm_conv_q31(uint32_t n) { arm_conv_q31(srcA_q31, n, coef_q31, BENCH_NUM_TAPS, dst_q31); }
+static void bench_arm_conv_q15(uint32_t n) { arm_conv_q15(srcA_q15, n, coef_q15, BENCH_NUM_TAPS, dst_q15); }
+static void bench_arm_conv_q7(uint32_t n)  { arm_conv_q7(srcA_q7, n, coef_q7, BENCH_NUM_TAPS, dst_q7); }
+
+/* Transforms (n is the FFT length) */
+static const arm_cfft_instance_f32 * bench_cfft_f32(uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:   return &arm_cfft_sR_f32_len16;
+  case 32u:   return &arm_cfft_sR_f32_len32;
+  case 64u:   return &arm_cfft_sR_f32_len64;
+  case 128u:  return &arm_cfft_sR_f32_len128;
+  case 256u:  return &arm_cfft_sR_f32_len256;
+  case 512u:  return &arm_cfft_sR_f32_len512;
+  case 1024u: return &arm_cfft_sR_f32_len1024;
+  case 2048u: return &arm_cfft_sR_f32_len2048;
+  default:    return &arm_cfft_sR_f32_len4096;
+  }
+}
+static const arm_cfft_instance_q31 * bench_cfft_q31(uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:   return &arm_cfft_sR_q31_len16;
+  case 32u:   return &arm_cfft_sR_q31_len32;
+  case 64u:   return &arm_cfft_sR_q31_len64;
+  case 128u:  return &arm_cfft_sR_q31_len128;
+  case 256u:  return &arm_cfft_sR_q31_len256;
+  case 512u:  return &arm_cfft_sR_q31_len512;
+  case 1024u: return &arm_cfft_sR_q31_len1024;
+  case 2048u: return &arm_cfft_sR_q31_len2048;
+  default:    return &arm_cfft_sR_q31_len4096;
+  }
+}
+static const arm_cfft_instance_q15 * bench_cfft_q15(uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:   return &arm_cfft_sR_q15_len16;
+  case 32u:   return &arm_cfft_sR_q15_len32;
+  case 64u:   return &arm_cfft_sR_q15_len64;
+  case 128u:  return &arm_cfft_sR_q15_len128;
+  case 256u:  return &arm_cfft_sR_q15_len256;
+  case 512u:  return &arm_cfft_sR_q15_len512;
+  case 1024u: return &arm_cfft_sR_q15_len1024;
+  case 2048u: return &arm_cfft_sR_q15_len2048;
+  default:    return &arm_cfft_sR_q15_len4096;
+  }
+}
+
+static void bench_arm_cfft_f32(uint32_t n)
+{
+  memcpy(dst_f32, srcA_f32, 2u * n * sizeof(float32_t));
+  arm_cfft_f32(bench_cfft_f32(n), dst_f32, 0u, 1u);
+}
+static void bench_arm_cfft_q31(uint32_t n)
+{
+  memcpy(dst_q31, srcA_q31, 2u * n * sizeof(q31_t));
+  arm_cfft_q31(bench_cfft_q31(n), dst_q31, 0u, 1u);
+}
+static void bench_arm_cfft_q15(uint32_t n)
+{
+  memcpy(dst_q15, srcA_q15, 2u * n * sizeof(q15_t));
+  arm_cfft_q15(bench_cfft_q15(n), dst_q15, 0u, 1u);
+}
+static void bench_arm_rfft_fast_f32(uint32_t n)
+{
+  arm_rfft_fast_instance_f32 S;
+
+  arm_rfft_fast_init_f32(&S, (uint16_t) n);
+  memcpy(dst_f32, srcA_f32, n * sizeof(float32_t));
+  arm_rfft_fast_f32(&S, dst_f32, dst_f32 + 2u * BENCH_MAX_SAMPLES, 0u);
+}
+
+/* Goertzel filter banks (n is the frame length, one frame per call) */
+static void bench_arm_goertzel_f32(uint32_t n)
+{
+  static arm_goertzel_instance_f32 S;
+
+  if (S.frameLen != n)
+  {
+    arm_goertzel_init_f32(&S, BENCH_GOERTZEL_BINS, (uint16_t) n, goertzelFreqs, goertzelCoef_f32, goertzelState_f32);
+  }
+  arm_goertzel_f32(&S, srcA_f32, n, dst_f32);
+}
+static void bench_arm_goertzel_q31(uint32_t n)
+{
+  static arm_goertzel_instance_q31 S;
+
+  if (S.frameLen != n)
+  {
+    arm_goertzel_init_q31(&S, BENCH_GOERTZEL_BINS, (uint16_t) n, goertzelFreqs, goertzelCoef_q31, goertzelState_q31);
+  }
+  arm_goertzel_q31(&S, srcA_q31, n, dst_q31);
+}
+static void bench_arm_goertzel_q15(uint32_t n)
+{
+  static arm_goertzel_instance_q15 S;
+
+  if (S.frameLen != n)
+  {
+    arm_goertzel_init_q15(&S, BENCH_GOERTZEL_BINS, (uint16_t) n, goertzelFreqs, goertzelCoef_q31, goertzelState_q31);
+  }
+  arm_goertzel_q15(&S, srcA_q15, n, dst_q15);
+}
+/* The FFT path to the same powers: real FFT then squared magnitude of every bin */
+static void bench_rfft_fast_power_f32(uint32_t n)
+{
+  bench_arm_rfft_fast_f32(n);
+  arm_cmplx_mag_squared_f32(dst_f32 + 2u * BENCH_MAX_SAMPLES, dst_f32, n / 2u);
+}
+/* Sliding DFT (n samples, BENCH_GOERTZEL_BINS bins updated per sample) */
+static void bench_arm_sliding_dft_f32(uint32_t n)
+{
+  static arm_sliding_dft_instance_f32 S;
+
+  if (S.windowLen == 0u)
+  {
+    arm_sliding_dft_init_f32(&S, BENCH_SDFT_LEN, BENCH_GOERTZEL_BINS, sdftBins, 0.99999f,
+                             sdftTwiddle_f32, sdftState_f32, sdftHistory_f32);
+  }
+  arm_sliding_dft_f32(&S, srcA_f32, n);
+}
+
+/* Mixed-radix transforms, and the power-of-two transforms zero-padded to
+   the next power of two that they replace (n is the useful frame length) */
+static uint32_t bench_next_pow2(uint32_t n)
+{
+  uint32_t p = 16u;
+
+  while (p < n)
+  {
+    p <<= 1;
+  }
+  return p;
+}
+
+static void bench_arm_cfft_mixed_f32(uint32_t n)
+{
+  arm_cfft_mixed_instance_f32 S;
+  arm_cfft_mixed_init_f32(&S, (uint16_t) n);
+  memcpy(dst_f32, srcA_f32, 2u * n * sizeof(float32_t));
+  arm_cfft_mixed_f32(&S, dst_f32, dst_f32 + 2u * BENCH_MAX_SAMPLES, 0u);
+}
+static void bench_arm_cfft_mixed_q31(uint32_t n)
+{
+  arm_cfft_mixed_instance_q31 S;
+  arm_cfft_mixed_init_q31(&S, (uint16_t) n);
+  memcpy(dst_q31, srcA_q31, 2u * n * sizeof(q31_t));
+  arm_cfft_mixed_q31(&S, dst_q31, dst_q31 + 2u * BENCH_MAX_SAMPLES, 0u);
+}
+static void bench_arm_rfft_mixed_f32(uint32_t n)
+{
+  arm_rfft_mixed_instance_f32 S;
+  arm_rfft_mixed_init_f32(&S, (uint16_t) n);
+  memcpy(dst_f32, srcA_f32, n * sizeof(float32_t));
+  arm_rfft_mixed_f32(&S, dst_f32, dst_f32 + 2u * BENCH_MAX_SAMPLES, 0u);
+}
+static void bench_arm_cfft_padded_f32(uint32_t n)
+{
+  uint32_t len = bench_next_pow2(n);
+  memcpy(dst_f32, srcA_f32, 2u * n * sizeof(float32_t));
+  memset(dst_f32 + 2u * n, 0, 2u * (len - n) * sizeof(float32_t));
+  arm_cfft_f32(bench_cfft_f32(len), dst_f32, 0u, 1u);
+}
+static void bench_arm_cfft_padded_q31(uint32_t n)
+{
+  uint32_t len = bench_next_pow2(n);
+  memcpy(dst_q31, srcA_q31, 2u * n * sizeof(q31_t));
+  memset(dst_q31 + 2u * n, 0, 2u * (len - n) * sizeof(q31_t));
+  arm_cfft_q31(bench_cfft_q31(len), dst_q31, 0u, 1u);
+}
+static void bench_arm_rfft_fast_padded_f32(uint32_t n)
+{
+  arm_rfft_fast_instance_f32 S;
+  uint32_t len = bench_next_pow2(n);
+  arm_rfft_fast_init_f32(&S, (uint16_t) len);
+  memcpy(dst_f32, srcA_f32, n * sizeof(float32_t));
+  memset(dst_f32 + n, 0, (len - n) * sizeof(float32_t));
+  arm_rfft_fast_f32(&S, dst_f32, dst_f32 + 2u * BENCH_MAX_SAMPLES, 0u);
+}
+
+/* Matrix (n is the square matrix dimension) */
+#define BENCH_MAT_MULT(fn, t) \
+  static void bench_##fn##_##t(uint32_t n) \
+  { \
+    arm_matrix_instance_##t A, B, C; \
+    arm_mat_init_##t(&A, (uint16_t) n, (uint16_t) n, srcA_##t); \
+    arm_mat_init_##t(&B, (uint16_t) n, (uint16_t) n, srcB_##t); \
+    arm_mat_init_##t(&C, (uint16_t) n, (uint16_t) n, dst_##t); \
+    (void) fn##_##t(&A, &B, &C); \
+  }
+
+BENCH_MAT_MULT(arm_mat_mult, f32)
+BENCH_MAT_MULT(arm_mat_mult, q31)
+BENCH_MAT_MULT(arm_mat_mult_tiled, f32)
+BENCH_MAT_MULT(arm_mat_mult_tiled, q31)
+
+static void bench_arm_mat_mult_q15(uint32_t n)
+{
+  arm_matrix_instance_q15 A, B, C;
+  arm_mat_init_q15(&A, (uint16_t) n, (uint16_t) n, srcA_q15);
+  arm_mat_init_q15(&B, (uint16_t) n, (uint16_t) n, srcB_q15);
+  arm_mat_init_q15(&C, (uint16_t) n, (uint16_t) n, dst_q15);
+  (void) arm_mat_mult_q15(&A, &B, &C, state_q15);
+}
+static void bench_arm_mat_trans_f32(uint32_t n)
+{
+  arm_matrix_instance_f32 A, C;
+  arm_mat_init_f32(&A, (uint16_t) n, (uint16_t) n, srcA_f32);
+  arm_mat_init_f32(&C, (uint16_t) n, (uint16_t) n, dst_f32);
+  (void) arm_mat_trans_f32(&A, &C);
+}
+static void bench_arm_mat_inverse_f32(uint32_t n)
+{
+  arm_matrix_instance_f32 A, C;
+  uint32_t i;
+
+  /* Diagonally dominant, so the inverse always exists */
+  for (i = 0u; i < n * n; i++)
+  {
+    state_f32[i] = srcA_f32[i];
+  }
+  for (i = 0u; i < n; i++)
+  {
+    state_f32[i * n + i] += (float32_t) n;
+  }
+  arm_mat_init_f32(&A, (uint16_t) n, (uint16_t) n, state_f32);
+  arm_mat_init_f32(&C, (uint16_t) n, (uint16_t) n, dst_f32);
+  (void) arm_mat_inverse_f32(&A, &C);
+}
+
+/* Symmetric positive-definite n x n matrix in state_f32: (A + A^T) / 2 + n * I */
+static void bench_spd_f32(arm_matrix_instance_f32 *S, uint32_t n)
+{
+  uint32_t i, j;
+
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j <= i; j++)
+    {
+      state_f32[i * n + j] = 0.5f * (srcA_f32[i * n + j] + srcA_f32[j * n + i]);
+      state_f32[j * n + i] = state_f32[i * n + j];
+    }
+    state_f32[i * n + i] += (float32_t) n;
+  }
+  arm_mat_init_f32(S, (uint16_t) n, (uint16_t) n, state_f32);
+}
+static void bench_arm_mat_cholesky_f32(uint32_t n)
+{
+  arm_matrix_instance_f32 A;
+  bench_spd_f32(&A, n);
+  (void) arm_mat_cholesky_f32(&A, &A);
+}
+static void bench_arm_mat_ldlt_f32(uint32_t n)
+{
+  arm_matrix_instance_f32 A;
+  bench_spd_f32(&A, n);
+  (void) arm_mat_ldlt_f32(&A, &A);
+}
+/* A * X = B with BENCH_SOLVE_RHS right-hand sides; X ends up in dst_f32 + BENCH_MAX_SAMPLES */
+static void bench_arm_mat_inverse_mult_f32(uint32_t n)
+{
+  arm_matrix_instance_f32 A, Ainv, B, X;
+  bench_spd_f32(&A, n);
+  arm_mat_init_f32(&Ainv, (uint16_t) n, (uint16_t) n, dst_f32);
+  arm_mat_init_f32(&B, (uint16_t) n, BENCH_SOLVE_RHS, srcB_f32);
+  arm_mat_init_f32(&X, (uint16_t) n, BENCH_SOLVE_RHS, dst_f32 + BENCH_MAX_SAMPLES);
+  (void) arm_mat_inverse_f32(&A, &Ainv);
+  (void) arm_mat_mult_f32(&Ainv, &B, &X);
+}
+#define BENCH_MAT_SOLVE(fact) \
+  static void bench_##fact##_solve_f32(uint32_t n) \
+  { \
+    arm_matrix_instance_f32 A, X; \
+    bench_spd_f32(&A, n); \
+    arm_copy_f32(srcB_f32, dst_f32 + BENCH_MAX_SAMPLES, n * BENCH_SOLVE_RHS); \
+    arm_mat_init_f32(&X, (uint16_t) n, BENCH_SOLVE_RHS, dst_f32 + BENCH_MAX_SAMPLES); \
+    (void) fact##_f32(&A, &A); \
+    (void) fact##_solve_f32(&A, &X, &X); \
+  }
+
+BENCH_MAT_SOLVE(arm_mat_cholesky)
+BENCH_MAT_SOLVE(arm_mat_ldlt)
+
+/* Kalman attitude filter (n IMU samples, replayed from the start of the trace).
+ * Angles in rad and biases in rad/s for f32; for Q31, angles in units of pi
+ * rad and biases as the angle drift per sample scaled up by 2^BENCH_IMU_BIAS_SHIFT. */
+static void bench_arm_kalman_f32(uint32_t n)
+{
+  arm_kalman_instance_f32 S;
+  arm_matrix_instance_f32 F, H;
+  float32_t *pGyro, *pMeas, z[3];
+  uint32_t i, k;
+
+  memset(kalX_f32, 0, sizeof(kalX_f32));
+  memcpy(kalP_f32, kalP0_f32, sizeof(kalP_f32));
+  arm_kalman_init_f32(&S, BENCH_IMU_STATES, kalX_f32, kalP_f32, kalScratch_f32, kalIndex);
+  arm_mat_init_f32(&F, BENCH_IMU_STATES, BENCH_IMU_STATES, kalF_f32);
+  arm_mat_init_f32(&H, 3u, BENCH_IMU_STATES, kalH_f32);
+
+  for (i = 0u; i < n; i++)
+  {
+    pGyro = &imuGyro_f32[3u * (i % imuLen)];
+    pMeas = &imuMeas_f32[3u * (i % imuLen)];
+
+    /* Integrate the bias-corrected rates, then propagate the covariance */
+    for (k = 0u; k < 3u; k++)
+    {
+      kalX_f32[k] += (pGyro[k] - kalX_f32[3u + k]) * BENCH_IMU_DT;
+    }
+    arm_kalman_predict_f32(&S, &F, kalQ_f32, 0u);
+
+    /* Heading measured within pi of the estimate */
+    z[0] = pMeas[0];
+    z[1] = pMeas[1];
+    z[2] = pMeas[2];
+    if (z[2] - kalX_f32[2] > PI)
+    {
+      z[2] -= 2.0f * PI;
+    }
+    else if (z[2] - kalX_f32[2] < -PI)
+    {
+      z[2] += 2.0f * PI;
+    }
+    (void) arm_kalman_update_f32(&S, &H, z, kalR_f32, NULL);
+
+    if (i < BENCH_MAX_SAMPLES)
+    {
+      memcpy(&imuEst_f32[3u * i], kalX_f32, 3u * sizeof(float32_t));
+    }
+  }
+}
+static void bench_arm_kalman_q31(uint32_t n)
+{
+  arm_kalman_instance_q31 S;
+  arm_matrix_instance_q31 F, H;
+  q31_t *pGyro;
+  uint32_t i, k;
+
+  memset(kalX_q31, 0, sizeof(kalX_q31));
+  memcpy(kalP_q31, kalP0_q31, sizeof(kalP_q31));
+  arm_kalman_init_q31(&S, BENCH_IMU_STATES, 1u, 1u, kalX_q31, kalP_q31, kalScratch_q31, kalIndex);
+  arm_mat_init_q31(&F, BENCH_IMU_STATES, BENCH_IMU_STATES, kalF_q31);
+  arm_mat_init_q31(&H, 3u, BENCH_IMU_STATES, kalH_q31);
+
+  for (i = 0u; i < n; i++)
+  {
+    pGyro = &imuGyro_q31[3u * (i % imuLen)];
+
+    for (k = 0u; k < 3u; k++)
+    {
+      kalX_q31[k] = clip_q63_to_q31((q63_t) kalX_q31[k] + pGyro[k] - (kalX_q31[3u + k] >> BENCH_IMU_BIAS_SHIFT));
+    }
+    arm_kalman_predict_q31(&S, &F, kalQ_q31, 0u);
+    (void) arm_kalman_update_q31(&S, &H, &imuMeas_q31[3u * (i % imuLen)], kalR_q31, NULL);
+
+    if (i < BENCH_MAX_SAMPLES)
+    {
+      for (k = 0u; k < 3u; k++)
+      {
+        imuEst_q31[3u * i + k] = (float32_t) kalX_q31[k] * (PI / 2147483648.0f);
+      }
+    }
+  }
+}
+
+/* Statistics */
+#define BENCH_STAT_INDEX(fn, t) \
+  static void bench_##fn(uint32_t n) { fn(srcA_##t, n, &dst_##t[0], &sinkIndex); }
+
+static void bench_arm_mean_f32(uint32_t n) { arm_mean_f32(srcA_f32, n, &dst_f32[0]); }
+static void bench_arm_mean_q31(uint32_t n) { arm_mean_q31(srcA_q31, n, &dst_q31[0]); }
+static void bench_arm_mean_q15(uint32_t n) { arm_mean_q15(srcA_q15, n, &dst_q15[0]); }
+static void bench_arm_mean_q7(uint32_t n)  { arm_mean_q7(srcA_q7, n, &dst_q7[0]); }
+static void bench_arm_var_f32(uint32_t n)  { arm_var_f32(srcA_f32, n, &dst_f32[0]); }
+static void bench_arm_var_q31(uint32_t n)  { arm_var_q31(srcA_q31, n, &dst_q31[0]); }
+static void bench_arm_var_q15(uint32_t n)  { arm_var_q15(srcA_q15, n, &dst_q15[0]); }
+static void bench_arm_rms_f32(uint32_t n)  { arm_rms_f32(srcA_f32, n, &dst_f32[0]); }
+static void bench_arm_rms_q31(uint32_t n)  { arm_rms_q31(srcA_q31, n, &dst_q31[0]); }
+static void bench_arm_rms_q15(uint32_t n)  { arm_rms_q15(srcA_q15, n, &dst_q15[0]); }
+BENCH_STAT_INDEX(arm_max_f32, f32)
+BENCH_STAT_INDEX(arm_max_q31, q31)
+BENCH_STAT_INDEX(arm_max_q15, q15)
+BENCH_STAT_INDEX(arm_max_q7, q7)
+BENCH_STAT_INDEX(arm_min_f32, f32)
+BENCH_STAT_INDEX(arm_min_q31, q31)
+BENCH_STAT_INDEX(arm_min_q15, q15)
+BENCH_STAT_INDEX(arm_min_q7, q7)
+
+/* Support */
+static void bench_arm_copy_f32(uint32_t n) { arm_copy_f32(srcA_f32, dst_f32, n); }
+static void bench_arm_copy_q31(uint32_t n) { arm_copy_q31(srcA_q31, dst_q31, n); }
+static void bench_arm_copy_q15(uint32_t n) { arm_copy_q15(srcA_q15, dst_q15, n); }
+static void bench_arm_copy_q7(uint32_t n)  { arm_copy_q7(srcA_q7, dst_q7, n); }
+static void bench_arm_float_to_q31(uint32_t n) { arm_float_to_q31(srcA_f32, dst_q31, n); }
+static void bench_arm_float_to_q15(uint32_t n) { arm_float_to_q15(srcA_f32, dst_q15, n); }
+static void bench_arm_float_to_q7(uint32_t n)  { arm_float_to_q7(srcA_f32, dst_q7, n); }
+static void bench_arm_q31_to_float(uint32_t n) { arm_q31_to_float(srcA_q31, dst_f32, n); }
+static void bench_arm_q15_to_float(uint32_t n) { arm_q15_to_float(srcA_q15, dst_f32, n); }
+static void bench_arm_q7_to_float(uint32_t n)  { arm_q7_to_float(srcA_q7, dst_f32, n); }
+
+/* Sliding window statistics: n samples pushed through a BENCH_WINDOW_LEN window */
+static void bench_arm_sliding_stats_f32(uint32_t n)
+{
+  arm_sliding_stats_instance_f32 S;
+  float32_t r, m;
+  uint32_t index;
+  arm_sliding_stats_init_f32(&S, BENCH_WINDOW_LEN, slideHistory_f32, slideQueue);
+  arm_sliding_stats_f32(&S, srcA_f32, n);
+  arm_sliding_std_f32(&S, &r);
+  arm_sliding_max_f32(&S, &m, &index);
+  sink_f32 = r + m;
+}
+static void bench_arm_sliding_stats_q31(uint32_t n)
+{
+  arm_sliding_stats_instance_q31 S;
+  q31_t r, m;
+  uint32_t index;
+  arm_sliding_stats_init_q31(&S, BENCH_WINDOW_LEN, slideHistory_q31, slideQueue);
+  arm_sliding_stats_q31(&S, srcA_q31, n);
+  arm_sliding_std_q31(&S, &r);
+  arm_sliding_max_q31(&S, &m, &index);
+  sink_q31 = r + m;
+}
+static void bench_arm_sliding_stats_q15(uint32_t n)
+{
+  arm_sliding_stats_instance_q15 S;
+  q15_t r, m;
+  uint32_t index;
+  arm_sliding_stats_init_q15(&S, BENCH_WINDOW_LEN, slideHistory_q15, slideQueue);
+  arm_sliding_stats_q15(&S, srcA_q15, n);
+  arm_sliding_std_q15(&S, &r);
+  arm_sliding_max_q15(&S, &m, &index);
+  sink_q31 = r + m;
+}
+
+/* ----------------------------------------------------------------------
+* Benchmark table
+* ------------------------------------------------------------------- */
+typedef void (*bench_fn)(uint32_t n);
+
+typedef enum
+{
+  BENCH_SWEEP_BLOCK = 0,    /**< blockSizes, samples = n */
+  BENCH_SWEEP_FFT,          /**< fftSizes, samples = n */
+  BENCH_SWEEP_MATRIX,       /**< matDims, samples = n * n */
+  BENCH_SWEEP_MIXED,        /**< mixedSizes, samples = n */
+  BENCH_SWEEP_MIXED_REAL,   /**< mixedRealSizes, samples = n */
+  BENCH_SWEEP_TAPS,         /**< longTaps, samples = BENCH_LONG_BLOCK */
+  BENCH_SWEEP_CHANNELS      /**< channelCounts, samples = n * BENCH_CHANNEL_BLOCK */
+} bench_sweep;
+
+typedef struct
+{
+  const char *group;
+  const char *kernel;
+  const char *type;
+  bench_fn fn;
+  bench_sweep sweep;
+} bench_entry;
+
+static const uint32_t blockSizes[] = { 16u, 64u, 256u, 1024u, 4096u };
+static const uint32_t fftSizes[] = { 32u, 64u, 256u, 1024u, 4096u };
+static const uint32_t matDims[] = { 4u, 8u, 16u, 32u, 64u };
+static const uint32_t mixedSizes[] = { 300u, 480u, 500u, 600u, 960u, 1000u };
+static const uint32_t mixedRealSizes[] = { 600u, 960u, 1000u };
+static const uint32_t longTaps[] = { 16u, 32u, 64u, 128u, 256u, 512u, BENCH_LONG_TAPS };
+static const uint32_t channelCounts[] = { 1u, 2u, 4u, 6u, BENCH_MAX_CHANNELS };
+
+#define BENCH(g, k, t, s)  { g, #k "_" #t, #t, bench_##k##_##t, s }
+
+static const bench_entry benchTable[] =
+{
+  BENCH("BasicMath", arm_add, f32, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_add, q31, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_add, q15, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_add, q7, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_mult, f32, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_mult, q31, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_mult, q15, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_mult, q7, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_abs, f32, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_abs, q31, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_abs, q15, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_abs, q7, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_scale, f32, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_scale, q31, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_scale, q15, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_scale, q7, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_dot_prod, f32, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_dot_prod, q31, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_dot_prod, q15, BENCH_SWEEP_BLOCK),
+  BENCH("BasicMath", arm_dot_prod, q7, BENCH_SWEEP_BLOCK),
+
+  BENCH("ComplexMath", arm_cmplx_mult_cmplx, f32, BENCH_SWEEP_BLOCK),
+  BENCH("ComplexMath", arm_cmplx_mult_cmplx, q31, BENCH_SWEEP_BLOCK),
+  BENCH("ComplexMath", arm_cmplx_mult_cmplx, q15, BENCH_SWEEP_BLOCK),
+  BENCH("ComplexMath", arm_cmplx_mag, f32, BENCH_SWEEP_BLOCK),
+  BENCH("ComplexMath", arm_cmplx_mag, q31, BENCH_SWEEP_BLOCK),
+  BENCH("ComplexMath", arm_cmplx_mag, q15, BENCH_SWEEP_BLOCK),
+
+  BENCH("Filtering", arm_fir, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_fir, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_fir, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_fir, q7, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_biquad_cascade_df1, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_biquad_cascade_df1, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_biquad_cascade_df1, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_biquad_cascade_df2T, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_fir_resample, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_fir_resample, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_biquad_cascade_multichannel_df2T, f32, BENCH_SWEEP_CHANNELS),
+  BENCH("Filtering", arm_biquad_cascade_df2T_xN, f32, BENCH_SWEEP_CHANNELS),
+  BENCH("Filtering", arm_biquad_cascade_multichannel_df1, q31, BENCH_SWEEP_CHANNELS),
+  BENCH("Filtering", arm_biquad_cascade_df1_xN, q31, BENCH_SWEEP_CHANNELS),
+  BENCH("Filtering", arm_fir_long, f32, BENCH_SWEEP_TAPS),
+  BENCH("Filtering", arm_fir_fft, f32, BENCH_SWEEP_TAPS),
+  BENCH("Filtering", arm_fir_partitioned, f32, BENCH_SWEEP_TAPS),
+  BENCH("Filtering", arm_conv, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_conv, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_conv, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Filtering", arm_conv, q7, BENCH_SWEEP_BLOCK),
+
+  BENCH("Transform", arm_cfft, f32, BENCH_SWEEP_FFT),
+  BENCH("Transform", arm_cfft, q31, BENCH_SWEEP_FFT),
+  BENCH("Transform", arm_cfft, q15, BENCH_SWEEP_FFT),
+  BENCH("Transform", arm_rfft_fast, f32, BENCH_SWEEP_FFT),
+  BENCH("Transform", arm_goertzel, f32, BENCH_SWEEP_FFT),
+  BENCH("Transform", arm_goertzel, q31, BENCH_SWEEP_FFT),
+  BENCH("Transform", arm_goertzel, q15, BENCH_SWEEP_FFT),
+  BENCH("Transform", arm_sliding_dft, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Transform", arm_cfft_mixed, f32, BENCH_SWEEP_MIXED),
+  BENCH("Transform", arm_cfft_padded, f32, BENCH_SWEEP_MIXED),
+  BENCH("Transform", arm_cfft_mixed, q31, BENCH_SWEEP_MIXED),
+  BENCH("Transform", arm_cfft_padded, q31, BENCH_SWEEP_MIXED),
+  BENCH("Transform", arm_rfft_mixed, f32, BENCH_SWEEP_MIXED_REAL),
+  BENCH("Transform", arm_rfft_fast_padded, f32, BENCH_SWEEP_MIXED_REAL),
+
+  BENCH("Matrix", arm_mat_mult, f32, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_mult, q31, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_mult, q15, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_trans, f32, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_inverse, f32, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_mult_tiled, f32, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_mult_tiled, q31, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_cholesky, f32, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_ldlt, f32, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_inverse_mult, f32, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_cholesky_solve, f32, BENCH_SWEEP_MATRIX),
+  BENCH("Matrix", arm_mat_ldlt_solve, f32, BENCH_SWEEP_MATRIX),
+
+  BENCH("Controller", arm_kalman, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Controller", arm_kalman, q31, BENCH_SWEEP_BLOCK),
+
+  BENCH("Statistics", arm_mean, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_mean, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_mean, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_mean, q7, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_var, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_var, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_var, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_rms, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_rms, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_rms, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_max, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_max, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_max, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_max, q7, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_min, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_min, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_min, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_min, q7, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_sliding_stats, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_sliding_stats, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Statistics", arm_sliding_stats, q15, BENCH_SWEEP_BLOCK),
+
+  BENCH("Support", arm_copy, f32, BENCH_SWEEP_BLOCK),
+  BENCH("Support", arm_copy, q31, BENCH_SWEEP_BLOCK),
+  BENCH("Support", arm_copy, q15, BENCH_SWEEP_BLOCK),
+  BENCH("Support", arm_copy, q7, BENCH_SWEEP_BLOCK),
+  { "Support", "arm_float_to_q31", "f32", bench_arm_float_to_q31, BENCH_SWEEP_BLOCK },
+  { "Support", "arm_float_to_q15", "f32", bench_arm_float_to_q15, BENCH_SWEEP_BLOCK },
+  { "Support", "arm_float_to_q7", "f32", bench_arm_float_to_q7, BENCH_SWEEP_BLOCK },
+  { "Support", "arm_q31_to_float", "q31", bench_arm_q31_to_float, BENCH_SWEEP_BLOCK },
+  { "Support", "arm_q15_to_float", "q15", bench_arm_q15_to_float, BENCH_SWEEP_BLOCK },
+  { "Support", "arm_q7_to_float", "q7", bench_arm_q7_to_float, BENCH_SWEEP_BLOCK },
+};
+
+/* ----------------------------------------------------------------------
+* Test data
+* ------------------------------------------------------------------- */
+static uint32_t benchSeed = 0x12345678u;
+
+static float32_t bench_rand(void)
+{
+  benchSeed = benchSeed * 1664525u + 1013904223u;
+  return ((float32_t) (benchSeed >> 8) / 8388608.0f) - 1.0f;
+}
+
+static void bench_fill(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < 2u * BENCH_MAX_SAMPLES; i++)
+  {
+    srcA_f32[i] = 0.5f * bench_rand();
+    srcB_f32[i] = 0.5f * bench_rand();
+  }
+  arm_float_to_q31(srcA_f32, srcA_q31, 2u * BENCH_MAX_SAMPLES);
+  arm_float_to_q31(srcB_f32, srcB_q31, 2u * BENCH_MAX_SAMPLES);
+  arm_float_to_q15(srcA_f32, srcA_q15, 2u * BENCH_MAX_SAMPLES);
+  arm_float_to_q15(srcB_f32, srcB_q15, 2u * BENCH_MAX_SAMPLES);
+  arm_float_to_q7(srcA_f32, srcA_q7, 2u * BENCH_MAX_SAMPLES);
+  arm_float_to_q7(srcB_f32, srcB_q7, 2u * BENCH_MAX_SAMPLES);
+
+  /* Low-pass windowed sinc, sum of taps about 1 */
+  for (i = 0u; i < BENCH_NUM_TAPS; i++)
+  {
+    float32_t x = (float32_t) i - (float32_t) (BENCH_NUM_TAPS - 1u) / 2.0f;
+    float32_t w = 0.54f - 0.46f * cosf(2.0f * PI * (float32_t) i / (float32_t) (BENCH_NUM_TAPS - 1u));
+    coef_f32[i] = 0.25f * w * ((x == 0.0f) ? 1.0f : sinf(0.25f * PI * x) / (0.25f * PI * x));
+  }
+  arm_float_to_q31(coef_f32, coef_q31, BENCH_NUM_TAPS);
+  arm_float_to_q15(coef_f32, coef_q15, BENCH_NUM_TAPS);
+  arm_float_to_q7(coef_f32, coef_q7, BENCH_NUM_TAPS);
+
+  /* Stable biquads: b0 b1 b2 a1 a2 (q15 version interleaves a 0 after b0) */
+  for (i = 0u; i < BENCH_NUM_STAGES; i++)
+  {
+    biquadCoef_f32[5u * i + 0u] = 0.25f;
+    biquadCoef_f32[5u * i + 1u] = 0.5f;
+    biquadCoef_f32[5u * i + 2u] = 0.25f;
+    biquadCoef_f32[5u * i + 3u] = 0.5f;
+    biquadCoef_f32[5u * i + 4u] = -0.25f;
+
+    biquadCoef_q15[6u * i + 0u] = 0x1000;
+    biquadCoef_q15[6u * i + 1u] = 0;
+    biquadCoef_q15[6u * i + 2u] = 0x2000;
+    biquadCoef_q15[6u * i + 3u] = 0x1000;
+    biquadCoef_q15[6u * i + 4u] = 0x2000;
+    biquadCoef_q15[6u * i + 5u] = -0x1000;
+  }
+  arm_float_to_q31(biquadCoef_f32, biquadCoef_q31, 5u * BENCH_NUM_STAGES);
+}
+
+/* ----------------------------------------------------------------------
+* IMU trace for the Kalman kernels
+* ------------------------------------------------------------------- */
+
+/* Turns one raw sample into filter inputs: roll and pitch from gravity,
+ * tilt-compensated heading from the magnetic field */
+static void bench_imu_sample(uint32_t i, const float32_t *pRaw)
+{
+  float32_t roll = atan2f(pRaw[4], pRaw[5]);
+  float32_t pitch = atan2f(-pRaw[3], sqrtf(pRaw[4] * pRaw[4] + pRaw[5] * pRaw[5]));
+  float32_t mx = cosf(pitch) * pRaw[6] + sinf(pitch) * (sinf(roll) * pRaw[7] + cosf(roll) * pRaw[8]);
+  float32_t my = cosf(roll) * pRaw[7] - sinf(roll) * pRaw[8];
+
+  imuGyro_f32[3u * i] = pRaw[0];
+  imuGyro_f32[3u * i + 1u] = pRaw[1];
+  imuGyro_f32[3u * i + 2u] = pRaw[2];
+  imuMeas_f32[3u * i] = roll;
+  imuMeas_f32[3u * i + 1u] = pitch;
+  imuMeas_f32[3u * i + 2u] = atan2f(-my, mx);
+}
+
+/* Reads a CSV trace, returns the number of samples */
+static uint32_t bench_imu_load(const char *path)
+{
+  FILE *fp = fopen(path, "r");
+  char line[256];
+  float32_t raw[9];
+  uint32_t n = 0u;
+
+  if (fp == NULL)
+  {
+    return 0u;
+  }
+  while ((n < BENCH_MAX_SAMPLES) && (fgets(line, sizeof(line), fp) != NULL))
+  {
+    if ((line[0] != '#') &&
+        (sscanf(line, "%f,%f,%f,%f,%f,%f,%f,%f,%f", &raw[0], &raw[1], &raw[2], &raw[3],
+                &raw[4], &raw[5], &raw[6], &raw[7], &raw[8]) == 9))
+    {
+      bench_imu_sample(n++, raw);
+    }
+  }
+  fclose(fp);
+
+  return (n);
+}
+
+/* Slow rotation about all axes with biased, noisy sensors */
+static uint32_t bench_imu_synth(void)
+{
+  const float32_t bias[3] = { 0.02f, -0.01f, 0.015f };
+  const float32_t earthMag[3] = { 0.4f, 0.0f, 0.3f };
+  float32_t raw[9], att[3], rate[3], v[3], c[3], sn[3], t;
+  uint32_t i, k;
+
+  for (i = 0u; i < BENCH_MAX_SAMPLES; i++)
+  {
+    t = (float32_t) i * BENCH_IMU_DT;
+    att[0] = 0.5f * sinf(2.0f * PI * 0.2f * t);
+    att[1] = 0.3f * sinf(2.0f * PI * 0.13f * t + 1.0f);
+    att[2] = 0.8f * sinf(2.0f * PI * 0.05f * t);
+    rate[0] = 0.5f * 2.0f * PI * 0.2f * cosf(2.0f * PI * 0.2f * t);
+    rate[1] = 0.3f * 2.0f * PI * 0.13f * cosf(2.0f * PI * 0.13f * t + 1.0f);
+    rate[2] = 0.8f * 2.0f * PI * 0.05f * cosf(2.0f * PI * 0.05f * t);
+
+    for (k = 0u; k < 3u; k++)
+    {
+      c[k] = cosf(att[k]);
+      sn[k] = sinf(att[k]);
+      imuTruth_f32[3u * i + k] = att[k];
+      raw[k] = rate[k] + bias[k] + 0.005f * bench_rand();
+    }
+
+    /* Gravity and magnetic field in the body frame, R^T * e with R = Rz * Ry * Rx */
+    raw[3] = -sn[1];
+    raw[4] = sn[0] * c[1];
+    raw[5] = c[0] * c[1];
+    v[0] = c[2] * earthMag[0] + sn[2] * earthMag[1];
+    v[1] = -sn[2] * earthMag[0] + c[2] * earthMag[1];
+    v[2] = earthMag[2];
+    t = c[1] * v[0] - sn[1] * v[2];
+    v[2] = sn[1] * v[0] + c[1] * v[2];
+    v[0] = t;
+    raw[6] = v[0];
+    raw[7] = c[0] * v[1] + sn[0] * v[2];
+    raw[8] = -sn[0] * v[1] + c[0] * v[2];
+
+    for (k = 3u; k < 9u; k++)
+    {
+      raw[k] += 0.01f * bench_rand();
+    }
+    bench_imu_sample(i, raw);
+  }
+
+  return (BENCH_MAX_SAMPLES);
+}
+
+/* Loads or synthesizes the trace and sets up both filter models */
+static void bench_imu_prepare(const char *path)
+{
+  const float32_t angleScale = 1.0f / PI;
+  const float32_t biasScale = BENCH_IMU_DT / PI * (float32_t) (1u << BENCH_IMU_BIAS_SHIFT);
+  uint32_t i, j, k;
+
+  imuLen = (path != NULL) ? bench_imu_load(path) : 0u;
+  imuSynthetic = (imuLen == 0u);
+  if (imuSynthetic)
+  {
+    imuLen = bench_imu_synth();
+  }
+  printf("# imu trace: %s, %u samples\n", imuSynthetic ? "synthetic" : path, (unsigned) imuLen);
+
+  for (i = 0u; i < imuLen; i++)
+  {
+    for (k = 0u; k < 3u; k++)
+    {
+      imuGyro_q31[3u * i + k] = clip_q63_to_q31((q63_t) (imuGyro_f32[3u * i + k] * BENCH_IMU_DT * angleScale * 2147483648.0f));
+      imuMeas_q31[3u * i + k] = clip_q63_to_q31((q63_t) (imuMeas_f32[3u * i + k] * angleScale * 2147483648.0f));
+    }
+  }
+
+  /* F = [I, -dt*I; 0, I], H = [I, 0] */
+  memset(kalF_f32, 0, sizeof(kalF_f32));
+  memset(kalF_q31, 0, sizeof(kalF_q31));
+  memset(kalH_f32, 0, sizeof(kalH_f32));
+  memset(kalH_q31, 0, sizeof(kalH_q31));
+  for (i = 0u; i < BENCH_IMU_STATES; i++)
+  {
+    kalF_f32[i * BENCH_IMU_STATES + i] = 1.0f;
+    kalF_q31[i * BENCH_IMU_STATES + i] = 0x40000000;
+  }
+  for (i = 0u; i < 3u; i++)
+  {
+    kalF_f32[i * BENCH_IMU_STATES + 3u + i] = -BENCH_IMU_DT;
+    kalF_q31[i * BENCH_IMU_STATES + 3u + i] = -(0x40000000 >> BENCH_IMU_BIAS_SHIFT);
+    kalH_f32[i * BENCH_IMU_STATES + i] = 1.0f;
+    kalH_q31[i * BENCH_IMU_STATES + i] = 0x40000000;
+  }
+
+  /* Diagonal noise and initial covariances */
+  k = 0u;
+  for (i = 0u; i < BENCH_IMU_STATES; i++)
+  {
+    for (j = i; j < BENCH_IMU_STATES; j++)
+    {
+      float32_t scale = (i < 3u) ? angleScale : biasScale;
+
+      kalQ_f32[k] = (i != j) ? 0.0f : (i < 3u) ? 1e-6f : 1e-8f;
+      kalP0_f32[k] = (i != j) ? 0.0f : (i < 3u) ? 0.1f : 1e-3f;
+      kalQ_q31[k] = (q31_t) (kalQ_f32[k] * scale * scale * 2147483648.0f);
+      kalP0_q31[k] = (q31_t) (kalP0_f32[k] * scale * scale * 2147483648.0f);
+      k++;
+    }
+  }
+  for (i = 0u; i < 3u; i++)
+  {
+    kalR_f32[i] = (i < 2u) ? 4e-4f : 1e-3f;
+    kalR_q31[i] = (q31_t) (kalR_f32[i] * angleScale * angleScale * 2147483648.0f);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Correctness oracles
+* ------------------------------------------------------------------- */
+#define BENCH_PI_F64        3.14159265358979323846
+
+static int oracleFailures = 0;
+static double oracleRef_f64[2u * BENCH_MAX_SAMPLES];
+
+static void bench_oracle(const char *name, int pass, double err)
+{
+  printf("# oracle %s %s (max err %g)\n", name, pass ? "PASS" : "FAIL", err);
+  if (!pass)
+  {
+    oracleFailures++;
+  }
+}
+
+static void bench_oracle_fir(void)
+{
+  const uint32_t n = 256u;
+  uint32_t i, k;
+  double err = 0.0;
+
+  bench_arm_fir_f32(n);
+
+  for (i = 0u; i < n; i++)
+  {
+    double ref = 0.0;
+
+    /* Coefficients are stored time reversed */
+    for (k = 0u; k < BENCH_NUM_TAPS && k <= i; k++)
+    {
+      ref += (double) coef_f32[BENCH_NUM_TAPS - 1u - k] * (double) srcA_f32[i - k];
+    }
+    err = fmax(err, fabs(ref - (double) dst_f32[i]));
+  }
+  bench_oracle("arm_fir_f32", err < 1e-5, err);
+}
+
+static void bench_oracle_resample(void)
+{
+  const uint32_t n = 256u;
+  const uint32_t numOut = (n * BENCH_RESAMPLE_L + BENCH_RESAMPLE_M - 1u) / BENCH_RESAMPLE_M;
+  uint32_t m, i, t;
+  double err = 0.0;
+
+  bench_arm_fir_resample_f32(n);
+
+  for (m = 0u; m < numOut; m++)
+  {
+    double ref = 0.0;
+
+    /* Zero-stuffed input filtered by the time reversed taps, at t = m*M */
+    t = m * BENCH_RESAMPLE_M;
+    for (i = t % BENCH_RESAMPLE_L; i < BENCH_RESAMPLE_TAPS && i <= t; i += BENCH_RESAMPLE_L)
+    {
+      ref += (double) srcB_f32[BENCH_RESAMPLE_TAPS - 1u - i] * (double) srcA_f32[(t - i) / BENCH_RESAMPLE_L];
+    }
+    err = fmax(err, fabs(ref - (double) dst_f32[m]));
+  }
+  bench_oracle("arm_fir_resample_f32", (sinkIndex == numOut) && (err < 1e-4), err);
+
+  /* Same reference on the Q15 data, in LSBs after saturation */
+  bench_arm_fir_resample_q15(n);
+  err = 0.0;
+
+  for (m = 0u; m < numOut; m++)
+  {
+    double ref = 0.0;
+
+    t = m * BENCH_RESAMPLE_M;
+    for (i = t % BENCH_RESAMPLE_L; i < BENCH_RESAMPLE_TAPS && i <= t; i += BENCH_RESAMPLE_L)
+    {
+      ref += (double) srcB_q15[BENCH_RESAMPLE_TAPS - 1u - i] * (double) srcA_q15[(t - i) / BENCH_RESAMPLE_L];
+    }
+    ref = fmin(fmax(ref / 32768.0, -32768.0), 32767.0);
+    err = fmax(err, fabs(ref - (double) dst_q15[m]));
+  }
+  bench_oracle("arm_fir_resample_q15", (sinkIndex == numOut) && (err < 1.0), err);
+}
+
+static void bench_oracle_fft_bin(void)
+{
+  const uint32_t n = 1024u;
+  const uint32_t refIndex = 213u;
+  float32_t maxValue;
+  uint32_t i, testIndex;
+
+  /* Tone centred on refIndex plus white noise, as in arm_fft_bin_example */
+  for (i = 0u; i < n; i++)
+  {
+    dst_f32[2u * i] = cosf(2.0f * PI * (float32_t) (refIndex * i) / (float32_t) n) + 0.1f * bench_rand();
+    dst_f32[2u * i + 1u] = 0.0f;
+  }
+  arm_cfft_f32(&arm_cfft_sR_f32_len1024, dst_f32, 0u, 1u);
+  arm_cmplx_mag_f32(dst_f32, dst_f32 + 2u * n, n / 2u);
+  arm_max_f32(dst_f32 + 2u * n, n / 2u, &maxValue, &testIndex);
+
+  bench_oracle("arm_cfft_f32", testIndex == refIndex, (double) testIndex - (double) refIndex);
+}
+
+static void bench_oracle_dot_prod(void)
+{
+  const uint32_t n = 1024u;
+  uint32_t i;
+  double ref = 0.0;
+  float32_t r;
+
+  for (i = 0u; i < n; i++)
+  {
+    ref += (double) srcA_f32[i] * (double) srcB_f32[i];
+  }
+  arm_dot_prod_f32(srcA_f32, srcB_f32, n, &r);
+  bench_oracle("arm_dot_prod_f32", fabs(ref - (double) r) < 1e-3, fabs(ref - (double) r));
+}
+
+static void bench_oracle_mat_mult(void)
+{
+  const uint32_t n = 16u;
+  uint32_t i, j, k;
+  double err = 0.0;
+
+  bench_arm_mat_mult_f32(n);
+
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      double ref = 0.0;
+      for (k = 0u; k < n; k++)
+      {
+        ref += (double) srcA_f32[i * n + k] * (double) srcB_f32[k * n + j];
+      }
+      err = fmax(err, fabs(ref - (double) dst_f32[i * n + j]));
+    }
+  }
+  bench_oracle("arm_mat_mult_f32", err < 1e-5, err);
+
+  /* The tiled kernels accumulate in the same order, the results are identical */
+  memcpy(dst_f32 + BENCH_MAX_SAMPLES, dst_f32, n * n * sizeof(float32_t));
+  bench_arm_mat_mult_tiled_f32(n);
+  bench_oracle("arm_mat_mult_tiled_f32",
+               memcmp(dst_f32, dst_f32 + BENCH_MAX_SAMPLES, n * n * sizeof(float32_t)) == 0, 0.0);
+
+  bench_arm_mat_mult_q31(n);
+  memcpy(dst_q31 + BENCH_MAX_SAMPLES, dst_q31, n * n * sizeof(q31_t));
+  bench_arm_mat_mult_tiled_q31(n);
+  bench_oracle("arm_mat_mult_tiled_q31",
+               memcmp(dst_q31, dst_q31 + BENCH_MAX_SAMPLES, n * n * sizeof(q31_t)) == 0, 0.0);
+}
+
+/* Q31 against f32 estimates over the trace, and f32 against the truth of the synthetic trace */
+static void bench_oracle_kalman(void)
+{
+  uint32_t i, n = (imuLen < BENCH_MAX_SAMPLES) ? imuLen : BENCH_MAX_SAMPLES;
+  double d, errQ = 0.0, errT = 0.0;
+
+  bench_arm_kalman_f32(n);
+  bench_arm_kalman_q31(n);
+
+  /* Skip the first second while the estimates converge */
+  for (i = 3u * 100u; i < 3u * n; i++)
+  {
+    d = fabs((double) imuEst_q31[i] - (double) imuEst_f32[i]);
+    errQ = fmax(errQ, fmin(d, 2.0 * PI - d));
+    errT = fmax(errT, fabs((double) imuEst_f32[i] - (double) imuTruth_f32[i]));
+  }
+  bench_oracle("arm_kalman_q31", errQ < 0.01, errQ);
+  if (imuSynthetic)
+  {
+    bench_oracle("arm_kalman_f32", errT < 0.05, errT);
+  }
+}
+
+static void bench_oracle_mat_solve(void)
+{
+  const uint32_t n = 16u;
+  arm_matrix_instance_f32 A;
+  uint32_t i, j, k;
+  double errChol = 0.0, errLdlt = 0.0, errInv = 0.0;
+
+  /* Residual |A * X - B| of each solution, against the unfactored A */
+  bench_arm_mat_inverse_mult_f32(n);
+  memcpy(dst_f32 + 2u * BENCH_MAX_SAMPLES, dst_f32 + BENCH_MAX_SAMPLES, n * BENCH_SOLVE_RHS * sizeof(float32_t));
+  bench_arm_mat_cholesky_solve_f32(n);
+  memcpy(dst_f32 + 3u * BENCH_MAX_SAMPLES, dst_f32 + BENCH_MAX_SAMPLES, n * BENCH_SOLVE_RHS * sizeof(float32_t));
+  bench_arm_mat_ldlt_solve_f32(n);
+  bench_spd_f32(&A, n);
+
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < BENCH_SOLVE_RHS; j++)
+    {
+      double rInv = -(double) srcB_f32[i * BENCH_SOLVE_RHS + j];
+      double rChol = rInv, rLdlt = rInv;
+      for (k = 0u; k < n; k++)
+      {
+        rInv  += (double) state_f32[i * n + k] * (double) dst_f32[2u * BENCH_MAX_SAMPLES + k * BENCH_SOLVE_RHS + j];
+        rChol += (double) state_f32[i * n + k] * (double) dst_f32[3u * BENCH_MAX_SAMPLES + k * BENCH_SOLVE_RHS + j];
+        rLdlt += (double) state_f32[i * n + k] * (double) dst_f32[BENCH_MAX_SAMPLES + k * BENCH_SOLVE_RHS + j];
+      }
+      errInv = fmax(errInv, fabs(rInv));
+      errChol = fmax(errChol, fabs(rChol));
+      errLdlt = fmax(errLdlt, fabs(rLdlt));
+    }
+  }
+  bench_oracle("arm_mat_inverse_mult_f32", errInv < 1e-5, errInv);
+  bench_oracle("arm_mat_cholesky_solve_f32", errChol < 1e-5, errChol);
+  bench_oracle("arm_mat_ldlt_solve_f32", errLdlt < 1e-5, errLdlt);
+}
+
+/* Naive DFT of n complex (or real) samples into oracleRef_f64 */
+static void bench_dft(const float32_t *pSrc, uint32_t n, int complexInput)
+{
+  uint32_t j, k;
+
+  for (k = 0u; k < n; k++)
+  {
+    double re = 0.0, im = 0.0;
+    for (j = 0u; j < n; j++)
+    {
+      /* Reduce k*j first so the angle keeps its precision at large n */
+      double a = -2.0 * BENCH_PI_F64 * (double) ((k * j) % n) / (double) n;
+      double xr = complexInput ? (double) pSrc[2u * j] : (double) pSrc[j];
+      double xi = complexInput ? (double) pSrc[2u * j + 1u] : 0.0;
+      re += xr * cos(a) - xi * sin(a);
+      im += xr * sin(a) + xi * cos(a);
+    }
+    oracleRef_f64[2u * k] = re;
+    oracleRef_f64[2u * k + 1u] = im;
+  }
+}
+
+static void bench_oracle_mixed(void)
+{
+  uint32_t i, j, n;
+  double errF = 0.0, errQ = 0.0, errR = 0.0;
+
+  for (j = 0u; j < sizeof(mixedSizes) / sizeof(mixedSizes[0]); j++)
+  {
+    n = mixedSizes[j];
+    bench_dft(srcA_f32, n, 1);
+
+    /* The floating-point transform is unscaled, the Q31 one is scaled by 1/n */
+    bench_arm_cfft_mixed_f32(n);
+    bench_arm_cfft_mixed_q31(n);
+    for (i = 0u; i < 2u * n; i++)
+    {
+      errF = fmax(errF, fabs(oracleRef_f64[i] - (double) dst_f32[2u * BENCH_MAX_SAMPLES + i]));
+      errQ = fmax(errQ, fabs(oracleRef_f64[i] / (double) n -
+                             (double) dst_q31[2u * BENCH_MAX_SAMPLES + i] / 2147483648.0));
+    }
+  }
+  bench_oracle("arm_cfft_mixed_f32", errF < 1e-4, errF);
+  bench_oracle("arm_cfft_mixed_q31", errQ < 1e-7, errQ);
+
+  for (j = 0u; j < sizeof(mixedRealSizes) / sizeof(mixedRealSizes[0]); j++)
+  {
+    n = mixedRealSizes[j];
+    bench_dft(srcA_f32, n, 0);
+    bench_arm_rfft_mixed_f32(n);
+
+    /* Packed as {X[0].re, X[n/2].re, X[1].re, X[1].im, ...} */
+    errR = fmax(errR, fabs(oracleRef_f64[0] - (double) dst_f32[2u * BENCH_MAX_SAMPLES]));
+    errR = fmax(errR, fabs(oracleRef_f64[n] - (double) dst_f32[2u * BENCH_MAX_SAMPLES + 1u]));
+    for (i = 2u; i < n; i++)
+    {
+      errR = fmax(errR, fabs(oracleRef_f64[i] - (double) dst_f32[2u * BENCH_MAX_SAMPLES + i]));
+    }
+  }
+  bench_oracle("arm_rfft_mixed_f32", errR < 1e-4, errR);
+}
+
+/* Direct arm_fir_f32 over len samples of srcA with the taps in srcB, into dst_f32 + 2*BENCH_MAX_SAMPLES */
+static void bench_fir_long_ref(uint32_t numTaps, uint32_t len)
+{
+  arm_fir_instance_f32 S;
+  uint32_t i;
+
+  arm_fir_init_f32(&S, (uint16_t) numTaps, srcB_f32, longState_f32, BENCH_LONG_BLOCK);
+  for (i = 0u; i < len; i += BENCH_LONG_BLOCK)
+  {
+    arm_fir_f32(&S, srcA_f32 + i, dst_f32 + 2u * BENCH_MAX_SAMPLES + i, BENCH_LONG_BLOCK);
+  }
+}
+
+/* Several blocks in a row, so the history carried between blocks is checked too */
+static void bench_oracle_fir_fft(void)
+{
+  static const uint32_t taps[] = { 16u, 128u, BENCH_LONG_TAPS };
+  const uint32_t len = 4u * BENCH_LONG_BLOCK;
+  arm_fir_fft_instance_f32 S;
+  uint32_t i, j;
+  double err = 0.0;
+
+  for (j = 0u; j < sizeof(taps) / sizeof(taps[0]); j++)
+  {
+    bench_fir_long_ref(taps[j], len);
+    arm_fir_fft_init_f32(&S, (uint16_t) taps[j], srcB_f32, fftFirState_f32, BENCH_LONG_BLOCK);
+    for (i = 0u; i < len; i += BENCH_LONG_BLOCK)
+    {
+      arm_fir_fft_f32(&S, srcA_f32 + i, dst_f32 + i, BENCH_LONG_BLOCK);
+    }
+    for (i = 0u; i < len; i++)
+    {
+      err = fmax(err, fabs((double) dst_f32[2u * BENCH_MAX_SAMPLES + i] - (double) dst_f32[i]));
+    }
+  }
+  bench_oracle("arm_fir_fft_f32", err < 1e-4, err);
+}
+
+/* One partition and many, with a tap count that is not a multiple of the partition size */
+static void bench_oracle_fir_partitioned(void)
+{
+  static const uint32_t taps[] = { 16u, 100u, BENCH_LONG_TAPS };
+  const uint32_t len = 4u * BENCH_LONG_BLOCK;
+  arm_fir_partitioned_instance_f32 S;
+  uint32_t i, j;
+  double err = 0.0;
+
+  for (j = 0u; j < sizeof(taps) / sizeof(taps[0]); j++)
+  {
+    bench_fir_long_ref(taps[j], len);
+    arm_fir_partitioned_init_f32(&S, (uint16_t) taps[j], srcB_f32, partFirState_f32, BENCH_PART_BLOCK);
+    for (i = 0u; i < len; i += BENCH_PART_BLOCK)
+    {
+      arm_fir_partitioned_f32(&S, srcA_f32 + i, dst_f32 + i);
+    }
+    for (i = 0u; i < len; i++)
+    {
+      err = fmax(err, fabs((double) dst_f32[2u * BENCH_MAX_SAMPLES + i] - (double) dst_f32[i]));
+    }
+  }
+  bench_oracle("arm_fir_partitioned_f32", err < 1e-4, err);
+}
+
+/* Each channel of the interleaved output against a single-channel cascade run on that channel.
+   The channel count is not a multiple of 4 and the block is split over two calls. */
+static void bench_oracle_biquad_multichannel(void)
+{
+  const uint32_t numChannels = 6u;
+  const uint32_t len = 128u;
+  arm_biquad_cascade_multichannel_df2T_instance_f32 Mf;
+  arm_biquad_cascade_df2T_instance_f32 Sf;
+  arm_biquad_cascade_multichannel_df1_instance_q31 Mq;
+  arm_biquad_casd_df1_inst_q31 Sq;
+  float32_t *pRef_f32 = dst_f32 + 2u * BENCH_MAX_SAMPLES, *pIn_f32 = dst_f32 + 3u * BENCH_MAX_SAMPLES;
+  q31_t *pRef_q31 = dst_q31 + 2u * BENCH_MAX_SAMPLES, *pIn_q31 = dst_q31 + 3u * BENCH_MAX_SAMPLES;
+  uint32_t c, i;
+  double err = 0.0;
+  int exact = 1;
+
+  arm_biquad_cascade_multichannel_df2T_init_f32(&Mf, BENCH_NUM_STAGES, (uint8_t) numChannels, biquadCoef_f32, state_f32);
+  arm_biquad_cascade_multichannel_df2T_f32(&Mf, srcA_f32, dst_f32, len / 2u);
+  arm_biquad_cascade_multichannel_df2T_f32(&Mf, srcA_f32 + numChannels * (len / 2u), dst_f32 + numChannels * (len / 2u), len / 2u);
+
+  arm_biquad_cascade_multichannel_df1_init_q31(&Mq, BENCH_NUM_STAGES, (uint8_t) numChannels, biquadCoef_q31, state_q31, 1);
+  arm_biquad_cascade_multichannel_df1_q31(&Mq, srcA_q31, dst_q31, len / 2u);
+  arm_biquad_cascade_multichannel_df1_q31(&Mq, srcA_q31 + numChannels * (len / 2u), dst_q31 + numChannels * (len / 2u), len / 2u);
+
+  for (c = 0u; c < numChannels; c++)
+  {
+    for (i = 0u; i < len; i++)
+    {
+      pIn_f32[i] = srcA_f32[numChannels * i + c];
+      pIn_q31[i] = srcA_q31[numChannels * i + c];
+    }
+    arm_biquad_cascade_df2T_init_f32(&Sf, BENCH_NUM_STAGES, biquadCoef_f32, longState_f32);
+    arm_biquad_cascade_df2T_f32(&Sf, pIn_f32, pRef_f32, len);
+    arm_biquad_cascade_df1_init_q31(&Sq, BENCH_NUM_STAGES, biquadCoef_q31, state_q31 + BENCH_MAX_SAMPLES, 1);
+    arm_biquad_cascade_df1_q31(&Sq, pIn_q31, pRef_q31, len);
+
+    for (i = 0u; i < len; i++)
+    {
+      err = fmax(err, fabs((double) pRef_f32[i] - (double) dst_f32[numChannels * i + c]));
+      exact = exact && (pRef_q31[i] == dst_q31[numChannels * i + c]);
+    }
+  }
+  bench_oracle("arm_biquad_cascade_multichannel_df2T_f32", err < 1e-6, err);
+  bench_oracle("arm_biquad_cascade_multichannel_df1_q31", exact, 0.0);
+}
+
+/* Fixed-point Goertzel powers against f32, each bin fed a tone at its own frequency.
+   The banks include bins close to DC and Nyquist, which set the input shift of the whole bank. */
+static double bench_goertzel_err(const float32_t *pFreqs, uint32_t numBins, uint32_t n, int q15)
+{
+  arm_goertzel_instance_f32 Sf;
+  arm_goertzel_instance_q31 Sq;
+  arm_goertzel_instance_q15 Sh;
+  float32_t power_f32[BENCH_GOERTZEL_BINS + 2u];
+  q31_t power_q31[BENCH_GOERTZEL_BINS + 2u];
+  q15_t power_q15[BENCH_GOERTZEL_BINS + 2u];
+  double p, err = 0.0;
+  uint32_t i, k;
+
+  for (k = 0u; k < numBins; k++)
+  {
+    for (i = 0u; i < n; i++)
+    {
+      dst_f32[i] = 0.9f * (float32_t) cos(2.0 * BENCH_PI_F64 * (double) pFreqs[k] * (double) i);
+    }
+    arm_float_to_q31(dst_f32, dst_q31, n);
+    arm_float_to_q15(dst_f32, dst_q15, n);
+
+    arm_goertzel_init_f32(&Sf, (uint16_t) numBins, (uint16_t) n, pFreqs, goertzelCoef_f32, goertzelState_f32);
+    arm_goertzel_f32(&Sf, dst_f32, n, power_f32);
+    if (q15)
+    {
+      arm_goertzel_init_q15(&Sh, (uint16_t) numBins, (uint16_t) n, pFreqs, goertzelCoef_q31, goertzelState_q31);
+      arm_goertzel_q15(&Sh, dst_q15, n, power_q15);
+      p = ldexp((double) power_q15[k], 2 * (int) Sh.shift - 13);
+    }
+    else
+    {
+      arm_goertzel_init_q31(&Sq, (uint16_t) numBins, (uint16_t) n, pFreqs, goertzelCoef_q31, goertzelState_q31);
+      arm_goertzel_q31(&Sq, dst_q31, n, power_q31);
+      p = ldexp((double) power_q31[k], 2 * (int) Sq.shift - 29);
+    }
+    err = fmax(err, fabs(p - (double) power_f32[k]) / (double) power_f32[k]);
+  }
+  return (err);
+}
+
+static void bench_oracle_goertzel(void)
+{
+  float32_t freqs[BENCH_GOERTZEL_BINS + 2u];
+  double err;
+
+  /* DTMF bank plus 0.01 and 0.45 for Q31; Q15 keeps only the upper edge bin, its 3.13
+     power has no resolution left for a bin near DC at these frame lengths */
+  memcpy(freqs, goertzelFreqs, sizeof(goertzelFreqs));
+  freqs[BENCH_GOERTZEL_BINS] = 0.45f;
+  freqs[BENCH_GOERTZEL_BINS + 1u] = 0.01f;
+
+  err = fmax(bench_goertzel_err(freqs, BENCH_GOERTZEL_BINS + 2u, 205u, 0),
+             bench_goertzel_err(freqs, BENCH_GOERTZEL_BINS + 2u, BENCH_MAX_SAMPLES, 0));
+  bench_oracle("arm_goertzel_q31", err < 1e-3, err);
+
+  err = fmax(bench_goertzel_err(freqs, BENCH_GOERTZEL_BINS, 205u, 1),
+             bench_goertzel_err(freqs, BENCH_GOERTZEL_BINS + 1u, 205u, 1));
+  bench_oracle("arm_goertzel_q15", err < 2e-2, err);
+}
+
+/* Sliding statistics after len samples, pushed in uneven blocks, against the batch
+   functions on the last BENCH_WINDOW_LEN samples; the fixed-point results are exact */
+#define BENCH_SLIDING_ORACLE(t)                                                      \
+static int bench_sliding_exact_##t(uint32_t len)                                    \
+{                                                                                   \
+  arm_sliding_stats_instance_##t S;                                                 \
+  const t##_t *pWin = srcA_##t + len - BENCH_WINDOW_LEN;                             \
+  t##_t r, ref, m, mRef;                                                            \
+  uint32_t i, idx, idxRef, blk;                                                     \
+  int pass;                                                                         \
+  arm_sliding_stats_init_##t(&S, BENCH_WINDOW_LEN, slideHistory_##t, slideQueue);   \
+  for (i = 0u; i < len; i += blk)                                                   \
+  {                                                                                 \
+    blk = ((len - i) < 37u) ? (len - i) : 37u;                                      \
+    arm_sliding_stats_##t(&S, srcA_##t + i, blk);                                    \
+  }                                                                                 \
+  arm_sliding_mean_##t(&S, &r); arm_mean_##t((t##_t *) pWin, BENCH_WINDOW_LEN, &ref); \
+  pass = (r == ref);                                                                \
+  arm_sliding_var_##t(&S, &r); arm_var_##t((t##_t *) pWin, BENCH_WINDOW_LEN, &ref);   \
+  pass = pass && (r == ref);                                                        \
+  arm_sliding_max_##t(&S, &m, &idx); arm_max_##t((t##_t *) pWin, BENCH_WINDOW_LEN, &mRef, &idxRef); \
+  pass = pass && (m == mRef) && (idx == idxRef);                                    \
+  arm_sliding_min_##t(&S, &m, &idx); arm_min_##t((t##_t *) pWin, BENCH_WINDOW_LEN, &mRef, &idxRef); \
+  return pass && (m == mRef) && (idx == idxRef);                                    \
+}
+BENCH_SLIDING_ORACLE(q31)
+BENCH_SLIDING_ORACLE(q15)
+
+static void bench_oracle_sliding_stats(void)
+{
+  const uint32_t len = 1000u;
+  const float32_t *pWin = srcA_f32 + len - BENCH_WINDOW_LEN;
+  float32_t *pOffset = dst_f32 + 2u * BENCH_MAX_SAMPLES;
+  arm_sliding_stats_instance_f32 S;
+  float32_t r, ref, m, mRef;
+  uint32_t i, idx, idxRef, blk;
+  double err, mean, var;
+  int exact;
+
+  arm_sliding_stats_init_f32(&S, BENCH_WINDOW_LEN, slideHistory_f32, slideQueue);
+  for (i = 0u; i < len; i += blk)
+  {
+    blk = ((len - i) < 37u) ? (len - i) : 37u;
+    arm_sliding_stats_f32(&S, srcA_f32 + i, blk);
+  }
+  arm_sliding_mean_f32(&S, &r);
+  arm_mean_f32((float32_t *) pWin, BENCH_WINDOW_LEN, &ref);
+  err = fabs((double) r - (double) ref);
+  arm_sliding_var_f32(&S, &r);
+  arm_var_f32((float32_t *) pWin, BENCH_WINDOW_LEN, &ref);
+  err = fmax(err, fabs((double) r - (double) ref) / (double) ref);
+  arm_sliding_max_f32(&S, &m, &idx);
+  arm_max_f32((float32_t *) pWin, BENCH_WINDOW_LEN, &mRef, &idxRef);
+  exact = (m == mRef) && (idx == idxRef);
+  arm_sliding_min_f32(&S, &m, &idx);
+  arm_min_f32((float32_t *) pWin, BENCH_WINDOW_LEN, &mRef, &idxRef);
+  exact = exact && (m == mRef) && (idx == idxRef);
+  bench_oracle("arm_sliding_stats_f32", exact && (err < 1e-5), err);
+
+  bench_oracle("arm_sliding_stats_q31", bench_sliding_exact_q31(len), 0.0);
+  bench_oracle("arm_sliding_stats_q15", bench_sliding_exact_q15(len), 0.0);
+
+  /* About 2M samples on a DC offset: the relative error of the variance must not grow.
+     The reference is two-pass in double, arm_var_f32() itself loses the variance to the offset. */
+  for (i = 0u; i < BENCH_MAX_SAMPLES; i++)
+  {
+    pOffset[i] = srcA_f32[i] + 100.0f;
+  }
+  arm_sliding_stats_init_f32(&S, BENCH_WINDOW_LEN, slideHistory_f32, slideQueue);
+  for (i = 0u; i < 512u; i++)
+  {
+    arm_sliding_stats_f32(&S, pOffset, BENCH_MAX_SAMPLES - 1u);
+  }
+  arm_sliding_var_f32(&S, &r);
+  mean = 0.0;
+  for (i = 0u; i < BENCH_WINDOW_LEN; i++)
+  {
+    mean += (double) slideHistory_f32[i];
+  }
+  mean /= (double) BENCH_WINDOW_LEN;
+  var = 0.0;
+  for (i = 0u; i < BENCH_WINDOW_LEN; i++)
+  {
+    var += ((double) slideHistory_f32[i] - mean) * ((double) slideHistory_f32[i] - mean);
+  }
+  var /= (double) (BENCH_WINDOW_LEN - 1u);
+  err = fabs((double) r - var) / var;
+  bench_oracle("arm_sliding_var_f32_long", err < 1e-3, err);
+}
+
+/* ----------------------------------------------------------------------
+* Runner
+* ------------------------------------------------------------------- */
+/* Calls fn(n) for at least BENCH_MIN_TIME_NS; returns the number of calls */
+static uint64_t bench_measure(bench_fn fn, uint32_t n, double *seconds, uint64_t *cycles)
+{
+  uint64_t t0, t1, c0, c1, iter = 0u;
+
+  /* Warm up caches and lazily initialised tables */
+  fn(n);
+
+  t0 = bench_now_ns();
+  c0 = bench_cycles();
+  do
+  {
+    fn(n);
+    iter++;
+    t1 = bench_now_ns();
+  } while ((t1 - t0) < BENCH_MIN_TIME_NS);
+  c1 = bench_cycles();
+
+  *seconds = (double) (t1 - t0) * 1e-9;
+  *cycles = c1 - c0;
+
+  return (iter);
+}
+
+static void bench_run(const bench_entry *e, uint32_t n)
+{
+  uint64_t iter, cycles;
+  uint32_t samples = (e->sweep == BENCH_SWEEP_MATRIX) ? n * n :
+                     (e->sweep == BENCH_SWEEP_TAPS) ? BENCH_LONG_BLOCK :
+                     (e->sweep == BENCH_SWEEP_CHANNELS) ? n * BENCH_CHANNEL_BLOCK : n;
+  double seconds;
+
+  iter = bench_measure(e->fn, n, &seconds, &cycles);
+
+  printf("%s,%s,%s,%u,%.0f,%.3f\n",
+         e->group, e->kernel, e->type, (unsigned) n,
+         (double) iter * (double) samples / seconds,
+         (double) cycles / ((double) iter * (double) samples));
+}
+
+/* Number of Goertzel bins that cost as much as the FFT and magnitude of the frame */
+static void bench_goertzel_break_even(void)
+{
+  uint64_t iter, cycles;
+  double seconds, fftTime, binTime;
+  uint32_t j;
+
+  for (j = 0u; j < sizeof(fftSizes) / sizeof(fftSizes[0]); j++)
+  {
+    iter = bench_measure(bench_rfft_fast_power_f32, fftSizes[j], &seconds, &cycles);
+    fftTime = seconds / (double) iter;
+    iter = bench_measure(bench_arm_goertzel_f32, fftSizes[j], &seconds, &cycles);
+    binTime = seconds / ((double) iter * (double) BENCH_GOERTZEL_BINS);
+
+    printf("# goertzel_f32 break-even at %u samples: %.1f bins\n",
+           (unsigned) fftSizes[j], fftTime / binTime);
+  }
+}
+
+int32_t main(int argc, char **argv)
+{
+  const char *group = (argc > 1) ? argv[1] : NULL;
+  uint32_t i, j;
+
+  bench_fill();
+  bench_imu_prepare((argc > 2) ? argv[2] : NULL);
+
+#if defined(__x86_64__) || defined(__i386__)
+  printf("# cycles: time stamp counter\n");
+#else
+  printf("# cycles: derived from time at %u MHz\n", (unsigned) BENCH_CPU_MHZ);
+#endif
+
+  bench_oracle_fir();
+  bench_oracle_resample();
+  bench_oracle_fft_bin();
+  bench_oracle_dot_prod();
+  bench_oracle_mat_mult();
+  bench_oracle_mat_solve();
+  bench_oracle_kalman();
+  bench_oracle_mixed();
+  bench_oracle_fir_fft();
+  bench_oracle_fir_partitioned();
+  bench_oracle_biquad_multichannel();
+  bench_oracle_sliding_stats();
+  bench_oracle_goertzel();
+
+  printf("group,kernel,type,size,samples_per_sec,cycles_per_sample\n");
+
+  for (i = 0u; i < sizeof(benchTable) / sizeof(benchTable[0]); i++)
+  {
+    const bench_entry *e = &benchTable[i];
+    const uint32_t *sizes;
+    uint32_t numSizes;
+
+    if ((group != NULL) && (strcmp(group, e->group) != 0))
+    {
+      continue;
+    }
+
+    switch (e->sweep)
+    {
+    case BENCH_SWEEP_FFT:
+      sizes = fftSizes;
+      numSizes = sizeof(fftSizes) / sizeof(fftSizes[0]);
+      break;
+    case BENCH_SWEEP_MATRIX:
+      sizes = matDims;
+      numSizes = sizeof(matDims) / sizeof(matDims[0]);
+      break;
+    case BENCH_SWEEP_MIXED:
+      sizes = mixedSizes;
+      numSizes = sizeof(mixedSizes) / sizeof(mixedSizes[0]);
+      break;
+    case BENCH_SWEEP_MIXED_REAL:
+      sizes = mixedRealSizes;
+      numSizes = sizeof(mixedRealSizes) / sizeof(mixedRealSizes[0]);
+      break;
+    case BENCH_SWEEP_TAPS:
+      sizes = longTaps;
+      numSizes = sizeof(longTaps) / sizeof(longTaps[0]);
+      break;
+    case BENCH_SWEEP_CHANNELS:
+      sizes = channelCounts;
+      numSizes = sizeof(channelCounts) / sizeof(channelCounts[0]);
+      break;
+    default:
+      sizes = blockSizes;
+      numSizes = sizeof(blockSizes) / sizeof(blockSizes[0]);
+      break;
+    }
+
+    for (j = 0u; j < numSizes; j++)
+    {
+      bench_run(e, sizes[j]);
+    }
+  }
+
+  if ((group == NULL) || (strcmp(group, "Transform") == 0))
+  {
+    bench_goertzel_break_even();
+  }
+
+  return (oracleFailures == 0) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -26972,6 +26972,5240 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
 };
 
 
+/**
+* \par
+* Example code for floating-point mixed-radix Twiddle factors Generation:
+* \par
+* <pre>for(i = 0; i< N; i++)
+* {
+*	twiddleCoefMixed[2*i]= cos(i * 2*PI/(float)N);
+*	twiddleCoefMixed[2*i+1]= sin(i * 2*PI/(float)N);
+* } </pre>
+* \par
+* where N = 600	and PI = 3.14159265358979
+* \par
+* The whole circle is stored so that every radix stage of the N and N/2
+* point transforms, and the real FFT split stage, index it directly.
+*/
+const float32_t twiddleCoefMixed_600[1200] = {
+    1.000000000f,  0.000000000f,
+    0.999945169f,  0.010471784f,
+    0.999780683f,  0.020942420f,
+    0.999506560f,  0.031410759f,
+    0.999122830f,  0.041875654f,
+    0.998629535f,  0.052335956f,
+    0.998026728f,  0.062790520f,
+    0.997314477f,  0.073238197f,
+    0.996492859f,  0.083677843f,
+    0.995561965f,  0.094108313f,
+    0.994521895f,  0.104528463f,
+    0.993372766f,  0.114937150f,
+    0.992114701f,  0.125333234f,
+    0.990747840f,  0.135715572f,
+    0.989272333f,  0.146083029f,
+    0.987688341f,  0.156434465f,
+    0.985996037f,  0.166768747f,
+    0.984195608f,  0.177084740f,
+    0.982287251f,  0.187381315f,
+    0.980271175f,  0.197657340f,
+    0.978147601f,  0.207911691f,
+    0.975916762f,  0.218143241f,
+    0.973578903f,  0.228350870f,
+    0.971134280f,  0.238533458f,
+    0.968583161f,  0.248689887f,
+    0.965925826f,  0.258819045f,
+    0.963162567f,  0.268919821f,
+    0.960293686f,  0.278991106f,
+    0.957319498f,  0.289031797f,
+    0.954240329f,  0.299040792f,
+    0.951056516f,  0.309016994f,
+    0.947768410f,  0.318959309f,
+    0.944376370f,  0.328866647f,
+    0.940880769f,  0.338737920f,
+    0.937281989f,  0.348572047f,
+    0.933580426f,  0.358367950f,
+    0.929776486f,  0.368124553f,
+    0.925870585f,  0.377840787f,
+    0.921863152f,  0.387515586f,
+    0.917754626f,  0.397147891f,
+    0.913545458f,  0.406736643f,
+    0.909236109f,  0.416280792f,
+    0.904827052f,  0.425779292f,
+    0.900318771f,  0.435231099f,
+    0.895711760f,  0.444635179f,
+    0.891006524f,  0.453990500f,
+    0.886203579f,  0.463296035f,
+    0.881303452f,  0.472550765f,
+    0.876306680f,  0.481753674f,
+    0.871213811f,  0.490903754f,
+    0.866025404f,  0.500000000f,
+    0.860742027f,  0.509041416f,
+    0.855364260f,  0.518027009f,
+    0.849892693f,  0.526955795f,
+    0.844327926f,  0.535826795f,
+    0.838670568f,  0.544639035f,
+    0.832921241f,  0.553391549f,
+    0.827080574f,  0.562083378f,
+    0.821149209f,  0.570713568f,
+    0.815127796f,  0.579281172f,
+    0.809016994f,  0.587785252f,
+    0.802817475f,  0.596224875f,
+    0.796529918f,  0.604599115f,
+    0.790155012f,  0.612907054f,
+    0.783693457f,  0.621147780f,
+    0.777145961f,  0.629320391f,
+    0.770513243f,  0.637423990f,
+    0.763796029f,  0.645457688f,
+    0.756995056f,  0.653420604f,
+    0.750111070f,  0.661311865f,
+    0.743144825f,  0.669130606f,
+    0.736097087f,  0.676875970f,
+    0.728968627f,  0.684547106f,
+    0.721760228f,  0.692143174f,
+    0.714472680f,  0.699663341f,
+    0.707106781f,  0.707106781f,
+    0.699663341f,  0.714472680f,
+    0.692143174f,  0.721760228f,
+    0.684547106f,  0.728968627f,
+    0.676875970f,  0.736097087f,
+    0.669130606f,  0.743144825f,
+    0.661311865f,  0.750111070f,
+    0.653420604f,  0.756995056f,
+    0.645457688f,  0.763796029f,
+    0.637423990f,  0.770513243f,
+    0.629320391f,  0.777145961f,
+    0.621147780f,  0.783693457f,
+    0.612907054f,  0.790155012f,
+    0.604599115f,  0.796529918f,
+    0.596224875f,  0.802817475f,
+    0.587785252f,  0.809016994f,
+    0.579281172f,  0.815127796f,
+    0.570713568f,  0.821149209f,
+    0.562083378f,  0.827080574f,
+    0.553391549f,  0.832921241f,
+    0.544639035f,  0.838670568f,
+    0.535826795f,  0.844327926f,
+    0.526955795f,  0.849892693f,
+    0.518027009f,  0.855364260f,
+    0.509041416f,  0.860742027f,
+    0.500000000f,  0.866025404f,
+    0.490903754f,  0.871213811f,
+    0.481753674f,  0.876306680f,
+    0.472550765f,  0.881303452f,
+    0.463296035f,  0.886203579f,
+    0.453990500f,  0.891006524f,
+    0.444635179f,  0.895711760f,
+    0.435231099f,  0.900318771f,
+    0.425779292f,  0.904827052f,
+    0.416280792f,  0.909236109f,
+    0.406736643f,  0.913545458f,
+    0.397147891f,  0.917754626f,
+    0.387515586f,  0.921863152f,
+    0.377840787f,  0.925870585f,
+    0.368124553f,  0.929776486f,
+    0.358367950f,  0.933580426f,
+    0.348572047f,  0.937281989f,
+    0.338737920f,  0.940880769f,
+    0.328866647f,  0.944376370f,
+    0.318959309f,  0.947768410f,
+    0.309016994f,  0.951056516f,
+    0.299040792f,  0.954240329f,
+    0.289031797f,  0.957319498f,
+    0.278991106f,  0.960293686f,
+    0.268919821f,  0.963162567f,
+    0.258819045f,  0.965925826f,
+    0.248689887f,  0.968583161f,
+    0.238533458f,  0.971134280f,
+    0.228350870f,  0.973578903f,
+    0.218143241f,  0.975916762f,
+    0.207911691f,  0.978147601f,
+    0.197657340f,  0.980271175f,
+    0.187381315f,  0.982287251f,
+    0.177084740f,  0.984195608f,
+    0.166768747f,  0.985996037f,
+    0.156434465f,  0.987688341f,
+    0.146083029f,  0.989272333f,
+    0.135715572f,  0.990747840f,
+    0.125333234f,  0.992114701f,
+    0.114937150f,  0.993372766f,
+    0.104528463f,  0.994521895f,
+    0.094108313f,  0.995561965f,
+    0.083677843f,  0.996492859f,
+    0.073238197f,  0.997314477f,
+    0.062790520f,  0.998026728f,
+    0.052335956f,  0.998629535f,
+    0.041875654f,  0.999122830f,
+    0.031410759f,  0.999506560f,
+    0.020942420f,  0.999780683f,
+    0.010471784f,  0.999945169f,
+    0.000000000f,  1.000000000f,
+   -0.010471784f,  0.999945169f,
+   -0.020942420f,  0.999780683f,
+   -0.031410759f,  0.999506560f,
+   -0.041875654f,  0.999122830f,
+   -0.052335956f,  0.998629535f,
+   -0.062790520f,  0.998026728f,
+   -0.073238197f,  0.997314477f,
+   -0.083677843f,  0.996492859f,
+   -0.094108313f,  0.995561965f,
+   -0.104528463f,  0.994521895f,
+   -0.114937150f,  0.993372766f,
+   -0.125333234f,  0.992114701f,
+   -0.135715572f,  0.990747840f,
+   -0.146083029f,  0.989272333f,
+   -0.156434465f,  0.987688341f,
+   -0.166768747f,  0.985996037f,
+   -0.177084740f,  0.984195608f,
+   -0.187381315f,  0.982287251f,
+   -0.197657340f,  0.980271175f,
+   -0.207911691f,  0.978147601f,
+   -0.218143241f,  0.975916762f,
+   -0.228350870f,  0.973578903f,
+   -0.238533458f,  0.971134280f,
+   -0.248689887f,  0.968583161f,
+   -0.258819045f,  0.965925826f,
+   -0.268919821f,  0.963162567f,
+   -0.278991106f,  0.960293686f,
+   -0.289031797f,  0.957319498f,
+   -0.299040792f,  0.954240329f,
+   -0.309016994f,  0.951056516f,
+   -0.318959309f,  0.947768410f,
+   -0.328866647f,  0.944376370f,
+   -0.338737920f,  0.940880769f,
+   -0.348572047f,  0.937281989f,
+   -0.358367950f,  0.933580426f,
+   -0.368124553f,  0.929776486f,
+   -0.377840787f,  0.925870585f,
+   -0.387515586f,  0.921863152f,
+   -0.397147891f,  0.917754626f,
+   -0.406736643f,  0.913545458f,
+   -0.416280792f,  0.909236109f,
+   -0.425779292f,  0.904827052f,
+   -0.435231099f,  0.900318771f,
+   -0.444635179f,  0.895711760f,
+   -0.453990500f,  0.891006524f,
+   -0.463296035f,  0.886203579f,
+   -0.472550765f,  0.881303452f,
+   -0.481753674f,  0.876306680f,
+   -0.490903754f,  0.871213811f,
+   -0.500000000f,  0.866025404f,
+   -0.509041416f,  0.860742027f,
+   -0.518027009f,  0.855364260f,
+   -0.526955795f,  0.849892693f,
+   -0.535826795f,  0.844327926f,
+   -0.544639035f,  0.838670568f,
+   -0.553391549f,  0.832921241f,
+   -0.562083378f,  0.827080574f,
+   -0.570713568f,  0.821149209f,
+   -0.579281172f,  0.815127796f,
+   -0.587785252f,  0.809016994f,
+   -0.596224875f,  0.802817475f,
+   -0.604599115f,  0.796529918f,
+   -0.612907054f,  0.790155012f,
+   -0.621147780f,  0.783693457f,
+   -0.629320391f,  0.777145961f,
+   -0.637423990f,  0.770513243f,
+   -0.645457688f,  0.763796029f,
+   -0.653420604f,  0.756995056f,
+   -0.661311865f,  0.750111070f,
+   -0.669130606f,  0.743144825f,
+   -0.676875970f,  0.736097087f,
+   -0.684547106f,  0.728968627f,
+   -0.692143174f,  0.721760228f,
+   -0.699663341f,  0.714472680f,
+   -0.707106781f,  0.707106781f,
+   -0.714472680f,  0.699663341f,
+   -0.721760228f,  0.692143174f,
+   -0.728968627f,  0.684547106f,
+   -0.736097087f,  0.676875970f,
+   -0.743144825f,  0.669130606f,
+   -0.750111070f,  0.661311865f,
+   -0.756995056f,  0.653420604f,
+   -0.763796029f,  0.645457688f,
+   -0.770513243f,  0.637423990f,
+   -0.777145961f,  0.629320391f,
+   -0.783693457f,  0.621147780f,
+   -0.790155012f,  0.612907054f,
+   -0.796529918f,  0.604599115f,
+   -0.802817475f,  0.596224875f,
+   -0.809016994f,  0.587785252f,
+   -0.815127796f,  0.579281172f,
+   -0.821149209f,  0.570713568f,
+   -0.827080574f,  0.562083378f,
+   -0.832921241f,  0.553391549f,
+   -0.838670568f,  0.544639035f,
+   -0.844327926f,  0.535826795f,
+   -0.849892693f,  0.526955795f,
+   -0.855364260f,  0.518027009f,
+   -0.860742027f,  0.509041416f,
+   -0.866025404f,  0.500000000f,
+   -0.871213811f,  0.490903754f,
+   -0.876306680f,  0.481753674f,
+   -0.881303452f,  0.472550765f,
+   -0.886203579f,  0.463296035f,
+   -0.891006524f,  0.453990500f,
+   -0.895711760f,  0.444635179f,
+   -0.900318771f,  0.435231099f,
+   -0.904827052f,  0.425779292f,
+   -0.909236109f,  0.416280792f,
+   -0.913545458f,  0.406736643f,
+   -0.917754626f,  0.397147891f,
+   -0.921863152f,  0.387515586f,
+   -0.925870585f,  0.377840787f,
+   -0.929776486f,  0.368124553f,
+   -0.933580426f,  0.358367950f,
+   -0.937281989f,  0.348572047f,
+   -0.940880769f,  0.338737920f,
+   -0.944376370f,  0.328866647f,
+   -0.947768410f,  0.318959309f,
+   -0.951056516f,  0.309016994f,
+   -0.954240329f,  0.299040792f,
+   -0.957319498f,  0.289031797f,
+   -0.960293686f,  0.278991106f,
+   -0.963162567f,  0.268919821f,
+   -0.965925826f,  0.258819045f,
+   -0.968583161f,  0.248689887f,
+   -0.971134280f,  0.238533458f,
+   -0.973578903f,  0.228350870f,
+   -0.975916762f,  0.218143241f,
+   -0.978147601f,  0.207911691f,
+   -0.980271175f,  0.197657340f,
+   -0.982287251f,  0.187381315f,
+   -0.984195608f,  0.177084740f,
+   -0.985996037f,  0.166768747f,
+   -0.987688341f,  0.156434465f,
+   -0.989272333f,  0.146083029f,
+   -0.990747840f,  0.135715572f,
+   -0.992114701f,  0.125333234f,
+   -0.993372766f,  0.114937150f,
+   -0.994521895f,  0.104528463f,
+   -0.995561965f,  0.094108313f,
+   -0.996492859f,  0.083677843f,
+   -0.997314477f,  0.073238197f,
+   -0.998026728f,  0.062790520f,
+   -0.998629535f,  0.052335956f,
+   -0.999122830f,  0.041875654f,
+   -0.999506560f,  0.031410759f,
+   -0.999780683f,  0.020942420f,
+   -0.999945169f,  0.010471784f,
+   -1.000000000f,  0.000000000f,
+   -0.999945169f, -0.010471784f,
+   -0.999780683f, -0.020942420f,
+   -0.999506560f, -0.031410759f,
+   -0.999122830f, -0.041875654f,
+   -0.998629535f, -0.052335956f,
+   -0.998026728f, -0.062790520f,
+   -0.997314477f, -0.073238197f,
+   -0.996492859f, -0.083677843f,
+   -0.995561965f, -0.094108313f,
+   -0.994521895f, -0.104528463f,
+   -0.993372766f, -0.114937150f,
+   -0.992114701f, -0.125333234f,
+   -0.990747840f, -0.135715572f,
+   -0.989272333f, -0.146083029f,
+   -0.987688341f, -0.156434465f,
+   -0.985996037f, -0.166768747f,
+   -0.984195608f, -0.177084740f,
+   -0.982287251f, -0.187381315f,
+   -0.980271175f, -0.197657340f,
+   -0.978147601f, -0.207911691f,
+   -0.975916762f, -0.218143241f,
+   -0.973578903f, -0.228350870f,
+   -0.971134280f, -0.238533458f,
+   -0.968583161f, -0.248689887f,
+   -0.965925826f, -0.258819045f,
+   -0.963162567f, -0.268919821f,
+   -0.960293686f, -0.278991106f,
+   -0.957319498f, -0.289031797f,
+   -0.954240329f, -0.299040792f,
+   -0.951056516f, -0.309016994f,
+   -0.947768410f, -0.318959309f,
+   -0.944376370f, -0.328866647f,
+   -0.940880769f, -0.338737920f,
+   -0.937281989f, -0.348572047f,
+   -0.933580426f, -0.358367950f,
+   -0.929776486f, -0.368124553f,
+   -0.925870585f, -0.377840787f,
+   -0.921863152f, -0.387515586f,
+   -0.917754626f, -0.397147891f,
+   -0.913545458f, -0.406736643f,
+   -0.909236109f, -0.416280792f,
+   -0.904827052f, -0.425779292f,
+   -0.900318771f, -0.435231099f,
+   -0.895711760f, -0.444635179f,
+   -0.891006524f, -0.453990500f,
+   -0.886203579f, -0.463296035f,
+   -0.881303452f, -0.472550765f,
+   -0.876306680f, -0.481753674f,
+   -0.871213811f, -0.490903754f,
+   -0.866025404f, -0.500000000f,
+   -0.860742027f, -0.509041416f,
+   -0.855364260f, -0.518027009f,
+   -0.849892693f, -0.526955795f,
+   -0.844327926f, -0.535826795f,
+   -0.838670568f, -0.544639035f,
+   -0.832921241f, -0.553391549f,
+   -0.827080574f, -0.562083378f,
+   -0.821149209f, -0.570713568f,
+   -0.815127796f, -0.579281172f,
+   -0.809016994f, -0.587785252f,
+   -0.802817475f, -0.596224875f,
+   -0.796529918f, -0.604599115f,
+   -0.790155012f, -0.612907054f,
+   -0.783693457f, -0.621147780f,
+   -0.777145961f, -0.629320391f,
+   -0.770513243f, -0.637423990f,
+   -0.763796029f, -0.645457688f,
+   -0.756995056f, -0.653420604f,
+   -0.750111070f, -0.661311865f,
+   -0.743144825f, -0.669130606f,
+   -0.736097087f, -0.676875970f,
+   -0.728968627f, -0.684547106f,
+   -0.721760228f, -0.692143174f,
+   -0.714472680f, -0.699663341f,
+   -0.707106781f, -0.707106781f,
+   -0.699663341f, -0.714472680f,
+   -0.692143174f, -0.721760228f,
+   -0.684547106f, -0.728968627f,
+   -0.676875970f, -0.736097087f,
+   -0.669130606f, -0.743144825f,
+   -0.661311865f, -0.750111070f,
+   -0.653420604f, -0.756995056f,
+   -0.645457688f, -0.763796029f,
+   -0.637423990f, -0.770513243f,
+   -0.629320391f, -0.777145961f,
+   -0.621147780f, -0.783693457f,
+   -0.612907054f, -0.790155012f,
+   -0.604599115f, -0.796529918f,
+   -0.596224875f, -0.802817475f,
+   -0.587785252f, -0.809016994f,
+   -0.579281172f, -0.815127796f,
+   -0.570713568f, -0.821149209f,
+   -0.562083378f, -0.827080574f,
+   -0.553391549f, -0.832921241f,
+   -0.544639035f, -0.838670568f,
+   -0.535826795f, -0.844327926f,
+   -0.526955795f, -0.849892693f,
+   -0.518027009f, -0.855364260f,
+   -0.509041416f, -0.860742027f,
+   -0.500000000f, -0.866025404f,
+   -0.490903754f, -0.871213811f,
+   -0.481753674f, -0.876306680f,
+   -0.472550765f, -0.881303452f,
+   -0.463296035f, -0.886203579f,
+   -0.453990500f, -0.891006524f,
+   -0.444635179f, -0.895711760f,
+   -0.435231099f, -0.900318771f,
+   -0.425779292f, -0.904827052f,
+   -0.416280792f, -0.909236109f,
+   -0.406736643f, -0.913545458f,
+   -0.397147891f, -0.917754626f,
+   -0.387515586f, -0.921863152f,
+   -0.377840787f, -0.925870585f,
+   -0.368124553f, -0.929776486f,
+   -0.358367950f, -0.933580426f,
+   -0.348572047f, -0.937281989f,
+   -0.338737920f, -0.940880769f,
+   -0.328866647f, -0.944376370f,
+   -0.318959309f, -0.947768410f,
+   -0.309016994f, -0.951056516f,
+   -0.299040792f, -0.954240329f,
+   -0.289031797f, -0.957319498f,
+   -0.278991106f, -0.960293686f,
+   -0.268919821f, -0.963162567f,
+   -0.258819045f, -0.965925826f,
+   -0.248689887f, -0.968583161f,
+   -0.238533458f, -0.971134280f,
+   -0.228350870f, -0.973578903f,
+   -0.218143241f, -0.975916762f,
+   -0.207911691f, -0.978147601f,
+   -0.197657340f, -0.980271175f,
+   -0.187381315f, -0.982287251f,
+   -0.177084740f, -0.984195608f,
+   -0.166768747f, -0.985996037f,
+   -0.156434465f, -0.987688341f,
+   -0.146083029f, -0.989272333f,
+   -0.135715572f, -0.990747840f,
+   -0.125333234f, -0.992114701f,
+   -0.114937150f, -0.993372766f,
+   -0.104528463f, -0.994521895f,
+   -0.094108313f, -0.995561965f,
+   -0.083677843f, -0.996492859f,
+   -0.073238197f, -0.997314477f,
+   -0.062790520f, -0.998026728f,
+   -0.052335956f, -0.998629535f,
+   -0.041875654f, -0.999122830f,
+   -0.031410759f, -0.999506560f,
+   -0.020942420f, -0.999780683f,
+   -0.010471784f, -0.999945169f,
+    0.000000000f, -1.000000000f,
+    0.010471784f, -0.999945169f,
+    0.020942420f, -0.999780683f,
+    0.031410759f, -0.999506560f,
+    0.041875654f, -0.999122830f,
+    0.052335956f, -0.998629535f,
+    0.062790520f, -0.998026728f,
+    0.073238197f, -0.997314477f,
+    0.083677843f, -0.996492859f,
+    0.094108313f, -0.995561965f,
+    0.104528463f, -0.994521895f,
+    0.114937150f, -0.993372766f,
+    0.125333234f, -0.992114701f,
+    0.135715572f, -0.990747840f,
+    0.146083029f, -0.989272333f,
+    0.156434465f, -0.987688341f,
+    0.166768747f, -0.985996037f,
+    0.177084740f, -0.984195608f,
+    0.187381315f, -0.982287251f,
+    0.197657340f, -0.980271175f,
+    0.207911691f, -0.978147601f,
+    0.218143241f, -0.975916762f,
+    0.228350870f, -0.973578903f,
+    0.238533458f, -0.971134280f,
+    0.248689887f, -0.968583161f,
+    0.258819045f, -0.965925826f,
+    0.268919821f, -0.963162567f,
+    0.278991106f, -0.960293686f,
+    0.289031797f, -0.957319498f,
+    0.299040792f, -0.954240329f,
+    0.309016994f, -0.951056516f,
+    0.318959309f, -0.947768410f,
+    0.328866647f, -0.944376370f,
+    0.338737920f, -0.940880769f,
+    0.348572047f, -0.937281989f,
+    0.358367950f, -0.933580426f,
+    0.368124553f, -0.929776486f,
+    0.377840787f, -0.925870585f,
+    0.387515586f, -0.921863152f,
+    0.397147891f, -0.917754626f,
+    0.406736643f, -0.913545458f,
+    0.416280792f, -0.909236109f,
+    0.425779292f, -0.904827052f,
+    0.435231099f, -0.900318771f,
+    0.444635179f, -0.895711760f,
+    0.453990500f, -0.891006524f,
+    0.463296035f, -0.886203579f,
+    0.472550765f, -0.881303452f,
+    0.481753674f, -0.876306680f,
+    0.490903754f, -0.871213811f,
+    0.500000000f, -0.866025404f,
+    0.509041416f, -0.860742027f,
+    0.518027009f, -0.855364260f,
+    0.526955795f, -0.849892693f,
+    0.535826795f, -0.844327926f,
+    0.544639035f, -0.838670568f,
+    0.553391549f, -0.832921241f,
+    0.562083378f, -0.827080574f,
+    0.570713568f, -0.821149209f,
+    0.579281172f, -0.815127796f,
+    0.587785252f, -0.809016994f,
+    0.596224875f, -0.802817475f,
+    0.604599115f, -0.796529918f,
+    0.612907054f, -0.790155012f,
+    0.621147780f, -0.783693457f,
+    0.629320391f, -0.777145961f,
+    0.637423990f, -0.770513243f,
+    0.645457688f, -0.763796029f,
+    0.653420604f, -0.756995056f,
+    0.661311865f, -0.750111070f,
+    0.669130606f, -0.743144825f,
+    0.676875970f, -0.736097087f,
+    0.684547106f, -0.728968627f,
+    0.692143174f, -0.721760228f,
+    0.699663341f, -0.714472680f,
+    0.707106781f, -0.707106781f,
+    0.714472680f, -0.699663341f,
+    0.721760228f, -0.692143174f,
+    0.728968627f, -0.684547106f,
+    0.736097087f, -0.676875970f,
+    0.743144825f, -0.669130606f,
+    0.750111070f, -0.661311865f,
+    0.756995056f, -0.653420604f,
+    0.763796029f, -0.645457688f,
+    0.770513243f, -0.637423990f,
+    0.777145961f, -0.629320391f,
+    0.783693457f, -0.621147780f,
+    0.790155012f, -0.612907054f,
+    0.796529918f, -0.604599115f,
+    0.802817475f, -0.596224875f,
+    0.809016994f, -0.587785252f,
+    0.815127796f, -0.579281172f,
+    0.821149209f, -0.570713568f,
+    0.827080574f, -0.562083378f,
+    0.832921241f, -0.553391549f,
+    0.838670568f, -0.544639035f,
+    0.844327926f, -0.535826795f,
+    0.849892693f, -0.526955795f,
+    0.855364260f, -0.518027009f,
+    0.860742027f, -0.509041416f,
+    0.866025404f, -0.500000000f,
+    0.871213811f, -0.490903754f,
+    0.876306680f, -0.481753674f,
+    0.881303452f, -0.472550765f,
+    0.886203579f, -0.463296035f,
+    0.891006524f, -0.453990500f,
+    0.895711760f, -0.444635179f,
+    0.900318771f, -0.435231099f,
+    0.904827052f, -0.425779292f,
+    0.909236109f, -0.416280792f,
+    0.913545458f, -0.406736643f,
+    0.917754626f, -0.397147891f,
+    0.921863152f, -0.387515586f,
+    0.925870585f, -0.377840787f,
+    0.929776486f, -0.368124553f,
+    0.933580426f, -0.358367950f,
+    0.937281989f, -0.348572047f,
+    0.940880769f, -0.338737920f,
+    0.944376370f, -0.328866647f,
+    0.947768410f, -0.318959309f,
+    0.951056516f, -0.309016994f,
+    0.954240329f, -0.299040792f,
+    0.957319498f, -0.289031797f,
+    0.960293686f, -0.278991106f,
+    0.963162567f, -0.268919821f,
+    0.965925826f, -0.258819045f,
+    0.968583161f, -0.248689887f,
+    0.971134280f, -0.238533458f,
+    0.973578903f, -0.228350870f,
+    0.975916762f, -0.218143241f,
+    0.978147601f, -0.207911691f,
+    0.980271175f, -0.197657340f,
+    0.982287251f, -0.187381315f,
+    0.984195608f, -0.177084740f,
+    0.985996037f, -0.166768747f,
+    0.987688341f, -0.156434465f,
+    0.989272333f, -0.146083029f,
+    0.990747840f, -0.135715572f,
+    0.992114701f, -0.125333234f,
+    0.993372766f, -0.114937150f,
+    0.994521895f, -0.104528463f,
+    0.995561965f, -0.094108313f,
+    0.996492859f, -0.083677843f,
+    0.997314477f, -0.073238197f,
+    0.998026728f, -0.062790520f,
+    0.998629535f, -0.052335956f,
+    0.999122830f, -0.041875654f,
+    0.999506560f, -0.031410759f,
+    0.999780683f, -0.020942420f,
+    0.999945169f, -0.010471784f
+};
+
+
+/**
+* \par
+* Example code for floating-point mixed-radix Twiddle factors Generation:
+* \par
+* <pre>for(i = 0; i< N; i++)
+* {
+*	twiddleCoefMixed[2*i]= cos(i * 2*PI/(float)N);
+*	twiddleCoefMixed[2*i+1]= sin(i * 2*PI/(float)N);
+* } </pre>
+* \par
+* where N = 960	and PI = 3.14159265358979
+* \par
+* The whole circle is stored so that every radix stage of the N and N/2
+* point transforms, and the real FFT split stage, index it directly.
+*/
+const float32_t twiddleCoefMixed_960[1920] = {
+    1.000000000f,  0.000000000f,
+    0.999978582f,  0.006544938f,
+    0.999914328f,  0.013089596f,
+    0.999807240f,  0.019633692f,
+    0.999657325f,  0.026176948f,
+    0.999464587f,  0.032719083f,
+    0.999229036f,  0.039259816f,
+    0.998950681f,  0.045798867f,
+    0.998629535f,  0.052335956f,
+    0.998265610f,  0.058870804f,
+    0.997858923f,  0.065403129f,
+    0.997409491f,  0.071932653f,
+    0.996917334f,  0.078459096f,
+    0.996382472f,  0.084982177f,
+    0.995804928f,  0.091501619f,
+    0.995184727f,  0.098017140f,
+    0.994521895f,  0.104528463f,
+    0.993816462f,  0.111035309f,
+    0.993068457f,  0.117537397f,
+    0.992277912f,  0.124034451f,
+    0.991444861f,  0.130526192f,
+    0.990569340f,  0.137012342f,
+    0.989651387f,  0.143492622f,
+    0.988691040f,  0.149966756f,
+    0.987688341f,  0.156434465f,
+    0.986643332f,  0.162895473f,
+    0.985556059f,  0.169349504f,
+    0.984426568f,  0.175796280f,
+    0.983254908f,  0.182235525f,
+    0.982041128f,  0.188666965f,
+    0.980785280f,  0.195090322f,
+    0.979487420f,  0.201505322f,
+    0.978147601f,  0.207911691f,
+    0.976765881f,  0.214309153f,
+    0.975342321f,  0.220697435f,
+    0.973876979f,  0.227076263f,
+    0.972369920f,  0.233445364f,
+    0.970821208f,  0.239804465f,
+    0.969230910f,  0.246153293f,
+    0.967599092f,  0.252491577f,
+    0.965925826f,  0.258819045f,
+    0.964211183f,  0.265135426f,
+    0.962455236f,  0.271440450f,
+    0.960658061f,  0.277733846f,
+    0.958819735f,  0.284015345f,
+    0.956940336f,  0.290284677f,
+    0.955019944f,  0.296541575f,
+    0.953058643f,  0.302785770f,
+    0.951056516f,  0.309016994f,
+    0.949013649f,  0.315234982f,
+    0.946930129f,  0.321439465f,
+    0.944806046f,  0.327630180f,
+    0.942641491f,  0.333806859f,
+    0.940436556f,  0.339969240f,
+    0.938191336f,  0.346117057f,
+    0.935905927f,  0.352250048f,
+    0.933580426f,  0.358367950f,
+    0.931214935f,  0.364470500f,
+    0.928809553f,  0.370557438f,
+    0.926364384f,  0.376628502f,
+    0.923879533f,  0.382683432f,
+    0.921355105f,  0.388721970f,
+    0.918791210f,  0.394743856f,
+    0.916187957f,  0.400748833f,
+    0.913545458f,  0.406736643f,
+    0.910863825f,  0.412707030f,
+    0.908143174f,  0.418659738f,
+    0.905383621f,  0.424594511f,
+    0.902585284f,  0.430511097f,
+    0.899748284f,  0.436409241f,
+    0.896872742f,  0.442288690f,
+    0.893958780f,  0.448149194f,
+    0.891006524f,  0.453990500f,
+    0.888016101f,  0.459812358f,
+    0.884987637f,  0.465614520f,
+    0.881921264f,  0.471396737f,
+    0.878817113f,  0.477158760f,
+    0.875675315f,  0.482900344f,
+    0.872496007f,  0.488621241f,
+    0.869279324f,  0.494321208f,
+    0.866025404f,  0.500000000f,
+    0.862734386f,  0.505657373f,
+    0.859406412f,  0.511293086f,
+    0.856041623f,  0.516906897f,
+    0.852640164f,  0.522498565f,
+    0.849202182f,  0.528067851f,
+    0.845727822f,  0.533614516f,
+    0.842217234f,  0.539138323f,
+    0.838670568f,  0.544639035f,
+    0.835087976f,  0.550116417f,
+    0.831469612f,  0.555570233f,
+    0.827815631f,  0.561000251f,
+    0.824126189f,  0.566406237f,
+    0.820401444f,  0.571787960f,
+    0.816641555f,  0.577145190f,
+    0.812846685f,  0.582477697f,
+    0.809016994f,  0.587785252f,
+    0.805152649f,  0.593067629f,
+    0.801253813f,  0.598324601f,
+    0.797320654f,  0.603555942f,
+    0.793353340f,  0.608761429f,
+    0.789352042f,  0.613940839f,
+    0.785316931f,  0.619093949f,
+    0.781248179f,  0.624220540f,
+    0.777145961f,  0.629320391f,
+    0.773010453f,  0.634393284f,
+    0.768841832f,  0.639439002f,
+    0.764640276f,  0.644457328f,
+    0.760405966f,  0.649448048f,
+    0.756139082f,  0.654410948f,
+    0.751839807f,  0.659345815f,
+    0.747508327f,  0.664252438f,
+    0.743144825f,  0.669130606f,
+    0.738749490f,  0.673980111f,
+    0.734322509f,  0.678800746f,
+    0.729864073f,  0.683592302f,
+    0.725374371f,  0.688354576f,
+    0.720853597f,  0.693087363f,
+    0.716301943f,  0.697790460f,
+    0.711719606f,  0.702463666f,
+    0.707106781f,  0.707106781f,
+    0.702463666f,  0.711719606f,
+    0.697790460f,  0.716301943f,
+    0.693087363f,  0.720853597f,
+    0.688354576f,  0.725374371f,
+    0.683592302f,  0.729864073f,
+    0.678800746f,  0.734322509f,
+    0.673980111f,  0.738749490f,
+    0.669130606f,  0.743144825f,
+    0.664252438f,  0.747508327f,
+    0.659345815f,  0.751839807f,
+    0.654410948f,  0.756139082f,
+    0.649448048f,  0.760405966f,
+    0.644457328f,  0.764640276f,
+    0.639439002f,  0.768841832f,
+    0.634393284f,  0.773010453f,
+    0.629320391f,  0.777145961f,
+    0.624220540f,  0.781248179f,
+    0.619093949f,  0.785316931f,
+    0.613940839f,  0.789352042f,
+    0.608761429f,  0.793353340f,
+    0.603555942f,  0.797320654f,
+    0.598324601f,  0.801253813f,
+    0.593067629f,  0.805152649f,
+    0.587785252f,  0.809016994f,
+    0.582477697f,  0.812846685f,
+    0.577145190f,  0.816641555f,
+    0.571787960f,  0.820401444f,
+    0.566406237f,  0.824126189f,
+    0.561000251f,  0.827815631f,
+    0.555570233f,  0.831469612f,
+    0.550116417f,  0.835087976f,
+    0.544639035f,  0.838670568f,
+    0.539138323f,  0.842217234f,
+    0.533614516f,  0.845727822f,
+    0.528067851f,  0.849202182f,
+    0.522498565f,  0.852640164f,
+    0.516906897f,  0.856041623f,
+    0.511293086f,  0.859406412f,
+    0.505657373f,  0.862734386f,
+    0.500000000f,  0.866025404f,
+    0.494321208f,  0.869279324f,
+    0.488621241f,  0.872496007f,
+    0.482900344f,  0.875675315f,
+    0.477158760f,  0.878817113f,
+    0.471396737f,  0.881921264f,
+    0.465614520f,  0.884987637f,
+    0.459812358f,  0.888016101f,
+    0.453990500f,  0.891006524f,
+    0.448149194f,  0.893958780f,
+    0.442288690f,  0.896872742f,
+    0.436409241f,  0.899748284f,
+    0.430511097f,  0.902585284f,
+    0.424594511f,  0.905383621f,
+    0.418659738f,  0.908143174f,
+    0.412707030f,  0.910863825f,
+    0.406736643f,  0.913545458f,
+    0.400748833f,  0.916187957f,
+    0.394743856f,  0.918791210f,
+    0.388721970f,  0.921355105f,
+    0.382683432f,  0.923879533f,
+    0.376628502f,  0.926364384f,
+    0.370557438f,  0.928809553f,
+    0.364470500f,  0.931214935f,
+    0.358367950f,  0.933580426f,
+    0.352250048f,  0.935905927f,
+    0.346117057f,  0.938191336f,
+    0.339969240f,  0.940436556f,
+    0.333806859f,  0.942641491f,
+    0.327630180f,  0.944806046f,
+    0.321439465f,  0.946930129f,
+    0.315234982f,  0.949013649f,
+    0.309016994f,  0.951056516f,
+    0.302785770f,  0.953058643f,
+    0.296541575f,  0.955019944f,
+    0.290284677f,  0.956940336f,
+    0.284015345f,  0.958819735f,
+    0.277733846f,  0.960658061f,
+    0.271440450f,  0.962455236f,
+    0.265135426f,  0.964211183f,
+    0.258819045f,  0.965925826f,
+    0.252491577f,  0.967599092f,
+    0.246153293f,  0.969230910f,
+    0.239804465f,  0.970821208f,
+    0.233445364f,  0.972369920f,
+    0.227076263f,  0.973876979f,
+    0.220697435f,  0.975342321f,
+    0.214309153f,  0.976765881f,
+    0.207911691f,  0.978147601f,
+    0.201505322f,  0.979487420f,
+    0.195090322f,  0.980785280f,
+    0.188666965f,  0.982041128f,
+    0.182235525f,  0.983254908f,
+    0.175796280f,  0.984426568f,
+    0.169349504f,  0.985556059f,
+    0.162895473f,  0.986643332f,
+    0.156434465f,  0.987688341f,
+    0.149966756f,  0.988691040f,
+    0.143492622f,  0.989651387f,
+    0.137012342f,  0.990569340f,
+    0.130526192f,  0.991444861f,
+    0.124034451f,  0.992277912f,
+    0.117537397f,  0.993068457f,
+    0.111035309f,  0.993816462f,
+    0.104528463f,  0.994521895f,
+    0.098017140f,  0.995184727f,
+    0.091501619f,  0.995804928f,
+    0.084982177f,  0.996382472f,
+    0.078459096f,  0.996917334f,
+    0.071932653f,  0.997409491f,
+    0.065403129f,  0.997858923f,
+    0.058870804f,  0.998265610f,
+    0.052335956f,  0.998629535f,
+    0.045798867f,  0.998950681f,
+    0.039259816f,  0.999229036f,
+    0.032719083f,  0.999464587f,
+    0.026176948f,  0.999657325f,
+    0.019633692f,  0.999807240f,
+    0.013089596f,  0.999914328f,
+    0.006544938f,  0.999978582f,
+    0.000000000f,  1.000000000f,
+   -0.006544938f,  0.999978582f,
+   -0.013089596f,  0.999914328f,
+   -0.019633692f,  0.999807240f,
+   -0.026176948f,  0.999657325f,
+   -0.032719083f,  0.999464587f,
+   -0.039259816f,  0.999229036f,
+   -0.045798867f,  0.998950681f,
+   -0.052335956f,  0.998629535f,
+   -0.058870804f,  0.998265610f,
+   -0.065403129f,  0.997858923f,
+   -0.071932653f,  0.997409491f,
+   -0.078459096f,  0.996917334f,
+   -0.084982177f,  0.996382472f,
+   -0.091501619f,  0.995804928f,
+   -0.098017140f,  0.995184727f,
+   -0.104528463f,  0.994521895f,
+   -0.111035309f,  0.993816462f,
+   -0.117537397f,  0.993068457f,
+   -0.124034451f,  0.992277912f,
+   -0.130526192f,  0.991444861f,
+   -0.137012342f,  0.990569340f,
+   -0.143492622f,  0.989651387f,
+   -0.149966756f,  0.988691040f,
+   -0.156434465f,  0.987688341f,
+   -0.162895473f,  0.986643332f,
+   -0.169349504f,  0.985556059f,
+   -0.175796280f,  0.984426568f,
+   -0.182235525f,  0.983254908f,
+   -0.188666965f,  0.982041128f,
+   -0.195090322f,  0.980785280f,
+   -0.201505322f,  0.979487420f,
+   -0.207911691f,  0.978147601f,
+   -0.214309153f,  0.976765881f,
+   -0.220697435f,  0.975342321f,
+   -0.227076263f,  0.973876979f,
+   -0.233445364f,  0.972369920f,
+   -0.239804465f,  0.970821208f,
+   -0.246153293f,  0.969230910f,
+   -0.252491577f,  0.967599092f,
+   -0.258819045f,  0.965925826f,
+   -0.265135426f,  0.964211183f,
+   -0.271440450f,  0.962455236f,
+   -0.277733846f,  0.960658061f,
+   -0.284015345f,  0.958819735f,
+   -0.290284677f,  0.956940336f,
+   -0.296541575f,  0.955019944f,
+   -0.302785770f,  0.953058643f,
+   -0.309016994f,  0.951056516f,
+   -0.315234982f,  0.949013649f,
+   -0.321439465f,  0.946930129f,
+   -0.327630180f,  0.944806046f,
+   -0.333806859f,  0.942641491f,
+   -0.339969240f,  0.940436556f,
+   -0.346117057f,  0.938191336f,
+   -0.352250048f,  0.935905927f,
+   -0.358367950f,  0.933580426f,
+   -0.364470500f,  0.931214935f,
+   -0.370557438f,  0.928809553f,
+   -0.376628502f,  0.926364384f,
+   -0.382683432f,  0.923879533f,
+   -0.388721970f,  0.921355105f,
+   -0.394743856f,  0.918791210f,
+   -0.400748833f,  0.916187957f,
+   -0.406736643f,  0.913545458f,
+   -0.412707030f,  0.910863825f,
+   -0.418659738f,  0.908143174f,
+   -0.424594511f,  0.905383621f,
+   -0.430511097f,  0.902585284f,
+   -0.436409241f,  0.899748284f,
+   -0.442288690f,  0.896872742f,
+   -0.448149194f,  0.893958780f,
+   -0.453990500f,  0.891006524f,
+   -0.459812358f,  0.888016101f,
+   -0.465614520f,  0.884987637f,
+   -0.471396737f,  0.881921264f,
+   -0.477158760f,  0.878817113f,
+   -0.482900344f,  0.875675315f,
+   -0.488621241f,  0.872496007f,
+   -0.494321208f,  0.869279324f,
+   -0.500000000f,  0.866025404f,
+   -0.505657373f,  0.862734386f,
+   -0.511293086f,  0.859406412f,
+   -0.516906897f,  0.856041623f,
+   -0.522498565f,  0.852640164f,
+   -0.528067851f,  0.849202182f,
+   -0.533614516f,  0.845727822f,
+   -0.539138323f,  0.842217234f,
+   -0.544639035f,  0.838670568f,
+   -0.550116417f,  0.835087976f,
+   -0.555570233f,  0.831469612f,
+   -0.561000251f,  0.827815631f,
+   -0.566406237f,  0.824126189f,
+   -0.571787960f,  0.820401444f,
+   -0.577145190f,  0.816641555f,
+   -0.582477697f,  0.812846685f,
+   -0.587785252f,  0.809016994f,
+   -0.593067629f,  0.805152649f,
+   -0.598324601f,  0.801253813f,
+   -0.603555942f,  0.797320654f,
+   -0.608761429f,  0.793353340f,
+   -0.613940839f,  0.789352042f,
+   -0.619093949f,  0.785316931f,
+   -0.624220540f,  0.781248179f,
+   -0.629320391f,  0.777145961f,
+   -0.634393284f,  0.773010453f,
+   -0.639439002f,  0.768841832f,
+   -0.644457328f,  0.764640276f,
+   -0.649448048f,  0.760405966f,
+   -0.654410948f,  0.756139082f,
+   -0.659345815f,  0.751839807f,
+   -0.664252438f,  0.747508327f,
+   -0.669130606f,  0.743144825f,
+   -0.673980111f,  0.738749490f,
+   -0.678800746f,  0.734322509f,
+   -0.683592302f,  0.729864073f,
+   -0.688354576f,  0.725374371f,
+   -0.693087363f,  0.720853597f,
+   -0.697790460f,  0.716301943f,
+   -0.702463666f,  0.711719606f,
+   -0.707106781f,  0.707106781f,
+   -0.711719606f,  0.702463666f,
+   -0.716301943f,  0.697790460f,
+   -0.720853597f,  0.693087363f,
+   -0.725374371f,  0.688354576f,
+   -0.729864073f,  0.683592302f,
+   -0.734322509f,  0.678800746f,
+   -0.738749490f,  0.673980111f,
+   -0.743144825f,  0.669130606f,
+   -0.747508327f,  0.664252438f,
+   -0.751839807f,  0.659345815f,
+   -0.756139082f,  0.654410948f,
+   -0.760405966f,  0.649448048f,
+   -0.764640276f,  0.644457328f,
+   -0.768841832f,  0.639439002f,
+   -0.773010453f,  0.634393284f,
+   -0.777145961f,  0.629320391f,
+   -0.781248179f,  0.624220540f,
+   -0.785316931f,  0.619093949f,
+   -0.789352042f,  0.613940839f,
+   -0.793353340f,  0.608761429f,
+   -0.797320654f,  0.603555942f,
+   -0.801253813f,  0.598324601f,
+   -0.805152649f,  0.593067629f,
+   -0.809016994f,  0.587785252f,
+   -0.812846685f,  0.582477697f,
+   -0.816641555f,  0.577145190f,
+   -0.820401444f,  0.571787960f,
+   -0.824126189f,  0.566406237f,
+   -0.827815631f,  0.561000251f,
+   -0.831469612f,  0.555570233f,
+   -0.835087976f,  0.550116417f,
+   -0.838670568f,  0.544639035f,
+   -0.842217234f,  0.539138323f,
+   -0.845727822f,  0.533614516f,
+   -0.849202182f,  0.528067851f,
+   -0.852640164f,  0.522498565f,
+   -0.856041623f,  0.516906897f,
+   -0.859406412f,  0.511293086f,
+   -0.862734386f,  0.505657373f,
+   -0.866025404f,  0.500000000f,
+   -0.869279324f,  0.494321208f,
+   -0.872496007f,  0.488621241f,
+   -0.875675315f,  0.482900344f,
+   -0.878817113f,  0.477158760f,
+   -0.881921264f,  0.471396737f,
+   -0.884987637f,  0.465614520f,
+   -0.888016101f,  0.459812358f,
+   -0.891006524f,  0.453990500f,
+   -0.893958780f,  0.448149194f,
+   -0.896872742f,  0.442288690f,
+   -0.899748284f,  0.436409241f,
+   -0.902585284f,  0.430511097f,
+   -0.905383621f,  0.424594511f,
+   -0.908143174f,  0.418659738f,
+   -0.910863825f,  0.412707030f,
+   -0.913545458f,  0.406736643f,
+   -0.916187957f,  0.400748833f,
+   -0.918791210f,  0.394743856f,
+   -0.921355105f,  0.388721970f,
+   -0.923879533f,  0.382683432f,
+   -0.926364384f,  0.376628502f,
+   -0.928809553f,  0.370557438f,
+   -0.931214935f,  0.364470500f,
+   -0.933580426f,  0.358367950f,
+   -0.935905927f,  0.352250048f,
+   -0.938191336f,  0.346117057f,
+   -0.940436556f,  0.339969240f,
+   -0.942641491f,  0.333806859f,
+   -0.944806046f,  0.327630180f,
+   -0.946930129f,  0.321439465f,
+   -0.949013649f,  0.315234982f,
+   -0.951056516f,  0.309016994f,
+   -0.953058643f,  0.302785770f,
+   -0.955019944f,  0.296541575f,
+   -0.956940336f,  0.290284677f,
+   -0.958819735f,  0.284015345f,
+   -0.960658061f,  0.277733846f,
+   -0.962455236f,  0.271440450f,
+   -0.964211183f,  0.265135426f,
+   -0.965925826f,  0.258819045f,
+   -0.967599092f,  0.252491577f,
+   -0.969230910f,  0.246153293f,
+   -0.970821208f,  0.239804465f,
+   -0.972369920f,  0.233445364f,
+   -0.973876979f,  0.227076263f,
+   -0.975342321f,  0.220697435f,
+   -0.976765881f,  0.214309153f,
+   -0.978147601f,  0.207911691f,
+   -0.979487420f,  0.201505322f,
+   -0.980785280f,  0.195090322f,
+   -0.982041128f,  0.188666965f,
+   -0.983254908f,  0.182235525f,
+   -0.984426568f,  0.175796280f,
+   -0.985556059f,  0.169349504f,
+   -0.986643332f,  0.162895473f,
+   -0.987688341f,  0.156434465f,
+   -0.988691040f,  0.149966756f,
+   -0.989651387f,  0.143492622f,
+   -0.990569340f,  0.137012342f,
+   -0.991444861f,  0.130526192f,
+   -0.992277912f,  0.124034451f,
+   -0.993068457f,  0.117537397f,
+   -0.993816462f,  0.111035309f,
+   -0.994521895f,  0.104528463f,
+   -0.995184727f,  0.098017140f,
+   -0.995804928f,  0.091501619f,
+   -0.996382472f,  0.084982177f,
+   -0.996917334f,  0.078459096f,
+   -0.997409491f,  0.071932653f,
+   -0.997858923f,  0.065403129f,
+   -0.998265610f,  0.058870804f,
+   -0.998629535f,  0.052335956f,
+   -0.998950681f,  0.045798867f,
+   -0.999229036f,  0.039259816f,
+   -0.999464587f,  0.032719083f,
+   -0.999657325f,  0.026176948f,
+   -0.999807240f,  0.019633692f,
+   -0.999914328f,  0.013089596f,
+   -0.999978582f,  0.006544938f,
+   -1.000000000f,  0.000000000f,
+   -0.999978582f, -0.006544938f,
+   -0.999914328f, -0.013089596f,
+   -0.999807240f, -0.019633692f,
+   -0.999657325f, -0.026176948f,
+   -0.999464587f, -0.032719083f,
+   -0.999229036f, -0.039259816f,
+   -0.998950681f, -0.045798867f,
+   -0.998629535f, -0.052335956f,
+   -0.998265610f, -0.058870804f,
+   -0.997858923f, -0.065403129f,
+   -0.997409491f, -0.071932653f,
+   -0.996917334f, -0.078459096f,
+   -0.996382472f, -0.084982177f,
+   -0.995804928f, -0.091501619f,
+   -0.995184727f, -0.098017140f,
+   -0.994521895f, -0.104528463f,
+   -0.993816462f, -0.111035309f,
+   -0.993068457f, -0.117537397f,
+   -0.992277912f, -0.124034451f,
+   -0.991444861f, -0.130526192f,
+   -0.990569340f, -0.137012342f,
+   -0.989651387f, -0.143492622f,
+   -0.988691040f, -0.149966756f,
+   -0.987688341f, -0.156434465f,
+   -0.986643332f, -0.162895473f,
+   -0.985556059f, -0.169349504f,
+   -0.984426568f, -0.175796280f,
+   -0.983254908f, -0.182235525f,
+   -0.982041128f, -0.188666965f,
+   -0.980785280f, -0.195090322f,
+   -0.979487420f, -0.201505322f,
+   -0.978147601f, -0.207911691f,
+   -0.976765881f, -0.214309153f,
+   -0.975342321f, -0.220697435f,
+   -0.973876979f, -0.227076263f,
+   -0.972369920f, -0.233445364f,
+   -0.970821208f, -0.239804465f,
+   -0.969230910f, -0.246153293f,
+   -0.967599092f, -0.252491577f,
+   -0.965925826f, -0.258819045f,
+   -0.964211183f, -0.265135426f,
+   -0.962455236f, -0.271440450f,
+   -0.960658061f, -0.277733846f,
+   -0.958819735f, -0.284015345f,
+   -0.956940336f, -0.290284677f,
+   -0.955019944f, -0.296541575f,
+   -0.953058643f, -0.302785770f,
+   -0.951056516f, -0.309016994f,
+   -0.949013649f, -0.315234982f,
+   -0.946930129f, -0.321439465f,
+   -0.944806046f, -0.327630180f,
+   -0.942641491f, -0.333806859f,
+   -0.940436556f, -0.339969240f,
+   -0.938191336f, -0.346117057f,
+   -0.935905927f, -0.352250048f,
+   -0.933580426f, -0.358367950f,
+   -0.931214935f, -0.364470500f,
+   -0.928809553f, -0.370557438f,
+   -0.926364384f, -0.376628502f,
+   -0.923879533f, -0.382683432f,
+   -0.921355105f, -0.388721970f,
+   -0.918791210f, -0.394743856f,
+   -0.916187957f, -0.400748833f,
+   -0.913545458f, -0.406736643f,
+   -0.910863825f, -0.412707030f,
+   -0.908143174f, -0.418659738f,
+   -0.905383621f, -0.424594511f,
+   -0.902585284f, -0.430511097f,
+   -0.899748284f, -0.436409241f,
+   -0.896872742f, -0.442288690f,
+   -0.893958780f, -0.448149194f,
+   -0.891006524f, -0.453990500f,
+   -0.888016101f, -0.459812358f,
+   -0.884987637f, -0.465614520f,
+   -0.881921264f, -0.471396737f,
+   -0.878817113f, -0.477158760f,
+   -0.875675315f, -0.482900344f,
+   -0.872496007f, -0.488621241f,
+   -0.869279324f, -0.494321208f,
+   -0.866025404f, -0.500000000f,
+   -0.862734386f, -0.505657373f,
+   -0.859406412f, -0.511293086f,
+   -0.856041623f, -0.516906897f,
+   -0.852640164f, -0.522498565f,
+   -0.849202182f, -0.528067851f,
+   -0.845727822f, -0.533614516f,
+   -0.842217234f, -0.539138323f,
+   -0.838670568f, -0.544639035f,
+   -0.835087976f, -0.550116417f,
+   -0.831469612f, -0.555570233f,
+   -0.827815631f, -0.561000251f,
+   -0.824126189f, -0.566406237f,
+   -0.820401444f, -0.571787960f,
+   -0.816641555f, -0.577145190f,
+   -0.812846685f, -0.582477697f,
+   -0.809016994f, -0.587785252f,
+   -0.805152649f, -0.593067629f,
+   -0.801253813f, -0.598324601f,
+   -0.797320654f, -0.603555942f,
+   -0.793353340f, -0.608761429f,
+   -0.789352042f, -0.613940839f,
+   -0.785316931f, -0.619093949f,
+   -0.781248179f, -0.624220540f,
+   -0.777145961f, -0.629320391f,
+   -0.773010453f, -0.634393284f,
+   -0.768841832f, -0.639439002f,
+   -0.764640276f, -0.644457328f,
+   -0.760405966f, -0.649448048f,
+   -0.756139082f, -0.654410948f,
+   -0.751839807f, -0.659345815f,
+   -0.747508327f, -0.664252438f,
+   -0.743144825f, -0.669130606f,
+   -0.738749490f, -0.673980111f,
+   -0.734322509f, -0.678800746f,
+   -0.729864073f, -0.683592302f,
+   -0.725374371f, -0.688354576f,
+   -0.720853597f, -0.693087363f,
+   -0.716301943f, -0.697790460f,
+   -0.711719606f, -0.702463666f,
+   -0.707106781f, -0.707106781f,
+   -0.702463666f, -0.711719606f,
+   -0.697790460f, -0.716301943f,
+   -0.693087363f, -0.720853597f,
+   -0.688354576f, -0.725374371f,
+   -0.683592302f, -0.729864073f,
+   -0.678800746f, -0.734322509f,
+   -0.673980111f, -0.738749490f,
+   -0.669130606f, -0.743144825f,
+   -0.664252438f, -0.747508327f,
+   -0.659345815f, -0.751839807f,
+   -0.654410948f, -0.756139082f,
+   -0.649448048f, -0.760405966f,
+   -0.644457328f, -0.764640276f,
+   -0.639439002f, -0.768841832f,
+   -0.634393284f, -0.773010453f,
+   -0.629320391f, -0.777145961f,
+   -0.624220540f, -0.781248179f,
+   -0.619093949f, -0.785316931f,
+   -0.613940839f, -0.789352042f,
+   -0.608761429f, -0.793353340f,
+   -0.603555942f, -0.797320654f,
+   -0.598324601f, -0.801253813f,
+   -0.593067629f, -0.805152649f,
+   -0.587785252f, -0.809016994f,
+   -0.582477697f, -0.812846685f,
+   -0.577145190f, -0.816641555f,
+   -0.571787960f, -0.820401444f,
+   -0.566406237f, -0.824126189f,
+   -0.561000251f, -0.827815631f,
+   -0.555570233f, -0.831469612f,
+   -0.550116417f, -0.835087976f,
+   -0.544639035f, -0.838670568f,
+   -0.539138323f, -0.842217234f,
+   -0.533614516f, -0.845727822f,
+   -0.528067851f, -0.849202182f,
+   -0.522498565f, -0.852640164f,
+   -0.516906897f, -0.856041623f,
+   -0.511293086f, -0.859406412f,
+   -0.505657373f, -0.862734386f,
+   -0.500000000f, -0.866025404f,
+   -0.494321208f, -0.869279324f,
+   -0.488621241f, -0.872496007f,
+   -0.482900344f, -0.875675315f,
+   -0.477158760f, -0.878817113f,
+   -0.471396737f, -0.881921264f,
+   -0.465614520f, -0.884987637f,
+   -0.459812358f, -0.888016101f,
+   -0.453990500f, -0.891006524f,
+   -0.448149194f, -0.893958780f,
+   -0.442288690f, -0.896872742f,
+   -0.436409241f, -0.899748284f,
+   -0.430511097f, -0.902585284f,
+   -0.424594511f, -0.905383621f,
+   -0.418659738f, -0.908143174f,
+   -0.412707030f, -0.910863825f,
+   -0.406736643f, -0.913545458f,
+   -0.400748833f, -0.916187957f,
+   -0.394743856f, -0.918791210f,
+   -0.388721970f, -0.921355105f,
+   -0.382683432f, -0.923879533f,
+   -0.376628502f, -0.926364384f,
+   -0.370557438f, -0.928809553f,
+   -0.364470500f, -0.931214935f,
+   -0.358367950f, -0.933580426f,
+   -0.352250048f, -0.935905927f,
+   -0.346117057f, -0.938191336f,
+   -0.339969240f, -0.940436556f,
+   -0.333806859f, -0.942641491f,
+   -0.327630180f, -0.944806046f,
+   -0.321439465f, -0.946930129f,
+   -0.315234982f, -0.949013649f,
+   -0.309016994f, -0.951056516f,
+   -0.302785770f, -0.953058643f,
+   -0.296541575f, -0.955019944f,
+   -0.290284677f, -0.956940336f,
+   -0.284015345f, -0.958819735f,
+   -0.277733846f, -0.960658061f,
+   -0.271440450f, -0.962455236f,
+   -0.265135426f, -0.964211183f,
+   -0.258819045f, -0.965925826f,
+   -0.252491577f, -0.967599092f,
+   -0.246153293f, -0.969230910f,
+   -0.239804465f, -0.970821208f,
+   -0.233445364f, -0.972369920f,
+   -0.227076263f, -0.973876979f,
+   -0.220697435f, -0.975342321f,
+   -0.214309153f, -0.976765881f,
+   -0.207911691f, -0.978147601f,
+   -0.201505322f, -0.979487420f,
+   -0.195090322f, -0.980785280f,
+   -0.188666965f, -0.982041128f,
+   -0.182235525f, -0.983254908f,
+   -0.175796280f, -0.984426568f,
+   -0.169349504f, -0.985556059f,
+   -0.162895473f, -0.986643332f,
+   -0.156434465f, -0.987688341f,
+   -0.149966756f, -0.988691040f,
+   -0.143492622f, -0.989651387f,
+   -0.137012342f, -0.990569340f,
+   -0.130526192f, -0.991444861f,
+   -0.124034451f, -0.992277912f,
+   -0.117537397f, -0.993068457f,
+   -0.111035309f, -0.993816462f,
+   -0.104528463f, -0.994521895f,
+   -0.098017140f, -0.995184727f,
+   -0.091501619f, -0.995804928f,
+   -0.084982177f, -0.996382472f,
+   -0.078459096f, -0.996917334f,
+   -0.071932653f, -0.997409491f,
+   -0.065403129f, -0.997858923f,
+   -0.058870804f, -0.998265610f,
+   -0.052335956f, -0.998629535f,
+   -0.045798867f, -0.998950681f,
+   -0.039259816f, -0.999229036f,
+   -0.032719083f, -0.999464587f,
+   -0.026176948f, -0.999657325f,
+   -0.019633692f, -0.999807240f,
+   -0.013089596f, -0.999914328f,
+   -0.006544938f, -0.999978582f,
+    0.000000000f, -1.000000000f,
+    0.006544938f, -0.999978582f,
+    0.013089596f, -0.999914328f,
+    0.019633692f, -0.999807240f,
+    0.026176948f, -0.999657325f,
+    0.032719083f, -0.999464587f,
+    0.039259816f, -0.999229036f,
+    0.045798867f, -0.998950681f,
+    0.052335956f, -0.998629535f,
+    0.058870804f, -0.998265610f,
+    0.065403129f, -0.997858923f,
+    0.071932653f, -0.997409491f,
+    0.078459096f, -0.996917334f,
+    0.084982177f, -0.996382472f,
+    0.091501619f, -0.995804928f,
+    0.098017140f, -0.995184727f,
+    0.104528463f, -0.994521895f,
+    0.111035309f, -0.993816462f,
+    0.117537397f, -0.993068457f,
+    0.124034451f, -0.992277912f,
+    0.130526192f, -0.991444861f,
+    0.137012342f, -0.990569340f,
+    0.143492622f, -0.989651387f,
+    0.149966756f, -0.988691040f,
+    0.156434465f, -0.987688341f,
+    0.162895473f, -0.986643332f,
+    0.169349504f, -0.985556059f,
+    0.175796280f, -0.984426568f,
+    0.182235525f, -0.983254908f,
+    0.188666965f, -0.982041128f,
+    0.195090322f, -0.980785280f,
+    0.201505322f, -0.979487420f,
+    0.207911691f, -0.978147601f,
+    0.214309153f, -0.976765881f,
+    0.220697435f, -0.975342321f,
+    0.227076263f, -0.973876979f,
+    0.233445364f, -0.972369920f,
+    0.239804465f, -0.970821208f,
+    0.246153293f, -0.969230910f,
+    0.252491577f, -0.967599092f,
+    0.258819045f, -0.965925826f,
+    0.265135426f, -0.964211183f,
+    0.271440450f, -0.962455236f,
+    0.277733846f, -0.960658061f,
+    0.284015345f, -0.958819735f,
+    0.290284677f, -0.956940336f,
+    0.296541575f, -0.955019944f,
+    0.302785770f, -0.953058643f,
+    0.309016994f, -0.951056516f,
+    0.315234982f, -0.949013649f,
+    0.321439465f, -0.946930129f,
+    0.327630180f, -0.944806046f,
+    0.333806859f, -0.942641491f,
+    0.339969240f, -0.940436556f,
+    0.346117057f, -0.938191336f,
+    0.352250048f, -0.935905927f,
+    0.358367950f, -0.933580426f,
+    0.364470500f, -0.931214935f,
+    0.370557438f, -0.928809553f,
+    0.376628502f, -0.926364384f,
+    0.382683432f, -0.923879533f,
+    0.388721970f, -0.921355105f,
+    0.394743856f, -0.918791210f,
+    0.400748833f, -0.916187957f,
+    0.406736643f, -0.913545458f,
+    0.412707030f, -0.910863825f,
+    0.418659738f, -0.908143174f,
+    0.424594511f, -0.905383621f,
+    0.430511097f, -0.902585284f,
+    0.436409241f, -0.899748284f,
+    0.442288690f, -0.896872742f,
+    0.448149194f, -0.893958780f,
+    0.453990500f, -0.891006524f,
+    0.459812358f, -0.888016101f,
+    0.465614520f, -0.884987637f,
+    0.471396737f, -0.881921264f,
+    0.477158760f, -0.878817113f,
+    0.482900344f, -0.875675315f,
+    0.488621241f, -0.872496007f,
+    0.494321208f, -0.869279324f,
+    0.500000000f, -0.866025404f,
+    0.505657373f, -0.862734386f,
+    0.511293086f, -0.859406412f,
+    0.516906897f, -0.856041623f,
+    0.522498565f, -0.852640164f,
+    0.528067851f, -0.849202182f,
+    0.533614516f, -0.845727822f,
+    0.539138323f, -0.842217234f,
+    0.544639035f, -0.838670568f,
+    0.550116417f, -0.835087976f,
+    0.555570233f, -0.831469612f,
+    0.561000251f, -0.827815631f,
+    0.566406237f, -0.824126189f,
+    0.571787960f, -0.820401444f,
+    0.577145190f, -0.816641555f,
+    0.582477697f, -0.812846685f,
+    0.587785252f, -0.809016994f,
+    0.593067629f, -0.805152649f,
+    0.598324601f, -0.801253813f,
+    0.603555942f, -0.797320654f,
+    0.608761429f, -0.793353340f,
+    0.613940839f, -0.789352042f,
+    0.619093949f, -0.785316931f,
+    0.624220540f, -0.781248179f,
+    0.629320391f, -0.777145961f,
+    0.634393284f, -0.773010453f,
+    0.639439002f, -0.768841832f,
+    0.644457328f, -0.764640276f,
+    0.649448048f, -0.760405966f,
+    0.654410948f, -0.756139082f,
+    0.659345815f, -0.751839807f,
+    0.664252438f, -0.747508327f,
+    0.669130606f, -0.743144825f,
+    0.673980111f, -0.738749490f,
+    0.678800746f, -0.734322509f,
+    0.683592302f, -0.729864073f,
+    0.688354576f, -0.725374371f,
+    0.693087363f, -0.720853597f,
+    0.697790460f, -0.716301943f,
+    0.702463666f, -0.711719606f,
+    0.707106781f, -0.707106781f,
+    0.711719606f, -0.702463666f,
+    0.716301943f, -0.697790460f,
+    0.720853597f, -0.693087363f,
+    0.725374371f, -0.688354576f,
+    0.729864073f, -0.683592302f,
+    0.734322509f, -0.678800746f,
+    0.738749490f, -0.673980111f,
+    0.743144825f, -0.669130606f,
+    0.747508327f, -0.664252438f,
+    0.751839807f, -0.659345815f,
+    0.756139082f, -0.654410948f,
+    0.760405966f, -0.649448048f,
+    0.764640276f, -0.644457328f,
+    0.768841832f, -0.639439002f,
+    0.773010453f, -0.634393284f,
+    0.777145961f, -0.629320391f,
+    0.781248179f, -0.624220540f,
+    0.785316931f, -0.619093949f,
+    0.789352042f, -0.613940839f,
+    0.793353340f, -0.608761429f,
+    0.797320654f, -0.603555942f,
+    0.801253813f, -0.598324601f,
+    0.805152649f, -0.593067629f,
+    0.809016994f, -0.587785252f,
+    0.812846685f, -0.582477697f,
+    0.816641555f, -0.577145190f,
+    0.820401444f, -0.571787960f,
+    0.824126189f, -0.566406237f,
+    0.827815631f, -0.561000251f,
+    0.831469612f, -0.555570233f,
+    0.835087976f, -0.550116417f,
+    0.838670568f, -0.544639035f,
+    0.842217234f, -0.539138323f,
+    0.845727822f, -0.533614516f,
+    0.849202182f, -0.528067851f,
+    0.852640164f, -0.522498565f,
+    0.856041623f, -0.516906897f,
+    0.859406412f, -0.511293086f,
+    0.862734386f, -0.505657373f,
+    0.866025404f, -0.500000000f,
+    0.869279324f, -0.494321208f,
+    0.872496007f, -0.488621241f,
+    0.875675315f, -0.482900344f,
+    0.878817113f, -0.477158760f,
+    0.881921264f, -0.471396737f,
+    0.884987637f, -0.465614520f,
+    0.888016101f, -0.459812358f,
+    0.891006524f, -0.453990500f,
+    0.893958780f, -0.448149194f,
+    0.896872742f, -0.442288690f,
+    0.899748284f, -0.436409241f,
+    0.902585284f, -0.430511097f,
+    0.905383621f, -0.424594511f,
+    0.908143174f, -0.418659738f,
+    0.910863825f, -0.412707030f,
+    0.913545458f, -0.406736643f,
+    0.916187957f, -0.400748833f,
+    0.918791210f, -0.394743856f,
+    0.921355105f, -0.388721970f,
+    0.923879533f, -0.382683432f,
+    0.926364384f, -0.376628502f,
+    0.928809553f, -0.370557438f,
+    0.931214935f, -0.364470500f,
+    0.933580426f, -0.358367950f,
+    0.935905927f, -0.352250048f,
+    0.938191336f, -0.346117057f,
+    0.940436556f, -0.339969240f,
+    0.942641491f, -0.333806859f,
+    0.944806046f, -0.327630180f,
+    0.946930129f, -0.321439465f,
+    0.949013649f, -0.315234982f,
+    0.951056516f, -0.309016994f,
+    0.953058643f, -0.302785770f,
+    0.955019944f, -0.296541575f,
+    0.956940336f, -0.290284677f,
+    0.958819735f, -0.284015345f,
+    0.960658061f, -0.277733846f,
+    0.962455236f, -0.271440450f,
+    0.964211183f, -0.265135426f,
+    0.965925826f, -0.258819045f,
+    0.967599092f, -0.252491577f,
+    0.969230910f, -0.246153293f,
+    0.970821208f, -0.239804465f,
+    0.972369920f, -0.233445364f,
+    0.973876979f, -0.227076263f,
+    0.975342321f, -0.220697435f,
+    0.976765881f, -0.214309153f,
+    0.978147601f, -0.207911691f,
+    0.979487420f, -0.201505322f,
+    0.980785280f, -0.195090322f,
+    0.982041128f, -0.188666965f,
+    0.983254908f, -0.182235525f,
+    0.984426568f, -0.175796280f,
+    0.985556059f, -0.169349504f,
+    0.986643332f, -0.162895473f,
+    0.987688341f, -0.156434465f,
+    0.988691040f, -0.149966756f,
+    0.989651387f, -0.143492622f,
+    0.990569340f, -0.137012342f,
+    0.991444861f, -0.130526192f,
+    0.992277912f, -0.124034451f,
+    0.993068457f, -0.117537397f,
+    0.993816462f, -0.111035309f,
+    0.994521895f, -0.104528463f,
+    0.995184727f, -0.098017140f,
+    0.995804928f, -0.091501619f,
+    0.996382472f, -0.084982177f,
+    0.996917334f, -0.078459096f,
+    0.997409491f, -0.071932653f,
+    0.997858923f, -0.065403129f,
+    0.998265610f, -0.058870804f,
+    0.998629535f, -0.052335956f,
+    0.998950681f, -0.045798867f,
+    0.999229036f, -0.039259816f,
+    0.999464587f, -0.032719083f,
+    0.999657325f, -0.026176948f,
+    0.999807240f, -0.019633692f,
+    0.999914328f, -0.013089596f,
+    0.999978582f, -0.006544938f
+};
+
+
+/**
+* \par
+* Example code for floating-point mixed-radix Twiddle factors Generation:
+* \par
+* <pre>for(i = 0; i< N; i++)
+* {
+*	twiddleCoefMixed[2*i]= cos(i * 2*PI/(float)N);
+*	twiddleCoefMixed[2*i+1]= sin(i * 2*PI/(float)N);
+* } </pre>
+* \par
+* where N = 1000	and PI = 3.14159265358979
+* \par
+* The whole circle is stored so that every radix stage of the N and N/2
+* point transforms, and the real FFT split stage, index it directly.
+*/
+const float32_t twiddleCoefMixed_1000[2000] = {
+    1.000000000f,  0.000000000f,
+    0.999980261f,  0.006283144f,
+    0.999921044f,  0.012566040f,
+    0.999822352f,  0.018848440f,
+    0.999684189f,  0.025130095f,
+    0.999506560f,  0.031410759f,
+    0.999289473f,  0.037690183f,
+    0.999032935f,  0.043968118f,
+    0.998736957f,  0.050244318f,
+    0.998401550f,  0.056518534f,
+    0.998026728f,  0.062790520f,
+    0.997612506f,  0.069060026f,
+    0.997158900f,  0.075326806f,
+    0.996665928f,  0.081590612f,
+    0.996133609f,  0.087851197f,
+    0.995561965f,  0.094108313f,
+    0.994951017f,  0.100361715f,
+    0.994300790f,  0.106611154f,
+    0.993611311f,  0.112856385f,
+    0.992882605f,  0.119097160f,
+    0.992114701f,  0.125333234f,
+    0.991307631f,  0.131564359f,
+    0.990461426f,  0.137790291f,
+    0.989576119f,  0.144010783f,
+    0.988651745f,  0.150225589f,
+    0.987688341f,  0.156434465f,
+    0.986685944f,  0.162637165f,
+    0.985644595f,  0.168833445f,
+    0.984564335f,  0.175023059f,
+    0.983445205f,  0.181205764f,
+    0.982287251f,  0.187381315f,
+    0.981090517f,  0.193549468f,
+    0.979855052f,  0.199709981f,
+    0.978580904f,  0.205862609f,
+    0.977268124f,  0.212007110f,
+    0.975916762f,  0.218143241f,
+    0.974526873f,  0.224270761f,
+    0.973098511f,  0.230389427f,
+    0.971631733f,  0.236498997f,
+    0.970126596f,  0.242599231f,
+    0.968583161f,  0.248689887f,
+    0.967001488f,  0.254770726f,
+    0.965381639f,  0.260841506f,
+    0.963723678f,  0.266901989f,
+    0.962027672f,  0.272951936f,
+    0.960293686f,  0.278991106f,
+    0.958521789f,  0.285019262f,
+    0.956712052f,  0.291036167f,
+    0.954864545f,  0.297041582f,
+    0.952979342f,  0.303035270f,
+    0.951056516f,  0.309016994f,
+    0.949096145f,  0.314986520f,
+    0.947098305f,  0.320943610f,
+    0.945063075f,  0.326888030f,
+    0.942990536f,  0.332819545f,
+    0.940880769f,  0.338737920f,
+    0.938733858f,  0.344642923f,
+    0.936549887f,  0.350534320f,
+    0.934328942f,  0.356411879f,
+    0.932071112f,  0.362275367f,
+    0.929776486f,  0.368124553f,
+    0.927445153f,  0.373959206f,
+    0.925077207f,  0.379779096f,
+    0.922672740f,  0.385583992f,
+    0.920231847f,  0.391373667f,
+    0.917754626f,  0.397147891f,
+    0.915241173f,  0.402906436f,
+    0.912691587f,  0.408649075f,
+    0.910105971f,  0.414375581f,
+    0.907484425f,  0.420085728f,
+    0.904827052f,  0.425779292f,
+    0.902133959f,  0.431456046f,
+    0.899405252f,  0.437115767f,
+    0.896641037f,  0.442758231f,
+    0.893841424f,  0.448383216f,
+    0.891006524f,  0.453990500f,
+    0.888136449f,  0.459579861f,
+    0.885231311f,  0.465151078f,
+    0.882291226f,  0.470703932f,
+    0.879316310f,  0.476238204f,
+    0.876306680f,  0.481753674f,
+    0.873262455f,  0.487250126f,
+    0.870183755f,  0.492727342f,
+    0.867070701f,  0.498185105f,
+    0.863923417f,  0.503623202f,
+    0.860742027f,  0.509041416f,
+    0.857526656f,  0.514439534f,
+    0.854277432f,  0.519817343f,
+    0.850994482f,  0.525174630f,
+    0.847677936f,  0.530511184f,
+    0.844327926f,  0.535826795f,
+    0.840944582f,  0.541121252f,
+    0.837528040f,  0.546394347f,
+    0.834078434f,  0.551645871f,
+    0.830595899f,  0.556875616f,
+    0.827080574f,  0.562083378f,
+    0.823532598f,  0.567268949f,
+    0.819952109f,  0.572432126f,
+    0.816339251f,  0.577572703f,
+    0.812694164f,  0.582690480f,
+    0.809016994f,  0.587785252f,
+    0.805307886f,  0.592856820f,
+    0.801566985f,  0.597904983f,
+    0.797794440f,  0.602929542f,
+    0.793990399f,  0.607930298f,
+    0.790155012f,  0.612907054f,
+    0.786288432f,  0.617859613f,
+    0.782390811f,  0.622787780f,
+    0.778462302f,  0.627691361f,
+    0.774503060f,  0.632570162f,
+    0.770513243f,  0.637423990f,
+    0.766493007f,  0.642252653f,
+    0.762442511f,  0.647055962f,
+    0.758361915f,  0.651833725f,
+    0.754251381f,  0.656585756f,
+    0.750111070f,  0.661311865f,
+    0.745941145f,  0.666011867f,
+    0.741741773f,  0.670685577f,
+    0.737513117f,  0.675332808f,
+    0.733255346f,  0.679953379f,
+    0.728968627f,  0.684547106f,
+    0.724653130f,  0.689113808f,
+    0.720309025f,  0.693653306f,
+    0.715936483f,  0.698165419f,
+    0.711535677f,  0.702649970f,
+    0.707106781f,  0.707106781f,
+    0.702649970f,  0.711535677f,
+    0.698165419f,  0.715936483f,
+    0.693653306f,  0.720309025f,
+    0.689113808f,  0.724653130f,
+    0.684547106f,  0.728968627f,
+    0.679953379f,  0.733255346f,
+    0.675332808f,  0.737513117f,
+    0.670685577f,  0.741741773f,
+    0.666011867f,  0.745941145f,
+    0.661311865f,  0.750111070f,
+    0.656585756f,  0.754251381f,
+    0.651833725f,  0.758361915f,
+    0.647055962f,  0.762442511f,
+    0.642252653f,  0.766493007f,
+    0.637423990f,  0.770513243f,
+    0.632570162f,  0.774503060f,
+    0.627691361f,  0.778462302f,
+    0.622787780f,  0.782390811f,
+    0.617859613f,  0.786288432f,
+    0.612907054f,  0.790155012f,
+    0.607930298f,  0.793990399f,
+    0.602929542f,  0.797794440f,
+    0.597904983f,  0.801566985f,
+    0.592856820f,  0.805307886f,
+    0.587785252f,  0.809016994f,
+    0.582690480f,  0.812694164f,
+    0.577572703f,  0.816339251f,
+    0.572432126f,  0.819952109f,
+    0.567268949f,  0.823532598f,
+    0.562083378f,  0.827080574f,
+    0.556875616f,  0.830595899f,
+    0.551645871f,  0.834078434f,
+    0.546394347f,  0.837528040f,
+    0.541121252f,  0.840944582f,
+    0.535826795f,  0.844327926f,
+    0.530511184f,  0.847677936f,
+    0.525174630f,  0.850994482f,
+    0.519817343f,  0.854277432f,
+    0.514439534f,  0.857526656f,
+    0.509041416f,  0.860742027f,
+    0.503623202f,  0.863923417f,
+    0.498185105f,  0.867070701f,
+    0.492727342f,  0.870183755f,
+    0.487250126f,  0.873262455f,
+    0.481753674f,  0.876306680f,
+    0.476238204f,  0.879316310f,
+    0.470703932f,  0.882291226f,
+    0.465151078f,  0.885231311f,
+    0.459579861f,  0.888136449f,
+    0.453990500f,  0.891006524f,
+    0.448383216f,  0.893841424f,
+    0.442758231f,  0.896641037f,
+    0.437115767f,  0.899405252f,
+    0.431456046f,  0.902133959f,
+    0.425779292f,  0.904827052f,
+    0.420085728f,  0.907484425f,
+    0.414375581f,  0.910105971f,
+    0.408649075f,  0.912691587f,
+    0.402906436f,  0.915241173f,
+    0.397147891f,  0.917754626f,
+    0.391373667f,  0.920231847f,
+    0.385583992f,  0.922672740f,
+    0.379779096f,  0.925077207f,
+    0.373959206f,  0.927445153f,
+    0.368124553f,  0.929776486f,
+    0.362275367f,  0.932071112f,
+    0.356411879f,  0.934328942f,
+    0.350534320f,  0.936549887f,
+    0.344642923f,  0.938733858f,
+    0.338737920f,  0.940880769f,
+    0.332819545f,  0.942990536f,
+    0.326888030f,  0.945063075f,
+    0.320943610f,  0.947098305f,
+    0.314986520f,  0.949096145f,
+    0.309016994f,  0.951056516f,
+    0.303035270f,  0.952979342f,
+    0.297041582f,  0.954864545f,
+    0.291036167f,  0.956712052f,
+    0.285019262f,  0.958521789f,
+    0.278991106f,  0.960293686f,
+    0.272951936f,  0.962027672f,
+    0.266901989f,  0.963723678f,
+    0.260841506f,  0.965381639f,
+    0.254770726f,  0.967001488f,
+    0.248689887f,  0.968583161f,
+    0.242599231f,  0.970126596f,
+    0.236498997f,  0.971631733f,
+    0.230389427f,  0.973098511f,
+    0.224270761f,  0.974526873f,
+    0.218143241f,  0.975916762f,
+    0.212007110f,  0.977268124f,
+    0.205862609f,  0.978580904f,
+    0.199709981f,  0.979855052f,
+    0.193549468f,  0.981090517f,
+    0.187381315f,  0.982287251f,
+    0.181205764f,  0.983445205f,
+    0.175023059f,  0.984564335f,
+    0.168833445f,  0.985644595f,
+    0.162637165f,  0.986685944f,
+    0.156434465f,  0.987688341f,
+    0.150225589f,  0.988651745f,
+    0.144010783f,  0.989576119f,
+    0.137790291f,  0.990461426f,
+    0.131564359f,  0.991307631f,
+    0.125333234f,  0.992114701f,
+    0.119097160f,  0.992882605f,
+    0.112856385f,  0.993611311f,
+    0.106611154f,  0.994300790f,
+    0.100361715f,  0.994951017f,
+    0.094108313f,  0.995561965f,
+    0.087851197f,  0.996133609f,
+    0.081590612f,  0.996665928f,
+    0.075326806f,  0.997158900f,
+    0.069060026f,  0.997612506f,
+    0.062790520f,  0.998026728f,
+    0.056518534f,  0.998401550f,
+    0.050244318f,  0.998736957f,
+    0.043968118f,  0.999032935f,
+    0.037690183f,  0.999289473f,
+    0.031410759f,  0.999506560f,
+    0.025130095f,  0.999684189f,
+    0.018848440f,  0.999822352f,
+    0.012566040f,  0.999921044f,
+    0.006283144f,  0.999980261f,
+    0.000000000f,  1.000000000f,
+   -0.006283144f,  0.999980261f,
+   -0.012566040f,  0.999921044f,
+   -0.018848440f,  0.999822352f,
+   -0.025130095f,  0.999684189f,
+   -0.031410759f,  0.999506560f,
+   -0.037690183f,  0.999289473f,
+   -0.043968118f,  0.999032935f,
+   -0.050244318f,  0.998736957f,
+   -0.056518534f,  0.998401550f,
+   -0.062790520f,  0.998026728f,
+   -0.069060026f,  0.997612506f,
+   -0.075326806f,  0.997158900f,
+   -0.081590612f,  0.996665928f,
+   -0.087851197f,  0.996133609f,
+   -0.094108313f,  0.995561965f,
+   -0.100361715f,  0.994951017f,
+   -0.106611154f,  0.994300790f,
+   -0.112856385f,  0.993611311f,
+   -0.119097160f,  0.992882605f,
+   -0.125333234f,  0.992114701f,
+   -0.131564359f,  0.991307631f,
+   -0.137790291f,  0.990461426f,
+   -0.144010783f,  0.989576119f,
+   -0.150225589f,  0.988651745f,
+   -0.156434465f,  0.987688341f,
+   -0.162637165f,  0.986685944f,
+   -0.168833445f,  0.985644595f,
+   -0.175023059f,  0.984564335f,
+   -0.181205764f,  0.983445205f,
+   -0.187381315f,  0.982287251f,
+   -0.193549468f,  0.981090517f,
+   -0.199709981f,  0.979855052f,
+   -0.205862609f,  0.978580904f,
+   -0.212007110f,  0.977268124f,
+   -0.218143241f,  0.975916762f,
+   -0.224270761f,  0.974526873f,
+   -0.230389427f,  0.973098511f,
+   -0.236498997f,  0.971631733f,
+   -0.242599231f,  0.970126596f,
+   -0.248689887f,  0.968583161f,
+   -0.254770726f,  0.967001488f,
+   -0.260841506f,  0.965381639f,
+   -0.266901989f,  0.963723678f,
+   -0.272951936f,  0.962027672f,
+   -0.278991106f,  0.960293686f,
+   -0.285019262f,  0.958521789f,
+   -0.291036167f,  0.956712052f,
+   -0.297041582f,  0.954864545f,
+   -0.303035270f,  0.952979342f,
+   -0.309016994f,  0.951056516f,
+   -0.314986520f,  0.949096145f,
+   -0.320943610f,  0.947098305f,
+   -0.326888030f,  0.945063075f,
+   -0.332819545f,  0.942990536f,
+   -0.338737920f,  0.940880769f,
+   -0.344642923f,  0.938733858f,
+   -0.350534320f,  0.936549887f,
+   -0.356411879f,  0.934328942f,
+   -0.362275367f,  0.932071112f,
+   -0.368124553f,  0.929776486f,
+   -0.373959206f,  0.927445153f,
+   -0.379779096f,  0.925077207f,
+   -0.385583992f,  0.922672740f,
+   -0.391373667f,  0.920231847f,
+   -0.397147891f,  0.917754626f,
+   -0.402906436f,  0.915241173f,
+   -0.408649075f,  0.912691587f,
+   -0.414375581f,  0.910105971f,
+   -0.420085728f,  0.907484425f,
+   -0.425779292f,  0.904827052f,
+   -0.431456046f,  0.902133959f,
+   -0.437115767f,  0.899405252f,
+   -0.442758231f,  0.896641037f,
+   -0.448383216f,  0.893841424f,
+   -0.453990500f,  0.891006524f,
+   -0.459579861f,  0.888136449f,
+   -0.465151078f,  0.885231311f,
+   -0.470703932f,  0.882291226f,
+   -0.476238204f,  0.879316310f,
+   -0.481753674f,  0.876306680f,
+   -0.487250126f,  0.873262455f,
+   -0.492727342f,  0.870183755f,
+   -0.498185105f,  0.867070701f,
+   -0.503623202f,  0.863923417f,
+   -0.509041416f,  0.860742027f,
+   -0.514439534f,  0.857526656f,
+   -0.519817343f,  0.854277432f,
+   -0.525174630f,  0.850994482f,
+   -0.530511184f,  0.847677936f,
+   -0.535826795f,  0.844327926f,
+   -0.541121252f,  0.840944582f,
+   -0.546394347f,  0.837528040f,
+   -0.551645871f,  0.834078434f,
+   -0.556875616f,  0.830595899f,
+   -0.562083378f,  0.827080574f,
+   -0.567268949f,  0.823532598f,
+   -0.572432126f,  0.819952109f,
+   -0.577572703f,  0.816339251f,
+   -0.582690480f,  0.812694164f,
+   -0.587785252f,  0.809016994f,
+   -0.592856820f,  0.805307886f,
+   -0.597904983f,  0.801566985f,
+   -0.602929542f,  0.797794440f,
+   -0.607930298f,  0.793990399f,
+   -0.612907054f,  0.790155012f,
+   -0.617859613f,  0.786288432f,
+   -0.622787780f,  0.782390811f,
+   -0.627691361f,  0.778462302f,
+   -0.632570162f,  0.774503060f,
+   -0.637423990f,  0.770513243f,
+   -0.642252653f,  0.766493007f,
+   -0.647055962f,  0.762442511f,
+   -0.651833725f,  0.758361915f,
+   -0.656585756f,  0.754251381f,
+   -0.661311865f,  0.750111070f,
+   -0.666011867f,  0.745941145f,
+   -0.670685577f,  0.741741773f,
+   -0.675332808f,  0.737513117f,
+   -0.679953379f,  0.733255346f,
+   -0.684547106f,  0.728968627f,
+   -0.689113808f,  0.724653130f,
+   -0.693653306f,  0.720309025f,
+   -0.698165419f,  0.715936483f,
+   -0.702649970f,  0.711535677f,
+   -0.707106781f,  0.707106781f,
+   -0.711535677f,  0.702649970f,
+   -0.715936483f,  0.698165419f,
+   -0.720309025f,  0.693653306f,
+   -0.724653130f,  0.689113808f,
+   -0.728968627f,  0.684547106f,
+   -0.733255346f,  0.679953379f,
+   -0.737513117f,  0.675332808f,
+   -0.741741773f,  0.670685577f,
+   -0.745941145f,  0.666011867f,
+   -0.750111070f,  0.661311865f,
+   -0.754251381f,  0.656585756f,
+   -0.758361915f,  0.651833725f,
+   -0.762442511f,  0.647055962f,
+   -0.766493007f,  0.642252653f,
+   -0.770513243f,  0.637423990f,
+   -0.774503060f,  0.632570162f,
+   -0.778462302f,  0.627691361f,
+   -0.782390811f,  0.622787780f,
+   -0.786288432f,  0.617859613f,
+   -0.790155012f,  0.612907054f,
+   -0.793990399f,  0.607930298f,
+   -0.797794440f,  0.602929542f,
+   -0.801566985f,  0.597904983f,
+   -0.805307886f,  0.592856820f,
+   -0.809016994f,  0.587785252f,
+   -0.812694164f,  0.582690480f,
+   -0.816339251f,  0.577572703f,
+   -0.819952109f,  0.572432126f,
+   -0.823532598f,  0.567268949f,
+   -0.827080574f,  0.562083378f,
+   -0.830595899f,  0.556875616f,
+   -0.834078434f,  0.551645871f,
+   -0.837528040f,  0.546394347f,
+   -0.840944582f,  0.541121252f,
+   -0.844327926f,  0.535826795f,
+   -0.847677936f,  0.530511184f,
+   -0.850994482f,  0.525174630f,
+   -0.854277432f,  0.519817343f,
+   -0.857526656f,  0.514439534f,
+   -0.860742027f,  0.509041416f,
+   -0.863923417f,  0.503623202f,
+   -0.867070701f,  0.498185105f,
+   -0.870183755f,  0.492727342f,
+   -0.873262455f,  0.487250126f,
+   -0.876306680f,  0.481753674f,
+   -0.879316310f,  0.476238204f,
+   -0.882291226f,  0.470703932f,
+   -0.885231311f,  0.465151078f,
+   -0.888136449f,  0.459579861f,
+   -0.891006524f,  0.453990500f,
+   -0.893841424f,  0.448383216f,
+   -0.896641037f,  0.442758231f,
+   -0.899405252f,  0.437115767f,
+   -0.902133959f,  0.431456046f,
+   -0.904827052f,  0.425779292f,
+   -0.907484425f,  0.420085728f,
+   -0.910105971f,  0.414375581f,
+   -0.912691587f,  0.408649075f,
+   -0.915241173f,  0.402906436f,
+   -0.917754626f,  0.397147891f,
+   -0.920231847f,  0.391373667f,
+   -0.922672740f,  0.385583992f,
+   -0.925077207f,  0.379779096f,
+   -0.927445153f,  0.373959206f,
+   -0.929776486f,  0.368124553f,
+   -0.932071112f,  0.362275367f,
+   -0.934328942f,  0.356411879f,
+   -0.936549887f,  0.350534320f,
+   -0.938733858f,  0.344642923f,
+   -0.940880769f,  0.338737920f,
+   -0.942990536f,  0.332819545f,
+   -0.945063075f,  0.326888030f,
+   -0.947098305f,  0.320943610f,
+   -0.949096145f,  0.314986520f,
+   -0.951056516f,  0.309016994f,
+   -0.952979342f,  0.303035270f,
+   -0.954864545f,  0.297041582f,
+   -0.956712052f,  0.291036167f,
+   -0.958521789f,  0.285019262f,
+   -0.960293686f,  0.278991106f,
+   -0.962027672f,  0.272951936f,
+   -0.963723678f,  0.266901989f,
+   -0.965381639f,  0.260841506f,
+   -0.967001488f,  0.254770726f,
+   -0.968583161f,  0.248689887f,
+   -0.970126596f,  0.242599231f,
+   -0.971631733f,  0.236498997f,
+   -0.973098511f,  0.230389427f,
+   -0.974526873f,  0.224270761f,
+   -0.975916762f,  0.218143241f,
+   -0.977268124f,  0.212007110f,
+   -0.978580904f,  0.205862609f,
+   -0.979855052f,  0.199709981f,
+   -0.981090517f,  0.193549468f,
+   -0.982287251f,  0.187381315f,
+   -0.983445205f,  0.181205764f,
+   -0.984564335f,  0.175023059f,
+   -0.985644595f,  0.168833445f,
+   -0.986685944f,  0.162637165f,
+   -0.987688341f,  0.156434465f,
+   -0.988651745f,  0.150225589f,
+   -0.989576119f,  0.144010783f,
+   -0.990461426f,  0.137790291f,
+   -0.991307631f,  0.131564359f,
+   -0.992114701f,  0.125333234f,
+   -0.992882605f,  0.119097160f,
+   -0.993611311f,  0.112856385f,
+   -0.994300790f,  0.106611154f,
+   -0.994951017f,  0.100361715f,
+   -0.995561965f,  0.094108313f,
+   -0.996133609f,  0.087851197f,
+   -0.996665928f,  0.081590612f,
+   -0.997158900f,  0.075326806f,
+   -0.997612506f,  0.069060026f,
+   -0.998026728f,  0.062790520f,
+   -0.998401550f,  0.056518534f,
+   -0.998736957f,  0.050244318f,
+   -0.999032935f,  0.043968118f,
+   -0.999289473f,  0.037690183f,
+   -0.999506560f,  0.031410759f,
+   -0.999684189f,  0.025130095f,
+   -0.999822352f,  0.018848440f,
+   -0.999921044f,  0.012566040f,
+   -0.999980261f,  0.006283144f,
+   -1.000000000f,  0.000000000f,
+   -0.999980261f, -0.006283144f,
+   -0.999921044f, -0.012566040f,
+   -0.999822352f, -0.018848440f,
+   -0.999684189f, -0.025130095f,
+   -0.999506560f, -0.031410759f,
+   -0.999289473f, -0.037690183f,
+   -0.999032935f, -0.043968118f,
+   -0.998736957f, -0.050244318f,
+   -0.998401550f, -0.056518534f,
+   -0.998026728f, -0.062790520f,
+   -0.997612506f, -0.069060026f,
+   -0.997158900f, -0.075326806f,
+   -0.996665928f, -0.081590612f,
+   -0.996133609f, -0.087851197f,
+   -0.995561965f, -0.094108313f,
+   -0.994951017f, -0.100361715f,
+   -0.994300790f, -0.106611154f,
+   -0.993611311f, -0.112856385f,
+   -0.992882605f, -0.119097160f,
+   -0.992114701f, -0.125333234f,
+   -0.991307631f, -0.131564359f,
+   -0.990461426f, -0.137790291f,
+   -0.989576119f, -0.144010783f,
+   -0.988651745f, -0.150225589f,
+   -0.987688341f, -0.156434465f,
+   -0.986685944f, -0.162637165f,
+   -0.985644595f, -0.168833445f,
+   -0.984564335f, -0.175023059f,
+   -0.983445205f, -0.181205764f,
+   -0.982287251f, -0.187381315f,
+   -0.981090517f, -0.193549468f,
+   -0.979855052f, -0.199709981f,
+   -0.978580904f, -0.205862609f,
+   -0.977268124f, -0.212007110f,
+   -0.975916762f, -0.218143241f,
+   -0.974526873f, -0.224270761f,
+   -0.973098511f, -0.230389427f,
+   -0.971631733f, -0.236498997f,
+   -0.970126596f, -0.242599231f,
+   -0.968583161f, -0.248689887f,
+   -0.967001488f, -0.254770726f,
+   -0.965381639f, -0.260841506f,
+   -0.963723678f, -0.266901989f,
+   -0.962027672f, -0.272951936f,
+   -0.960293686f, -0.278991106f,
+   -0.958521789f, -0.285019262f,
+   -0.956712052f, -0.291036167f,
+   -0.954864545f, -0.297041582f,
+   -0.952979342f, -0.303035270f,
+   -0.951056516f, -0.309016994f,
+   -0.949096145f, -0.314986520f,
+   -0.947098305f, -0.320943610f,
+   -0.945063075f, -0.326888030f,
+   -0.942990536f, -0.332819545f,
+   -0.940880769f, -0.338737920f,
+   -0.938733858f, -0.344642923f,
+   -0.936549887f, -0.350534320f,
+   -0.934328942f, -0.356411879f,
+   -0.932071112f, -0.362275367f,
+   -0.929776486f, -0.368124553f,
+   -0.927445153f, -0.373959206f,
+   -0.925077207f, -0.379779096f,
+   -0.922672740f, -0.385583992f,
+   -0.920231847f, -0.391373667f,
+   -0.917754626f, -0.397147891f,
+   -0.915241173f, -0.402906436f,
+   -0.912691587f, -0.408649075f,
+   -0.910105971f, -0.414375581f,
+   -0.907484425f, -0.420085728f,
+   -0.904827052f, -0.425779292f,
+   -0.902133959f, -0.431456046f,
+   -0.899405252f, -0.437115767f,
+   -0.896641037f, -0.442758231f,
+   -0.893841424f, -0.448383216f,
+   -0.891006524f, -0.453990500f,
+   -0.888136449f, -0.459579861f,
+   -0.885231311f, -0.465151078f,
+   -0.882291226f, -0.470703932f,
+   -0.879316310f, -0.476238204f,
+   -0.876306680f, -0.481753674f,
+   -0.873262455f, -0.487250126f,
+   -0.870183755f, -0.492727342f,
+   -0.867070701f, -0.498185105f,
+   -0.863923417f, -0.503623202f,
+   -0.860742027f, -0.509041416f,
+   -0.857526656f, -0.514439534f,
+   -0.854277432f, -0.519817343f,
+   -0.850994482f, -0.525174630f,
+   -0.847677936f, -0.530511184f,
+   -0.844327926f, -0.535826795f,
+   -0.840944582f, -0.541121252f,
+   -0.837528040f, -0.546394347f,
+   -0.834078434f, -0.551645871f,
+   -0.830595899f, -0.556875616f,
+   -0.827080574f, -0.562083378f,
+   -0.823532598f, -0.567268949f,
+   -0.819952109f, -0.572432126f,
+   -0.816339251f, -0.577572703f,
+   -0.812694164f, -0.582690480f,
+   -0.809016994f, -0.587785252f,
+   -0.805307886f, -0.592856820f,
+   -0.801566985f, -0.597904983f,
+   -0.797794440f, -0.602929542f,
+   -0.793990399f, -0.607930298f,
+   -0.790155012f, -0.612907054f,
+   -0.786288432f, -0.617859613f,
+   -0.782390811f, -0.622787780f,
+   -0.778462302f, -0.627691361f,
+   -0.774503060f, -0.632570162f,
+   -0.770513243f, -0.637423990f,
+   -0.766493007f, -0.642252653f,
+   -0.762442511f, -0.647055962f,
+   -0.758361915f, -0.651833725f,
+   -0.754251381f, -0.656585756f,
+   -0.750111070f, -0.661311865f,
+   -0.745941145f, -0.666011867f,
+   -0.741741773f, -0.670685577f,
+   -0.737513117f, -0.675332808f,
+   -0.733255346f, -0.679953379f,
+   -0.728968627f, -0.684547106f,
+   -0.724653130f, -0.689113808f,
+   -0.720309025f, -0.693653306f,
+   -0.715936483f, -0.698165419f,
+   -0.711535677f, -0.702649970f,
+   -0.707106781f, -0.707106781f,
+   -0.702649970f, -0.711535677f,
+   -0.698165419f, -0.715936483f,
+   -0.693653306f, -0.720309025f,
+   -0.689113808f, -0.724653130f,
+   -0.684547106f, -0.728968627f,
+   -0.679953379f, -0.733255346f,
+   -0.675332808f, -0.737513117f,
+   -0.670685577f, -0.741741773f,
+   -0.666011867f, -0.745941145f,
+   -0.661311865f, -0.750111070f,
+   -0.656585756f, -0.754251381f,
+   -0.651833725f, -0.758361915f,
+   -0.647055962f, -0.762442511f,
+   -0.642252653f, -0.766493007f,
+   -0.637423990f, -0.770513243f,
+   -0.632570162f, -0.774503060f,
+   -0.627691361f, -0.778462302f,
+   -0.622787780f, -0.782390811f,
+   -0.617859613f, -0.786288432f,
+   -0.612907054f, -0.790155012f,
+   -0.607930298f, -0.793990399f,
+   -0.602929542f, -0.797794440f,
+   -0.597904983f, -0.801566985f,
+   -0.592856820f, -0.805307886f,
+   -0.587785252f, -0.809016994f,
+   -0.582690480f, -0.812694164f,
+   -0.577572703f, -0.816339251f,
+   -0.572432126f, -0.819952109f,
+   -0.567268949f, -0.823532598f,
+   -0.562083378f, -0.827080574f,
+   -0.556875616f, -0.830595899f,
+   -0.551645871f, -0.834078434f,
+   -0.546394347f, -0.837528040f,
+   -0.541121252f, -0.840944582f,
+   -0.535826795f, -0.844327926f,
+   -0.530511184f, -0.847677936f,
+   -0.525174630f, -0.850994482f,
+   -0.519817343f, -0.854277432f,
+   -0.514439534f, -0.857526656f,
+   -0.509041416f, -0.860742027f,
+   -0.503623202f, -0.863923417f,
+   -0.498185105f, -0.867070701f,
+   -0.492727342f, -0.870183755f,
+   -0.487250126f, -0.873262455f,
+   -0.481753674f, -0.876306680f,
+   -0.476238204f, -0.879316310f,
+   -0.470703932f, -0.882291226f,
+   -0.465151078f, -0.885231311f,
+   -0.459579861f, -0.888136449f,
+   -0.453990500f, -0.891006524f,
+   -0.448383216f, -0.893841424f,
+   -0.442758231f, -0.896641037f,
+   -0.437115767f, -0.899405252f,
+   -0.431456046f, -0.902133959f,
+   -0.425779292f, -0.904827052f,
+   -0.420085728f, -0.907484425f,
+   -0.414375581f, -0.910105971f,
+   -0.408649075f, -0.912691587f,
+   -0.402906436f, -0.915241173f,
+   -0.397147891f, -0.917754626f,
+   -0.391373667f, -0.920231847f,
+   -0.385583992f, -0.922672740f,
+   -0.379779096f, -0.925077207f,
+   -0.373959206f, -0.927445153f,
+   -0.368124553f, -0.929776486f,
+   -0.362275367f, -0.932071112f,
+   -0.356411879f, -0.934328942f,
+   -0.350534320f, -0.936549887f,
+   -0.344642923f, -0.938733858f,
+   -0.338737920f, -0.940880769f,
+   -0.332819545f, -0.942990536f,
+   -0.326888030f, -0.945063075f,
+   -0.320943610f, -0.947098305f,
+   -0.314986520f, -0.949096145f,
+   -0.309016994f, -0.951056516f,
+   -0.303035270f, -0.952979342f,
+   -0.297041582f, -0.954864545f,
+   -0.291036167f, -0.956712052f,
+   -0.285019262f, -0.958521789f,
+   -0.278991106f, -0.960293686f,
+   -0.272951936f, -0.962027672f,
+   -0.266901989f, -0.963723678f,
+   -0.260841506f, -0.965381639f,
+   -0.254770726f, -0.967001488f,
+   -0.248689887f, -0.968583161f,
+   -0.242599231f, -0.970126596f,
+   -0.236498997f, -0.971631733f,
+   -0.230389427f, -0.973098511f,
+   -0.224270761f, -0.974526873f,
+   -0.218143241f, -0.975916762f,
+   -0.212007110f, -0.977268124f,
+   -0.205862609f, -0.978580904f,
+   -0.199709981f, -0.979855052f,
+   -0.193549468f, -0.981090517f,
+   -0.187381315f, -0.982287251f,
+   -0.181205764f, -0.983445205f,
+   -0.175023059f, -0.984564335f,
+   -0.168833445f, -0.985644595f,
+   -0.162637165f, -0.986685944f,
+   -0.156434465f, -0.987688341f,
+   -0.150225589f, -0.988651745f,
+   -0.144010783f, -0.989576119f,
+   -0.137790291f, -0.990461426f,
+   -0.131564359f, -0.991307631f,
+   -0.125333234f, -0.992114701f,
+   -0.119097160f, -0.992882605f,
+   -0.112856385f, -0.993611311f,
+   -0.106611154f, -0.994300790f,
+   -0.100361715f, -0.994951017f,
+   -0.094108313f, -0.995561965f,
+   -0.087851197f, -0.996133609f,
+   -0.081590612f, -0.996665928f,
+   -0.075326806f, -0.997158900f,
+   -0.069060026f, -0.997612506f,
+   -0.062790520f, -0.998026728f,
+   -0.056518534f, -0.998401550f,
+   -0.050244318f, -0.998736957f,
+   -0.043968118f, -0.999032935f,
+   -0.037690183f, -0.999289473f,
+   -0.031410759f, -0.999506560f,
+   -0.025130095f, -0.999684189f,
+   -0.018848440f, -0.999822352f,
+   -0.012566040f, -0.999921044f,
+   -0.006283144f, -0.999980261f,
+    0.000000000f, -1.000000000f,
+    0.006283144f, -0.999980261f,
+    0.012566040f, -0.999921044f,
+    0.018848440f, -0.999822352f,
+    0.025130095f, -0.999684189f,
+    0.031410759f, -0.999506560f,
+    0.037690183f, -0.999289473f,
+    0.043968118f, -0.999032935f,
+    0.050244318f, -0.998736957f,
+    0.056518534f, -0.998401550f,
+    0.062790520f, -0.998026728f,
+    0.069060026f, -0.997612506f,
+    0.075326806f, -0.997158900f,
+    0.081590612f, -0.996665928f,
+    0.087851197f, -0.996133609f,
+    0.094108313f, -0.995561965f,
+    0.100361715f, -0.994951017f,
+    0.106611154f, -0.994300790f,
+    0.112856385f, -0.993611311f,
+    0.119097160f, -0.992882605f,
+    0.125333234f, -0.992114701f,
+    0.131564359f, -0.991307631f,
+    0.137790291f, -0.990461426f,
+    0.144010783f, -0.989576119f,
+    0.150225589f, -0.988651745f,
+    0.156434465f, -0.987688341f,
+    0.162637165f, -0.986685944f,
+    0.168833445f, -0.985644595f,
+    0.175023059f, -0.984564335f,
+    0.181205764f, -0.983445205f,
+    0.187381315f, -0.982287251f,
+    0.193549468f, -0.981090517f,
+    0.199709981f, -0.979855052f,
+    0.205862609f, -0.978580904f,
+    0.212007110f, -0.977268124f,
+    0.218143241f, -0.975916762f,
+    0.224270761f, -0.974526873f,
+    0.230389427f, -0.973098511f,
+    0.236498997f, -0.971631733f,
+    0.242599231f, -0.970126596f,
+    0.248689887f, -0.968583161f,
+    0.254770726f, -0.967001488f,
+    0.260841506f, -0.965381639f,
+    0.266901989f, -0.963723678f,
+    0.272951936f, -0.962027672f,
+    0.278991106f, -0.960293686f,
+    0.285019262f, -0.958521789f,
+    0.291036167f, -0.956712052f,
+    0.297041582f, -0.954864545f,
+    0.303035270f, -0.952979342f,
+    0.309016994f, -0.951056516f,
+    0.314986520f, -0.949096145f,
+    0.320943610f, -0.947098305f,
+    0.326888030f, -0.945063075f,
+    0.332819545f, -0.942990536f,
+    0.338737920f, -0.940880769f,
+    0.344642923f, -0.938733858f,
+    0.350534320f, -0.936549887f,
+    0.356411879f, -0.934328942f,
+    0.362275367f, -0.932071112f,
+    0.368124553f, -0.929776486f,
+    0.373959206f, -0.927445153f,
+    0.379779096f, -0.925077207f,
+    0.385583992f, -0.922672740f,
+    0.391373667f, -0.920231847f,
+    0.397147891f, -0.917754626f,
+    0.402906436f, -0.915241173f,
+    0.408649075f, -0.912691587f,
+    0.414375581f, -0.910105971f,
+    0.420085728f, -0.907484425f,
+    0.425779292f, -0.904827052f,
+    0.431456046f, -0.902133959f,
+    0.437115767f, -0.899405252f,
+    0.442758231f, -0.896641037f,
+    0.448383216f, -0.893841424f,
+    0.453990500f, -0.891006524f,
+    0.459579861f, -0.888136449f,
+    0.465151078f, -0.885231311f,
+    0.470703932f, -0.882291226f,
+    0.476238204f, -0.879316310f,
+    0.481753674f, -0.876306680f,
+    0.487250126f, -0.873262455f,
+    0.492727342f, -0.870183755f,
+    0.498185105f, -0.867070701f,
+    0.503623202f, -0.863923417f,
+    0.509041416f, -0.860742027f,
+    0.514439534f, -0.857526656f,
+    0.519817343f, -0.854277432f,
+    0.525174630f, -0.850994482f,
+    0.530511184f, -0.847677936f,
+    0.535826795f, -0.844327926f,
+    0.541121252f, -0.840944582f,
+    0.546394347f, -0.837528040f,
+    0.551645871f, -0.834078434f,
+    0.556875616f, -0.830595899f,
+    0.562083378f, -0.827080574f,
+    0.567268949f, -0.823532598f,
+    0.572432126f, -0.819952109f,
+    0.577572703f, -0.816339251f,
+    0.582690480f, -0.812694164f,
+    0.587785252f, -0.809016994f,
+    0.592856820f, -0.805307886f,
+    0.597904983f, -0.801566985f,
+    0.602929542f, -0.797794440f,
+    0.607930298f, -0.793990399f,
+    0.612907054f, -0.790155012f,
+    0.617859613f, -0.786288432f,
+    0.622787780f, -0.782390811f,
+    0.627691361f, -0.778462302f,
+    0.632570162f, -0.774503060f,
+    0.637423990f, -0.770513243f,
+    0.642252653f, -0.766493007f,
+    0.647055962f, -0.762442511f,
+    0.651833725f, -0.758361915f,
+    0.656585756f, -0.754251381f,
+    0.661311865f, -0.750111070f,
+    0.666011867f, -0.745941145f,
+    0.670685577f, -0.741741773f,
+    0.675332808f, -0.737513117f,
+    0.679953379f, -0.733255346f,
+    0.684547106f, -0.728968627f,
+    0.689113808f, -0.724653130f,
+    0.693653306f, -0.720309025f,
+    0.698165419f, -0.715936483f,
+    0.702649970f, -0.711535677f,
+    0.707106781f, -0.707106781f,
+    0.711535677f, -0.702649970f,
+    0.715936483f, -0.698165419f,
+    0.720309025f, -0.693653306f,
+    0.724653130f, -0.689113808f,
+    0.728968627f, -0.684547106f,
+    0.733255346f, -0.679953379f,
+    0.737513117f, -0.675332808f,
+    0.741741773f, -0.670685577f,
+    0.745941145f, -0.666011867f,
+    0.750111070f, -0.661311865f,
+    0.754251381f, -0.656585756f,
+    0.758361915f, -0.651833725f,
+    0.762442511f, -0.647055962f,
+    0.766493007f, -0.642252653f,
+    0.770513243f, -0.637423990f,
+    0.774503060f, -0.632570162f,
+    0.778462302f, -0.627691361f,
+    0.782390811f, -0.622787780f,
+    0.786288432f, -0.617859613f,
+    0.790155012f, -0.612907054f,
+    0.793990399f, -0.607930298f,
+    0.797794440f, -0.602929542f,
+    0.801566985f, -0.597904983f,
+    0.805307886f, -0.592856820f,
+    0.809016994f, -0.587785252f,
+    0.812694164f, -0.582690480f,
+    0.816339251f, -0.577572703f,
+    0.819952109f, -0.572432126f,
+    0.823532598f, -0.567268949f,
+    0.827080574f, -0.562083378f,
+    0.830595899f, -0.556875616f,
+    0.834078434f, -0.551645871f,
+    0.837528040f, -0.546394347f,
+    0.840944582f, -0.541121252f,
+    0.844327926f, -0.535826795f,
+    0.847677936f, -0.530511184f,
+    0.850994482f, -0.525174630f,
+    0.854277432f, -0.519817343f,
+    0.857526656f, -0.514439534f,
+    0.860742027f, -0.509041416f,
+    0.863923417f, -0.503623202f,
+    0.867070701f, -0.498185105f,
+    0.870183755f, -0.492727342f,
+    0.873262455f, -0.487250126f,
+    0.876306680f, -0.481753674f,
+    0.879316310f, -0.476238204f,
+    0.882291226f, -0.470703932f,
+    0.885231311f, -0.465151078f,
+    0.888136449f, -0.459579861f,
+    0.891006524f, -0.453990500f,
+    0.893841424f, -0.448383216f,
+    0.896641037f, -0.442758231f,
+    0.899405252f, -0.437115767f,
+    0.902133959f, -0.431456046f,
+    0.904827052f, -0.425779292f,
+    0.907484425f, -0.420085728f,
+    0.910105971f, -0.414375581f,
+    0.912691587f, -0.408649075f,
+    0.915241173f, -0.402906436f,
+    0.917754626f, -0.397147891f,
+    0.920231847f, -0.391373667f,
+    0.922672740f, -0.385583992f,
+    0.925077207f, -0.379779096f,
+    0.927445153f, -0.373959206f,
+    0.929776486f, -0.368124553f,
+    0.932071112f, -0.362275367f,
+    0.934328942f, -0.356411879f,
+    0.936549887f, -0.350534320f,
+    0.938733858f, -0.344642923f,
+    0.940880769f, -0.338737920f,
+    0.942990536f, -0.332819545f,
+    0.945063075f, -0.326888030f,
+    0.947098305f, -0.320943610f,
+    0.949096145f, -0.314986520f,
+    0.951056516f, -0.309016994f,
+    0.952979342f, -0.303035270f,
+    0.954864545f, -0.297041582f,
+    0.956712052f, -0.291036167f,
+    0.958521789f, -0.285019262f,
+    0.960293686f, -0.278991106f,
+    0.962027672f, -0.272951936f,
+    0.963723678f, -0.266901989f,
+    0.965381639f, -0.260841506f,
+    0.967001488f, -0.254770726f,
+    0.968583161f, -0.248689887f,
+    0.970126596f, -0.242599231f,
+    0.971631733f, -0.236498997f,
+    0.973098511f, -0.230389427f,
+    0.974526873f, -0.224270761f,
+    0.975916762f, -0.218143241f,
+    0.977268124f, -0.212007110f,
+    0.978580904f, -0.205862609f,
+    0.979855052f, -0.199709981f,
+    0.981090517f, -0.193549468f,
+    0.982287251f, -0.187381315f,
+    0.983445205f, -0.181205764f,
+    0.984564335f, -0.175023059f,
+    0.985644595f, -0.168833445f,
+    0.986685944f, -0.162637165f,
+    0.987688341f, -0.156434465f,
+    0.988651745f, -0.150225589f,
+    0.989576119f, -0.144010783f,
+    0.990461426f, -0.137790291f,
+    0.991307631f, -0.131564359f,
+    0.992114701f, -0.125333234f,
+    0.992882605f, -0.119097160f,
+    0.993611311f, -0.112856385f,
+    0.994300790f, -0.106611154f,
+    0.994951017f, -0.100361715f,
+    0.995561965f, -0.094108313f,
+    0.996133609f, -0.087851197f,
+    0.996665928f, -0.081590612f,
+    0.997158900f, -0.075326806f,
+    0.997612506f, -0.069060026f,
+    0.998026728f, -0.062790520f,
+    0.998401550f, -0.056518534f,
+    0.998736957f, -0.050244318f,
+    0.999032935f, -0.043968118f,
+    0.999289473f, -0.037690183f,
+    0.999506560f, -0.031410759f,
+    0.999684189f, -0.025130095f,
+    0.999822352f, -0.018848440f,
+    0.999921044f, -0.012566040f,
+    0.999980261f, -0.006283144f
+};
+
+
+/**
+* \par
+* Example code for Q31 mixed-radix Twiddle factors Generation:
+* \par
+* <pre>for(i = 0; i< N; i++)
+* {
+*    twiddleCoefMixedQ31[2*i]= cos(i * 2*PI/(float)N);
+*    twiddleCoefMixedQ31[2*i+1]= sin(i * 2*PI/(float)N);
+* } </pre>
+* \par
+* where N = 600	and PI = 3.14159265358979
+* \par
+* Convert Floating point to Q31(Fixed point 1.31):
+*	round(twiddleCoefMixedQ31(i) * pow(2, 31))
+*/
+const q31_t twiddleCoefMixed_600_q31[1200] = {
+    0x7FFFFFFF, 0x00000000,
+    0x7FFE340C, 0x015723B1,
+    0x7FF8D03D, 0x02AE3DC0,
+    0x7FEFD4BA, 0x0405448B,
+    0x7FE341C4, 0x055C2E72,
+    0x7FD317B4, 0x06B2F1D2,
+    0x7FBF5700, 0x0809850E,
+    0x7FA80034, 0x095FDE87,
+    0x7F8D13F9, 0x0AB5F4A0,
+    0x7F6E9310, 0x0C0BBDC0,
+    0x7F4C7E54, 0x0D61304E,
+    0x7F26D6BA, 0x0EB642B3,
+    0x7EFD9D52, 0x100AEB5E,
+    0x7ED0D343, 0x115F20BD,
+    0x7EA079CE, 0x12B2D943,
+    0x7E6C9251, 0x14060B68,
+    0x7E351E3F, 0x1558ADA5,
+    0x7DFA1F27, 0x16AAB678,
+    0x7DBB96B1, 0x17FC1C65,
+    0x7D79869E, 0x194CD5F2,
+    0x7D33F0CA, 0x1A9CD9AC,
+    0x7CEAD728, 0x1BEC1E24,
+    0x7C9E3BC6, 0x1D3A99F0,
+    0x7C4E20CA, 0x1E8843AC,
+    0x7BFA8874, 0x1FD511FA,
+    0x7BA3751D, 0x2120FB83,
+    0x7B48E937, 0x226BF6F5,
+    0x7AEAE74B, 0x23B5FB06,
+    0x7A8971FF, 0x24FEFE72,
+    0x7A248C0E, 0x2646F7FB,
+    0x79BC384D, 0x278DDE6E,
+    0x795079AB, 0x28D3A89D,
+    0x78E1532D, 0x2A184D62,
+    0x786EC7F2, 0x2B5BC3A1,
+    0x77F8DB32, 0x2C9E0244,
+    0x777F903C, 0x2DDF0040,
+    0x7702EA78, 0x2F1EB491,
+    0x7682ED65, 0x305D163F,
+    0x75FF9C9C, 0x319A1C59,
+    0x7578FBCC, 0x32D5BDF9,
+    0x74EF0EBC, 0x340FF242,
+    0x7461D94C, 0x3548B062,
+    0x73D15F73, 0x367FEF92,
+    0x733DA540, 0x37B5A715,
+    0x72A6AED6, 0x38E9CE39,
+    0x720C8075, 0x3A1C5C57,
+    0x716F1E6F, 0x3B4D48D4,
+    0x70CE8D30, 0x3C7C8B20,
+    0x702AD13A, 0x3DAA1AB9,
+    0x6F83EF25, 0x3ED5EF28,
+    0x6ED9EBA1, 0x40000000,
+    0x6E2CCB74, 0x412844E4,
+    0x6D7C937A, 0x424EB584,
+    0x6CC948A5, 0x4373499A,
+    0x6C12EFFE, 0x4495F8F0,
+    0x6B598EA3, 0x45B6BB5E,
+    0x6A9D29C8, 0x46D588C7,
+    0x69DDC6B9, 0x47F2591F,
+    0x691B6AD3, 0x490D2466,
+    0x68561B8C, 0x4A25E2AD,
+    0x678DDE6E, 0x4B3C8C12,
+    0x66C2B918, 0x4C5118C2,
+    0x65F4B13E, 0x4D6380F9,
+    0x6523CCA8, 0x4E73BD03,
+    0x64501135, 0x4F81C53D,
+    0x637984D4, 0x508D9211,
+    0x62A02D8D, 0x51971BFB,
+    0x61C4117A, 0x529E5B86,
+    0x60E536C8, 0x53A3494E,
+    0x6003A3B8, 0x54A5DE01,
+    0x5F1F5EA1, 0x55A6125C,
+    0x5E386DEA, 0x56A3DF2D,
+    0x5D4ED80F, 0x579F3D54,
+    0x5C62A3A0, 0x589825C4,
+    0x5B73D73C, 0x598E917F,
+    0x5A82799A, 0x5A82799A,
+    0x598E917F, 0x5B73D73C,
+    0x589825C4, 0x5C62A3A0,
+    0x579F3D54, 0x5D4ED80F,
+    0x56A3DF2D, 0x5E386DEA,
+    0x55A6125C, 0x5F1F5EA1,
+    0x54A5DE01, 0x6003A3B8,
+    0x53A3494E, 0x60E536C8,
+    0x529E5B86, 0x61C4117A,
+    0x51971BFB, 0x62A02D8D,
+    0x508D9211, 0x637984D4,
+    0x4F81C53D, 0x64501135,
+    0x4E73BD03, 0x6523CCA8,
+    0x4D6380F9, 0x65F4B13E,
+    0x4C5118C2, 0x66C2B918,
+    0x4B3C8C12, 0x678DDE6E,
+    0x4A25E2AD, 0x68561B8C,
+    0x490D2466, 0x691B6AD3,
+    0x47F2591F, 0x69DDC6B9,
+    0x46D588C7, 0x6A9D29C8,
+    0x45B6BB5E, 0x6B598EA3,
+    0x4495F8F0, 0x6C12EFFE,
+    0x4373499A, 0x6CC948A5,
+    0x424EB584, 0x6D7C937A,
+    0x412844E4, 0x6E2CCB74,
+    0x40000000, 0x6ED9EBA1,
+    0x3ED5EF28, 0x6F83EF25,
+    0x3DAA1AB9, 0x702AD13A,
+    0x3C7C8B20, 0x70CE8D30,
+    0x3B4D48D4, 0x716F1E6F,
+    0x3A1C5C57, 0x720C8075,
+    0x38E9CE39, 0x72A6AED6,
+    0x37B5A715, 0x733DA540,
+    0x367FEF92, 0x73D15F73,
+    0x3548B062, 0x7461D94C,
+    0x340FF242, 0x74EF0EBC,
+    0x32D5BDF9, 0x7578FBCC,
+    0x319A1C59, 0x75FF9C9C,
+    0x305D163F, 0x7682ED65,
+    0x2F1EB491, 0x7702EA78,
+    0x2DDF0040, 0x777F903C,
+    0x2C9E0244, 0x77F8DB32,
+    0x2B5BC3A1, 0x786EC7F2,
+    0x2A184D62, 0x78E1532D,
+    0x28D3A89D, 0x795079AB,
+    0x278DDE6E, 0x79BC384D,
+    0x2646F7FB, 0x7A248C0E,
+    0x24FEFE72, 0x7A8971FF,
+    0x23B5FB06, 0x7AEAE74B,
+    0x226BF6F5, 0x7B48E937,
+    0x2120FB83, 0x7BA3751D,
+    0x1FD511FA, 0x7BFA8874,
+    0x1E8843AC, 0x7C4E20CA,
+    0x1D3A99F0, 0x7C9E3BC6,
+    0x1BEC1E24, 0x7CEAD728,
+    0x1A9CD9AC, 0x7D33F0CA,
+    0x194CD5F2, 0x7D79869E,
+    0x17FC1C65, 0x7DBB96B1,
+    0x16AAB678, 0x7DFA1F27,
+    0x1558ADA5, 0x7E351E3F,
+    0x14060B68, 0x7E6C9251,
+    0x12B2D943, 0x7EA079CE,
+    0x115F20BD, 0x7ED0D343,
+    0x100AEB5E, 0x7EFD9D52,
+    0x0EB642B3, 0x7F26D6BA,
+    0x0D61304E, 0x7F4C7E54,
+    0x0C0BBDC0, 0x7F6E9310,
+    0x0AB5F4A0, 0x7F8D13F9,
+    0x095FDE87, 0x7FA80034,
+    0x0809850E, 0x7FBF5700,
+    0x06B2F1D2, 0x7FD317B4,
+    0x055C2E72, 0x7FE341C4,
+    0x0405448B, 0x7FEFD4BA,
+    0x02AE3DC0, 0x7FF8D03D,
+    0x015723B1, 0x7FFE340C,
+    0x00000000, 0x7FFFFFFF,
+    0xFEA8DC4F, 0x7FFE340C,
+    0xFD51C240, 0x7FF8D03D,
+    0xFBFABB75, 0x7FEFD4BA,
+    0xFAA3D18E, 0x7FE341C4,
+    0xF94D0E2E, 0x7FD317B4,
+    0xF7F67AF2, 0x7FBF5700,
+    0xF6A02179, 0x7FA80034,
+    0xF54A0B60, 0x7F8D13F9,
+    0xF3F44240, 0x7F6E9310,
+    0xF29ECFB2, 0x7F4C7E54,
+    0xF149BD4D, 0x7F26D6BA,
+    0xEFF514A2, 0x7EFD9D52,
+    0xEEA0DF43, 0x7ED0D343,
+    0xED4D26BD, 0x7EA079CE,
+    0xEBF9F498, 0x7E6C9251,
+    0xEAA7525B, 0x7E351E3F,
+    0xE9554988, 0x7DFA1F27,
+    0xE803E39B, 0x7DBB96B1,
+    0xE6B32A0E, 0x7D79869E,
+    0xE5632654, 0x7D33F0CA,
+    0xE413E1DC, 0x7CEAD728,
+    0xE2C56610, 0x7C9E3BC6,
+    0xE177BC54, 0x7C4E20CA,
+    0xE02AEE06, 0x7BFA8874,
+    0xDEDF047D, 0x7BA3751D,
+    0xDD94090B, 0x7B48E937,
+    0xDC4A04FA, 0x7AEAE74B,
+    0xDB01018E, 0x7A8971FF,
+    0xD9B90805, 0x7A248C0E,
+    0xD8722192, 0x79BC384D,
+    0xD72C5763, 0x795079AB,
+    0xD5E7B29E, 0x78E1532D,
+    0xD4A43C5F, 0x786EC7F2,
+    0xD361FDBC, 0x77F8DB32,
+    0xD220FFC0, 0x777F903C,
+    0xD0E14B6F, 0x7702EA78,
+    0xCFA2E9C1, 0x7682ED65,
+    0xCE65E3A7, 0x75FF9C9C,
+    0xCD2A4207, 0x7578FBCC,
+    0xCBF00DBE, 0x74EF0EBC,
+    0xCAB74F9E, 0x7461D94C,
+    0xC980106E, 0x73D15F73,
+    0xC84A58EB, 0x733DA540,
+    0xC71631C7, 0x72A6AED6,
+    0xC5E3A3A9, 0x720C8075,
+    0xC4B2B72C, 0x716F1E6F,
+    0xC38374E0, 0x70CE8D30,
+    0xC255E547, 0x702AD13A,
+    0xC12A10D8, 0x6F83EF25,
+    0xC0000000, 0x6ED9EBA1,
+    0xBED7BB1C, 0x6E2CCB74,
+    0xBDB14A7C, 0x6D7C937A,
+    0xBC8CB666, 0x6CC948A5,
+    0xBB6A0710, 0x6C12EFFE,
+    0xBA4944A2, 0x6B598EA3,
+    0xB92A7739, 0x6A9D29C8,
+    0xB80DA6E1, 0x69DDC6B9,
+    0xB6F2DB9A, 0x691B6AD3,
+    0xB5DA1D53, 0x68561B8C,
+    0xB4C373EE, 0x678DDE6E,
+    0xB3AEE73E, 0x66C2B918,
+    0xB29C7F07, 0x65F4B13E,
+    0xB18C42FD, 0x6523CCA8,
+    0xB07E3AC3, 0x64501135,
+    0xAF726DEF, 0x637984D4,
+    0xAE68E405, 0x62A02D8D,
+    0xAD61A47A, 0x61C4117A,
+    0xAC5CB6B2, 0x60E536C8,
+    0xAB5A21FF, 0x6003A3B8,
+    0xAA59EDA4, 0x5F1F5EA1,
+    0xA95C20D3, 0x5E386DEA,
+    0xA860C2AC, 0x5D4ED80F,
+    0xA767DA3C, 0x5C62A3A0,
+    0xA6716E81, 0x5B73D73C,
+    0xA57D8666, 0x5A82799A,
+    0xA48C28C4, 0x598E917F,
+    0xA39D5C60, 0x589825C4,
+    0xA2B127F1, 0x579F3D54,
+    0xA1C79216, 0x56A3DF2D,
+    0xA0E0A15F, 0x55A6125C,
+    0x9FFC5C48, 0x54A5DE01,
+    0x9F1AC938, 0x53A3494E,
+    0x9E3BEE86, 0x529E5B86,
+    0x9D5FD273, 0x51971BFB,
+    0x9C867B2C, 0x508D9211,
+    0x9BAFEECB, 0x4F81C53D,
+    0x9ADC3358, 0x4E73BD03,
+    0x9A0B4EC2, 0x4D6380F9,
+    0x993D46E8, 0x4C5118C2,
+    0x98722192, 0x4B3C8C12,
+    0x97A9E474, 0x4A25E2AD,
+    0x96E4952D, 0x490D2466,
+    0x96223947, 0x47F2591F,
+    0x9562D638, 0x46D588C7,
+    0x94A6715D, 0x45B6BB5E,
+    0x93ED1002, 0x4495F8F0,
+    0x9336B75B, 0x4373499A,
+    0x92836C86, 0x424EB584,
+    0x91D3348C, 0x412844E4,
+    0x9126145F, 0x40000000,
+    0x907C10DB, 0x3ED5EF28,
+    0x8FD52EC6, 0x3DAA1AB9,
+    0x8F3172D0, 0x3C7C8B20,
+    0x8E90E191, 0x3B4D48D4,
+    0x8DF37F8B, 0x3A1C5C57,
+    0x8D59512A, 0x38E9CE39,
+    0x8CC25AC0, 0x37B5A715,
+    0x8C2EA08D, 0x367FEF92,
+    0x8B9E26B4, 0x3548B062,
+    0x8B10F144, 0x340FF242,
+    0x8A870434, 0x32D5BDF9,
+    0x8A006364, 0x319A1C59,
+    0x897D129B, 0x305D163F,
+    0x88FD1588, 0x2F1EB491,
+    0x88806FC4, 0x2DDF0040,
+    0x880724CE, 0x2C9E0244,
+    0x8791380E, 0x2B5BC3A1,
+    0x871EACD3, 0x2A184D62,
+    0x86AF8655, 0x28D3A89D,
+    0x8643C7B3, 0x278DDE6E,
+    0x85DB73F2, 0x2646F7FB,
+    0x85768E01, 0x24FEFE72,
+    0x851518B5, 0x23B5FB06,
+    0x84B716C9, 0x226BF6F5,
+    0x845C8AE3, 0x2120FB83,
+    0x8405778C, 0x1FD511FA,
+    0x83B1DF36, 0x1E8843AC,
+    0x8361C43A, 0x1D3A99F0,
+    0x831528D8, 0x1BEC1E24,
+    0x82CC0F36, 0x1A9CD9AC,
+    0x82867962, 0x194CD5F2,
+    0x8244694F, 0x17FC1C65,
+    0x8205E0D9, 0x16AAB678,
+    0x81CAE1C1, 0x1558ADA5,
+    0x81936DAF, 0x14060B68,
+    0x815F8632, 0x12B2D943,
+    0x812F2CBD, 0x115F20BD,
+    0x810262AE, 0x100AEB5E,
+    0x80D92946, 0x0EB642B3,
+    0x80B381AC, 0x0D61304E,
+    0x80916CF0, 0x0C0BBDC0,
+    0x8072EC07, 0x0AB5F4A0,
+    0x8057FFCC, 0x095FDE87,
+    0x8040A900, 0x0809850E,
+    0x802CE84C, 0x06B2F1D2,
+    0x801CBE3C, 0x055C2E72,
+    0x80102B46, 0x0405448B,
+    0x80072FC3, 0x02AE3DC0,
+    0x8001CBF4, 0x015723B1,
+    0x80000000, 0x00000000,
+    0x8001CBF4, 0xFEA8DC4F,
+    0x80072FC3, 0xFD51C240,
+    0x80102B46, 0xFBFABB75,
+    0x801CBE3C, 0xFAA3D18E,
+    0x802CE84C, 0xF94D0E2E,
+    0x8040A900, 0xF7F67AF2,
+    0x8057FFCC, 0xF6A02179,
+    0x8072EC07, 0xF54A0B60,
+    0x80916CF0, 0xF3F44240,
+    0x80B381AC, 0xF29ECFB2,
+    0x80D92946, 0xF149BD4D,
+    0x810262AE, 0xEFF514A2,
+    0x812F2CBD, 0xEEA0DF43,
+    0x815F8632, 0xED4D26BD,
+    0x81936DAF, 0xEBF9F498,
+    0x81CAE1C1, 0xEAA7525B,
+    0x8205E0D9, 0xE9554988,
+    0x8244694F, 0xE803E39B,
+    0x82867962, 0xE6B32A0E,
+    0x82CC0F36, 0xE5632654,
+    0x831528D8, 0xE413E1DC,
+    0x8361C43A, 0xE2C56610,
+    0x83B1DF36, 0xE177BC54,
+    0x8405778C, 0xE02AEE06,
+    0x845C8AE3, 0xDEDF047D,
+    0x84B716C9, 0xDD94090B,
+    0x851518B5, 0xDC4A04FA,
+    0x85768E01, 0xDB01018E,
+    0x85DB73F2, 0xD9B90805,
+    0x8643C7B3, 0xD8722192,
+    0x86AF8655, 0xD72C5763,
+    0x871EACD3, 0xD5E7B29E,
+    0x8791380E, 0xD4A43C5F,
+    0x880724CE, 0xD361FDBC,
+    0x88806FC4, 0xD220FFC0,
+    0x88FD1588, 0xD0E14B6F,
+    0x897D129B, 0xCFA2E9C1,
+    0x8A006364, 0xCE65E3A7,
+    0x8A870434, 0xCD2A4207,
+    0x8B10F144, 0xCBF00DBE,
+    0x8B9E26B4, 0xCAB74F9E,
+    0x8C2EA08D, 0xC980106E,
+    0x8CC25AC0, 0xC84A58EB,
+    0x8D59512A, 0xC71631C7,
+    0x8DF37F8B, 0xC5E3A3A9,
+    0x8E90E191, 0xC4B2B72C,
+    0x8F3172D0, 0xC38374E0,
+    0x8FD52EC6, 0xC255E547,
+    0x907C10DB, 0xC12A10D8,
+    0x9126145F, 0xC0000000,
+    0x91D3348C, 0xBED7BB1C,
+    0x92836C86, 0xBDB14A7C,
+    0x9336B75B, 0xBC8CB666,
+    0x93ED1002, 0xBB6A0710,
+    0x94A6715D, 0xBA4944A2,
+    0x9562D638, 0xB92A7739,
+    0x96223947, 0xB80DA6E1,
+    0x96E4952D, 0xB6F2DB9A,
+    0x97A9E474, 0xB5DA1D53,
+    0x98722192, 0xB4C373EE,
+    0x993D46E8, 0xB3AEE73E,
+    0x9A0B4EC2, 0xB29C7F07,
+    0x9ADC3358, 0xB18C42FD,
+    0x9BAFEECB, 0xB07E3AC3,
+    0x9C867B2C, 0xAF726DEF,
+    0x9D5FD273, 0xAE68E405,
+    0x9E3BEE86, 0xAD61A47A,
+    0x9F1AC938, 0xAC5CB6B2,
+    0x9FFC5C48, 0xAB5A21FF,
+    0xA0E0A15F, 0xAA59EDA4,
+    0xA1C79216, 0xA95C20D3,
+    0xA2B127F1, 0xA860C2AC,
+    0xA39D5C60, 0xA767DA3C,
+    0xA48C28C4, 0xA6716E81,
+    0xA57D8666, 0xA57D8666,
+    0xA6716E81, 0xA48C28C4,
+    0xA767DA3C, 0xA39D5C60,
+    0xA860C2AC, 0xA2B127F1,
+    0xA95C20D3, 0xA1C79216,
+    0xAA59EDA4, 0xA0E0A15F,
+    0xAB5A21FF, 0x9FFC5C48,
+    0xAC5CB6B2, 0x9F1AC938,
+    0xAD61A47A, 0x9E3BEE86,
+    0xAE68E405, 0x9D5FD273,
+    0xAF726DEF, 0x9C867B2C,
+    0xB07E3AC3, 0x9BAFEECB,
+    0xB18C42FD, 0x9ADC3358,
+    0xB29C7F07, 0x9A0B4EC2,
+    0xB3AEE73E, 0x993D46E8,
+    0xB4C373EE, 0x98722192,
+    0xB5DA1D53, 0x97A9E474,
+    0xB6F2DB9A, 0x96E4952D,
+    0xB80DA6E1, 0x96223947,
+    0xB92A7739, 0x9562D638,
+    0xBA4944A2, 0x94A6715D,
+    0xBB6A0710, 0x93ED1002,
+    0xBC8CB666, 0x9336B75B,
+    0xBDB14A7C, 0x92836C86,
+    0xBED7BB1C, 0x91D3348C,
+    0xC0000000, 0x9126145F,
+    0xC12A10D8, 0x907C10DB,
+    0xC255E547, 0x8FD52EC6,
+    0xC38374E0, 0x8F3172D0,
+    0xC4B2B72C, 0x8E90E191,
+    0xC5E3A3A9, 0x8DF37F8B,
+    0xC71631C7, 0x8D59512A,
+    0xC84A58EB, 0x8CC25AC0,
+    0xC980106E, 0x8C2EA08D,
+    0xCAB74F9E, 0x8B9E26B4,
+    0xCBF00DBE, 0x8B10F144,
+    0xCD2A4207, 0x8A870434,
+    0xCE65E3A7, 0x8A006364,
+    0xCFA2E9C1, 0x897D129B,
+    0xD0E14B6F, 0x88FD1588,
+    0xD220FFC0, 0x88806FC4,
+    0xD361FDBC, 0x880724CE,
+    0xD4A43C5F, 0x8791380E,
+    0xD5E7B29E, 0x871EACD3,
+    0xD72C5763, 0x86AF8655,
+    0xD8722192, 0x8643C7B3,
+    0xD9B90805, 0x85DB73F2,
+    0xDB01018E, 0x85768E01,
+    0xDC4A04FA, 0x851518B5,
+    0xDD94090B, 0x84B716C9,
+    0xDEDF047D, 0x845C8AE3,
+    0xE02AEE06, 0x8405778C,
+    0xE177BC54, 0x83B1DF36,
+    0xE2C56610, 0x8361C43A,
+    0xE413E1DC, 0x831528D8,
+    0xE5632654, 0x82CC0F36,
+    0xE6B32A0E, 0x82867962,
+    0xE803E39B, 0x8244694F,
+    0xE9554988, 0x8205E0D9,
+    0xEAA7525B, 0x81CAE1C1,
+    0xEBF9F498, 0x81936DAF,
+    0xED4D26BD, 0x815F8632,
+    0xEEA0DF43, 0x812F2CBD,
+    0xEFF514A2, 0x810262AE,
+    0xF149BD4D, 0x80D92946,
+    0xF29ECFB2, 0x80B381AC,
+    0xF3F44240, 0x80916CF0,
+    0xF54A0B60, 0x8072EC07,
+    0xF6A02179, 0x8057FFCC,
+    0xF7F67AF2, 0x8040A900,
+    0xF94D0E2E, 0x802CE84C,
+    0xFAA3D18E, 0x801CBE3C,
+    0xFBFABB75, 0x80102B46,
+    0xFD51C240, 0x80072FC3,
+    0xFEA8DC4F, 0x8001CBF4,
+    0x00000000, 0x80000000,
+    0x015723B1, 0x8001CBF4,
+    0x02AE3DC0, 0x80072FC3,
+    0x0405448B, 0x80102B46,
+    0x055C2E72, 0x801CBE3C,
+    0x06B2F1D2, 0x802CE84C,
+    0x0809850E, 0x8040A900,
+    0x095FDE87, 0x8057FFCC,
+    0x0AB5F4A0, 0x8072EC07,
+    0x0C0BBDC0, 0x80916CF0,
+    0x0D61304E, 0x80B381AC,
+    0x0EB642B3, 0x80D92946,
+    0x100AEB5E, 0x810262AE,
+    0x115F20BD, 0x812F2CBD,
+    0x12B2D943, 0x815F8632,
+    0x14060B68, 0x81936DAF,
+    0x1558ADA5, 0x81CAE1C1,
+    0x16AAB678, 0x8205E0D9,
+    0x17FC1C65, 0x8244694F,
+    0x194CD5F2, 0x82867962,
+    0x1A9CD9AC, 0x82CC0F36,
+    0x1BEC1E24, 0x831528D8,
+    0x1D3A99F0, 0x8361C43A,
+    0x1E8843AC, 0x83B1DF36,
+    0x1FD511FA, 0x8405778C,
+    0x2120FB83, 0x845C8AE3,
+    0x226BF6F5, 0x84B716C9,
+    0x23B5FB06, 0x851518B5,
+    0x24FEFE72, 0x85768E01,
+    0x2646F7FB, 0x85DB73F2,
+    0x278DDE6E, 0x8643C7B3,
+    0x28D3A89D, 0x86AF8655,
+    0x2A184D62, 0x871EACD3,
+    0x2B5BC3A1, 0x8791380E,
+    0x2C9E0244, 0x880724CE,
+    0x2DDF0040, 0x88806FC4,
+    0x2F1EB491, 0x88FD1588,
+    0x305D163F, 0x897D129B,
+    0x319A1C59, 0x8A006364,
+    0x32D5BDF9, 0x8A870434,
+    0x340FF242, 0x8B10F144,
+    0x3548B062, 0x8B9E26B4,
+    0x367FEF92, 0x8C2EA08D,
+    0x37B5A715, 0x8CC25AC0,
+    0x38E9CE39, 0x8D59512A,
+    0x3A1C5C57, 0x8DF37F8B,
+    0x3B4D48D4, 0x8E90E191,
+    0x3C7C8B20, 0x8F3172D0,
+    0x3DAA1AB9, 0x8FD52EC6,
+    0x3ED5EF28, 0x907C10DB,
+    0x40000000, 0x9126145F,
+    0x412844E4, 0x91D3348C,
+    0x424EB584, 0x92836C86,
+    0x4373499A, 0x9336B75B,
+    0x4495F8F0, 0x93ED1002,
+    0x45B6BB5E, 0x94A6715D,
+    0x46D588C7, 0x9562D638,
+    0x47F2591F, 0x96223947,
+    0x490D2466, 0x96E4952D,
+    0x4A25E2AD, 0x97A9E474,
+    0x4B3C8C12, 0x98722192,
+    0x4C5118C2, 0x993D46E8,
+    0x4D6380F9, 0x9A0B4EC2,
+    0x4E73BD03, 0x9ADC3358,
+    0x4F81C53D, 0x9BAFEECB,
+    0x508D9211, 0x9C867B2C,
+    0x51971BFB, 0x9D5FD273,
+    0x529E5B86, 0x9E3BEE86,
+    0x53A3494E, 0x9F1AC938,
+    0x54A5DE01, 0x9FFC5C48,
+    0x55A6125C, 0xA0E0A15F,
+    0x56A3DF2D, 0xA1C79216,
+    0x579F3D54, 0xA2B127F1,
+    0x589825C4, 0xA39D5C60,
+    0x598E917F, 0xA48C28C4,
+    0x5A82799A, 0xA57D8666,
+    0x5B73D73C, 0xA6716E81,
+    0x5C62A3A0, 0xA767DA3C,
+    0x5D4ED80F, 0xA860C2AC,
+    0x5E386DEA, 0xA95C20D3,
+    0x5F1F5EA1, 0xAA59EDA4,
+    0x6003A3B8, 0xAB5A21FF,
+    0x60E536C8, 0xAC5CB6B2,
+    0x61C4117A, 0xAD61A47A,
+    0x62A02D8D, 0xAE68E405,
+    0x637984D4, 0xAF726DEF,
+    0x64501135, 0xB07E3AC3,
+    0x6523CCA8, 0xB18C42FD,
+    0x65F4B13E, 0xB29C7F07,
+    0x66C2B918, 0xB3AEE73E,
+    0x678DDE6E, 0xB4C373EE,
+    0x68561B8C, 0xB5DA1D53,
+    0x691B6AD3, 0xB6F2DB9A,
+    0x69DDC6B9, 0xB80DA6E1,
+    0x6A9D29C8, 0xB92A7739,
+    0x6B598EA3, 0xBA4944A2,
+    0x6C12EFFE, 0xBB6A0710,
+    0x6CC948A5, 0xBC8CB666,
+    0x6D7C937A, 0xBDB14A7C,
+    0x6E2CCB74, 0xBED7BB1C,
+    0x6ED9EBA1, 0xC0000000,
+    0x6F83EF25, 0xC12A10D8,
+    0x702AD13A, 0xC255E547,
+    0x70CE8D30, 0xC38374E0,
+    0x716F1E6F, 0xC4B2B72C,
+    0x720C8075, 0xC5E3A3A9,
+    0x72A6AED6, 0xC71631C7,
+    0x733DA540, 0xC84A58EB,
+    0x73D15F73, 0xC980106E,
+    0x7461D94C, 0xCAB74F9E,
+    0x74EF0EBC, 0xCBF00DBE,
+    0x7578FBCC, 0xCD2A4207,
+    0x75FF9C9C, 0xCE65E3A7,
+    0x7682ED65, 0xCFA2E9C1,
+    0x7702EA78, 0xD0E14B6F,
+    0x777F903C, 0xD220FFC0,
+    0x77F8DB32, 0xD361FDBC,
+    0x786EC7F2, 0xD4A43C5F,
+    0x78E1532D, 0xD5E7B29E,
+    0x795079AB, 0xD72C5763,
+    0x79BC384D, 0xD8722192,
+    0x7A248C0E, 0xD9B90805,
+    0x7A8971FF, 0xDB01018E,
+    0x7AEAE74B, 0xDC4A04FA,
+    0x7B48E937, 0xDD94090B,
+    0x7BA3751D, 0xDEDF047D,
+    0x7BFA8874, 0xE02AEE06,
+    0x7C4E20CA, 0xE177BC54,
+    0x7C9E3BC6, 0xE2C56610,
+    0x7CEAD728, 0xE413E1DC,
+    0x7D33F0CA, 0xE5632654,
+    0x7D79869E, 0xE6B32A0E,
+    0x7DBB96B1, 0xE803E39B,
+    0x7DFA1F27, 0xE9554988,
+    0x7E351E3F, 0xEAA7525B,
+    0x7E6C9251, 0xEBF9F498,
+    0x7EA079CE, 0xED4D26BD,
+    0x7ED0D343, 0xEEA0DF43,
+    0x7EFD9D52, 0xEFF514A2,
+    0x7F26D6BA, 0xF149BD4D,
+    0x7F4C7E54, 0xF29ECFB2,
+    0x7F6E9310, 0xF3F44240,
+    0x7F8D13F9, 0xF54A0B60,
+    0x7FA80034, 0xF6A02179,
+    0x7FBF5700, 0xF7F67AF2,
+    0x7FD317B4, 0xF94D0E2E,
+    0x7FE341C4, 0xFAA3D18E,
+    0x7FEFD4BA, 0xFBFABB75,
+    0x7FF8D03D, 0xFD51C240,
+    0x7FFE340C, 0xFEA8DC4F
+};
+
+
+/**
+* \par
+* Example code for Q31 mixed-radix Twiddle factors Generation:
+* \par
+* <pre>for(i = 0; i< N; i++)
+* {
+*    twiddleCoefMixedQ31[2*i]= cos(i * 2*PI/(float)N);
+*    twiddleCoefMixedQ31[2*i+1]= sin(i * 2*PI/(float)N);
+* } </pre>
+* \par
+* where N = 960	and PI = 3.14159265358979
+* \par
+* Convert Floating point to Q31(Fixed point 1.31):
+*	round(twiddleCoefMixedQ31(i) * pow(2, 31))
+*/
+const q31_t twiddleCoefMixed_960_q31[1920] = {
+    0x7FFFFFFF, 0x00000000,
+    0x7FFF4C54, 0x00D676EB,
+    0x7FFD3154, 0x01ACEB7C,
+    0x7FF9AF04, 0x02835B5A,
+    0x7FF4C56F, 0x0359C428,
+    0x7FEE74A2, 0x0430238F,
+    0x7FE6BCB0, 0x05067734,
+    0x7FDD9DAD, 0x05DCBCBE,
+    0x7FD317B4, 0x06B2F1D2,
+    0x7FC72AE2, 0x07891418,
+    0x7FB9D759, 0x085F2137,
+    0x7FAB1D3D, 0x093516D4,
+    0x7F9AFCB9, 0x0A0AF299,
+    0x7F8975F9, 0x0AE0B22C,
+    0x7F76892F, 0x0BB65336,
+    0x7F62368F, 0x0C8BD35E,
+    0x7F4C7E54, 0x0D61304E,
+    0x7F3560B9, 0x0E3667AD,
+    0x7F1CDE01, 0x0F0B7727,
+    0x7F02F66F, 0x0FE05C64,
+    0x7EE7AA4C, 0x10B5150F,
+    0x7ECAF9E5, 0x11899ED3,
+    0x7EACE58A, 0x125DF75B,
+    0x7E8D6D91, 0x13321C53,
+    0x7E6C9251, 0x14060B68,
+    0x7E4A5426, 0x14D9C245,
+    0x7E26B371, 0x15AD3E9A,
+    0x7E01B096, 0x16807E15,
+    0x7DDB4BFC, 0x17537E63,
+    0x7DB3860F, 0x18263D36,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7D5FD801, 0x19CAED29,
+    0x7D33F0CA, 0x1A9CD9AC,
+    0x7D06AA16, 0x1B6E7B7A,
+    0x7CD80464, 0x1C3FD045,
+    0x7CA80038, 0x1D10D5C2,
+    0x7C769E18, 0x1DE189A6,
+    0x7C43DE8E, 0x1EB1E9A7,
+    0x7C0FC22A, 0x1F81F37C,
+    0x7BDA497D, 0x2051A4DD,
+    0x7BA3751D, 0x2120FB83,
+    0x7B6B45A5, 0x21EFF528,
+    0x7B31BBB2, 0x22BE8F87,
+    0x7AF6D7E6, 0x238CC85D,
+    0x7ABA9AE6, 0x245A9D65,
+    0x7A7D055B, 0x25280C5E,
+    0x7A3E17F2, 0x25F51307,
+    0x79FDD35C, 0x26C1AF22,
+    0x79BC384D, 0x278DDE6E,
+    0x7979477D, 0x28599EB0,
+    0x793501A9, 0x2924EDAC,
+    0x78EF678F, 0x29EFC925,
+    0x78A879F4, 0x2ABA2EE4,
+    0x7860399E, 0x2B841CAF,
+    0x7816A759, 0x2C4D9050,
+    0x77CBC3F2, 0x2D168792,
+    0x777F903C, 0x2DDF0040,
+    0x77320D0D, 0x2EA6F827,
+    0x76E33B3F, 0x2F6E6D16,
+    0x76931BAE, 0x30355CDD,
+    0x7641AF3D, 0x30FBC54D,
+    0x75EEF6CE, 0x31C1A43B,
+    0x759AF34C, 0x3286F779,
+    0x7545A5A0, 0x334BBCDE,
+    0x74EF0EBC, 0x340FF242,
+    0x74972F92, 0x34D3957E,
+    0x743E0918, 0x3596A46C,
+    0x73E39C49, 0x36591CEA,
+    0x7387EA23, 0x371AFCD5,
+    0x732AF3A7, 0x37DC420C,
+    0x72CCB9DB, 0x389CEA72,
+    0x726D3DC6, 0x395CF3E9,
+    0x720C8075, 0x3A1C5C57,
+    0x71AA82F7, 0x3ADB21A1,
+    0x71474660, 0x3B9941B1,
+    0x70E2CBC6, 0x3C56BA70,
+    0x707D1443, 0x3D1389CB,
+    0x701620F5, 0x3DCFADB0,
+    0x6FADF2FC, 0x3E8B240E,
+    0x6F448B7E, 0x3F45EAD8,
+    0x6ED9EBA1, 0x40000000,
+    0x6E6E1492, 0x40B9617D,
+    0x6E010780, 0x41720D46,
+    0x6D92C59B, 0x422A0154,
+    0x6D23501B, 0x42E13BA4,
+    0x6CB2A837, 0x4397BA32,
+    0x6C40CF2C, 0x444D7AFF,
+    0x6BCDC639, 0x45027C0C,
+    0x6B598EA3, 0x45B6BB5E,
+    0x6AE429AE, 0x466A36F9,
+    0x6A6D98A4, 0x471CECE7,
+    0x69F5DCD3, 0x47CEDB31,
+    0x697CF78A, 0x487FFFE4,
+    0x6902EA1D, 0x4930590F,
+    0x6887B5E2, 0x49DFE4C2,
+    0x680B5C33, 0x4A8EA111,
+    0x678DDE6E, 0x4B3C8C12,
+    0x670F3DF3, 0x4BE9A3DB,
+    0x668F7C25, 0x4C95E688,
+    0x660E9A6A, 0x4D415234,
+    0x658C9A2D, 0x4DEBE4FE,
+    0x65097CDB, 0x4E959D08,
+    0x648543E4, 0x4F3E7875,
+    0x63FFF0BA, 0x4FE6756A,
+    0x637984D4, 0x508D9211,
+    0x62F201AC, 0x5133CC94,
+    0x626968BE, 0x51D92321,
+    0x61DFBB8A, 0x527D93E6,
+    0x6154FB91, 0x53211D18,
+    0x60C92A5A, 0x53C3BCEA,
+    0x603C496C, 0x54657194,
+    0x5FAE5A55, 0x55063951,
+    0x5F1F5EA1, 0x55A6125C,
+    0x5E8F57E2, 0x5644FAF4,
+    0x5DFE47AD, 0x56E2F15D,
+    0x5D6C2F99, 0x577FF3DA,
+    0x5CD91140, 0x581C00B3,
+    0x5C44EE40, 0x58B71632,
+    0x5BAFC837, 0x595132A2,
+    0x5B19A0C8, 0x59EA5454,
+    0x5A82799A, 0x5A82799A,
+    0x59EA5454, 0x5B19A0C8,
+    0x595132A2, 0x5BAFC837,
+    0x58B71632, 0x5C44EE40,
+    0x581C00B3, 0x5CD91140,
+    0x577FF3DA, 0x5D6C2F99,
+    0x56E2F15D, 0x5DFE47AD,
+    0x5644FAF4, 0x5E8F57E2,
+    0x55A6125C, 0x5F1F5EA1,
+    0x55063951, 0x5FAE5A55,
+    0x54657194, 0x603C496C,
+    0x53C3BCEA, 0x60C92A5A,
+    0x53211D18, 0x6154FB91,
+    0x527D93E6, 0x61DFBB8A,
+    0x51D92321, 0x626968BE,
+    0x5133CC94, 0x62F201AC,
+    0x508D9211, 0x637984D4,
+    0x4FE6756A, 0x63FFF0BA,
+    0x4F3E7875, 0x648543E4,
+    0x4E959D08, 0x65097CDB,
+    0x4DEBE4FE, 0x658C9A2D,
+    0x4D415234, 0x660E9A6A,
+    0x4C95E688, 0x668F7C25,
+    0x4BE9A3DB, 0x670F3DF3,
+    0x4B3C8C12, 0x678DDE6E,
+    0x4A8EA111, 0x680B5C33,
+    0x49DFE4C2, 0x6887B5E2,
+    0x4930590F, 0x6902EA1D,
+    0x487FFFE4, 0x697CF78A,
+    0x47CEDB31, 0x69F5DCD3,
+    0x471CECE7, 0x6A6D98A4,
+    0x466A36F9, 0x6AE429AE,
+    0x45B6BB5E, 0x6B598EA3,
+    0x45027C0C, 0x6BCDC639,
+    0x444D7AFF, 0x6C40CF2C,
+    0x4397BA32, 0x6CB2A837,
+    0x42E13BA4, 0x6D23501B,
+    0x422A0154, 0x6D92C59B,
+    0x41720D46, 0x6E010780,
+    0x40B9617D, 0x6E6E1492,
+    0x40000000, 0x6ED9EBA1,
+    0x3F45EAD8, 0x6F448B7E,
+    0x3E8B240E, 0x6FADF2FC,
+    0x3DCFADB0, 0x701620F5,
+    0x3D1389CB, 0x707D1443,
+    0x3C56BA70, 0x70E2CBC6,
+    0x3B9941B1, 0x71474660,
+    0x3ADB21A1, 0x71AA82F7,
+    0x3A1C5C57, 0x720C8075,
+    0x395CF3E9, 0x726D3DC6,
+    0x389CEA72, 0x72CCB9DB,
+    0x37DC420C, 0x732AF3A7,
+    0x371AFCD5, 0x7387EA23,
+    0x36591CEA, 0x73E39C49,
+    0x3596A46C, 0x743E0918,
+    0x34D3957E, 0x74972F92,
+    0x340FF242, 0x74EF0EBC,
+    0x334BBCDE, 0x7545A5A0,
+    0x3286F779, 0x759AF34C,
+    0x31C1A43B, 0x75EEF6CE,
+    0x30FBC54D, 0x7641AF3D,
+    0x30355CDD, 0x76931BAE,
+    0x2F6E6D16, 0x76E33B3F,
+    0x2EA6F827, 0x77320D0D,
+    0x2DDF0040, 0x777F903C,
+    0x2D168792, 0x77CBC3F2,
+    0x2C4D9050, 0x7816A759,
+    0x2B841CAF, 0x7860399E,
+    0x2ABA2EE4, 0x78A879F4,
+    0x29EFC925, 0x78EF678F,
+    0x2924EDAC, 0x793501A9,
+    0x28599EB0, 0x7979477D,
+    0x278DDE6E, 0x79BC384D,
+    0x26C1AF22, 0x79FDD35C,
+    0x25F51307, 0x7A3E17F2,
+    0x25280C5E, 0x7A7D055B,
+    0x245A9D65, 0x7ABA9AE6,
+    0x238CC85D, 0x7AF6D7E6,
+    0x22BE8F87, 0x7B31BBB2,
+    0x21EFF528, 0x7B6B45A5,
+    0x2120FB83, 0x7BA3751D,
+    0x2051A4DD, 0x7BDA497D,
+    0x1F81F37C, 0x7C0FC22A,
+    0x1EB1E9A7, 0x7C43DE8E,
+    0x1DE189A6, 0x7C769E18,
+    0x1D10D5C2, 0x7CA80038,
+    0x1C3FD045, 0x7CD80464,
+    0x1B6E7B7A, 0x7D06AA16,
+    0x1A9CD9AC, 0x7D33F0CA,
+    0x19CAED29, 0x7D5FD801,
+    0x18F8B83C, 0x7D8A5F40,
+    0x18263D36, 0x7DB3860F,
+    0x17537E63, 0x7DDB4BFC,
+    0x16807E15, 0x7E01B096,
+    0x15AD3E9A, 0x7E26B371,
+    0x14D9C245, 0x7E4A5426,
+    0x14060B68, 0x7E6C9251,
+    0x13321C53, 0x7E8D6D91,
+    0x125DF75B, 0x7EACE58A,
+    0x11899ED3, 0x7ECAF9E5,
+    0x10B5150F, 0x7EE7AA4C,
+    0x0FE05C64, 0x7F02F66F,
+    0x0F0B7727, 0x7F1CDE01,
+    0x0E3667AD, 0x7F3560B9,
+    0x0D61304E, 0x7F4C7E54,
+    0x0C8BD35E, 0x7F62368F,
+    0x0BB65336, 0x7F76892F,
+    0x0AE0B22C, 0x7F8975F9,
+    0x0A0AF299, 0x7F9AFCB9,
+    0x093516D4, 0x7FAB1D3D,
+    0x085F2137, 0x7FB9D759,
+    0x07891418, 0x7FC72AE2,
+    0x06B2F1D2, 0x7FD317B4,
+    0x05DCBCBE, 0x7FDD9DAD,
+    0x05067734, 0x7FE6BCB0,
+    0x0430238F, 0x7FEE74A2,
+    0x0359C428, 0x7FF4C56F,
+    0x02835B5A, 0x7FF9AF04,
+    0x01ACEB7C, 0x7FFD3154,
+    0x00D676EB, 0x7FFF4C54,
+    0x00000000, 0x7FFFFFFF,
+    0xFF298915, 0x7FFF4C54,
+    0xFE531484, 0x7FFD3154,
+    0xFD7CA4A6, 0x7FF9AF04,
+    0xFCA63BD8, 0x7FF4C56F,
+    0xFBCFDC71, 0x7FEE74A2,
+    0xFAF988CC, 0x7FE6BCB0,
+    0xFA234342, 0x7FDD9DAD,
+    0xF94D0E2E, 0x7FD317B4,
+    0xF876EBE8, 0x7FC72AE2,
+    0xF7A0DEC9, 0x7FB9D759,
+    0xF6CAE92C, 0x7FAB1D3D,
+    0xF5F50D67, 0x7F9AFCB9,
+    0xF51F4DD4, 0x7F8975F9,
+    0xF449ACCA, 0x7F76892F,
+    0xF3742CA2, 0x7F62368F,
+    0xF29ECFB2, 0x7F4C7E54,
+    0xF1C99853, 0x7F3560B9,
+    0xF0F488D9, 0x7F1CDE01,
+    0xF01FA39C, 0x7F02F66F,
+    0xEF4AEAF1, 0x7EE7AA4C,
+    0xEE76612D, 0x7ECAF9E5,
+    0xEDA208A5, 0x7EACE58A,
+    0xECCDE3AD, 0x7E8D6D91,
+    0xEBF9F498, 0x7E6C9251,
+    0xEB263DBB, 0x7E4A5426,
+    0xEA52C166, 0x7E26B371,
+    0xE97F81EB, 0x7E01B096,
+    0xE8AC819D, 0x7DDB4BFC,
+    0xE7D9C2CA, 0x7DB3860F,
+    0xE70747C4, 0x7D8A5F40,
+    0xE63512D7, 0x7D5FD801,
+    0xE5632654, 0x7D33F0CA,
+    0xE4918486, 0x7D06AA16,
+    0xE3C02FBB, 0x7CD80464,
+    0xE2EF2A3E, 0x7CA80038,
+    0xE21E765A, 0x7C769E18,
+    0xE14E1659, 0x7C43DE8E,
+    0xE07E0C84, 0x7C0FC22A,
+    0xDFAE5B23, 0x7BDA497D,
+    0xDEDF047D, 0x7BA3751D,
+    0xDE100AD8, 0x7B6B45A5,
+    0xDD417079, 0x7B31BBB2,
+    0xDC7337A3, 0x7AF6D7E6,
+    0xDBA5629B, 0x7ABA9AE6,
+    0xDAD7F3A2, 0x7A7D055B,
+    0xDA0AECF9, 0x7A3E17F2,
+    0xD93E50DE, 0x79FDD35C,
+    0xD8722192, 0x79BC384D,
+    0xD7A66150, 0x7979477D,
+    0xD6DB1254, 0x793501A9,
+    0xD61036DB, 0x78EF678F,
+    0xD545D11C, 0x78A879F4,
+    0xD47BE351, 0x7860399E,
+    0xD3B26FB0, 0x7816A759,
+    0xD2E9786E, 0x77CBC3F2,
+    0xD220FFC0, 0x777F903C,
+    0xD15907D9, 0x77320D0D,
+    0xD09192EA, 0x76E33B3F,
+    0xCFCAA323, 0x76931BAE,
+    0xCF043AB3, 0x7641AF3D,
+    0xCE3E5BC5, 0x75EEF6CE,
+    0xCD790887, 0x759AF34C,
+    0xCCB44322, 0x7545A5A0,
+    0xCBF00DBE, 0x74EF0EBC,
+    0xCB2C6A82, 0x74972F92,
+    0xCA695B94, 0x743E0918,
+    0xC9A6E316, 0x73E39C49,
+    0xC8E5032B, 0x7387EA23,
+    0xC823BDF4, 0x732AF3A7,
+    0xC763158E, 0x72CCB9DB,
+    0xC6A30C17, 0x726D3DC6,
+    0xC5E3A3A9, 0x720C8075,
+    0xC524DE5F, 0x71AA82F7,
+    0xC466BE4F, 0x71474660,
+    0xC3A94590, 0x70E2CBC6,
+    0xC2EC7635, 0x707D1443,
+    0xC2305250, 0x701620F5,
+    0xC174DBF2, 0x6FADF2FC,
+    0xC0BA1528, 0x6F448B7E,
+    0xC0000000, 0x6ED9EBA1,
+    0xBF469E83, 0x6E6E1492,
+    0xBE8DF2BA, 0x6E010780,
+    0xBDD5FEAC, 0x6D92C59B,
+    0xBD1EC45C, 0x6D23501B,
+    0xBC6845CE, 0x6CB2A837,
+    0xBBB28501, 0x6C40CF2C,
+    0xBAFD83F4, 0x6BCDC639,
+    0xBA4944A2, 0x6B598EA3,
+    0xB995C907, 0x6AE429AE,
+    0xB8E31319, 0x6A6D98A4,
+    0xB83124CF, 0x69F5DCD3,
+    0xB780001C, 0x697CF78A,
+    0xB6CFA6F1, 0x6902EA1D,
+    0xB6201B3E, 0x6887B5E2,
+    0xB5715EEF, 0x680B5C33,
+    0xB4C373EE, 0x678DDE6E,
+    0xB4165C25, 0x670F3DF3,
+    0xB36A1978, 0x668F7C25,
+    0xB2BEADCC, 0x660E9A6A,
+    0xB2141B02, 0x658C9A2D,
+    0xB16A62F8, 0x65097CDB,
+    0xB0C1878B, 0x648543E4,
+    0xB0198A96, 0x63FFF0BA,
+    0xAF726DEF, 0x637984D4,
+    0xAECC336C, 0x62F201AC,
+    0xAE26DCDF, 0x626968BE,
+    0xAD826C1A, 0x61DFBB8A,
+    0xACDEE2E8, 0x6154FB91,
+    0xAC3C4316, 0x60C92A5A,
+    0xAB9A8E6C, 0x603C496C,
+    0xAAF9C6AF, 0x5FAE5A55,
+    0xAA59EDA4, 0x5F1F5EA1,
+    0xA9BB050C, 0x5E8F57E2,
+    0xA91D0EA3, 0x5DFE47AD,
+    0xA8800C26, 0x5D6C2F99,
+    0xA7E3FF4D, 0x5CD91140,
+    0xA748E9CE, 0x5C44EE40,
+    0xA6AECD5E, 0x5BAFC837,
+    0xA615ABAC, 0x5B19A0C8,
+    0xA57D8666, 0x5A82799A,
+    0xA4E65F38, 0x59EA5454,
+    0xA45037C9, 0x595132A2,
+    0xA3BB11C0, 0x58B71632,
+    0xA326EEC0, 0x581C00B3,
+    0xA293D067, 0x577FF3DA,
+    0xA201B853, 0x56E2F15D,
+    0xA170A81E, 0x5644FAF4,
+    0xA0E0A15F, 0x55A6125C,
+    0xA051A5AB, 0x55063951,
+    0x9FC3B694, 0x54657194,
+    0x9F36D5A6, 0x53C3BCEA,
+    0x9EAB046F, 0x53211D18,
+    0x9E204476, 0x527D93E6,
+    0x9D969742, 0x51D92321,
+    0x9D0DFE54, 0x5133CC94,
+    0x9C867B2C, 0x508D9211,
+    0x9C000F46, 0x4FE6756A,
+    0x9B7ABC1C, 0x4F3E7875,
+    0x9AF68325, 0x4E959D08,
+    0x9A7365D3, 0x4DEBE4FE,
+    0x99F16596, 0x4D415234,
+    0x997083DB, 0x4C95E688,
+    0x98F0C20D, 0x4BE9A3DB,
+    0x98722192, 0x4B3C8C12,
+    0x97F4A3CD, 0x4A8EA111,
+    0x97784A1E, 0x49DFE4C2,
+    0x96FD15E3, 0x4930590F,
+    0x96830876, 0x487FFFE4,
+    0x960A232D, 0x47CEDB31,
+    0x9592675C, 0x471CECE7,
+    0x951BD652, 0x466A36F9,
+    0x94A6715D, 0x45B6BB5E,
+    0x943239C7, 0x45027C0C,
+    0x93BF30D4, 0x444D7AFF,
+    0x934D57C9, 0x4397BA32,
+    0x92DCAFE5, 0x42E13BA4,
+    0x926D3A65, 0x422A0154,
+    0x91FEF880, 0x41720D46,
+    0x9191EB6E, 0x40B9617D,
+    0x9126145F, 0x40000000,
+    0x90BB7482, 0x3F45EAD8,
+    0x90520D04, 0x3E8B240E,
+    0x8FE9DF0B, 0x3DCFADB0,
+    0x8F82EBBD, 0x3D1389CB,
+    0x8F1D343A, 0x3C56BA70,
+    0x8EB8B9A0, 0x3B9941B1,
+    0x8E557D09, 0x3ADB21A1,
+    0x8DF37F8B, 0x3A1C5C57,
+    0x8D92C23A, 0x395CF3E9,
+    0x8D334625, 0x389CEA72,
+    0x8CD50C59, 0x37DC420C,
+    0x8C7815DD, 0x371AFCD5,
+    0x8C1C63B7, 0x36591CEA,
+    0x8BC1F6E8, 0x3596A46C,
+    0x8B68D06E, 0x34D3957E,
+    0x8B10F144, 0x340FF242,
+    0x8ABA5A60, 0x334BBCDE,
+    0x8A650CB4, 0x3286F779,
+    0x8A110932, 0x31C1A43B,
+    0x89BE50C3, 0x30FBC54D,
+    0x896CE452, 0x30355CDD,
+    0x891CC4C1, 0x2F6E6D16,
+    0x88CDF2F3, 0x2EA6F827,
+    0x88806FC4, 0x2DDF0040,
+    0x88343C0E, 0x2D168792,
+    0x87E958A7, 0x2C4D9050,
+    0x879FC662, 0x2B841CAF,
+    0x8757860C, 0x2ABA2EE4,
+    0x87109871, 0x29EFC925,
+    0x86CAFE57, 0x2924EDAC,
+    0x8686B883, 0x28599EB0,
+    0x8643C7B3, 0x278DDE6E,
+    0x86022CA4, 0x26C1AF22,
+    0x85C1E80E, 0x25F51307,
+    0x8582FAA5, 0x25280C5E,
+    0x8545651A, 0x245A9D65,
+    0x8509281A, 0x238CC85D,
+    0x84CE444E, 0x22BE8F87,
+    0x8494BA5B, 0x21EFF528,
+    0x845C8AE3, 0x2120FB83,
+    0x8425B683, 0x2051A4DD,
+    0x83F03DD6, 0x1F81F37C,
+    0x83BC2172, 0x1EB1E9A7,
+    0x838961E8, 0x1DE189A6,
+    0x8357FFC8, 0x1D10D5C2,
+    0x8327FB9C, 0x1C3FD045,
+    0x82F955EA, 0x1B6E7B7A,
+    0x82CC0F36, 0x1A9CD9AC,
+    0x82A027FF, 0x19CAED29,
+    0x8275A0C0, 0x18F8B83C,
+    0x824C79F1, 0x18263D36,
+    0x8224B404, 0x17537E63,
+    0x81FE4F6A, 0x16807E15,
+    0x81D94C8F, 0x15AD3E9A,
+    0x81B5ABDA, 0x14D9C245,
+    0x81936DAF, 0x14060B68,
+    0x8172926F, 0x13321C53,
+    0x81531A76, 0x125DF75B,
+    0x8135061B, 0x11899ED3,
+    0x811855B4, 0x10B5150F,
+    0x80FD0991, 0x0FE05C64,
+    0x80E321FF, 0x0F0B7727,
+    0x80CA9F47, 0x0E3667AD,
+    0x80B381AC, 0x0D61304E,
+    0x809DC971, 0x0C8BD35E,
+    0x808976D1, 0x0BB65336,
+    0x80768A07, 0x0AE0B22C,
+    0x80650347, 0x0A0AF299,
+    0x8054E2C3, 0x093516D4,
+    0x804628A7, 0x085F2137,
+    0x8038D51E, 0x07891418,
+    0x802CE84C, 0x06B2F1D2,
+    0x80226253, 0x05DCBCBE,
+    0x80194350, 0x05067734,
+    0x80118B5E, 0x0430238F,
+    0x800B3A91, 0x0359C428,
+    0x800650FC, 0x02835B5A,
+    0x8002CEAC, 0x01ACEB7C,
+    0x8000B3AC, 0x00D676EB,
+    0x80000000, 0x00000000,
+    0x8000B3AC, 0xFF298915,
+    0x8002CEAC, 0xFE531484,
+    0x800650FC, 0xFD7CA4A6,
+    0x800B3A91, 0xFCA63BD8,
+    0x80118B5E, 0xFBCFDC71,
+    0x80194350, 0xFAF988CC,
+    0x80226253, 0xFA234342,
+    0x802CE84C, 0xF94D0E2E,
+    0x8038D51E, 0xF876EBE8,
+    0x804628A7, 0xF7A0DEC9,
+    0x8054E2C3, 0xF6CAE92C,
+    0x80650347, 0xF5F50D67,
+    0x80768A07, 0xF51F4DD4,
+    0x808976D1, 0xF449ACCA,
+    0x809DC971, 0xF3742CA2,
+    0x80B381AC, 0xF29ECFB2,
+    0x80CA9F47, 0xF1C99853,
+    0x80E321FF, 0xF0F488D9,
+    0x80FD0991, 0xF01FA39C,
+    0x811855B4, 0xEF4AEAF1,
+    0x8135061B, 0xEE76612D,
+    0x81531A76, 0xEDA208A5,
+    0x8172926F, 0xECCDE3AD,
+    0x81936DAF, 0xEBF9F498,
+    0x81B5ABDA, 0xEB263DBB,
+    0x81D94C8F, 0xEA52C166,
+    0x81FE4F6A, 0xE97F81EB,
+    0x8224B404, 0xE8AC819D,
+    0x824C79F1, 0xE7D9C2CA,
+    0x8275A0C0, 0xE70747C4,
+    0x82A027FF, 0xE63512D7,
+    0x82CC0F36, 0xE5632654,
+    0x82F955EA, 0xE4918486,
+    0x8327FB9C, 0xE3C02FBB,
+    0x8357FFC8, 0xE2EF2A3E,
+    0x838961E8, 0xE21E765A,
+    0x83BC2172, 0xE14E1659,
+    0x83F03DD6, 0xE07E0C84,
+    0x8425B683, 0xDFAE5B23,
+    0x845C8AE3, 0xDEDF047D,
+    0x8494BA5B, 0xDE100AD8,
+    0x84CE444E, 0xDD417079,
+    0x8509281A, 0xDC7337A3,
+    0x8545651A, 0xDBA5629B,
+    0x8582FAA5, 0xDAD7F3A2,
+    0x85C1E80E, 0xDA0AECF9,
+    0x86022CA4, 0xD93E50DE,
+    0x8643C7B3, 0xD8722192,
+    0x8686B883, 0xD7A66150,
+    0x86CAFE57, 0xD6DB1254,
+    0x87109871, 0xD61036DB,
+    0x8757860C, 0xD545D11C,
+    0x879FC662, 0xD47BE351,
+    0x87E958A7, 0xD3B26FB0,
+    0x88343C0E, 0xD2E9786E,
+    0x88806FC4, 0xD220FFC0,
+    0x88CDF2F3, 0xD15907D9,
+    0x891CC4C1, 0xD09192EA,
+    0x896CE452, 0xCFCAA323,
+    0x89BE50C3, 0xCF043AB3,
+    0x8A110932, 0xCE3E5BC5,
+    0x8A650CB4, 0xCD790887,
+    0x8ABA5A60, 0xCCB44322,
+    0x8B10F144, 0xCBF00DBE,
+    0x8B68D06E, 0xCB2C6A82,
+    0x8BC1F6E8, 0xCA695B94,
+    0x8C1C63B7, 0xC9A6E316,
+    0x8C7815DD, 0xC8E5032B,
+    0x8CD50C59, 0xC823BDF4,
+    0x8D334625, 0xC763158E,
+    0x8D92C23A, 0xC6A30C17,
+    0x8DF37F8B, 0xC5E3A3A9,
+    0x8E557D09, 0xC524DE5F,
+    0x8EB8B9A0, 0xC466BE4F,
+    0x8F1D343A, 0xC3A94590,
+    0x8F82EBBD, 0xC2EC7635,
+    0x8FE9DF0B, 0xC2305250,
+    0x90520D04, 0xC174DBF2,
+    0x90BB7482, 0xC0BA1528,
+    0x9126145F, 0xC0000000,
+    0x9191EB6E, 0xBF469E83,
+    0x91FEF880, 0xBE8DF2BA,
+    0x926D3A65, 0xBDD5FEAC,
+    0x92DCAFE5, 0xBD1EC45C,
+    0x934D57C9, 0xBC6845CE,
+    0x93BF30D4, 0xBBB28501,
+    0x943239C7, 0xBAFD83F4,
+    0x94A6715D, 0xBA4944A2,
+    0x951BD652, 0xB995C907,
+    0x9592675C, 0xB8E31319,
+    0x960A232D, 0xB83124CF,
+    0x96830876, 0xB780001C,
+    0x96FD15E3, 0xB6CFA6F1,
+    0x97784A1E, 0xB6201B3E,
+    0x97F4A3CD, 0xB5715EEF,
+    0x98722192, 0xB4C373EE,
+    0x98F0C20D, 0xB4165C25,
+    0x997083DB, 0xB36A1978,
+    0x99F16596, 0xB2BEADCC,
+    0x9A7365D3, 0xB2141B02,
+    0x9AF68325, 0xB16A62F8,
+    0x9B7ABC1C, 0xB0C1878B,
+    0x9C000F46, 0xB0198A96,
+    0x9C867B2C, 0xAF726DEF,
+    0x9D0DFE54, 0xAECC336C,
+    0x9D969742, 0xAE26DCDF,
+    0x9E204476, 0xAD826C1A,
+    0x9EAB046F, 0xACDEE2E8,
+    0x9F36D5A6, 0xAC3C4316,
+    0x9FC3B694, 0xAB9A8E6C,
+    0xA051A5AB, 0xAAF9C6AF,
+    0xA0E0A15F, 0xAA59EDA4,
+    0xA170A81E, 0xA9BB050C,
+    0xA201B853, 0xA91D0EA3,
+    0xA293D067, 0xA8800C26,
+    0xA326EEC0, 0xA7E3FF4D,
+    0xA3BB11C0, 0xA748E9CE,
+    0xA45037C9, 0xA6AECD5E,
+    0xA4E65F38, 0xA615ABAC,
+    0xA57D8666, 0xA57D8666,
+    0xA615ABAC, 0xA4E65F38,
+    0xA6AECD5E, 0xA45037C9,
+    0xA748E9CE, 0xA3BB11C0,
+    0xA7E3FF4D, 0xA326EEC0,
+    0xA8800C26, 0xA293D067,
+    0xA91D0EA3, 0xA201B853,
+    0xA9BB050C, 0xA170A81E,
+    0xAA59EDA4, 0xA0E0A15F,
+    0xAAF9C6AF, 0xA051A5AB,
+    0xAB9A8E6C, 0x9FC3B694,
+    0xAC3C4316, 0x9F36D5A6,
+    0xACDEE2E8, 0x9EAB046F,
+    0xAD826C1A, 0x9E204476,
+    0xAE26DCDF, 0x9D969742,
+    0xAECC336C, 0x9D0DFE54,
+    0xAF726DEF, 0x9C867B2C,
+    0xB0198A96, 0x9C000F46,
+    0xB0C1878B, 0x9B7ABC1C,
+    0xB16A62F8, 0x9AF68325,
+    0xB2141B02, 0x9A7365D3,
+    0xB2BEADCC, 0x99F16596,
+    0xB36A1978, 0x997083DB,
+    0xB4165C25, 0x98F0C20D,
+    0xB4C373EE, 0x98722192,
+    0xB5715EEF, 0x97F4A3CD,
+    0xB6201B3E, 0x97784A1E,
+    0xB6CFA6F1, 0x96FD15E3,
+    0xB780001C, 0x96830876,
+    0xB83124CF, 0x960A232D,
+    0xB8E31319, 0x9592675C,
+    0xB995C907, 0x951BD652,
+    0xBA4944A2, 0x94A6715D,
+    0xBAFD83F4, 0x943239C7,
+    0xBBB28501, 0x93BF30D4,
+    0xBC6845CE, 0x934D57C9,
+    0xBD1EC45C, 0x92DCAFE5,
+    0xBDD5FEAC, 0x926D3A65,
+    0xBE8DF2BA, 0x91FEF880,
+    0xBF469E83, 0x9191EB6E,
+    0xC0000000, 0x9126145F,
+    0xC0BA1528, 0x90BB7482,
+    0xC174DBF2, 0x90520D04,
+    0xC2305250, 0x8FE9DF0B,
+    0xC2EC7635, 0x8F82EBBD,
+    0xC3A94590, 0x8F1D343A,
+    0xC466BE4F, 0x8EB8B9A0,
+    0xC524DE5F, 0x8E557D09,
+    0xC5E3A3A9, 0x8DF37F8B,
+    0xC6A30C17, 0x8D92C23A,
+    0xC763158E, 0x8D334625,
+    0xC823BDF4, 0x8CD50C59,
+    0xC8E5032B, 0x8C7815DD,
+    0xC9A6E316, 0x8C1C63B7,
+    0xCA695B94, 0x8BC1F6E8,
+    0xCB2C6A82, 0x8B68D06E,
+    0xCBF00DBE, 0x8B10F144,
+    0xCCB44322, 0x8ABA5A60,
+    0xCD790887, 0x8A650CB4,
+    0xCE3E5BC5, 0x8A110932,
+    0xCF043AB3, 0x89BE50C3,
+    0xCFCAA323, 0x896CE452,
+    0xD09192EA, 0x891CC4C1,
+    0xD15907D9, 0x88CDF2F3,
+    0xD220FFC0, 0x88806FC4,
+    0xD2E9786E, 0x88343C0E,
+    0xD3B26FB0, 0x87E958A7,
+    0xD47BE351, 0x879FC662,
+    0xD545D11C, 0x8757860C,
+    0xD61036DB, 0x87109871,
+    0xD6DB1254, 0x86CAFE57,
+    0xD7A66150, 0x8686B883,
+    0xD8722192, 0x8643C7B3,
+    0xD93E50DE, 0x86022CA4,
+    0xDA0AECF9, 0x85C1E80E,
+    0xDAD7F3A2, 0x8582FAA5,
+    0xDBA5629B, 0x8545651A,
+    0xDC7337A3, 0x8509281A,
+    0xDD417079, 0x84CE444E,
+    0xDE100AD8, 0x8494BA5B,
+    0xDEDF047D, 0x845C8AE3,
+    0xDFAE5B23, 0x8425B683,
+    0xE07E0C84, 0x83F03DD6,
+    0xE14E1659, 0x83BC2172,
+    0xE21E765A, 0x838961E8,
+    0xE2EF2A3E, 0x8357FFC8,
+    0xE3C02FBB, 0x8327FB9C,
+    0xE4918486, 0x82F955EA,
+    0xE5632654, 0x82CC0F36,
+    0xE63512D7, 0x82A027FF,
+    0xE70747C4, 0x8275A0C0,
+    0xE7D9C2CA, 0x824C79F1,
+    0xE8AC819D, 0x8224B404,
+    0xE97F81EB, 0x81FE4F6A,
+    0xEA52C166, 0x81D94C8F,
+    0xEB263DBB, 0x81B5ABDA,
+    0xEBF9F498, 0x81936DAF,
+    0xECCDE3AD, 0x8172926F,
+    0xEDA208A5, 0x81531A76,
+    0xEE76612D, 0x8135061B,
+    0xEF4AEAF1, 0x811855B4,
+    0xF01FA39C, 0x80FD0991,
+    0xF0F488D9, 0x80E321FF,
+    0xF1C99853, 0x80CA9F47,
+    0xF29ECFB2, 0x80B381AC,
+    0xF3742CA2, 0x809DC971,
+    0xF449ACCA, 0x808976D1,
+    0xF51F4DD4, 0x80768A07,
+    0xF5F50D67, 0x80650347,
+    0xF6CAE92C, 0x8054E2C3,
+    0xF7A0DEC9, 0x804628A7,
+    0xF876EBE8, 0x8038D51E,
+    0xF94D0E2E, 0x802CE84C,
+    0xFA234342, 0x80226253,
+    0xFAF988CC, 0x80194350,
+    0xFBCFDC71, 0x80118B5E,
+    0xFCA63BD8, 0x800B3A91,
+    0xFD7CA4A6, 0x800650FC,
+    0xFE531484, 0x8002CEAC,
+    0xFF298915, 0x8000B3AC,
+    0x00000000, 0x80000000,
+    0x00D676EB, 0x8000B3AC,
+    0x01ACEB7C, 0x8002CEAC,
+    0x02835B5A, 0x800650FC,
+    0x0359C428, 0x800B3A91,
+    0x0430238F, 0x80118B5E,
+    0x05067734, 0x80194350,
+    0x05DCBCBE, 0x80226253,
+    0x06B2F1D2, 0x802CE84C,
+    0x07891418, 0x8038D51E,
+    0x085F2137, 0x804628A7,
+    0x093516D4, 0x8054E2C3,
+    0x0A0AF299, 0x80650347,
+    0x0AE0B22C, 0x80768A07,
+    0x0BB65336, 0x808976D1,
+    0x0C8BD35E, 0x809DC971,
+    0x0D61304E, 0x80B381AC,
+    0x0E3667AD, 0x80CA9F47,
+    0x0F0B7727, 0x80E321FF,
+    0x0FE05C64, 0x80FD0991,
+    0x10B5150F, 0x811855B4,
+    0x11899ED3, 0x8135061B,
+    0x125DF75B, 0x81531A76,
+    0x13321C53, 0x8172926F,
+    0x14060B68, 0x81936DAF,
+    0x14D9C245, 0x81B5ABDA,
+    0x15AD3E9A, 0x81D94C8F,
+    0x16807E15, 0x81FE4F6A,
+    0x17537E63, 0x8224B404,
+    0x18263D36, 0x824C79F1,
+    0x18F8B83C, 0x8275A0C0,
+    0x19CAED29, 0x82A027FF,
+    0x1A9CD9AC, 0x82CC0F36,
+    0x1B6E7B7A, 0x82F955EA,
+    0x1C3FD045, 0x8327FB9C,
+    0x1D10D5C2, 0x8357FFC8,
+    0x1DE189A6, 0x838961E8,
+    0x1EB1E9A7, 0x83BC2172,
+    0x1F81F37C, 0x83F03DD6,
+    0x2051A4DD, 0x8425B683,
+    0x2120FB83, 0x845C8AE3,
+    0x21EFF528, 0x8494BA5B,
+    0x22BE8F87, 0x84CE444E,
+    0x238CC85D, 0x8509281A,
+    0x245A9D65, 0x8545651A,
+    0x25280C5E, 0x8582FAA5,
+    0x25F51307, 0x85C1E80E,
+    0x26C1AF22, 0x86022CA4,
+    0x278DDE6E, 0x8643C7B3,
+    0x28599EB0, 0x8686B883,
+    0x2924EDAC, 0x86CAFE57,
+    0x29EFC925, 0x87109871,
+    0x2ABA2EE4, 0x8757860C,
+    0x2B841CAF, 0x879FC662,
+    0x2C4D9050, 0x87E958A7,
+    0x2D168792, 0x88343C0E,
+    0x2DDF0040, 0x88806FC4,
+    0x2EA6F827, 0x88CDF2F3,
+    0x2F6E6D16, 0x891CC4C1,
+    0x30355CDD, 0x896CE452,
+    0x30FBC54D, 0x89BE50C3,
+    0x31C1A43B, 0x8A110932,
+    0x3286F779, 0x8A650CB4,
+    0x334BBCDE, 0x8ABA5A60,
+    0x340FF242, 0x8B10F144,
+    0x34D3957E, 0x8B68D06E,
+    0x3596A46C, 0x8BC1F6E8,
+    0x36591CEA, 0x8C1C63B7,
+    0x371AFCD5, 0x8C7815DD,
+    0x37DC420C, 0x8CD50C59,
+    0x389CEA72, 0x8D334625,
+    0x395CF3E9, 0x8D92C23A,
+    0x3A1C5C57, 0x8DF37F8B,
+    0x3ADB21A1, 0x8E557D09,
+    0x3B9941B1, 0x8EB8B9A0,
+    0x3C56BA70, 0x8F1D343A,
+    0x3D1389CB, 0x8F82EBBD,
+    0x3DCFADB0, 0x8FE9DF0B,
+    0x3E8B240E, 0x90520D04,
+    0x3F45EAD8, 0x90BB7482,
+    0x40000000, 0x9126145F,
+    0x40B9617D, 0x9191EB6E,
+    0x41720D46, 0x91FEF880,
+    0x422A0154, 0x926D3A65,
+    0x42E13BA4, 0x92DCAFE5,
+    0x4397BA32, 0x934D57C9,
+    0x444D7AFF, 0x93BF30D4,
+    0x45027C0C, 0x943239C7,
+    0x45B6BB5E, 0x94A6715D,
+    0x466A36F9, 0x951BD652,
+    0x471CECE7, 0x9592675C,
+    0x47CEDB31, 0x960A232D,
+    0x487FFFE4, 0x96830876,
+    0x4930590F, 0x96FD15E3,
+    0x49DFE4C2, 0x97784A1E,
+    0x4A8EA111, 0x97F4A3CD,
+    0x4B3C8C12, 0x98722192,
+    0x4BE9A3DB, 0x98F0C20D,
+    0x4C95E688, 0x997083DB,
+    0x4D415234, 0x99F16596,
+    0x4DEBE4FE, 0x9A7365D3,
+    0x4E959D08, 0x9AF68325,
+    0x4F3E7875, 0x9B7ABC1C,
+    0x4FE6756A, 0x9C000F46,
+    0x508D9211, 0x9C867B2C,
+    0x5133CC94, 0x9D0DFE54,
+    0x51D92321, 0x9D969742,
+    0x527D93E6, 0x9E204476,
+    0x53211D18, 0x9EAB046F,
+    0x53C3BCEA, 0x9F36D5A6,
+    0x54657194, 0x9FC3B694,
+    0x55063951, 0xA051A5AB,
+    0x55A6125C, 0xA0E0A15F,
+    0x5644FAF4, 0xA170A81E,
+    0x56E2F15D, 0xA201B853,
+    0x577FF3DA, 0xA293D067,
+    0x581C00B3, 0xA326EEC0,
+    0x58B71632, 0xA3BB11C0,
+    0x595132A2, 0xA45037C9,
+    0x59EA5454, 0xA4E65F38,
+    0x5A82799A, 0xA57D8666,
+    0x5B19A0C8, 0xA615ABAC,
+    0x5BAFC837, 0xA6AECD5E,
+    0x5C44EE40, 0xA748E9CE,
+    0x5CD91140, 0xA7E3FF4D,
+    0x5D6C2F99, 0xA8800C26,
+    0x5DFE47AD, 0xA91D0EA3,
+    0x5E8F57E2, 0xA9BB050C,
+    0x5F1F5EA1, 0xAA59EDA4,
+    0x5FAE5A55, 0xAAF9C6AF,
+    0x603C496C, 0xAB9A8E6C,
+    0x60C92A5A, 0xAC3C4316,
+    0x6154FB91, 0xACDEE2E8,
+    0x61DFBB8A, 0xAD826C1A,
+    0x626968BE, 0xAE26DCDF,
+    0x62F201AC, 0xAECC336C,
+    0x637984D4, 0xAF726DEF,
+    0x63FFF0BA, 0xB0198A96,
+    0x648543E4, 0xB0C1878B,
+    0x65097CDB, 0xB16A62F8,
+    0x658C9A2D, 0xB2141B02,
+    0x660E9A6A, 0xB2BEADCC,
+    0x668F7C25, 0xB36A1978,
+    0x670F3DF3, 0xB4165C25,
+    0x678DDE6E, 0xB4C373EE,
+    0x680B5C33, 0xB5715EEF,
+    0x6887B5E2, 0xB6201B3E,
+    0x6902EA1D, 0xB6CFA6F1,
+    0x697CF78A, 0xB780001C,
+    0x69F5DCD3, 0xB83124CF,
+    0x6A6D98A4, 0xB8E31319,
+    0x6AE429AE, 0xB995C907,
+    0x6B598EA3, 0xBA4944A2,
+    0x6BCDC639, 0xBAFD83F4,
+    0x6C40CF2C, 0xBBB28501,
+    0x6CB2A837, 0xBC6845CE,
+    0x6D23501B, 0xBD1EC45C,
+    0x6D92C59B, 0xBDD5FEAC,
+    0x6E010780, 0xBE8DF2BA,
+    0x6E6E1492, 0xBF469E83,
+    0x6ED9EBA1, 0xC0000000,
+    0x6F448B7E, 0xC0BA1528,
+    0x6FADF2FC, 0xC174DBF2,
+    0x701620F5, 0xC2305250,
+    0x707D1443, 0xC2EC7635,
+    0x70E2CBC6, 0xC3A94590,
+    0x71474660, 0xC466BE4F,
+    0x71AA82F7, 0xC524DE5F,
+    0x720C8075, 0xC5E3A3A9,
+    0x726D3DC6, 0xC6A30C17,
+    0x72CCB9DB, 0xC763158E,
+    0x732AF3A7, 0xC823BDF4,
+    0x7387EA23, 0xC8E5032B,
+    0x73E39C49, 0xC9A6E316,
+    0x743E0918, 0xCA695B94,
+    0x74972F92, 0xCB2C6A82,
+    0x74EF0EBC, 0xCBF00DBE,
+    0x7545A5A0, 0xCCB44322,
+    0x759AF34C, 0xCD790887,
+    0x75EEF6CE, 0xCE3E5BC5,
+    0x7641AF3D, 0xCF043AB3,
+    0x76931BAE, 0xCFCAA323,
+    0x76E33B3F, 0xD09192EA,
+    0x77320D0D, 0xD15907D9,
+    0x777F903C, 0xD220FFC0,
+    0x77CBC3F2, 0xD2E9786E,
+    0x7816A759, 0xD3B26FB0,
+    0x7860399E, 0xD47BE351,
+    0x78A879F4, 0xD545D11C,
+    0x78EF678F, 0xD61036DB,
+    0x793501A9, 0xD6DB1254,
+    0x7979477D, 0xD7A66150,
+    0x79BC384D, 0xD8722192,
+    0x79FDD35C, 0xD93E50DE,
+    0x7A3E17F2, 0xDA0AECF9,
+    0x7A7D055B, 0xDAD7F3A2,
+    0x7ABA9AE6, 0xDBA5629B,
+    0x7AF6D7E6, 0xDC7337A3,
+    0x7B31BBB2, 0xDD417079,
+    0x7B6B45A5, 0xDE100AD8,
+    0x7BA3751D, 0xDEDF047D,
+    0x7BDA497D, 0xDFAE5B23,
+    0x7C0FC22A, 0xE07E0C84,
+    0x7C43DE8E, 0xE14E1659,
+    0x7C769E18, 0xE21E765A,
+    0x7CA80038, 0xE2EF2A3E,
+    0x7CD80464, 0xE3C02FBB,
+    0x7D06AA16, 0xE4918486,
+    0x7D33F0CA, 0xE5632654,
+    0x7D5FD801, 0xE63512D7,
+    0x7D8A5F40, 0xE70747C4,
+    0x7DB3860F, 0xE7D9C2CA,
+    0x7DDB4BFC, 0xE8AC819D,
+    0x7E01B096, 0xE97F81EB,
+    0x7E26B371, 0xEA52C166,
+    0x7E4A5426, 0xEB263DBB,
+    0x7E6C9251, 0xEBF9F498,
+    0x7E8D6D91, 0xECCDE3AD,
+    0x7EACE58A, 0xEDA208A5,
+    0x7ECAF9E5, 0xEE76612D,
+    0x7EE7AA4C, 0xEF4AEAF1,
+    0x7F02F66F, 0xF01FA39C,
+    0x7F1CDE01, 0xF0F488D9,
+    0x7F3560B9, 0xF1C99853,
+    0x7F4C7E54, 0xF29ECFB2,
+    0x7F62368F, 0xF3742CA2,
+    0x7F76892F, 0xF449ACCA,
+    0x7F8975F9, 0xF51F4DD4,
+    0x7F9AFCB9, 0xF5F50D67,
+    0x7FAB1D3D, 0xF6CAE92C,
+    0x7FB9D759, 0xF7A0DEC9,
+    0x7FC72AE2, 0xF876EBE8,
+    0x7FD317B4, 0xF94D0E2E,
+    0x7FDD9DAD, 0xFA234342,
+    0x7FE6BCB0, 0xFAF988CC,
+    0x7FEE74A2, 0xFBCFDC71,
+    0x7FF4C56F, 0xFCA63BD8,
+    0x7FF9AF04, 0xFD7CA4A6,
+    0x7FFD3154, 0xFE531484,
+    0x7FFF4C54, 0xFF298915
+};
+
+
+/**
+* \par
+* Example code for Q31 mixed-radix Twiddle factors Generation:
+* \par
+* <pre>for(i = 0; i< N; i++)
+* {
+*    twiddleCoefMixedQ31[2*i]= cos(i * 2*PI/(float)N);
+*    twiddleCoefMixedQ31[2*i+1]= sin(i * 2*PI/(float)N);
+* } </pre>
+* \par
+* where N = 1000	and PI = 3.14159265358979
+* \par
+* Convert Floating point to Q31(Fixed point 1.31):
+*	round(twiddleCoefMixedQ31(i) * pow(2, 31))
+*/
+const q31_t twiddleCoefMixed_1000_q31[2000] = {
+    0x7FFFFFFF, 0x00000000,
+    0x7FFF5A6B, 0x00CDE2D5,
+    0x7FFD69AC, 0x019BC395,
+    0x7FFA2DC9, 0x0269A02C,
+    0x7FF5A6CA, 0x03377685,
+    0x7FEFD4BA, 0x0405448B,
+    0x7FE8B7AA, 0x04D3082B,
+    0x7FE04FAB, 0x05A0BF4F,
+    0x7FD69CD3, 0x066E67E4,
+    0x7FCB9F3B, 0x073BFFD5,
+    0x7FBF5700, 0x0809850E,
+    0x7FB1C440, 0x08D6F57C,
+    0x7FA2E721, 0x09A44F0B,
+    0x7F92BFC7, 0x0A718FA8,
+    0x7F814E5D, 0x0B3EB540,
+    0x7F6E9310, 0x0C0BBDC0,
+    0x7F5A8E10, 0x0CD8A716,
+    0x7F453F91, 0x0DA56F2F,
+    0x7F2EA7CA, 0x0E7213F9,
+    0x7F16C6F6, 0x0F3E9364,
+    0x7EFD9D52, 0x100AEB5E,
+    0x7EE32B20, 0x10D719D6,
+    0x7EC770A4, 0x11A31CBC,
+    0x7EAA6E25, 0x126EF201,
+    0x7E8C23EF, 0x133A9794,
+    0x7E6C9251, 0x14060B68,
+    0x7E4BB99B, 0x14D14B6D,
+    0x7E299A23, 0x159C5596,
+    0x7E063441, 0x166727D5,
+    0x7DE18850, 0x1731C01E,
+    0x7DBB96B1, 0x17FC1C65,
+    0x7D945FC3, 0x18C63A9E,
+    0x7D6BE3EE, 0x199018BD,
+    0x7D42239A, 0x1A59B4BA,
+    0x7D171F33, 0x1B230C8A,
+    0x7CEAD728, 0x1BEC1E24,
+    0x7CBD4BEC, 0x1CB4E780,
+    0x7C8E7DF4, 0x1D7D6696,
+    0x7C5E6DBA, 0x1E459961,
+    0x7C2D1BBA, 0x1F0D7DD9,
+    0x7BFA8874, 0x1FD511FA,
+    0x7BC6B46B, 0x209C53BF,
+    0x7B91A023, 0x21634125,
+    0x7B5B4C28, 0x2229D82A,
+    0x7B23B906, 0x22F016CA,
+    0x7AEAE74B, 0x23B5FB06,
+    0x7AB0D78C, 0x247B82DE,
+    0x7A758A5F, 0x2540AC51,
+    0x7A39005C, 0x26057563,
+    0x79FB3A21, 0x26C9DC16,
+    0x79BC384D, 0x278DDE6E,
+    0x797BFB84, 0x28517A70,
+    0x793A846B, 0x2914AE22,
+    0x78F7D3AC, 0x29D7778A,
+    0x78B3E9F4, 0x2A99D4B2,
+    0x786EC7F2, 0x2B5BC3A1,
+    0x78286E59, 0x2C1D4262,
+    0x77E0DDDF, 0x2CDE4F01,
+    0x7798173E, 0x2D9EE789,
+    0x774E1B31, 0x2E5F0A0A,
+    0x7702EA78, 0x2F1EB491,
+    0x76B685D5, 0x2FDDE52F,
+    0x7668EE0F, 0x309C99F5,
+    0x761A23ED, 0x315AD0F6,
+    0x75CA283D, 0x32188846,
+    0x7578FBCC, 0x32D5BDF9,
+    0x75269F6C, 0x33927026,
+    0x74D313F4, 0x344E9CE6,
+    0x747E5A3A, 0x350A4250,
+    0x7428731B, 0x35C55E81,
+    0x73D15F73, 0x367FEF92,
+    0x73792026, 0x3739F3A3,
+    0x731FB617, 0x37F368D1,
+    0x72C5222D, 0x38AC4D3D,
+    0x72696552, 0x39649F09,
+    0x720C8075, 0x3A1C5C57,
+    0x71AE7485, 0x3AD3834C,
+    0x714F4276, 0x3B8A120E,
+    0x70EEEB3E, 0x3C4006C5,
+    0x708D6FD6, 0x3CF55F9B,
+    0x702AD13A, 0x3DAA1AB9,
+    0x6FC7106A, 0x3E5E364D,
+    0x6F622E68, 0x3F11B085,
+    0x6EFC2C38, 0x3FC4878F,
+    0x6E950AE4, 0x4076B99E,
+    0x6E2CCB74, 0x412844E4,
+    0x6DC36EF8, 0x41D92797,
+    0x6D58F67F, 0x42895FEB,
+    0x6CED631E, 0x4338EC1A,
+    0x6C80B5EB, 0x43E7CA5D,
+    0x6C12EFFE, 0x4495F8F0,
+    0x6BA41273, 0x45437611,
+    0x6B341E6B, 0x45F03FFD,
+    0x6AC31505, 0x469C54F7,
+    0x6A50F768, 0x4747B340,
+    0x69DDC6B9, 0x47F2591F,
+    0x69698423, 0x489C44D8,
+    0x68F430D3, 0x494574B5,
+    0x687DCDF8, 0x49EDE700,
+    0x68065CC5, 0x4A959A05,
+    0x678DDE6E, 0x4B3C8C12,
+    0x6714542C, 0x4BE2BB77,
+    0x6699BF39, 0x4C882686,
+    0x661E20D1, 0x4D2CCB94,
+    0x65A17A36, 0x4DD0A8F5,
+    0x6523CCA8, 0x4E73BD03,
+    0x64A5196F, 0x4F160618,
+    0x642561D0, 0x4FB7828F,
+    0x63A4A717, 0x505830C6,
+    0x6322EA91, 0x50F80F1F,
+    0x62A02D8D, 0x51971BFB,
+    0x621C715E, 0x523555BF,
+    0x6197B759, 0x52D2BAD1,
+    0x611200D4, 0x536F499A,
+    0x608B4F2B, 0x540B0086,
+    0x6003A3B8, 0x54A5DE01,
+    0x5F7AFFDC, 0x553FE07B,
+    0x5EF164F8, 0x55D90665,
+    0x5E66D470, 0x56714E32,
+    0x5DDB4FAA, 0x5708B65A,
+    0x5D4ED80F, 0x579F3D54,
+    0x5CC16F0C, 0x5834E19B,
+    0x5C33160C, 0x58C9A1AC,
+    0x5BA3CE82, 0x595D7C05,
+    0x5B1399E0, 0x59F06F28,
+    0x5A82799A, 0x5A82799A,
+    0x59F06F28, 0x5B1399E0,
+    0x595D7C05, 0x5BA3CE82,
+    0x58C9A1AC, 0x5C33160C,
+    0x5834E19B, 0x5CC16F0C,
+    0x579F3D54, 0x5D4ED80F,
+    0x5708B65A, 0x5DDB4FAA,
+    0x56714E32, 0x5E66D470,
+    0x55D90665, 0x5EF164F8,
+    0x553FE07B, 0x5F7AFFDC,
+    0x54A5DE01, 0x6003A3B8,
+    0x540B0086, 0x608B4F2B,
+    0x536F499A, 0x611200D4,
+    0x52D2BAD1, 0x6197B759,
+    0x523555BF, 0x621C715E,
+    0x51971BFB, 0x62A02D8D,
+    0x50F80F1F, 0x6322EA91,
+    0x505830C6, 0x63A4A717,
+    0x4FB7828F, 0x642561D0,
+    0x4F160618, 0x64A5196F,
+    0x4E73BD03, 0x6523CCA8,
+    0x4DD0A8F5, 0x65A17A36,
+    0x4D2CCB94, 0x661E20D1,
+    0x4C882686, 0x6699BF39,
+    0x4BE2BB77, 0x6714542C,
+    0x4B3C8C12, 0x678DDE6E,
+    0x4A959A05, 0x68065CC5,
+    0x49EDE700, 0x687DCDF8,
+    0x494574B5, 0x68F430D3,
+    0x489C44D8, 0x69698423,
+    0x47F2591F, 0x69DDC6B9,
+    0x4747B340, 0x6A50F768,
+    0x469C54F7, 0x6AC31505,
+    0x45F03FFD, 0x6B341E6B,
+    0x45437611, 0x6BA41273,
+    0x4495F8F0, 0x6C12EFFE,
+    0x43E7CA5D, 0x6C80B5EB,
+    0x4338EC1A, 0x6CED631E,
+    0x42895FEB, 0x6D58F67F,
+    0x41D92797, 0x6DC36EF8,
+    0x412844E4, 0x6E2CCB74,
+    0x4076B99E, 0x6E950AE4,
+    0x3FC4878F, 0x6EFC2C38,
+    0x3F11B085, 0x6F622E68,
+    0x3E5E364D, 0x6FC7106A,
+    0x3DAA1AB9, 0x702AD13A,
+    0x3CF55F9B, 0x708D6FD6,
+    0x3C4006C5, 0x70EEEB3E,
+    0x3B8A120E, 0x714F4276,
+    0x3AD3834C, 0x71AE7485,
+    0x3A1C5C57, 0x720C8075,
+    0x39649F09, 0x72696552,
+    0x38AC4D3D, 0x72C5222D,
+    0x37F368D1, 0x731FB617,
+    0x3739F3A3, 0x73792026,
+    0x367FEF92, 0x73D15F73,
+    0x35C55E81, 0x7428731B,
+    0x350A4250, 0x747E5A3A,
+    0x344E9CE6, 0x74D313F4,
+    0x33927026, 0x75269F6C,
+    0x32D5BDF9, 0x7578FBCC,
+    0x32188846, 0x75CA283D,
+    0x315AD0F6, 0x761A23ED,
+    0x309C99F5, 0x7668EE0F,
+    0x2FDDE52F, 0x76B685D5,
+    0x2F1EB491, 0x7702EA78,
+    0x2E5F0A0A, 0x774E1B31,
+    0x2D9EE789, 0x7798173E,
+    0x2CDE4F01, 0x77E0DDDF,
+    0x2C1D4262, 0x78286E59,
+    0x2B5BC3A1, 0x786EC7F2,
+    0x2A99D4B2, 0x78B3E9F4,
+    0x29D7778A, 0x78F7D3AC,
+    0x2914AE22, 0x793A846B,
+    0x28517A70, 0x797BFB84,
+    0x278DDE6E, 0x79BC384D,
+    0x26C9DC16, 0x79FB3A21,
+    0x26057563, 0x7A39005C,
+    0x2540AC51, 0x7A758A5F,
+    0x247B82DE, 0x7AB0D78C,
+    0x23B5FB06, 0x7AEAE74B,
+    0x22F016CA, 0x7B23B906,
+    0x2229D82A, 0x7B5B4C28,
+    0x21634125, 0x7B91A023,
+    0x209C53BF, 0x7BC6B46B,
+    0x1FD511FA, 0x7BFA8874,
+    0x1F0D7DD9, 0x7C2D1BBA,
+    0x1E459961, 0x7C5E6DBA,
+    0x1D7D6696, 0x7C8E7DF4,
+    0x1CB4E780, 0x7CBD4BEC,
+    0x1BEC1E24, 0x7CEAD728,
+    0x1B230C8A, 0x7D171F33,
+    0x1A59B4BA, 0x7D42239A,
+    0x199018BD, 0x7D6BE3EE,
+    0x18C63A9E, 0x7D945FC3,
+    0x17FC1C65, 0x7DBB96B1,
+    0x1731C01E, 0x7DE18850,
+    0x166727D5, 0x7E063441,
+    0x159C5596, 0x7E299A23,
+    0x14D14B6D, 0x7E4BB99B,
+    0x14060B68, 0x7E6C9251,
+    0x133A9794, 0x7E8C23EF,
+    0x126EF201, 0x7EAA6E25,
+    0x11A31CBC, 0x7EC770A4,
+    0x10D719D6, 0x7EE32B20,
+    0x100AEB5E, 0x7EFD9D52,
+    0x0F3E9364, 0x7F16C6F6,
+    0x0E7213F9, 0x7F2EA7CA,
+    0x0DA56F2F, 0x7F453F91,
+    0x0CD8A716, 0x7F5A8E10,
+    0x0C0BBDC0, 0x7F6E9310,
+    0x0B3EB540, 0x7F814E5D,
+    0x0A718FA8, 0x7F92BFC7,
+    0x09A44F0B, 0x7FA2E721,
+    0x08D6F57C, 0x7FB1C440,
+    0x0809850E, 0x7FBF5700,
+    0x073BFFD5, 0x7FCB9F3B,
+    0x066E67E4, 0x7FD69CD3,
+    0x05A0BF4F, 0x7FE04FAB,
+    0x04D3082B, 0x7FE8B7AA,
+    0x0405448B, 0x7FEFD4BA,
+    0x03377685, 0x7FF5A6CA,
+    0x0269A02C, 0x7FFA2DC9,
+    0x019BC395, 0x7FFD69AC,
+    0x00CDE2D5, 0x7FFF5A6B,
+    0x00000000, 0x7FFFFFFF,
+    0xFF321D2B, 0x7FFF5A6B,
+    0xFE643C6B, 0x7FFD69AC,
+    0xFD965FD4, 0x7FFA2DC9,
+    0xFCC8897B, 0x7FF5A6CA,
+    0xFBFABB75, 0x7FEFD4BA,
+    0xFB2CF7D5, 0x7FE8B7AA,
+    0xFA5F40B1, 0x7FE04FAB,
+    0xF991981C, 0x7FD69CD3,
+    0xF8C4002B, 0x7FCB9F3B,
+    0xF7F67AF2, 0x7FBF5700,
+    0xF7290A84, 0x7FB1C440,
+    0xF65BB0F5, 0x7FA2E721,
+    0xF58E7058, 0x7F92BFC7,
+    0xF4C14AC0, 0x7F814E5D,
+    0xF3F44240, 0x7F6E9310,
+    0xF32758EA, 0x7F5A8E10,
+    0xF25A90D1, 0x7F453F91,
+    0xF18DEC07, 0x7F2EA7CA,
+    0xF0C16C9C, 0x7F16C6F6,
+    0xEFF514A2, 0x7EFD9D52,
+    0xEF28E62A, 0x7EE32B20,
+    0xEE5CE344, 0x7EC770A4,
+    0xED910DFF, 0x7EAA6E25,
+    0xECC5686C, 0x7E8C23EF,
+    0xEBF9F498, 0x7E6C9251,
+    0xEB2EB493, 0x7E4BB99B,
+    0xEA63AA6A, 0x7E299A23,
+    0xE998D82B, 0x7E063441,
+    0xE8CE3FE2, 0x7DE18850,
+    0xE803E39B, 0x7DBB96B1,
+    0xE739C562, 0x7D945FC3,
+    0xE66FE743, 0x7D6BE3EE,
+    0xE5A64B46, 0x7D42239A,
+    0xE4DCF376, 0x7D171F33,
+    0xE413E1DC, 0x7CEAD728,
+    0xE34B1880, 0x7CBD4BEC,
+    0xE282996A, 0x7C8E7DF4,
+    0xE1BA669F, 0x7C5E6DBA,
+    0xE0F28227, 0x7C2D1BBA,
+    0xE02AEE06, 0x7BFA8874,
+    0xDF63AC41, 0x7BC6B46B,
+    0xDE9CBEDB, 0x7B91A023,
+    0xDDD627D6, 0x7B5B4C28,
+    0xDD0FE936, 0x7B23B906,
+    0xDC4A04FA, 0x7AEAE74B,
+    0xDB847D22, 0x7AB0D78C,
+    0xDABF53AF, 0x7A758A5F,
+    0xD9FA8A9D, 0x7A39005C,
+    0xD93623EA, 0x79FB3A21,
+    0xD8722192, 0x79BC384D,
+    0xD7AE8590, 0x797BFB84,
+    0xD6EB51DE, 0x793A846B,
+    0xD6288876, 0x78F7D3AC,
+    0xD5662B4E, 0x78B3E9F4,
+    0xD4A43C5F, 0x786EC7F2,
+    0xD3E2BD9E, 0x78286E59,
+    0xD321B0FF, 0x77E0DDDF,
+    0xD2611877, 0x7798173E,
+    0xD1A0F5F6, 0x774E1B31,
+    0xD0E14B6F, 0x7702EA78,
+    0xD0221AD1, 0x76B685D5,
+    0xCF63660B, 0x7668EE0F,
+    0xCEA52F0A, 0x761A23ED,
+    0xCDE777BA, 0x75CA283D,
+    0xCD2A4207, 0x7578FBCC,
+    0xCC6D8FDA, 0x75269F6C,
+    0xCBB1631A, 0x74D313F4,
+    0xCAF5BDB0, 0x747E5A3A,
+    0xCA3AA17F, 0x7428731B,
+    0xC980106E, 0x73D15F73,
+    0xC8C60C5D, 0x73792026,
+    0xC80C972F, 0x731FB617,
+    0xC753B2C3, 0x72C5222D,
+    0xC69B60F7, 0x72696552,
+    0xC5E3A3A9, 0x720C8075,
+    0xC52C7CB4, 0x71AE7485,
+    0xC475EDF2, 0x714F4276,
+    0xC3BFF93B, 0x70EEEB3E,
+    0xC30AA065, 0x708D6FD6,
+    0xC255E547, 0x702AD13A,
+    0xC1A1C9B3, 0x6FC7106A,
+    0xC0EE4F7B, 0x6F622E68,
+    0xC03B7871, 0x6EFC2C38,
+    0xBF894662, 0x6E950AE4,
+    0xBED7BB1C, 0x6E2CCB74,
+    0xBE26D869, 0x6DC36EF8,
+    0xBD76A015, 0x6D58F67F,
+    0xBCC713E6, 0x6CED631E,
+    0xBC1835A3, 0x6C80B5EB,
+    0xBB6A0710, 0x6C12EFFE,
+    0xBABC89EF, 0x6BA41273,
+    0xBA0FC003, 0x6B341E6B,
+    0xB963AB09, 0x6AC31505,
+    0xB8B84CC0, 0x6A50F768,
+    0xB80DA6E1, 0x69DDC6B9,
+    0xB763BB28, 0x69698423,
+    0xB6BA8B4B, 0x68F430D3,
+    0xB6121900, 0x687DCDF8,
+    0xB56A65FB, 0x68065CC5,
+    0xB4C373EE, 0x678DDE6E,
+    0xB41D4489, 0x6714542C,
+    0xB377D97A, 0x6699BF39,
+    0xB2D3346C, 0x661E20D1,
+    0xB22F570B, 0x65A17A36,
+    0xB18C42FD, 0x6523CCA8,
+    0xB0E9F9E8, 0x64A5196F,
+    0xB0487D71, 0x642561D0,
+    0xAFA7CF3A, 0x63A4A717,
+    0xAF07F0E1, 0x6322EA91,
+    0xAE68E405, 0x62A02D8D,
+    0xADCAAA41, 0x621C715E,
+    0xAD2D452F, 0x6197B759,
+    0xAC90B666, 0x611200D4,
+    0xABF4FF7A, 0x608B4F2B,
+    0xAB5A21FF, 0x6003A3B8,
+    0xAAC01F85, 0x5F7AFFDC,
+    0xAA26F99B, 0x5EF164F8,
+    0xA98EB1CE, 0x5E66D470,
+    0xA8F749A6, 0x5DDB4FAA,
+    0xA860C2AC, 0x5D4ED80F,
+    0xA7CB1E65, 0x5CC16F0C,
+    0xA7365E54, 0x5C33160C,
+    0xA6A283FB, 0x5BA3CE82,
+    0xA60F90D8, 0x5B1399E0,
+    0xA57D8666, 0x5A82799A,
+    0xA4EC6620, 0x59F06F28,
+    0xA45C317E, 0x595D7C05,
+    0xA3CCE9F4, 0x58C9A1AC,
+    0xA33E90F4, 0x5834E19B,
+    0xA2B127F1, 0x579F3D54,
+    0xA224B056, 0x5708B65A,
+    0xA1992B90, 0x56714E32,
+    0xA10E9B08, 0x55D90665,
+    0xA0850024, 0x553FE07B,
+    0x9FFC5C48, 0x54A5DE01,
+    0x9F74B0D5, 0x540B0086,
+    0x9EEDFF2C, 0x536F499A,
+    0x9E6848A7, 0x52D2BAD1,
+    0x9DE38EA2, 0x523555BF,
+    0x9D5FD273, 0x51971BFB,
+    0x9CDD156F, 0x50F80F1F,
+    0x9C5B58E9, 0x505830C6,
+    0x9BDA9E30, 0x4FB7828F,
+    0x9B5AE691, 0x4F160618,
+    0x9ADC3358, 0x4E73BD03,
+    0x9A5E85CA, 0x4DD0A8F5,
+    0x99E1DF2F, 0x4D2CCB94,
+    0x996640C7, 0x4C882686,
+    0x98EBABD4, 0x4BE2BB77,
+    0x98722192, 0x4B3C8C12,
+    0x97F9A33B, 0x4A959A05,
+    0x97823208, 0x49EDE700,
+    0x970BCF2D, 0x494574B5,
+    0x96967BDD, 0x489C44D8,
+    0x96223947, 0x47F2591F,
+    0x95AF0898, 0x4747B340,
+    0x953CEAFB, 0x469C54F7,
+    0x94CBE195, 0x45F03FFD,
+    0x945BED8D, 0x45437611,
+    0x93ED1002, 0x4495F8F0,
+    0x937F4A15, 0x43E7CA5D,
+    0x93129CE2, 0x4338EC1A,
+    0x92A70981, 0x42895FEB,
+    0x923C9108, 0x41D92797,
+    0x91D3348C, 0x412844E4,
+    0x916AF51C, 0x4076B99E,
+    0x9103D3C8, 0x3FC4878F,
+    0x909DD198, 0x3F11B085,
+    0x9038EF96, 0x3E5E364D,
+    0x8FD52EC6, 0x3DAA1AB9,
+    0x8F72902A, 0x3CF55F9B,
+    0x8F1114C2, 0x3C4006C5,
+    0x8EB0BD8A, 0x3B8A120E,
+    0x8E518B7B, 0x3AD3834C,
+    0x8DF37F8B, 0x3A1C5C57,
+    0x8D969AAE, 0x39649F09,
+    0x8D3ADDD3, 0x38AC4D3D,
+    0x8CE049E9, 0x37F368D1,
+    0x8C86DFDA, 0x3739F3A3,
+    0x8C2EA08D, 0x367FEF92,
+    0x8BD78CE5, 0x35C55E81,
+    0x8B81A5C6, 0x350A4250,
+    0x8B2CEC0C, 0x344E9CE6,
+    0x8AD96094, 0x33927026,
+    0x8A870434, 0x32D5BDF9,
+    0x8A35D7C3, 0x32188846,
+    0x89E5DC13, 0x315AD0F6,
+    0x899711F1, 0x309C99F5,
+    0x89497A2B, 0x2FDDE52F,
+    0x88FD1588, 0x2F1EB491,
+    0x88B1E4CF, 0x2E5F0A0A,
+    0x8867E8C2, 0x2D9EE789,
+    0x881F2221, 0x2CDE4F01,
+    0x87D791A7, 0x2C1D4262,
+    0x8791380E, 0x2B5BC3A1,
+    0x874C160C, 0x2A99D4B2,
+    0x87082C54, 0x29D7778A,
+    0x86C57B95, 0x2914AE22,
+    0x8684047C, 0x28517A70,
+    0x8643C7B3, 0x278DDE6E,
+    0x8604C5DF, 0x26C9DC16,
+    0x85C6FFA4, 0x26057563,
+    0x858A75A1, 0x2540AC51,
+    0x854F2874, 0x247B82DE,
+    0x851518B5, 0x23B5FB06,
+    0x84DC46FA, 0x22F016CA,
+    0x84A4B3D8, 0x2229D82A,
+    0x846E5FDD, 0x21634125,
+    0x84394B95, 0x209C53BF,
+    0x8405778C, 0x1FD511FA,
+    0x83D2E446, 0x1F0D7DD9,
+    0x83A19246, 0x1E459961,
+    0x8371820C, 0x1D7D6696,
+    0x8342B414, 0x1CB4E780,
+    0x831528D8, 0x1BEC1E24,
+    0x82E8E0CD, 0x1B230C8A,
+    0x82BDDC66, 0x1A59B4BA,
+    0x82941C12, 0x199018BD,
+    0x826BA03D, 0x18C63A9E,
+    0x8244694F, 0x17FC1C65,
+    0x821E77B0, 0x1731C01E,
+    0x81F9CBBF, 0x166727D5,
+    0x81D665DD, 0x159C5596,
+    0x81B44665, 0x14D14B6D,
+    0x81936DAF, 0x14060B68,
+    0x8173DC11, 0x133A9794,
+    0x815591DB, 0x126EF201,
+    0x81388F5C, 0x11A31CBC,
+    0x811CD4E0, 0x10D719D6,
+    0x810262AE, 0x100AEB5E,
+    0x80E9390A, 0x0F3E9364,
+    0x80D15836, 0x0E7213F9,
+    0x80BAC06F, 0x0DA56F2F,
+    0x80A571F0, 0x0CD8A716,
+    0x80916CF0, 0x0C0BBDC0,
+    0x807EB1A3, 0x0B3EB540,
+    0x806D4039, 0x0A718FA8,
+    0x805D18DF, 0x09A44F0B,
+    0x804E3BC0, 0x08D6F57C,
+    0x8040A900, 0x0809850E,
+    0x803460C5, 0x073BFFD5,
+    0x8029632D, 0x066E67E4,
+    0x801FB055, 0x05A0BF4F,
+    0x80174856, 0x04D3082B,
+    0x80102B46, 0x0405448B,
+    0x800A5936, 0x03377685,
+    0x8005D237, 0x0269A02C,
+    0x80029654, 0x019BC395,
+    0x8000A595, 0x00CDE2D5,
+    0x80000000, 0x00000000,
+    0x8000A595, 0xFF321D2B,
+    0x80029654, 0xFE643C6B,
+    0x8005D237, 0xFD965FD4,
+    0x800A5936, 0xFCC8897B,
+    0x80102B46, 0xFBFABB75,
+    0x80174856, 0xFB2CF7D5,
+    0x801FB055, 0xFA5F40B1,
+    0x8029632D, 0xF991981C,
+    0x803460C5, 0xF8C4002B,
+    0x8040A900, 0xF7F67AF2,
+    0x804E3BC0, 0xF7290A84,
+    0x805D18DF, 0xF65BB0F5,
+    0x806D4039, 0xF58E7058,
+    0x807EB1A3, 0xF4C14AC0,
+    0x80916CF0, 0xF3F44240,
+    0x80A571F0, 0xF32758EA,
+    0x80BAC06F, 0xF25A90D1,
+    0x80D15836, 0xF18DEC07,
+    0x80E9390A, 0xF0C16C9C,
+    0x810262AE, 0xEFF514A2,
+    0x811CD4E0, 0xEF28E62A,
+    0x81388F5C, 0xEE5CE344,
+    0x815591DB, 0xED910DFF,
+    0x8173DC11, 0xECC5686C,
+    0x81936DAF, 0xEBF9F498,
+    0x81B44665, 0xEB2EB493,
+    0x81D665DD, 0xEA63AA6A,
+    0x81F9CBBF, 0xE998D82B,
+    0x821E77B0, 0xE8CE3FE2,
+    0x8244694F, 0xE803E39B,
+    0x826BA03D, 0xE739C562,
+    0x82941C12, 0xE66FE743,
+    0x82BDDC66, 0xE5A64B46,
+    0x82E8E0CD, 0xE4DCF376,
+    0x831528D8, 0xE413E1DC,
+    0x8342B414, 0xE34B1880,
+    0x8371820C, 0xE282996A,
+    0x83A19246, 0xE1BA669F,
+    0x83D2E446, 0xE0F28227,
+    0x8405778C, 0xE02AEE06,
+    0x84394B95, 0xDF63AC41,
+    0x846E5FDD, 0xDE9CBEDB,
+    0x84A4B3D8, 0xDDD627D6,
+    0x84DC46FA, 0xDD0FE936,
+    0x851518B5, 0xDC4A04FA,
+    0x854F2874, 0xDB847D22,
+    0x858A75A1, 0xDABF53AF,
+    0x85C6FFA4, 0xD9FA8A9D,
+    0x8604C5DF, 0xD93623EA,
+    0x8643C7B3, 0xD8722192,
+    0x8684047C, 0xD7AE8590,
+    0x86C57B95, 0xD6EB51DE,
+    0x87082C54, 0xD6288876,
+    0x874C160C, 0xD5662B4E,
+    0x8791380E, 0xD4A43C5F,
+    0x87D791A7, 0xD3E2BD9E,
+    0x881F2221, 0xD321B0FF,
+    0x8867E8C2, 0xD2611877,
+    0x88B1E4CF, 0xD1A0F5F6,
+    0x88FD1588, 0xD0E14B6F,
+    0x89497A2B, 0xD0221AD1,
+    0x899711F1, 0xCF63660B,
+    0x89E5DC13, 0xCEA52F0A,
+    0x8A35D7C3, 0xCDE777BA,
+    0x8A870434, 0xCD2A4207,
+    0x8AD96094, 0xCC6D8FDA,
+    0x8B2CEC0C, 0xCBB1631A,
+    0x8B81A5C6, 0xCAF5BDB0,
+    0x8BD78CE5, 0xCA3AA17F,
+    0x8C2EA08D, 0xC980106E,
+    0x8C86DFDA, 0xC8C60C5D,
+    0x8CE049E9, 0xC80C972F,
+    0x8D3ADDD3, 0xC753B2C3,
+    0x8D969AAE, 0xC69B60F7,
+    0x8DF37F8B, 0xC5E3A3A9,
+    0x8E518B7B, 0xC52C7CB4,
+    0x8EB0BD8A, 0xC475EDF2,
+    0x8F1114C2, 0xC3BFF93B,
+    0x8F72902A, 0xC30AA065,
+    0x8FD52EC6, 0xC255E547,
+    0x9038EF96, 0xC1A1C9B3,
+    0x909DD198, 0xC0EE4F7B,
+    0x9103D3C8, 0xC03B7871,
+    0x916AF51C, 0xBF894662,
+    0x91D3348C, 0xBED7BB1C,
+    0x923C9108, 0xBE26D869,
+    0x92A70981, 0xBD76A015,
+    0x93129CE2, 0xBCC713E6,
+    0x937F4A15, 0xBC1835A3,
+    0x93ED1002, 0xBB6A0710,
+    0x945BED8D, 0xBABC89EF,
+    0x94CBE195, 0xBA0FC003,
+    0x953CEAFB, 0xB963AB09,
+    0x95AF0898, 0xB8B84CC0,
+    0x96223947, 0xB80DA6E1,
+    0x96967BDD, 0xB763BB28,
+    0x970BCF2D, 0xB6BA8B4B,
+    0x97823208, 0xB6121900,
+    0x97F9A33B, 0xB56A65FB,
+    0x98722192, 0xB4C373EE,
+    0x98EBABD4, 0xB41D4489,
+    0x996640C7, 0xB377D97A,
+    0x99E1DF2F, 0xB2D3346C,
+    0x9A5E85CA, 0xB22F570B,
+    0x9ADC3358, 0xB18C42FD,
+    0x9B5AE691, 0xB0E9F9E8,
+    0x9BDA9E30, 0xB0487D71,
+    0x9C5B58E9, 0xAFA7CF3A,
+    0x9CDD156F, 0xAF07F0E1,
+    0x9D5FD273, 0xAE68E405,
+    0x9DE38EA2, 0xADCAAA41,
+    0x9E6848A7, 0xAD2D452F,
+    0x9EEDFF2C, 0xAC90B666,
+    0x9F74B0D5, 0xABF4FF7A,
+    0x9FFC5C48, 0xAB5A21FF,
+    0xA0850024, 0xAAC01F85,
+    0xA10E9B08, 0xAA26F99B,
+    0xA1992B90, 0xA98EB1CE,
+    0xA224B056, 0xA8F749A6,
+    0xA2B127F1, 0xA860C2AC,
+    0xA33E90F4, 0xA7CB1E65,
+    0xA3CCE9F4, 0xA7365E54,
+    0xA45C317E, 0xA6A283FB,
+    0xA4EC6620, 0xA60F90D8,
+    0xA57D8666, 0xA57D8666,
+    0xA60F90D8, 0xA4EC6620,
+    0xA6A283FB, 0xA45C317E,
+    0xA7365E54, 0xA3CCE9F4,
+    0xA7CB1E65, 0xA33E90F4,
+    0xA860C2AC, 0xA2B127F1,
+    0xA8F749A6, 0xA224B056,
+    0xA98EB1CE, 0xA1992B90,
+    0xAA26F99B, 0xA10E9B08,
+    0xAAC01F85, 0xA0850024,
+    0xAB5A21FF, 0x9FFC5C48,
+    0xABF4FF7A, 0x9F74B0D5,
+    0xAC90B666, 0x9EEDFF2C,
+    0xAD2D452F, 0x9E6848A7,
+    0xADCAAA41, 0x9DE38EA2,
+    0xAE68E405, 0x9D5FD273,
+    0xAF07F0E1, 0x9CDD156F,
+    0xAFA7CF3A, 0x9C5B58E9,
+    0xB0487D71, 0x9BDA9E30,
+    0xB0E9F9E8, 0x9B5AE691,
+    0xB18C42FD, 0x9ADC3358,
+    0xB22F570B, 0x9A5E85CA,
+    0xB2D3346C, 0x99E1DF2F,
+    0xB377D97A, 0x996640C7,
+    0xB41D4489, 0x98EBABD4,
+    0xB4C373EE, 0x98722192,
+    0xB56A65FB, 0x97F9A33B,
+    0xB6121900, 0x97823208,
+    0xB6BA8B4B, 0x970BCF2D,
+    0xB763BB28, 0x96967BDD,
+    0xB80DA6E1, 0x96223947,
+    0xB8B84CC0, 0x95AF0898,
+    0xB963AB09, 0x953CEAFB,
+    0xBA0FC003, 0x94CBE195,
+    0xBABC89EF, 0x945BED8D,
+    0xBB6A0710, 0x93ED1002,
+    0xBC1835A3, 0x937F4A15,
+    0xBCC713E6, 0x93129CE2,
+    0xBD76A015, 0x92A70981,
+    0xBE26D869, 0x923C9108,
+    0xBED7BB1C, 0x91D3348C,
+    0xBF894662, 0x916AF51C,
+    0xC03B7871, 0x9103D3C8,
+    0xC0EE4F7B, 0x909DD198,
+    0xC1A1C9B3, 0x9038EF96,
+    0xC255E547, 0x8FD52EC6,
+    0xC30AA065, 0x8F72902A,
+    0xC3BFF93B, 0x8F1114C2,
+    0xC475EDF2, 0x8EB0BD8A,
+    0xC52C7CB4, 0x8E518B7B,
+    0xC5E3A3A9, 0x8DF37F8B,
+    0xC69B60F7, 0x8D969AAE,
+    0xC753B2C3, 0x8D3ADDD3,
+    0xC80C972F, 0x8CE049E9,
+    0xC8C60C5D, 0x8C86DFDA,
+    0xC980106E, 0x8C2EA08D,
+    0xCA3AA17F, 0x8BD78CE5,
+    0xCAF5BDB0, 0x8B81A5C6,
+    0xCBB1631A, 0x8B2CEC0C,
+    0xCC6D8FDA, 0x8AD96094,
+    0xCD2A4207, 0x8A870434,
+    0xCDE777BA, 0x8A35D7C3,
+    0xCEA52F0A, 0x89E5DC13,
+    0xCF63660B, 0x899711F1,
+    0xD0221AD1, 0x89497A2B,
+    0xD0E14B6F, 0x88FD1588,
+    0xD1A0F5F6, 0x88B1E4CF,
+    0xD2611877, 0x8867E8C2,
+    0xD321B0FF, 0x881F2221,
+    0xD3E2BD9E, 0x87D791A7,
+    0xD4A43C5F, 0x8791380E,
+    0xD5662B4E, 0x874C160C,
+    0xD6288876, 0x87082C54,
+    0xD6EB51DE, 0x86C57B95,
+    0xD7AE8590, 0x8684047C,
+    0xD8722192, 0x8643C7B3,
+    0xD93623EA, 0x8604C5DF,
+    0xD9FA8A9D, 0x85C6FFA4,
+    0xDABF53AF, 0x858A75A1,
+    0xDB847D22, 0x854F2874,
+    0xDC4A04FA, 0x851518B5,
+    0xDD0FE936, 0x84DC46FA,
+    0xDDD627D6, 0x84A4B3D8,
+    0xDE9CBEDB, 0x846E5FDD,
+    0xDF63AC41, 0x84394B95,
+    0xE02AEE06, 0x8405778C,
+    0xE0F28227, 0x83D2E446,
+    0xE1BA669F, 0x83A19246,
+    0xE282996A, 0x8371820C,
+    0xE34B1880, 0x8342B414,
+    0xE413E1DC, 0x831528D8,
+    0xE4DCF376, 0x82E8E0CD,
+    0xE5A64B46, 0x82BDDC66,
+    0xE66FE743, 0x82941C12,
+    0xE739C562, 0x826BA03D,
+    0xE803E39B, 0x8244694F,
+    0xE8CE3FE2, 0x821E77B0,
+    0xE998D82B, 0x81F9CBBF,
+    0xEA63AA6A, 0x81D665DD,
+    0xEB2EB493, 0x81B44665,
+    0xEBF9F498, 0x81936DAF,
+    0xECC5686C, 0x8173DC11,
+    0xED910DFF, 0x815591DB,
+    0xEE5CE344, 0x81388F5C,
+    0xEF28E62A, 0x811CD4E0,
+    0xEFF514A2, 0x810262AE,
+    0xF0C16C9C, 0x80E9390A,
+    0xF18DEC07, 0x80D15836,
+    0xF25A90D1, 0x80BAC06F,
+    0xF32758EA, 0x80A571F0,
+    0xF3F44240, 0x80916CF0,
+    0xF4C14AC0, 0x807EB1A3,
+    0xF58E7058, 0x806D4039,
+    0xF65BB0F5, 0x805D18DF,
+    0xF7290A84, 0x804E3BC0,
+    0xF7F67AF2, 0x8040A900,
+    0xF8C4002B, 0x803460C5,
+    0xF991981C, 0x8029632D,
+    0xFA5F40B1, 0x801FB055,
+    0xFB2CF7D5, 0x80174856,
+    0xFBFABB75, 0x80102B46,
+    0xFCC8897B, 0x800A5936,
+    0xFD965FD4, 0x8005D237,
+    0xFE643C6B, 0x80029654,
+    0xFF321D2B, 0x8000A595,
+    0x00000000, 0x80000000,
+    0x00CDE2D5, 0x8000A595,
+    0x019BC395, 0x80029654,
+    0x0269A02C, 0x8005D237,
+    0x03377685, 0x800A5936,
+    0x0405448B, 0x80102B46,
+    0x04D3082B, 0x80174856,
+    0x05A0BF4F, 0x801FB055,
+    0x066E67E4, 0x8029632D,
+    0x073BFFD5, 0x803460C5,
+    0x0809850E, 0x8040A900,
+    0x08D6F57C, 0x804E3BC0,
+    0x09A44F0B, 0x805D18DF,
+    0x0A718FA8, 0x806D4039,
+    0x0B3EB540, 0x807EB1A3,
+    0x0C0BBDC0, 0x80916CF0,
+    0x0CD8A716, 0x80A571F0,
+    0x0DA56F2F, 0x80BAC06F,
+    0x0E7213F9, 0x80D15836,
+    0x0F3E9364, 0x80E9390A,
+    0x100AEB5E, 0x810262AE,
+    0x10D719D6, 0x811CD4E0,
+    0x11A31CBC, 0x81388F5C,
+    0x126EF201, 0x815591DB,
+    0x133A9794, 0x8173DC11,
+    0x14060B68, 0x81936DAF,
+    0x14D14B6D, 0x81B44665,
+    0x159C5596, 0x81D665DD,
+    0x166727D5, 0x81F9CBBF,
+    0x1731C01E, 0x821E77B0,
+    0x17FC1C65, 0x8244694F,
+    0x18C63A9E, 0x826BA03D,
+    0x199018BD, 0x82941C12,
+    0x1A59B4BA, 0x82BDDC66,
+    0x1B230C8A, 0x82E8E0CD,
+    0x1BEC1E24, 0x831528D8,
+    0x1CB4E780, 0x8342B414,
+    0x1D7D6696, 0x8371820C,
+    0x1E459961, 0x83A19246,
+    0x1F0D7DD9, 0x83D2E446,
+    0x1FD511FA, 0x8405778C,
+    0x209C53BF, 0x84394B95,
+    0x21634125, 0x846E5FDD,
+    0x2229D82A, 0x84A4B3D8,
+    0x22F016CA, 0x84DC46FA,
+    0x23B5FB06, 0x851518B5,
+    0x247B82DE, 0x854F2874,
+    0x2540AC51, 0x858A75A1,
+    0x26057563, 0x85C6FFA4,
+    0x26C9DC16, 0x8604C5DF,
+    0x278DDE6E, 0x8643C7B3,
+    0x28517A70, 0x8684047C,
+    0x2914AE22, 0x86C57B95,
+    0x29D7778A, 0x87082C54,
+    0x2A99D4B2, 0x874C160C,
+    0x2B5BC3A1, 0x8791380E,
+    0x2C1D4262, 0x87D791A7,
+    0x2CDE4F01, 0x881F2221,
+    0x2D9EE789, 0x8867E8C2,
+    0x2E5F0A0A, 0x88B1E4CF,
+    0x2F1EB491, 0x88FD1588,
+    0x2FDDE52F, 0x89497A2B,
+    0x309C99F5, 0x899711F1,
+    0x315AD0F6, 0x89E5DC13,
+    0x32188846, 0x8A35D7C3,
+    0x32D5BDF9, 0x8A870434,
+    0x33927026, 0x8AD96094,
+    0x344E9CE6, 0x8B2CEC0C,
+    0x350A4250, 0x8B81A5C6,
+    0x35C55E81, 0x8BD78CE5,
+    0x367FEF92, 0x8C2EA08D,
+    0x3739F3A3, 0x8C86DFDA,
+    0x37F368D1, 0x8CE049E9,
+    0x38AC4D3D, 0x8D3ADDD3,
+    0x39649F09, 0x8D969AAE,
+    0x3A1C5C57, 0x8DF37F8B,
+    0x3AD3834C, 0x8E518B7B,
+    0x3B8A120E, 0x8EB0BD8A,
+    0x3C4006C5, 0x8F1114C2,
+    0x3CF55F9B, 0x8F72902A,
+    0x3DAA1AB9, 0x8FD52EC6,
+    0x3E5E364D, 0x9038EF96,
+    0x3F11B085, 0x909DD198,
+    0x3FC4878F, 0x9103D3C8,
+    0x4076B99E, 0x916AF51C,
+    0x412844E4, 0x91D3348C,
+    0x41D92797, 0x923C9108,
+    0x42895FEB, 0x92A70981,
+    0x4338EC1A, 0x93129CE2,
+    0x43E7CA5D, 0x937F4A15,
+    0x4495F8F0, 0x93ED1002,
+    0x45437611, 0x945BED8D,
+    0x45F03FFD, 0x94CBE195,
+    0x469C54F7, 0x953CEAFB,
+    0x4747B340, 0x95AF0898,
+    0x47F2591F, 0x96223947,
+    0x489C44D8, 0x96967BDD,
+    0x494574B5, 0x970BCF2D,
+    0x49EDE700, 0x97823208,
+    0x4A959A05, 0x97F9A33B,
+    0x4B3C8C12, 0x98722192,
+    0x4BE2BB77, 0x98EBABD4,
+    0x4C882686, 0x996640C7,
+    0x4D2CCB94, 0x99E1DF2F,
+    0x4DD0A8F5, 0x9A5E85CA,
+    0x4E73BD03, 0x9ADC3358,
+    0x4F160618, 0x9B5AE691,
+    0x4FB7828F, 0x9BDA9E30,
+    0x505830C6, 0x9C5B58E9,
+    0x50F80F1F, 0x9CDD156F,
+    0x51971BFB, 0x9D5FD273,
+    0x523555BF, 0x9DE38EA2,
+    0x52D2BAD1, 0x9E6848A7,
+    0x536F499A, 0x9EEDFF2C,
+    0x540B0086, 0x9F74B0D5,
+    0x54A5DE01, 0x9FFC5C48,
+    0x553FE07B, 0xA0850024,
+    0x55D90665, 0xA10E9B08,
+    0x56714E32, 0xA1992B90,
+    0x5708B65A, 0xA224B056,
+    0x579F3D54, 0xA2B127F1,
+    0x5834E19B, 0xA33E90F4,
+    0x58C9A1AC, 0xA3CCE9F4,
+    0x595D7C05, 0xA45C317E,
+    0x59F06F28, 0xA4EC6620,
+    0x5A82799A, 0xA57D8666,
+    0x5B1399E0, 0xA60F90D8,
+    0x5BA3CE82, 0xA6A283FB,
+    0x5C33160C, 0xA7365E54,
+    0x5CC16F0C, 0xA7CB1E65,
+    0x5D4ED80F, 0xA860C2AC,
+    0x5DDB4FAA, 0xA8F749A6,
+    0x5E66D470, 0xA98EB1CE,
+    0x5EF164F8, 0xAA26F99B,
+    0x5F7AFFDC, 0xAAC01F85,
+    0x6003A3B8, 0xAB5A21FF,
+    0x608B4F2B, 0xABF4FF7A,
+    0x611200D4, 0xAC90B666,
+    0x6197B759, 0xAD2D452F,
+    0x621C715E, 0xADCAAA41,
+    0x62A02D8D, 0xAE68E405,
+    0x6322EA91, 0xAF07F0E1,
+    0x63A4A717, 0xAFA7CF3A,
+    0x642561D0, 0xB0487D71,
+    0x64A5196F, 0xB0E9F9E8,
+    0x6523CCA8, 0xB18C42FD,
+    0x65A17A36, 0xB22F570B,
+    0x661E20D1, 0xB2D3346C,
+    0x6699BF39, 0xB377D97A,
+    0x6714542C, 0xB41D4489,
+    0x678DDE6E, 0xB4C373EE,
+    0x68065CC5, 0xB56A65FB,
+    0x687DCDF8, 0xB6121900,
+    0x68F430D3, 0xB6BA8B4B,
+    0x69698423, 0xB763BB28,
+    0x69DDC6B9, 0xB80DA6E1,
+    0x6A50F768, 0xB8B84CC0,
+    0x6AC31505, 0xB963AB09,
+    0x6B341E6B, 0xBA0FC003,
+    0x6BA41273, 0xBABC89EF,
+    0x6C12EFFE, 0xBB6A0710,
+    0x6C80B5EB, 0xBC1835A3,
+    0x6CED631E, 0xBCC713E6,
+    0x6D58F67F, 0xBD76A015,
+    0x6DC36EF8, 0xBE26D869,
+    0x6E2CCB74, 0xBED7BB1C,
+    0x6E950AE4, 0xBF894662,
+    0x6EFC2C38, 0xC03B7871,
+    0x6F622E68, 0xC0EE4F7B,
+    0x6FC7106A, 0xC1A1C9B3,
+    0x702AD13A, 0xC255E547,
+    0x708D6FD6, 0xC30AA065,
+    0x70EEEB3E, 0xC3BFF93B,
+    0x714F4276, 0xC475EDF2,
+    0x71AE7485, 0xC52C7CB4,
+    0x720C8075, 0xC5E3A3A9,
+    0x72696552, 0xC69B60F7,
+    0x72C5222D, 0xC753B2C3,
+    0x731FB617, 0xC80C972F,
+    0x73792026, 0xC8C60C5D,
+    0x73D15F73, 0xC980106E,
+    0x7428731B, 0xCA3AA17F,
+    0x747E5A3A, 0xCAF5BDB0,
+    0x74D313F4, 0xCBB1631A,
+    0x75269F6C, 0xCC6D8FDA,
+    0x7578FBCC, 0xCD2A4207,
+    0x75CA283D, 0xCDE777BA,
+    0x761A23ED, 0xCEA52F0A,
+    0x7668EE0F, 0xCF63660B,
+    0x76B685D5, 0xD0221AD1,
+    0x7702EA78, 0xD0E14B6F,
+    0x774E1B31, 0xD1A0F5F6,
+    0x7798173E, 0xD2611877,
+    0x77E0DDDF, 0xD321B0FF,
+    0x78286E59, 0xD3E2BD9E,
+    0x786EC7F2, 0xD4A43C5F,
+    0x78B3E9F4, 0xD5662B4E,
+    0x78F7D3AC, 0xD6288876,
+    0x793A846B, 0xD6EB51DE,
+    0x797BFB84, 0xD7AE8590,
+    0x79BC384D, 0xD8722192,
+    0x79FB3A21, 0xD93623EA,
+    0x7A39005C, 0xD9FA8A9D,
+    0x7A758A5F, 0xDABF53AF,
+    0x7AB0D78C, 0xDB847D22,
+    0x7AEAE74B, 0xDC4A04FA,
+    0x7B23B906, 0xDD0FE936,
+    0x7B5B4C28, 0xDDD627D6,
+    0x7B91A023, 0xDE9CBEDB,
+    0x7BC6B46B, 0xDF63AC41,
+    0x7BFA8874, 0xE02AEE06,
+    0x7C2D1BBA, 0xE0F28227,
+    0x7C5E6DBA, 0xE1BA669F,
+    0x7C8E7DF4, 0xE282996A,
+    0x7CBD4BEC, 0xE34B1880,
+    0x7CEAD728, 0xE413E1DC,
+    0x7D171F33, 0xE4DCF376,
+    0x7D42239A, 0xE5A64B46,
+    0x7D6BE3EE, 0xE66FE743,
+    0x7D945FC3, 0xE739C562,
+    0x7DBB96B1, 0xE803E39B,
+    0x7DE18850, 0xE8CE3FE2,
+    0x7E063441, 0xE998D82B,
+    0x7E299A23, 0xEA63AA6A,
+    0x7E4BB99B, 0xEB2EB493,
+    0x7E6C9251, 0xEBF9F498,
+    0x7E8C23EF, 0xECC5686C,
+    0x7EAA6E25, 0xED910DFF,
+    0x7EC770A4, 0xEE5CE344,
+    0x7EE32B20, 0xEF28E62A,
+    0x7EFD9D52, 0xEFF514A2,
+    0x7F16C6F6, 0xF0C16C9C,
+    0x7F2EA7CA, 0xF18DEC07,
+    0x7F453F91, 0xF25A90D1,
+    0x7F5A8E10, 0xF32758EA,
+    0x7F6E9310, 0xF3F44240,
+    0x7F814E5D, 0xF4C14AC0,
+    0x7F92BFC7, 0xF58E7058,
+    0x7FA2E721, 0xF65BB0F5,
+    0x7FB1C440, 0xF7290A84,
+    0x7FBF5700, 0xF7F67AF2,
+    0x7FCB9F3B, 0xF8C4002B,
+    0x7FD69CD3, 0xF991981C,
+    0x7FE04FAB, 0xFA5F40B1,
+    0x7FE8B7AA, 0xFB2CF7D5,
+    0x7FEFD4BA, 0xFBFABB75,
+    0x7FF5A6CA, 0xFCC8897B,
+    0x7FFA2DC9, 0xFD965FD4,
+    0x7FFD69AC, 0xFE643C6B,
+    0x7FFF5A6B, 0xFF321D2B
+};
+
+
 /**   
  * \par    
  * Example code for the generation of the floating-point sine table:
@@ -154,3 +154,53 @@ const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 = {
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 = {
 	4096, twiddleCoef_4096_q15, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+
+//Mixed-radix structs
+
+const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len300 = {
+	300, 2, twiddleCoefMixed_600, 4, {4, 3, 5, 5}
+};
+
+const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len480 = {
+	480, 2, twiddleCoefMixed_960, 5, {4, 4, 2, 3, 5}
+};
+
+const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len500 = {
+	500, 2, twiddleCoefMixed_1000, 4, {4, 5, 5, 5}
+};
+
+const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len600 = {
+	600, 1, twiddleCoefMixed_600, 5, {4, 2, 3, 5, 5}
+};
+
+const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len960 = {
+	960, 1, twiddleCoefMixed_960, 5, {4, 4, 4, 3, 5}
+};
+
+const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len1000 = {
+	1000, 1, twiddleCoefMixed_1000, 5, {4, 2, 5, 5, 5}
+};
+
+const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len300 = {
+	300, 2, twiddleCoefMixed_600_q31, 4, {4, 3, 5, 5}
+};
+
+const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len480 = {
+	480, 2, twiddleCoefMixed_960_q31, 5, {4, 4, 2, 3, 5}
+};
+
+const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len500 = {
+	500, 2, twiddleCoefMixed_1000_q31, 4, {4, 5, 5, 5}
+};
+
+const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len600 = {
+	600, 1, twiddleCoefMixed_600_q31, 5, {4, 2, 3, 5, 5}
+};
+
+const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len960 = {
+	960, 1, twiddleCoefMixed_960_q31, 5, {4, 4, 4, 3, 5}
+};
+
+const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len1000 = {
+	1000, 1, twiddleCoefMixed_1000_q31, 5, {4, 2, 5, 5, 5}
+};
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_kalman_init_f32.c
+*
+* Description:	Floating-point Kalman filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup Kalman Kalman Filter
+ *
+ * Linear and extended Kalman filter for state estimation, e.g. sensor fusion of
+ * gyroscope, accelerometer and magnetometer readings.
+ *
+ * The filter keeps the state estimate <code>x</code> (n elements) and its
+ * covariance <code>P</code> (n x n).  Each sample period the application calls
+ * the prediction step
+ * <pre>
+ *     x = F * x
+ *     P = F * P * F^T + Q
+ * </pre>
+ * and, whenever measurements <code>z</code> are available, the update step
+ * <pre>
+ *     y = z - H * x
+ *     K = P * H^T * (H * P * H^T + R)^-1
+ *     x = x + K * y
+ *     P = P - K * H * P
+ * </pre>
+ *
+ * \par Extended filter
+ * For a nonlinear model the application evaluates the state transition itself,
+ * writes the result to <code>S->pX</code> and calls the prediction step with the
+ * Jacobian as <code>F</code> and <code>stateFlag = 0</code>.  Likewise, the update
+ * step takes the Jacobian of the measurement function as <code>H</code> and the
+ * predicted measurements h(x) in <code>pHx</code>.
+ *
+ * \par Storage and sparsity
+ * <code>P</code>, and the process noise <code>Q</code>, are symmetric and only their
+ * upper triangles are stored, packed row by row: element (i,j), i <= j, is at
+ * index <code>i*n - i*(i-1)/2 + (j-i)</code>.  The prediction step computes only
+ * the upper triangle of <code>F * P * F^T</code>.
+ *
+ * \par
+ * The measurement noise must be uncorrelated, <code>R</code> is given as the vector
+ * of its diagonal.  The measurements are then processed one at a time, which
+ * replaces the matrix inverse by a scalar division and turns the covariance update
+ * into a symmetric rank-one downdate of the upper triangle.  Each row of
+ * <code>H</code> is scanned once for its nonzero elements and only those are used,
+ * so a row that observes k states costs O(n*k) instead of O(n*n) before the
+ * downdate.  Correlated measurement noise can be handled by the application by
+ * whitening: factor <code>R = L * L^T</code> with <code>arm_mat_cholesky_f32()</code>
+ * and solve <code>L * z' = z</code> and <code>L * H' = H</code> with
+ * <code>arm_mat_solve_lower_triangular_f32()</code>; <code>z'</code> and
+ * <code>H'</code> then have unit noise variances.
+ *
+ * \par Fixed point
+ * The Q31 functions use the same algorithm with 64-bit accumulation and saturation
+ * of every stored result.  States, covariances and noise variances are Q31 values;
+ * the application chooses their scaling so that all of them stay within [-1, 1).
+ * <code>F</code> and <code>H</code> typically hold values of magnitude 1 or more and
+ * are given in Q(31-fShift) and Q(31-hShift) format.
+ * The product <code>F * P</code> is computed with <code>arm_mat_mult_q31()</code>,
+ * so the input scaling guidelines of that function apply.
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Kalman filter.
+ * @param[out]      *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]       numStates number of states.
+ * @param[in]       *pX points to the state vector, holding the initial state.
+ * @param[in]       *pP points to the packed upper triangle of the covariance, holding the initial covariance.
+ * @param[in]       *pScratch points to the working buffer, of length <code>2*numStates*numStates+numStates</code>.
+ * @param[in]       *pIndex points to the index buffer, of length <code>numStates</code>.
+ * @return     		The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numStates</code>
+ * is zero and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * The filter works directly on <code>pX</code> and <code>pP</code>; the application
+ * may read, or overwrite, them between calls.
+ */
+
+arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  float32_t * pX,
+  float32_t * pP,
+  float32_t * pScratch,
+  uint16_t * pIndex)
+{
+  arm_status status;
+
+  if(numStates == 0u)
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    S->numStates = numStates;
+    S->pX = pX;
+    S->pP = pP;
+    S->pScratch = pScratch;
+    S->pIndex = pIndex;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
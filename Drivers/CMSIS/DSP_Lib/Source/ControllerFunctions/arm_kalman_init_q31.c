@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_kalman_init_q31.c
+*
+* Description:	Q31 Kalman filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Kalman filter.
+ * @param[out]      *S points to an instance of the Q31 Kalman filter structure.
+ * @param[in]       numStates number of states.
+ * @param[in]       fShift the transition matrix is in Q(31-fShift) format, at most 15.
+ * @param[in]       hShift the measurement matrix is in Q(31-hShift) format, at most 31.
+ * @param[in]       *pX points to the state vector, holding the initial state.
+ * @param[in]       *pP points to the packed upper triangle of the covariance, holding the initial covariance.
+ * @param[in]       *pScratch points to the working buffer, of length <code>2*numStates*numStates+numStates</code>.
+ * @param[in]       *pIndex points to the index buffer, of length <code>numStates</code>.
+ * @return     		The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numStates</code>
+ * is zero or a shift is out of range, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * <code>fShift</code> is limited to 15 because the prediction step forms
+ * <code>F * P * F^T</code>, in which the format of <code>F</code> appears twice.
+ */
+
+arm_status arm_kalman_init_q31(
+  arm_kalman_instance_q31 * S,
+  uint16_t numStates,
+  uint8_t fShift,
+  uint8_t hShift,
+  q31_t * pX,
+  q31_t * pP,
+  q31_t * pScratch,
+  uint16_t * pIndex)
+{
+  arm_status status;
+
+  if((numStates == 0u) || (fShift > 15u) || (hShift > 31u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    S->numStates = numStates;
+    S->fShift = fShift;
+    S->hShift = hShift;
+    S->pX = pX;
+    S->pP = pP;
+    S->pScratch = pScratch;
+    S->pIndex = pIndex;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
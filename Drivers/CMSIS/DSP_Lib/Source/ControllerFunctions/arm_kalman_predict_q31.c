@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_kalman_predict_q31.c
+*
+* Description:	Q31 Kalman filter prediction step.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Prediction step of the Q31 Kalman filter.
+ * @param[in,out]   *S points to an instance of the Q31 Kalman filter structure.
+ * @param[in]       *pF points to the n x n state transition matrix, or its Jacobian, in Q(31-fShift) format.
+ * @param[in]       *pQ points to the packed upper triangle of the process noise covariance, or NULL for none.
+ * @param[in]       stateFlag 1 = propagate the state as <code>x = F * x</code>,
+ * 0 = leave the state as the application has already propagated it.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * <code>F * P</code> is computed with <code>arm_mat_mult_q31()</code> and is thus
+ * held scaled down by 2^fShift.  The upper triangle of its product with
+ * <code>F^T</code> and the state <code>F * x</code> are accumulated in 64 bits,
+ * shifted back to 1.31 format and saturated.
+ */
+
+void arm_kalman_predict_q31(
+  arm_kalman_instance_q31 * S,
+  const arm_matrix_instance_q31 * pF,
+  const q31_t * pQ,
+  uint8_t stateFlag)
+{
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t fShift = S->fShift;                   /* format of F */
+  q31_t *pP = S->pP;                             /* packed covariance */
+  q31_t *pFull = S->pScratch;                    /* unpacked covariance, n x n */
+  q31_t *pT = pFull + n * n;                     /* F * P / 2^fShift, n x n */
+  q31_t *pXNew = pT + n * n;                     /* F * x, n x 1 */
+  q31_t *pFj, *pTi;                              /* matrix rows */
+  q63_t sum;                                     /* Accumulator */
+  arm_matrix_instance_q31 full, prod;            /* views of the working buffer */
+  uint32_t i, j, k;                              /* loop counters */
+
+  /* Unpack the upper triangle into a full symmetric matrix */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = i; j < n; j++)
+    {
+      pFull[i * n + j] = *pP;
+      pFull[j * n + i] = *pP++;
+    }
+  }
+
+  /* T = F * P, in 1.31 format scaled down by 2^fShift */
+  arm_mat_init_q31(&full, (uint16_t) n, (uint16_t) n, pFull);
+  arm_mat_init_q31(&prod, (uint16_t) n, (uint16_t) n, pT);
+  arm_mat_mult_q31(pF, &full, &prod);
+
+  /* P = T * F^T + Q, upper triangle only: P(i,j) = sum(T(i,k) * F(j,k)) */
+  pP = S->pP;
+
+  for (i = 0u; i < n; i++)
+  {
+    pTi = pT + i * n;
+
+    for (j = i; j < n; j++)
+    {
+      pFj = pF->pData + j * n;
+      sum = 0;
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += (q63_t) pTi[k] * pFj[k];
+      }
+
+      sum >>= 31u - 2u * fShift;
+
+      if (pQ != NULL)
+      {
+        sum += *pQ++;
+      }
+
+      *pP++ = clip_q63_to_q31(sum);
+    }
+  }
+
+  /* x = F * x */
+  if (stateFlag == 1u)
+  {
+    for (i = 0u; i < n; i++)
+    {
+      pFj = pF->pData + i * n;
+      sum = 0;
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += (q63_t) pFj[k] * S->pX[k];
+      }
+
+      pXNew[i] = clip_q63_to_q31(sum >> (31u - fShift));
+    }
+
+    arm_copy_q31(pXNew, S->pX, n);
+  }
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_kalman_update_f32.c
+*
+* Description:	Floating-point Kalman filter measurement update step.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Measurement update step of the floating-point Kalman filter.
+ * @param[in,out]   *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]       *pH points to the m x n measurement matrix, or its Jacobian.
+ * @param[in]       *pZ points to the m measurements.
+ * @param[in]       *pR points to the m measurement noise variances (the diagonal of R).
+ * @param[in]       *pHx points to the m predicted measurements h(x), or NULL to use <code>H * x</code>.
+ * @return     		The function returns <code>ARM_MATH_SINGULAR</code> if a measurement was
+ * skipped because its innovation variance was not positive, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * The measurements are applied one row of <code>H</code> at a time.  For a row
+ * <code>h</code> with nonzero elements at the columns J:
+ * <pre>
+ *     v = P * h^T                  (only the columns J of P are read)
+ *     s = h * v + r
+ *     y = z - h(x) - h * (x - x0)  (x0 is the state on entry)
+ *     x = x + v * y / s
+ *     P = P - v * v^T / s          (upper triangle only)
+ * </pre>
+ * For a linear measurement (<code>pHx == NULL</code>) the innovation reduces to
+ * <code>z - h * x</code>.
+ */
+
+arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  const float32_t * pZ,
+  const float32_t * pR,
+  const float32_t * pHx)
+{
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t m = pH->numRows;                      /* number of measurements */
+  float32_t *pX = S->pX;                         /* state vector */
+  float32_t *pP;                                 /* packed covariance */
+  float32_t *pX0 = S->pScratch;                  /* state on entry */
+  float32_t *pV = pX0 + n;                       /* P * h^T */
+  float32_t *pHr;                                /* row of H */
+  uint16_t *pIdx = S->pIndex;                    /* nonzero columns of the row */
+  float32_t sum, y, s, w;                        /* Temporary variables */
+  uint32_t r, i, j, k, nnz;                      /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the update */
+
+  if (pHx != NULL)
+  {
+    arm_copy_f32(pX, pX0, n);
+  }
+
+  for (r = 0u; r < m; r++)
+  {
+    pHr = pH->pData + r * n;
+
+    /* Nonzero columns of this row */
+    nnz = 0u;
+    for (j = 0u; j < n; j++)
+    {
+      if (pHr[j] != 0.0f)
+      {
+        pIdx[nnz++] = (uint16_t) j;
+      }
+    }
+
+    if (nnz == 0u)
+    {
+      continue;
+    }
+
+    /* Innovation */
+    y = pZ[r];
+    for (k = 0u; k < nnz; k++)
+    {
+      j = pIdx[k];
+      y -= pHr[j] * ((pHx != NULL) ? (pX[j] - pX0[j]) : pX[j]);
+    }
+    if (pHx != NULL)
+    {
+      y -= pHx[r];
+    }
+
+    /* v = P * h^T, P(i,j) is read from the upper triangle */
+    for (i = 0u; i < n; i++)
+    {
+      sum = 0.0f;
+
+      for (k = 0u; k < nnz; k++)
+      {
+        j = pIdx[k];
+
+        if (i <= j)
+        {
+          sum += S->pP[((i * (2u * n - i + 1u)) >> 1u) + (j - i)] * pHr[j];
+        }
+        else
+        {
+          sum += S->pP[((j * (2u * n - j + 1u)) >> 1u) + (i - j)] * pHr[j];
+        }
+      }
+
+      pV[i] = sum;
+    }
+
+    /* Innovation variance s = h * v + r */
+    s = pR[r];
+    for (k = 0u; k < nnz; k++)
+    {
+      j = pIdx[k];
+      s += pHr[j] * pV[j];
+    }
+
+    if (!(s > 0.0f))
+    {
+      status = ARM_MATH_SINGULAR;
+      continue;
+    }
+
+    s = 1.0f / s;
+    y *= s;
+
+    /* x = x + v * y / s and the rank-one downdate P = P - v * v^T / s */
+    pP = S->pP;
+
+    for (i = 0u; i < n; i++)
+    {
+      pX[i] += pV[i] * y;
+      w = pV[i] * s;
+
+      for (j = i; j < n; j++)
+      {
+        *pP++ -= w * pV[j];
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,215 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_kalman_update_q31.c
+*
+* Description:	Q31 Kalman filter measurement update step.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Measurement update step of the Q31 Kalman filter.
+ * @param[in,out]   *S points to an instance of the Q31 Kalman filter structure.
+ * @param[in]       *pH points to the m x n measurement matrix, or its Jacobian, in Q(31-hShift) format.
+ * @param[in]       *pZ points to the m measurements.
+ * @param[in]       *pR points to the m measurement noise variances (the diagonal of R).
+ * @param[in]       *pHx points to the m predicted measurements h(x), or NULL to use <code>H * x</code>.
+ * @return     		The function returns <code>ARM_MATH_SINGULAR</code> if a measurement was
+ * skipped because its innovation variance was not positive, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * Same sequential algorithm as <code>arm_kalman_update_f32()</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * All sums are accumulated in 64 bits and saturated to 1.31 format when stored.
+ * The gain <code>v / s</code> of each measurement can exceed 1; it is computed
+ * with a per-measurement shift chosen so that it fits a 32-bit value, with one
+ * 64-bit division per state.
+ */
+
+arm_status arm_kalman_update_q31(
+  arm_kalman_instance_q31 * S,
+  const arm_matrix_instance_q31 * pH,
+  const q31_t * pZ,
+  const q31_t * pR,
+  const q31_t * pHx)
+{
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t m = pH->numRows;                      /* number of measurements */
+  uint32_t hShift = S->hShift;                   /* format of H */
+  q31_t *pX = S->pX;                             /* state vector */
+  q31_t *pP;                                     /* packed covariance */
+  q31_t *pX0 = S->pScratch;                      /* state on entry */
+  q31_t *pV = pX0 + n;                           /* P * h^T */
+  q31_t *pU = pV + n;                            /* gain v / s, in Q(31-kShift) */
+  q31_t *pHr;                                    /* row of H */
+  uint16_t *pIdx = S->pIndex;                    /* nonzero columns of the row */
+  q63_t sum, y;                                  /* Accumulators */
+  q31_t s, vMax;                                 /* innovation variance, largest |v| */
+  uint32_t kShift;                               /* format of the gain */
+  uint32_t r, i, j, k, nnz;                      /* loop counters */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the update */
+
+  if (pHx != NULL)
+  {
+    arm_copy_q31(pX, pX0, n);
+  }
+
+  for (r = 0u; r < m; r++)
+  {
+    pHr = pH->pData + r * n;
+
+    /* Nonzero columns of this row */
+    nnz = 0u;
+    for (j = 0u; j < n; j++)
+    {
+      if (pHr[j] != 0)
+      {
+        pIdx[nnz++] = (uint16_t) j;
+      }
+    }
+
+    if (nnz == 0u)
+    {
+      continue;
+    }
+
+    /* Innovation */
+    sum = 0;
+    for (k = 0u; k < nnz; k++)
+    {
+      j = pIdx[k];
+      sum += (q63_t) pHr[j] * ((pHx != NULL) ? ((q63_t) pX[j] - pX0[j]) : (q63_t) pX[j]);
+    }
+    y = (q63_t) pZ[r] - (sum >> (31u - hShift));
+    if (pHx != NULL)
+    {
+      y -= pHx[r];
+    }
+    y = clip_q63_to_q31(y);
+
+    /* v = P * h^T, P(i,j) is read from the upper triangle */
+    vMax = 0;
+
+    for (i = 0u; i < n; i++)
+    {
+      sum = 0;
+
+      for (k = 0u; k < nnz; k++)
+      {
+        j = pIdx[k];
+
+        if (i <= j)
+        {
+          sum += (q63_t) S->pP[((i * (2u * n - i + 1u)) >> 1u) + (j - i)] * pHr[j];
+        }
+        else
+        {
+          sum += (q63_t) S->pP[((j * (2u * n - j + 1u)) >> 1u) + (i - j)] * pHr[j];
+        }
+      }
+
+      pV[i] = clip_q63_to_q31(sum >> (31u - hShift));
+
+      if (pV[i] > vMax)
+      {
+        vMax = pV[i];
+      }
+      else if (-(q63_t) pV[i] > vMax)
+      {
+        vMax = clip_q63_to_q31(-(q63_t) pV[i]);
+      }
+    }
+
+    /* Innovation variance s = h * v + r */
+    sum = 0;
+    for (k = 0u; k < nnz; k++)
+    {
+      j = pIdx[k];
+      sum += (q63_t) pHr[j] * pV[j];
+    }
+    s = clip_q63_to_q31((sum >> (31u - hShift)) + pR[r]);
+
+    if (s <= 0)
+    {
+      status = ARM_MATH_SINGULAR;
+      continue;
+    }
+
+    /* Smallest shift for which every |v / s| < 2^kShift */
+    kShift = 0u;
+    while ((q63_t) vMax >= ((q63_t) s << kShift))
+    {
+      kShift++;
+    }
+
+    /* u = v / s in Q(31-kShift) */
+    for (i = 0u; i < n; i++)
+    {
+      pU[i] = (q31_t) (((q63_t) pV[i] << (31u - kShift)) / s);
+    }
+
+    /* x = x + u * y and the rank-one downdate P = P - u * v^T */
+    pP = S->pP;
+
+    for (i = 0u; i < n; i++)
+    {
+      pX[i] = clip_q63_to_q31((q63_t) pX[i] + (((q63_t) pU[i] * y) >> (31u - kShift)));
+
+      for (j = i; j < n; j++)
+      {
+        *pP = clip_q63_to_q31((q63_t) *pP - (((q63_t) pU[i] * pV[j]) >> (31u - kShift)));
+        pP++;
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,287 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_multichannel_df1_q31.c
+*
+* Description:	Processing function for the multichannel Q31 Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/* Channel counts up to this value get their own inlined copy of the stage kernel */
+#define ARM_BIQUAD_MC_MAX_CHANNELS   8u
+
+#if defined ( __CC_ARM )
+  #define ARM_BIQUAD_MC_INLINE  static __forceinline
+#elif defined ( __GNUC__ )
+  #define ARM_BIQUAD_MC_INLINE  static __INLINE __attribute__((always_inline))
+#else
+  #define ARM_BIQUAD_MC_INLINE  static __INLINE
+#endif
+
+/*
+ * One Biquad stage for numChannels interleaved channels.  When numChannels is
+ * a literal the channel loop is fully unrolled and the channel states are
+ * kept in local variables for the whole block.
+ */
+ARM_BIQUAD_MC_INLINE void arm_biquad_mc_df1_stage_q31(
+  q31_t * pIn,
+  q31_t * pOut,
+  q31_t * pState,
+  const q31_t * pCoeffs,
+  uint32_t blockSize,
+  uint32_t numChannels,
+  uint32_t lShift)
+{
+  q31_t Xn1[ARM_BIQUAD_MC_MAX_CHANNELS];         /*  Filter state variables        */
+  q31_t Xn2[ARM_BIQUAD_MC_MAX_CHANNELS];
+  q31_t Yn1[ARM_BIQUAD_MC_MAX_CHANNELS];
+  q31_t Yn2[ARM_BIQUAD_MC_MAX_CHANNELS];
+  q31_t b0 = pCoeffs[0];                         /*  Filter coefficients           */
+  q31_t b1 = pCoeffs[1];
+  q31_t b2 = pCoeffs[2];
+  q31_t a1 = pCoeffs[3];
+  q31_t a2 = pCoeffs[4];
+  q31_t Xn;                                      /*  temporary input               */
+  q63_t acc;                                     /*  accumulator                   */
+  uint32_t sample, c;                            /*  loop counters                 */
+
+  for (c = 0u; c < numChannels; c++)
+  {
+    Xn1[c] = pState[4u * c];
+    Xn2[c] = pState[(4u * c) + 1u];
+    Yn1[c] = pState[(4u * c) + 2u];
+    Yn2[c] = pState[(4u * c) + 3u];
+  }
+
+  sample = blockSize;
+
+  while(sample > 0u)
+  {
+    for (c = 0u; c < numChannels; c++)
+    {
+      Xn = pIn[c];
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (q63_t) b0 * Xn;
+      acc += (q63_t) b1 * Xn1[c];
+      acc += (q63_t) b2 * Xn2[c];
+      acc += (q63_t) a1 * Yn1[c];
+      acc += (q63_t) a2 * Yn2[c];
+
+      /* The result is converted to 1.31  */
+      acc = acc >> lShift;
+
+      Xn2[c] = Xn1[c];
+      Xn1[c] = Xn;
+      Yn2[c] = Yn1[c];
+      Yn1[c] = (q31_t) acc;
+
+      pOut[c] = (q31_t) acc;
+    }
+
+    pIn += numChannels;
+    pOut += numChannels;
+
+    sample--;
+  }
+
+  for (c = 0u; c < numChannels; c++)
+  {
+    pState[4u * c] = Xn1[c];
+    pState[(4u * c) + 1u] = Xn2[c];
+    pState[(4u * c) + 2u] = Yn1[c];
+    pState[(4u * c) + 3u] = Yn2[c];
+  }
+}
+
+/*
+ * One Biquad stage for any number of channels, one channel at a time.
+ */
+static void arm_biquad_mc_df1_stage_strided_q31(
+  q31_t * pIn,
+  q31_t * pOut,
+  q31_t * pState,
+  const q31_t * pCoeffs,
+  uint32_t blockSize,
+  uint32_t numChannels,
+  uint32_t lShift)
+{
+  q31_t b0 = pCoeffs[0];                         /*  Filter coefficients           */
+  q31_t b1 = pCoeffs[1];
+  q31_t b2 = pCoeffs[2];
+  q31_t a1 = pCoeffs[3];
+  q31_t a2 = pCoeffs[4];
+  q31_t Xn, Xn1, Xn2, Yn1, Yn2;                  /*  Filter state variables        */
+  q31_t *pI, *pO;
+  q63_t acc;                                     /*  accumulator                   */
+  uint32_t sample, c;                            /*  loop counters                 */
+
+  for (c = 0u; c < numChannels; c++)
+  {
+    Xn1 = pState[4u * c];
+    Xn2 = pState[(4u * c) + 1u];
+    Yn1 = pState[(4u * c) + 2u];
+    Yn2 = pState[(4u * c) + 3u];
+    pI = pIn + c;
+    pO = pOut + c;
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      Xn = *pI;
+
+      acc = (q63_t) b0 * Xn;
+      acc += (q63_t) b1 * Xn1;
+      acc += (q63_t) b2 * Xn2;
+      acc += (q63_t) a1 * Yn1;
+      acc += (q63_t) a2 * Yn2;
+
+      acc = acc >> lShift;
+
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = (q31_t) acc;
+
+      *pO = (q31_t) acc;
+
+      pI += numChannels;
+      pO += numChannels;
+
+      sample--;
+    }
+
+    pState[4u * c] = Xn1;
+    pState[(4u * c) + 1u] = Xn2;
+    pState[(4u * c) + 2u] = Yn1;
+    pState[(4u * c) + 3u] = Yn2;
+  }
+}
+
+/**
+ * @brief Processing function for the multichannel Q31 Biquad cascade filter.
+ * @param[in]  *S         points to an instance of the multichannel Q31 Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of interleaved input data.
+ * @param[out] *pDst      points to the block of interleaved output data.
+ * @param[in]  blockSize  number of samples per channel to process per call.
+ * @return none.
+ *
+ * \par
+ * The input and output buffers hold <code>blockSize</code> frames of <code>numChannels</code>
+ * interleaved samples.  All channels are filtered with the same coefficients and the results
+ * are bit exact with <code>numChannels</code> separate <code>arm_biquad_cascade_df1_q31()</code> instances.
+ * Channel counts from 1 to 8 use a kernel specialized at compile time; larger counts are
+ * processed one channel at a time.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format, exactly as
+ * <code>arm_biquad_cascade_df1_q31()</code>.
+ * If the accumulator result overflows it wraps around rather than clip.
+ * In order to avoid overflows completely the input signal must be scaled down by 2 bits and lie in the range [-0.25 +0.25).
+ * After all 5 multiply-accumulates are performed, the 2.62 accumulator is shifted by <code>postShift</code> bits and the result truncated to
+ * 1.31 format by discarding the low 32 bits.
+ */
+
+void arm_biquad_cascade_multichannel_df1_q31(
+  const arm_biquad_cascade_multichannel_df1_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t lShift = 31u - (uint32_t) S->postShift;  /*  Shift to be applied to the output */
+  q31_t *pIn = pSrc;                             /*  input pointer initialization  */
+  q31_t *pState = S->pState;                     /*  pState pointer initialization */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  uint32_t numChannels = S->numChannels;         /*  number of channels            */
+  uint32_t stage = S->numStages;                 /*  loop counter                  */
+
+  do
+  {
+    switch (numChannels)
+    {
+    case 1u:
+      arm_biquad_mc_df1_stage_q31(pIn, pDst, pState, pCoeffs, blockSize, 1u, lShift);
+      break;
+    case 2u:
+      arm_biquad_mc_df1_stage_q31(pIn, pDst, pState, pCoeffs, blockSize, 2u, lShift);
+      break;
+    case 3u:
+      arm_biquad_mc_df1_stage_q31(pIn, pDst, pState, pCoeffs, blockSize, 3u, lShift);
+      break;
+    case 4u:
+      arm_biquad_mc_df1_stage_q31(pIn, pDst, pState, pCoeffs, blockSize, 4u, lShift);
+      break;
+    case 5u:
+      arm_biquad_mc_df1_stage_q31(pIn, pDst, pState, pCoeffs, blockSize, 5u, lShift);
+      break;
+    case 6u:
+      arm_biquad_mc_df1_stage_q31(pIn, pDst, pState, pCoeffs, blockSize, 6u, lShift);
+      break;
+    case 7u:
+      arm_biquad_mc_df1_stage_q31(pIn, pDst, pState, pCoeffs, blockSize, 7u, lShift);
+      break;
+    case 8u:
+      arm_biquad_mc_df1_stage_q31(pIn, pDst, pState, pCoeffs, blockSize, 8u, lShift);
+      break;
+    default:
+      arm_biquad_mc_df1_stage_strided_q31(pIn, pDst, pState, pCoeffs, blockSize, numChannels, lShift);
+      break;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    pCoeffs += 5u;
+    pState += 4u * numChannels;
+
+  } while(--stage);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
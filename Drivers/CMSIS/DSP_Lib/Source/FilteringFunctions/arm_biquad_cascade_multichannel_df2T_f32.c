@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_multichannel_df2T_f32.c
+*
+* Description:	Processing function for the multichannel floating-point transposed direct form II Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/* Channel counts up to this value get their own inlined copy of the stage kernel */
+#define ARM_BIQUAD_MC_MAX_CHANNELS   8u
+
+#if defined ( __CC_ARM )
+  #define ARM_BIQUAD_MC_INLINE  static __forceinline
+#elif defined ( __GNUC__ )
+  #define ARM_BIQUAD_MC_INLINE  static __INLINE __attribute__((always_inline))
+#else
+  #define ARM_BIQUAD_MC_INLINE  static __INLINE
+#endif
+
+/*
+ * One Biquad stage for numChannels interleaved channels.  When numChannels is
+ * a literal the channel loop is fully unrolled and the states of all channels
+ * stay in registers; the recursions of the channels are independent, so their
+ * multiply-accumulates overlap in the pipeline.
+ */
+ARM_BIQUAD_MC_INLINE void arm_biquad_mc_df2T_stage_f32(
+  float32_t * pIn,
+  float32_t * pOut,
+  float32_t * pState,
+  const float32_t * pCoeffs,
+  uint32_t blockSize,
+  uint32_t numChannels)
+{
+  float32_t d1[ARM_BIQUAD_MC_MAX_CHANNELS];      /*  state variables           */
+  float32_t d2[ARM_BIQUAD_MC_MAX_CHANNELS];
+  float32_t b0 = pCoeffs[0];                     /*  Filter coefficients       */
+  float32_t b1 = pCoeffs[1];
+  float32_t b2 = pCoeffs[2];
+  float32_t a1 = pCoeffs[3];
+  float32_t a2 = pCoeffs[4];
+  float32_t Xn, acc;                             /*  input and accumulator     */
+  uint32_t sample, c;                            /*  loop counters             */
+
+  for (c = 0u; c < numChannels; c++)
+  {
+    d1[c] = pState[2u * c];
+    d2[c] = pState[(2u * c) + 1u];
+  }
+
+  sample = blockSize;
+
+  while(sample > 0u)
+  {
+    for (c = 0u; c < numChannels; c++)
+    {
+      Xn = pIn[c];
+
+      acc = (b0 * Xn) + d1[c];
+      d1[c] = ((b1 * Xn) + (a1 * acc)) + d2[c];
+      d2[c] = (b2 * Xn) + (a2 * acc);
+
+      pOut[c] = acc;
+    }
+
+    pIn += numChannels;
+    pOut += numChannels;
+
+    sample--;
+  }
+
+  for (c = 0u; c < numChannels; c++)
+  {
+    pState[2u * c] = d1[c];
+    pState[(2u * c) + 1u] = d2[c];
+  }
+}
+
+/*
+ * One Biquad stage for any number of channels, one channel at a time.
+ */
+static void arm_biquad_mc_df2T_stage_strided_f32(
+  float32_t * pIn,
+  float32_t * pOut,
+  float32_t * pState,
+  const float32_t * pCoeffs,
+  uint32_t blockSize,
+  uint32_t numChannels)
+{
+  float32_t b0 = pCoeffs[0];                     /*  Filter coefficients       */
+  float32_t b1 = pCoeffs[1];
+  float32_t b2 = pCoeffs[2];
+  float32_t a1 = pCoeffs[3];
+  float32_t a2 = pCoeffs[4];
+  float32_t d1, d2, Xn, acc;
+  float32_t *pI, *pO;
+  uint32_t sample, c;                            /*  loop counters             */
+
+  for (c = 0u; c < numChannels; c++)
+  {
+    d1 = pState[2u * c];
+    d2 = pState[(2u * c) + 1u];
+    pI = pIn + c;
+    pO = pOut + c;
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      Xn = *pI;
+
+      acc = (b0 * Xn) + d1;
+      d1 = ((b1 * Xn) + (a1 * acc)) + d2;
+      d2 = (b2 * Xn) + (a2 * acc);
+
+      *pO = acc;
+
+      pI += numChannels;
+      pO += numChannels;
+
+      sample--;
+    }
+
+    pState[2u * c] = d1;
+    pState[(2u * c) + 1u] = d2;
+  }
+}
+
+/**
+* @brief Processing function for the multichannel floating-point transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input data.
+* @param[out] *pDst     points to the block of interleaved output data.
+* @param[in]  blockSize number of samples per channel to process.
+* @return none.
+*
+* \par
+* The input and output buffers hold <code>blockSize</code> frames of <code>numChannels</code>
+* interleaved samples, <code>{x0[0], x1[0], ..., x0[1], x1[1], ...}</code>.
+* All channels are filtered with the same coefficients and produce the same results as
+* <code>numChannels</code> separate <code>arm_biquad_cascade_df2T_f32()</code> instances;
+* the coefficients of a stage are read once per block for all the channels.
+* \par
+* Channel counts from 1 to 8 use a kernel specialized at compile time, which keeps all
+* the channel states in registers.  Larger counts are processed one channel at a time.
+*/
+
+void arm_biquad_cascade_multichannel_df2T_f32(
+const arm_biquad_cascade_multichannel_df2T_instance_f32 * S,
+float32_t * pSrc,
+float32_t * pDst,
+uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  uint32_t numChannels = S->numChannels;         /*  number of channels        */
+  uint32_t stage = S->numStages;                 /*  loop counter              */
+
+  do
+  {
+    switch (numChannels)
+    {
+    case 1u:
+      arm_biquad_mc_df2T_stage_f32(pIn, pDst, pState, pCoeffs, blockSize, 1u);
+      break;
+    case 2u:
+      arm_biquad_mc_df2T_stage_f32(pIn, pDst, pState, pCoeffs, blockSize, 2u);
+      break;
+    case 3u:
+      arm_biquad_mc_df2T_stage_f32(pIn, pDst, pState, pCoeffs, blockSize, 3u);
+      break;
+    case 4u:
+      arm_biquad_mc_df2T_stage_f32(pIn, pDst, pState, pCoeffs, blockSize, 4u);
+      break;
+    case 5u:
+      arm_biquad_mc_df2T_stage_f32(pIn, pDst, pState, pCoeffs, blockSize, 5u);
+      break;
+    case 6u:
+      arm_biquad_mc_df2T_stage_f32(pIn, pDst, pState, pCoeffs, blockSize, 6u);
+      break;
+    case 7u:
+      arm_biquad_mc_df2T_stage_f32(pIn, pDst, pState, pCoeffs, blockSize, 7u);
+      break;
+    case 8u:
+      arm_biquad_mc_df2T_stage_f32(pIn, pDst, pState, pCoeffs, blockSize, 8u);
+      break;
+    default:
+      arm_biquad_mc_df2T_stage_strided_f32(pIn, pDst, pState, pCoeffs, blockSize, numChannels);
+      break;
+    }
+
+    /* The first stage goes from the input buffer to the output buffer. */
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    pCoeffs += 5u;
+    pState += 2u * numChannels;
+
+  } while(--stage);
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
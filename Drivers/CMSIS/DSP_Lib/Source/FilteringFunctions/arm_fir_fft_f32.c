@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fft_f32.c
+*
+* Description:	Floating-point FFT-based (overlap-save) FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @defgroup FIR_FFT FFT-based FIR Filter
+*
+* This function implements a long floating-point FIR filter with fast convolution.
+* For filters of hundreds or thousands of taps, <code>arm_fir_f32()</code> costs
+* <code>numTaps</code> multiply-accumulates per sample, while the FFT-based filter
+* costs about <code>2*fftLen*log2(fftLen)/blockSize</code> operations per sample.
+*
+* \par Algorithm:
+* The filter uses the overlap-save method. The spectrum <code>H</code> of the
+* zero-padded impulse response is computed once by the initialization function.
+* Every call then:
+* - appends the new block to the last <code>fftLen - blockSize</code> input samples,
+* - computes the real FFT of these <code>fftLen</code> samples with <code>arm_rfft_fast_f32()</code>,
+* - multiplies it by <code>H</code> with <code>arm_cmplx_mult_cmplx_f32()</code>,
+* - computes the inverse real FFT and outputs its last <code>blockSize</code> samples.
+* \par
+* Since <code>fftLen >= numTaps + blockSize - 1</code>, the circular wrap-around only
+* affects the discarded samples, and the output is identical to <code>arm_fir_f32()</code>
+* up to rounding.
+*
+* \par Path selection:
+* The initialization function compares the cost of both methods and falls back to
+* <code>arm_fir_f32()</code> when the direct filter is cheaper, as for short filters or
+* small blocks. The application uses the same calls in both cases.
+*
+* \par Instance Structure
+* The coefficients, state and FFT instances are stored together in an instance data structure.
+* A separate instance structure must be defined for each filter.
+* Coefficient arrays may be shared among several instances while state arrays cannot be shared.
+*/
+
+/**
+* @addtogroup FIR_FFT
+* @{
+*/
+
+/**
+* @param[in,out] *S          points to an instance of the floating-point FFT-based FIR filter structure.
+* @param[in]     *pSrc       points to the block of input data.
+* @param[out]    *pDst       points to the block of output data.
+* @param[in]     blockSize   number of samples to process per call, at most the blockSize given to the init function.
+* @return        none.
+*/
+
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t fftLen = S->fftLen;                   /* FFT length                 */
+  float32_t *pHist = S->pState;                  /* input history              */
+  float32_t *pX = S->pScratch;                   /* time domain scratch        */
+  float32_t *pY = S->pScratch + fftLen;          /* frequency domain scratch   */
+  float32_t *pH = S->pSpectrum;                  /* filter spectrum            */
+
+  if (fftLen == 0u)
+  {
+    /* Direct FIR is cheaper for this filter */
+    arm_fir_f32(&S->fir, pSrc, pDst, blockSize);
+    return;
+  }
+
+  /* Slide the history and append the new block */
+  memmove(pHist, pHist + blockSize, (fftLen - blockSize) * sizeof(float32_t));
+  memcpy(pHist + (fftLen - blockSize), pSrc, blockSize * sizeof(float32_t));
+
+  /* The real FFT modifies its input, so transform a copy of the history */
+  memcpy(pX, pHist, fftLen * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->rfft, pX, pY, 0u);
+
+  /* Y = X * H. DC and Nyquist are real and packed in the first complex pair */
+  pY[0] *= pH[0];
+  pY[1] *= pH[1];
+  arm_cmplx_mult_cmplx_f32(pY + 2u, pH + 2u, pY + 2u, (fftLen / 2u) - 1u);
+
+  /* Back to the time domain; the first fftLen - blockSize samples are wrapped and discarded */
+  arm_rfft_fast_f32(&S->rfft, pY, pX, 1u);
+  memcpy(pDst, pX + (fftLen - blockSize), blockSize * sizeof(float32_t));
+}
+
+/**
+* @} end of FIR_FFT group
+*/
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fft_init_f32.c
+*
+* Description:	Floating-point FFT-based (overlap-save) FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * Relative cost of one butterfly operation of arm_rfft_fast_f32() against one
+ * multiply-accumulate of arm_fir_f32(), in 1/16 units. It is used to choose between
+ * the direct and the FFT path and was calibrated with the crossover measured by
+ * arm_benchmark_example. It can be overridden at build time.
+ */
+#ifndef ARM_FIR_FFT_COST_FACTOR
+#define ARM_FIR_FFT_COST_FACTOR  32u
+#endif
+
+/**
+ * @brief  Initialization function for the floating-point FFT-based FIR filter.
+ * @param[in,out] *S          points to an instance of the floating-point FFT-based FIR filter structure.
+ * @param[in]     numTaps     Number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs    points to the filter coefficients buffer.
+ * @param[in]     *pState     points to the state buffer.
+ * @param[in]     blockSize   maximum number of samples that are processed per call.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numTaps</code> or <code>blockSize</code> is zero.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+ * exactly as for <code>arm_fir_init_f32()</code>:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * The FFT length <code>fftLen</code> is the smallest power of two, at least 32, that is
+ * greater than or equal to <code>numTaps + blockSize - 1</code>.
+ * <code>pState</code> points to an array of <code>4*fftLen</code> samples. It holds the input
+ * history, the filter spectrum and the FFT scratch area.
+ * \par
+ * The function estimates the cost per sample of the direct filter (<code>numTaps</code>
+ * multiply-accumulates) and of the FFT filter (two real FFTs of <code>fftLen</code> points
+ * and a complex multiplication, spread over <code>blockSize</code> samples), and selects
+ * the cheaper one. The direct path is also used when <code>fftLen</code> would exceed 4096.
+ * In that case only <code>numTaps + blockSize - 1</code> samples of <code>pState</code> are used.
+ */
+
+arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  uint32_t fftLen = 32u;                         /* FFT length                 */
+  uint32_t log2Len = 5u;                         /* log2 of the FFT length     */
+  uint32_t fftCost, directCost;                  /* cost per block             */
+  uint32_t i;
+
+  if ((numTaps == 0u) || (blockSize == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+
+  /* Smallest power of two that holds one block of linear convolution */
+  while ((fftLen < (numTaps + blockSize - 1u)) && (fftLen <= 4096u))
+  {
+    fftLen <<= 1;
+    log2Len++;
+  }
+
+  /* Two real FFTs of fftLen points, (fftLen/2)*log2(fftLen/2) butterflies each, plus the spectrum product */
+  fftCost = ((fftLen * (log2Len - 1u) * ARM_FIR_FFT_COST_FACTOR) / 16u) + (2u * fftLen);
+  directCost = (uint32_t) numTaps * blockSize;
+
+  if ((fftLen > 4096u) || (fftCost >= directCost))
+  {
+    /* Direct path: the state buffer is a regular FIR state buffer */
+    S->fftLen = 0u;
+    arm_fir_init_f32(&S->fir, numTaps, pCoeffs, pState, blockSize);
+    return (ARM_MATH_SUCCESS);
+  }
+
+  S->fftLen = (uint16_t) fftLen;
+  S->pState = pState;
+  S->pSpectrum = pState + fftLen;
+  S->pScratch = pState + (2u * fftLen);
+  (void) arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+
+  /* Keep the coefficients in the direct instance as well, so the filter can be inspected */
+  S->fir.numTaps = numTaps;
+  S->fir.pCoeffs = pCoeffs;
+  S->fir.pState = NULL;
+
+  /* Filter spectrum: b[n] zero padded to fftLen */
+  for (i = 0u; i < numTaps; i++)
+  {
+    S->pScratch[i] = pCoeffs[numTaps - 1u - i];
+  }
+  memset(&S->pScratch[numTaps], 0, (fftLen - numTaps) * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pSpectrum, 0u);
+
+  /* Clear the input history */
+  memset(S->pState, 0, fftLen * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_partitioned_f32.c
+*
+* Description:	Floating-point uniformly partitioned convolution FIR filter processing function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @defgroup FIR_Partitioned Partitioned Convolution FIR Filter
+*
+* This function implements a long floating-point FIR filter, such as a room or
+* cabinet impulse response, with a latency of one block.
+* The FFT-based filter <code>arm_fir_fft_f32()</code> needs an FFT longer than the
+* impulse response; here the impulse response is cut into partitions of
+* <code>blockSize</code> taps and every partition is convolved with an FFT of
+* <code>2*blockSize</code> points, so the cost stays close to fast convolution
+* while the delay is set by the block size only.
+*
+* \par Algorithm:
+* Uniformly partitioned overlap-save convolution with a frequency-domain delay line (FDL).
+* For every block of <code>blockSize</code> input samples:
+* - the last two input blocks are transformed with <code>arm_rfft_fast_f32()</code>,
+*   and the spectrum is stored in the FDL in place of the oldest one,
+* - the output spectrum is the sum over the partitions <code>k</code> of
+*   <code>X[t-k] * H[k]</code>, computed with <code>arm_cmplx_mult_cmplx_f32()</code>,
+* - the inverse real FFT gives the output block in its second half.
+* \par
+* The cost per block is two real FFTs plus <code>numParts</code> complex multiply-accumulates
+* of <code>blockSize</code> bins.
+*
+* \par Instance Structure
+* The spectra, delay line and FFT instance are stored together in an instance data structure.
+* A separate instance structure must be defined for each filter.
+*/
+
+/**
+* @addtogroup FIR_Partitioned
+* @{
+*/
+
+/**
+* @param[in,out] *S     points to an instance of the floating-point partitioned convolution structure.
+* @param[in]     *pSrc  points to the block of <code>blockSize</code> input samples.
+* @param[out]    *pDst  points to the block of <code>blockSize</code> output samples.
+* @return        none.
+*/
+
+void arm_fir_partitioned_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  uint32_t blockSize = S->blockSize;             /* partition size             */
+  uint32_t fftLen = S->fftLen;                   /* FFT length                 */
+  uint32_t numParts = S->numParts;               /* number of partitions       */
+  uint32_t slot = S->fdlIndex;                   /* FDL slot of X[t-k]         */
+  uint32_t k;
+  float32_t *pFrame = S->pFrame;                 /* last two input blocks      */
+  float32_t *pX = S->pScratch;                   /* FFT input copy / output    */
+  float32_t *pProd = S->pScratch + fftLen;       /* partition product          */
+  float32_t *pAcc = S->pScratch + (2u * fftLen); /* output spectrum            */
+  float32_t *pXk, *pHk;
+
+  /* Slide the input frame by one block */
+  memcpy(pFrame, pFrame + blockSize, blockSize * sizeof(float32_t));
+  memcpy(pFrame + blockSize, pSrc, blockSize * sizeof(float32_t));
+
+  /* X[t] replaces the oldest spectrum in the delay line */
+  memcpy(pX, pFrame, fftLen * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->rfft, pX, S->pFdl + (slot * fftLen), 0u);
+
+  /* Y = sum over k of X[t-k] * H[k] */
+  memset(pAcc, 0, fftLen * sizeof(float32_t));
+
+  for (k = 0u; k < numParts; k++)
+  {
+    pXk = S->pFdl + (slot * fftLen);
+    pHk = S->pSpectra + (k * fftLen);
+
+    /* DC and Nyquist are real and packed in the first complex pair */
+    pAcc[0] += pXk[0] * pHk[0];
+    pAcc[1] += pXk[1] * pHk[1];
+    arm_cmplx_mult_cmplx_f32(pXk + 2u, pHk + 2u, pProd + 2u, (fftLen / 2u) - 1u);
+    arm_add_f32(pAcc + 2u, pProd + 2u, pAcc + 2u, fftLen - 2u);
+
+    /* Step back in time through the circular delay line */
+    slot = (slot == 0u) ? (numParts - 1u) : (slot - 1u);
+  }
+
+  /* Back to the time domain; the second half is the output block */
+  arm_rfft_fast_f32(&S->rfft, pAcc, pX, 1u);
+  memcpy(pDst, pX + blockSize, blockSize * sizeof(float32_t));
+
+  /* Next spectrum goes to the following slot */
+  S->fdlIndex = (uint16_t) ((S->fdlIndex + 1u == numParts) ? 0u : (S->fdlIndex + 1u));
+}
+
+/**
+* @} end of FIR_Partitioned group
+*/
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_partitioned_init_f32.c
+*
+* Description:	Floating-point uniformly partitioned convolution FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Partitioned
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point partitioned convolution FIR filter.
+ * @param[in,out] *S          points to an instance of the floating-point partitioned convolution structure.
+ * @param[in]     numTaps     Number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs    points to the filter coefficients buffer.
+ * @param[in]     *pState     points to the state buffer.
+ * @param[in]     blockSize   number of samples processed per call.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numTaps</code> is zero or
+ * <code>blockSize</code> is not a power of two from 16 to 2048.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+ * exactly as for <code>arm_fir_init_f32()</code>:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * The impulse response is split into <code>numParts = ceil(numTaps/blockSize)</code> partitions
+ * and the spectrum of each one is computed with an FFT of <code>fftLen = 2*blockSize</code> points.
+ * <code>pState</code> points to an array of <code>(2*numParts + 4)*fftLen</code> samples that holds
+ * the partition spectra, the frequency-domain delay line, the input frame and the scratch area.
+ */
+
+arm_status arm_fir_partitioned_init_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint16_t blockSize)
+{
+  uint32_t fftLen = 2u * (uint32_t) blockSize;   /* FFT length                 */
+  uint32_t numParts;                             /* number of partitions       */
+  uint32_t k, i, n;
+  float32_t *pH;
+
+  /* The FFT length must be supported by arm_rfft_fast_f32() */
+  if ((numTaps == 0u) || (fftLen < 32u) || (fftLen > 4096u) || ((fftLen & (fftLen - 1u)) != 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  numParts = ((uint32_t) numTaps + blockSize - 1u) / blockSize;
+
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+  S->fftLen = (uint16_t) fftLen;
+  S->numParts = (uint16_t) numParts;
+  S->pSpectra = pState;
+  S->pFdl = pState + (numParts * fftLen);
+  S->pFrame = pState + (2u * numParts * fftLen);
+  S->pScratch = S->pFrame + fftLen;
+  (void) arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+
+  /* Spectrum of partition k: b[k*blockSize .. k*blockSize + blockSize - 1] zero padded to fftLen */
+  for (k = 0u; k < numParts; k++)
+  {
+    pH = S->pSpectra + (k * fftLen);
+
+    for (i = 0u; i < blockSize; i++)
+    {
+      n = (k * blockSize) + i;
+      S->pScratch[i] = (n < numTaps) ? pCoeffs[numTaps - 1u - n] : 0.0f;
+    }
+    memset(&S->pScratch[blockSize], 0, blockSize * sizeof(float32_t));
+
+    arm_rfft_fast_f32(&S->rfft, S->pScratch, pH, 0u);
+  }
+
+  arm_fir_partitioned_reset_f32(S);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Partitioned group
+ */
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_f32.c
+*
+* Description:	Floating-point rational L/M polyphase resampler.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Rational L/M Polyphase Resampler
+ *
+ * These functions change the sample rate of a signal by the rational factor <code>L/M</code>,
+ * for example 147/160 from 48 kHz to 44.1 kHz.
+ * Conceptually they are an FIR interpolator by <code>L</code> followed by a decimator by <code>M</code>:
+ * the signal is zero stuffed, low pass filtered and every <code>M</code>-th sample is kept.
+ * Only the samples that are kept are computed, and only the non-zero inputs are multiplied,
+ * so each output costs <code>phaseLength</code> multiply-accumulates and no intermediate
+ * high-rate buffer is needed.
+ *
+ * \par Algorithm:
+ * Output <code>m</code> sits at position <code>t = m*M</code> on the upsampled grid.
+ * With <code>n = t / L</code> and <code>j = t % L</code> it is the output <code>j</code> of the FIR interpolator
+ * for input <code>x[n]</code>:
+ * <pre>
+ *    y[m] = b[j] * x[n] + b[L+j] * x[n-1] + ... + b[L*(phaseLength-1)+j] * x[n-phaseLength+1]
+ * </pre>
+ * \par
+ * The low pass filter must have a normalized cutoff frequency of <code>1/max(L, M)</code>.
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, a multiple of <code>L</code>,
+ * stored in time reversed order exactly as for the FIR interpolator; the same array may be shared
+ * by <code>arm_fir_interpolate_instance</code> and <code>arm_fir_resample_instance</code> structures.
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+ * The position of the next output on the upsampled grid is carried from one call to the next,
+ * so any sequence of block sizes up to <code>blockSize</code> produces the same output stream.
+ * Each call writes between <code>floor(blockSize*L/M)</code> and <code>ceil(blockSize*L/M)</code> samples
+ * and returns their number.
+ *
+ * \par Instance Structure
+ * The coefficients, state variables and phase of a resampler are stored together in an instance data structure.
+ * A separate instance structure must be defined for each resampler.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 version accumulates in 64 bits, as <code>arm_fir_interpolate_q15()</code>.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point rational L/M resampler.
+ * @param[in,out] *S        points to an instance of the floating-point resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *ptr1, *ptr2;                        /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t M = S->M;                             /* Downsample factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t end = blockSize * L;                  /* End of the block on the upsampled grid */
+  uint32_t t = S->phase;                         /* Position of the next output */
+  uint32_t numOut = 0u;                          /* Number of output samples */
+  uint32_t n, tapCnt;
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* Copy the new input block after them */
+  memcpy(pState + (phaseLen - 1u), pSrc, blockSize * sizeof(float32_t));
+
+  while(t < end)
+  {
+    /* Output t is phase (t % L) of the interpolator output for input (t / L) */
+    n = t / L;
+
+    /* Initialize state and coefficient pointers */
+    ptr1 = pState + n;
+    ptr2 = pCoeffs + ((L - 1u) - (t - (n * L)));
+
+    sum = 0.0f;
+
+    /* Loop unrolling.  Compute 4 taps at a time. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum += ptr1[0] * ptr2[0];
+      sum += ptr1[1] * ptr2[L];
+      sum += ptr1[2] * ptr2[2u * L];
+      sum += ptr1[3] * ptr2[3u * L];
+
+      ptr1 += 4u;
+      ptr2 += 4u * L;
+
+      tapCnt--;
+    }
+
+    /* Compute the remaining taps */
+    tapCnt = phaseLen % 0x4u;
+
+    while(tapCnt > 0u)
+    {
+      sum += *ptr1++ * *ptr2;
+      ptr2 += L;
+
+      tapCnt--;
+    }
+
+    *pDst++ = sum;
+    numOut++;
+
+    /* Step to the next output on the upsampled grid */
+    t += M;
+  }
+
+  /* Carry the position of the next output into the next block */
+  S->phase = t - end;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(pState, pState + blockSize, (phaseLen - 1u) * sizeof(float32_t));
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_q15.c
+*
+* Description:	Q15 rational L/M polyphase resampler.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 rational L/M resampler.
+ * @param[in,out] *S        points to an instance of the Q15 resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *ptr1, *ptr2;                            /* Temporary pointers for state and coefficient buffers */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t M = S->M;                             /* Downsample factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t end = blockSize * L;                  /* End of the block on the upsampled grid */
+  uint32_t t = S->phase;                         /* Position of the next output */
+  uint32_t numOut = 0u;                          /* Number of output samples */
+  uint32_t n, tapCnt;
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* Copy the new input block after them */
+  memcpy(pState + (phaseLen - 1u), pSrc, blockSize * sizeof(q15_t));
+
+  while(t < end)
+  {
+    /* Output t is phase (t % L) of the interpolator output for input (t / L) */
+    n = t / L;
+
+    /* Initialize state and coefficient pointers */
+    ptr1 = pState + n;
+    ptr2 = pCoeffs + ((L - 1u) - (t - (n * L)));
+
+    sum = 0;
+
+    /* Loop unrolling.  Compute 4 taps at a time. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum += (q31_t) ptr1[0] * ptr2[0];
+      sum += (q31_t) ptr1[1] * ptr2[L];
+      sum += (q31_t) ptr1[2] * ptr2[2u * L];
+      sum += (q31_t) ptr1[3] * ptr2[3u * L];
+
+      ptr1 += 4u;
+      ptr2 += 4u * L;
+
+      tapCnt--;
+    }
+
+    /* Compute the remaining taps */
+    tapCnt = phaseLen % 0x4u;
+
+    while(tapCnt > 0u)
+    {
+      sum += (q31_t) *ptr1++ * *ptr2;
+      ptr2 += L;
+
+      tapCnt--;
+    }
+
+    /* The result is in 34.30 format; convert to 1.15 with saturation */
+    *pDst++ = (q15_t) (__SSAT((sum >> 15), 16));
+    numOut++;
+
+    /* Step to the next output on the upsampled grid */
+    t += M;
+  }
+
+  /* Carry the position of the next output into the next block */
+  S->phase = t - end;
+
+  /* Prepare the state buffer for the next function call */
+  memmove(pState, pState + blockSize, (phaseLen - 1u) * sizeof(q15_t));
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
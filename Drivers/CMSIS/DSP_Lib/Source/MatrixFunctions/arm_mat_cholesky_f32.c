@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_cholesky_f32.c
+*
+* Description:	Floating-point Cholesky factorization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky and LDL^T Factorization
+ *
+ * Factors a symmetric matrix into triangular factors.
+ *
+ * For a symmetric positive-definite matrix <code>A</code>, the Cholesky factorization
+ * computes the lower triangular <code>L</code> with positive diagonal such that
+ * <pre>
+ *     A = L * L^T
+ * </pre>
+ * The LDL^T factorization computes a unit lower triangular <code>L</code> and a
+ * diagonal <code>D</code> such that
+ * <pre>
+ *     A = L * D * L^T
+ * </pre>
+ * without square roots, and also applies to symmetric matrices that are not
+ * positive definite as long as no pivot is zero.  No pivoting is performed.
+ *
+ * Both functions read only the lower triangle of the input and may work in place
+ * (<code>pSrc == pDst</code>).  Together with the functions of the \ref MatrixSolve
+ * group they solve <code>A * X = B</code> in about n^3/3 + 2 n^2 multiply-accumulates
+ * per right-hand side, where <code>arm_mat_inverse_f32()</code> followed by
+ * <code>arm_mat_mult_f32()</code> needs about n^3 + n^2, and with better accuracy.
+ * The inverse only pays off when there are more than about 2n/3 right-hand sides.
+ *
+ * If a pivot is not usable (zero, or not positive for Cholesky) the functions stop
+ * and return <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky factorization.
+ * @param[in]       *pSrc points to the symmetric positive-definite input matrix structure
+ * @param[out]      *pDst points to the output matrix structure, may be equal to <code>pSrc</code>
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is found not to be positive definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * @details
+ * On return the lower triangle of <code>pDst</code>, diagonal included, holds
+ * <code>L</code> and the upper triangle is zero.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pLi, *pLj;                          /* rows i and j of the factor */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t n = pSrc->numRows;                    /* matrix dimension */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Row by row: L(i,j) = (A(i,j) - sum(L(i,k) * L(j,k), k < j)) / L(j,j)
+     * Only entries left of (i,j) in the rows of L are read, so the element of A
+     * at the same position is still intact when it is needed. */
+    for (i = 0u; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pLi = pOut + i * n;
+
+      for (j = 0u; j <= i; j++)
+      {
+        pLj = pOut + j * n;
+        sum = pIn[i * n + j];
+
+        for (k = 0u; k < j; k++)
+        {
+          sum -= pLi[k] * pLj[k];
+        }
+
+        if (j < i)
+        {
+          pLi[j] = sum / pLj[j];
+        }
+        else if (sum > 0.0f)
+        {
+          arm_sqrt_f32(sum, &pLi[i]);
+        }
+        else
+        {
+          /* Not positive definite (or NaN in the input) */
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pLi[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_ldlt_f32.c
+*
+* Description:	Floating-point LDL^T factorization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL^T factorization.
+ * @param[in]       *pSrc points to the symmetric input matrix structure
+ * @param[out]      *pDst points to the output matrix structure, may be equal to <code>pSrc</code>
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If a zero pivot is found, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * @details
+ * The factors are returned in compact form: the strictly lower triangle of
+ * <code>pDst</code> holds <code>L</code> (whose unit diagonal is implied), the
+ * diagonal holds <code>D</code> and the upper triangle is zero.
+ * Use <code>arm_mat_ldlt_solve_f32()</code> to solve with it.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pLi, *pLj;                          /* rows i and j of the factor */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t n = pSrc->numRows;                    /* matrix dimension */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Row by row:
+     *   L(i,j) = (A(i,j) - sum(L(i,k) * D(k) * L(j,k), k < j)) / D(j)
+     *   D(i)   =  A(i,i) - sum(L(i,k) * D(k) * L(i,k), k < i)
+     * with D(k) kept on the diagonal of the output. */
+    for (i = 0u; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pLi = pOut + i * n;
+
+      for (j = 0u; j <= i; j++)
+      {
+        pLj = pOut + j * n;
+        sum = pIn[i * n + j];
+
+        for (k = 0u; k < j; k++)
+        {
+          sum -= pLi[k] * pOut[k * n + k] * pLj[k];
+        }
+
+        if (j < i)
+        {
+          pLi[j] = sum / pLj[j];
+        }
+        else if (sum != 0.0f)
+        {
+          pLi[i] = sum;
+        }
+        else
+        {
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pLi[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
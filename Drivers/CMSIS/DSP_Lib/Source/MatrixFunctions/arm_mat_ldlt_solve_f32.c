@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_ldlt_solve_f32.c
+*
+* Description:	Floating-point solve with LDL^T factors.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point solve of <code>L * D * L^T * X = B</code>.
+ * @param[in]       *pSrcL points to the compact factors computed by <code>arm_mat_ldlt_f32()</code>
+ * @param[in]       *pSrcB points to the right-hand side matrix structure
+ * @param[out]      *pDst points to the solution matrix structure, may be equal to <code>pSrcB</code>
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if an element of <code>D</code> is zero and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pL = pSrcL->pData;                  /* factor pointer */
+  float32_t *pB = pSrcB->pData;                  /* right-hand side pointer */
+  float32_t *pX = pDst->pData;                   /* solution pointer */
+  float32_t *pXi, *pXk;                          /* rows of the solution */
+  float32_t t;                                   /* Temporary matrix element */
+  uint32_t n = pSrcL->numRows;                   /* matrix dimension */
+  uint32_t m = pSrcB->numCols;                   /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcL->numRows != pSrcL->numCols) || (pSrcL->numCols != pSrcB->numRows)
+     || (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* L * Z = B, L has a unit diagonal */
+    for (i = 0u; i < n; i++)
+    {
+      pXi = pX + i * m;
+
+      if (pXi != pB + i * m)
+      {
+        arm_copy_f32(pB + i * m, pXi, m);
+      }
+
+      for (k = 0u; k < i; k++)
+      {
+        t = pL[i * n + k];
+        pXk = pX + k * m;
+
+        for (c = 0u; c < m; c++)
+        {
+          pXi[c] -= t * pXk[c];
+        }
+      }
+    }
+
+    /* D * Y = Z */
+    for (i = 0u; i < n; i++)
+    {
+      t = pL[i * n + i];
+
+      if (t == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+        break;
+      }
+
+      pXi = pX + i * m;
+
+      for (c = 0u; c < m; c++)
+      {
+        pXi[c] /= t;
+      }
+    }
+
+    /* L^T * X = Y, from the bottom up */
+    if (status == ARM_MATH_SUCCESS)
+    {
+      for (i = n; i > 0u; i--)
+      {
+        pXi = pX + (i - 1u) * m;
+
+        for (k = i; k < n; k++)
+        {
+          t = pL[k * n + (i - 1u)];
+          pXk = pX + k * m;
+
+          for (c = 0u; c < m; c++)
+          {
+            pXi[c] -= t * pXk[c];
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,325 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_mult_tiled_f32.c
+*
+* Description:	Cache-tiled, register-blocked floating-point matrix multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * Depth of the k tiles: <code>ARM_MAT_MULT_TILE_K</code> rows of <code>pSrcB</code>
+ * by <code>ARM_MAT_MULT_TILE_N</code> columns form the panel that is reused for every
+ * row block of <code>pSrcA</code>.  The defaults keep the panel within 16 KB.
+ */
+#ifndef ARM_MAT_MULT_TILE_K
+#define ARM_MAT_MULT_TILE_K    64u
+#endif
+
+#ifndef ARM_MAT_MULT_TILE_N
+#define ARM_MAT_MULT_TILE_N    64u
+#endif
+
+/**
+ * @brief Floating-point matrix multiplication, cache-tiled and register-blocked.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * Computes the same product as <code>arm_mat_mult_f32()</code>, but walks the
+ * output in blocks so that each element loaded from the inputs is used several
+ * times while it is in a register: 4 x 4 output blocks on Cortex-M4 and Cortex-M3
+ * (16 accumulators), 2 x 2 on Cortex-M0.  The inner dimension is split into
+ * tiles of <code>ARM_MAT_MULT_TILE_K</code> and the columns of <code>pSrcB</code>
+ * into tiles of <code>ARM_MAT_MULT_TILE_N</code>, so that on cores with a data cache
+ * the panel of <code>pSrcB</code> stays resident while all rows of <code>pSrcA</code>
+ * pass over it.  Partial sums are kept in <code>pDst</code> between k tiles.
+ *
+ * \par
+ * Each output element is still accumulated in order of increasing k, so the
+ * result matches that of the plain row-by-column loop.
+ * <code>pDst</code> must not overlap either input.
+ */
+
+arm_status arm_mat_mult_tiled_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
+  float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pA, *pB, *pC;                       /* Temporary data matrix pointers */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t k0, k1, j0, j1;                       /* tile bounds */
+  uint32_t i, j, k;                              /* loop counters */
+  float32_t a0, a1, b0, b1;                      /* Temporary input values */
+  float32_t c00, c01, c10, c11;                  /* Accumulators */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t a2, a3, b2, b3;                      /* Temporary input values */
+  float32_t c02, c03, c12, c13;                  /* Accumulators */
+  float32_t c20, c21, c22, c23, c30, c31, c32, c33;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Clear the output, it accumulates the partial sums of the k tiles */
+    arm_fill_f32(0.0f, pOut, numRowsA * numColsB);
+
+    for (k0 = 0u; k0 < numColsA; k0 = k1)
+    {
+      k1 = (numColsA - k0 > ARM_MAT_MULT_TILE_K) ? k0 + ARM_MAT_MULT_TILE_K : numColsA;
+
+      for (j0 = 0u; j0 < numColsB; j0 = j1)
+      {
+        j1 = (numColsB - j0 > ARM_MAT_MULT_TILE_N) ? j0 + ARM_MAT_MULT_TILE_N : numColsB;
+
+        i = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* 4 x 4 blocks of the output */
+        for (; i + 4u <= numRowsA; i += 4u)
+        {
+          for (j = j0; j + 4u <= j1; j += 4u)
+          {
+            pC = pOut + i * numColsB + j;
+
+            c00 = pC[0];  c01 = pC[1];  c02 = pC[2];  c03 = pC[3];
+            pC += numColsB;
+            c10 = pC[0];  c11 = pC[1];  c12 = pC[2];  c13 = pC[3];
+            pC += numColsB;
+            c20 = pC[0];  c21 = pC[1];  c22 = pC[2];  c23 = pC[3];
+            pC += numColsB;
+            c30 = pC[0];  c31 = pC[1];  c32 = pC[2];  c33 = pC[3];
+
+            pA = pInA + i * numColsA + k0;
+            pB = pInB + k0 * numColsB + j;
+
+            for (k = k0; k < k1; k++)
+            {
+              /* One column of the A block and one row of the B block */
+              a0 = pA[0];
+              a1 = pA[numColsA];
+              a2 = pA[2u * numColsA];
+              a3 = pA[3u * numColsA];
+              b0 = pB[0];
+              b1 = pB[1];
+              b2 = pB[2];
+              b3 = pB[3];
+
+              c00 += a0 * b0;  c01 += a0 * b1;  c02 += a0 * b2;  c03 += a0 * b3;
+              c10 += a1 * b0;  c11 += a1 * b1;  c12 += a1 * b2;  c13 += a1 * b3;
+              c20 += a2 * b0;  c21 += a2 * b1;  c22 += a2 * b2;  c23 += a2 * b3;
+              c30 += a3 * b0;  c31 += a3 * b1;  c32 += a3 * b2;  c33 += a3 * b3;
+
+              pA++;
+              pB += numColsB;
+            }
+
+            pC = pOut + i * numColsB + j;
+
+            pC[0] = c00;  pC[1] = c01;  pC[2] = c02;  pC[3] = c03;
+            pC += numColsB;
+            pC[0] = c10;  pC[1] = c11;  pC[2] = c12;  pC[3] = c13;
+            pC += numColsB;
+            pC[0] = c20;  pC[1] = c21;  pC[2] = c22;  pC[3] = c23;
+            pC += numColsB;
+            pC[0] = c30;  pC[1] = c31;  pC[2] = c32;  pC[3] = c33;
+          }
+
+          /* Remaining columns of the tile, 4 x 1 */
+          for (; j < j1; j++)
+          {
+            pC = pOut + i * numColsB + j;
+
+            c00 = pC[0];
+            c10 = pC[numColsB];
+            c20 = pC[2u * numColsB];
+            c30 = pC[3u * numColsB];
+
+            pA = pInA + i * numColsA + k0;
+            pB = pInB + k0 * numColsB + j;
+
+            for (k = k0; k < k1; k++)
+            {
+              b0 = *pB;
+              c00 += pA[0] * b0;
+              c10 += pA[numColsA] * b0;
+              c20 += pA[2u * numColsA] * b0;
+              c30 += pA[3u * numColsA] * b0;
+
+              pA++;
+              pB += numColsB;
+            }
+
+            pC[0] = c00;
+            pC[numColsB] = c10;
+            pC[2u * numColsB] = c20;
+            pC[3u * numColsB] = c30;
+          }
+        }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        /* 2 x 2 blocks of the output (the remaining rows on Cortex-M4 and Cortex-M3) */
+        for (; i + 2u <= numRowsA; i += 2u)
+        {
+          for (j = j0; j + 2u <= j1; j += 2u)
+          {
+            pC = pOut + i * numColsB + j;
+
+            c00 = pC[0];
+            c01 = pC[1];
+            c10 = pC[numColsB];
+            c11 = pC[numColsB + 1u];
+
+            pA = pInA + i * numColsA + k0;
+            pB = pInB + k0 * numColsB + j;
+
+            for (k = k0; k < k1; k++)
+            {
+              a0 = pA[0];
+              a1 = pA[numColsA];
+              b0 = pB[0];
+              b1 = pB[1];
+
+              c00 += a0 * b0;
+              c01 += a0 * b1;
+              c10 += a1 * b0;
+              c11 += a1 * b1;
+
+              pA++;
+              pB += numColsB;
+            }
+
+            pC[0] = c00;
+            pC[1] = c01;
+            pC[numColsB] = c10;
+            pC[numColsB + 1u] = c11;
+          }
+
+          /* Remaining column of the tile, 2 x 1 */
+          if (j < j1)
+          {
+            pC = pOut + i * numColsB + j;
+
+            c00 = pC[0];
+            c10 = pC[numColsB];
+
+            pA = pInA + i * numColsA + k0;
+            pB = pInB + k0 * numColsB + j;
+
+            for (k = k0; k < k1; k++)
+            {
+              b0 = *pB;
+              c00 += pA[0] * b0;
+              c10 += pA[numColsA] * b0;
+
+              pA++;
+              pB += numColsB;
+            }
+
+            pC[0] = c00;
+            pC[numColsB] = c10;
+          }
+        }
+
+        /* Remaining row, 1 x 1 */
+        if (i < numRowsA)
+        {
+          for (j = j0; j < j1; j++)
+          {
+            pC = pOut + i * numColsB + j;
+            c00 = *pC;
+
+            pA = pInA + i * numColsA + k0;
+            pB = pInB + k0 * numColsB + j;
+
+            for (k = k0; k < k1; k++)
+            {
+              c00 += *pA++ * *pB;
+              pB += numColsB;
+            }
+
+            *pC = c00;
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_mult_tiled_q31.c
+*
+* Description:	Cache-tiled, register-blocked Q31 matrix multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+#ifndef ARM_MAT_MULT_TILE_N
+#define ARM_MAT_MULT_TILE_N    64u
+#endif
+
+/**
+ * @brief Q31 matrix multiplication, cache-tiled and register-blocked.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * Identical to <code>arm_mat_mult_q31()</code>: each output is accumulated in a
+ * 2.62 accumulator, right shifted by 31 bits and saturated to 1.31 format.
+ * The input should be scaled down by log2(numColsA) bits to avoid intermediate overflows.
+ *
+ * \par
+ * The output is computed in 2 x 2 blocks, so that every element loaded from
+ * <code>pSrcA</code> and <code>pSrcB</code> feeds two multiply-accumulates; four
+ * 64-bit accumulators is what the Cortex-M register file holds without spilling.
+ * Columns of <code>pSrcB</code> are processed in tiles of <code>ARM_MAT_MULT_TILE_N</code>,
+ * which all rows of <code>pSrcA</code> traverse before the next tile.  The inner
+ * dimension is not tiled: the 64-bit partial sums cannot be parked in the
+ * 32-bit output between tiles without losing precision.
+ * <code>pDst</code> must not overlap either input.
+ */
+
+arm_status arm_mat_mult_tiled_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  q31_t *pInA = pSrcA->pData;                    /* input data matrix pointer A */
+  q31_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
+  q31_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q31_t *pA, *pB, *pC;                           /* Temporary data matrix pointers */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t j0, j1;                               /* tile bounds */
+  uint32_t i, j, k;                              /* loop counters */
+  q31_t a0, a1, b0, b1;                          /* Temporary input values */
+  q63_t c00, c01, c10, c11;                      /* Accumulators */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (j0 = 0u; j0 < numColsB; j0 = j1)
+    {
+      j1 = (numColsB - j0 > ARM_MAT_MULT_TILE_N) ? j0 + ARM_MAT_MULT_TILE_N : numColsB;
+
+      /* 2 x 2 blocks of the output */
+      for (i = 0u; i + 2u <= numRowsA; i += 2u)
+      {
+        for (j = j0; j + 2u <= j1; j += 2u)
+        {
+          c00 = 0;
+          c01 = 0;
+          c10 = 0;
+          c11 = 0;
+
+          pA = pInA + i * numColsA;
+          pB = pInB + j;
+
+          for (k = 0u; k < numColsA; k++)
+          {
+            a0 = pA[0];
+            a1 = pA[numColsA];
+            b0 = pB[0];
+            b1 = pB[1];
+
+            c00 += (q63_t) a0 * b0;
+            c01 += (q63_t) a0 * b1;
+            c10 += (q63_t) a1 * b0;
+            c11 += (q63_t) a1 * b1;
+
+            pA++;
+            pB += numColsB;
+          }
+
+          pC = pOut + i * numColsB + j;
+
+          pC[0] = clip_q63_to_q31(c00 >> 31);
+          pC[1] = clip_q63_to_q31(c01 >> 31);
+          pC[numColsB] = clip_q63_to_q31(c10 >> 31);
+          pC[numColsB + 1u] = clip_q63_to_q31(c11 >> 31);
+        }
+
+        /* Remaining column of the tile, 2 x 1 */
+        if (j < j1)
+        {
+          c00 = 0;
+          c10 = 0;
+
+          pA = pInA + i * numColsA;
+          pB = pInB + j;
+
+          for (k = 0u; k < numColsA; k++)
+          {
+            b0 = *pB;
+            c00 += (q63_t) pA[0] * b0;
+            c10 += (q63_t) pA[numColsA] * b0;
+
+            pA++;
+            pB += numColsB;
+          }
+
+          pC = pOut + i * numColsB + j;
+
+          pC[0] = clip_q63_to_q31(c00 >> 31);
+          pC[numColsB] = clip_q63_to_q31(c10 >> 31);
+        }
+      }
+
+      /* Remaining row, 1 x 1 */
+      if (i < numRowsA)
+      {
+        for (j = j0; j < j1; j++)
+        {
+          c00 = 0;
+
+          pA = pInA + i * numColsA;
+          pB = pInB + j;
+
+          for (k = 0u; k < numColsA; k++)
+          {
+            c00 += (q63_t) *pA++ * *pB;
+            pB += numColsB;
+          }
+
+          pOut[i * numColsB + j] = clip_q63_to_q31(c00 >> 31);
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_solve_lower_triangular_f32.c
+*
+* Description:	Floating-point lower triangular solve.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSolve Linear System Solve
+ *
+ * Solves <code>A * X = B</code> for <code>X</code>, where <code>B</code> has one
+ * column per right-hand side.
+ *
+ * The triangular solves use forward substitution (lower triangular <code>A</code>)
+ * or back substitution (upper triangular <code>A</code>).  The symmetric solves
+ * take the factors computed by the functions of the \ref MatrixChol group and apply
+ * both substitutions, so a factorization can be reused for any number of
+ * right-hand sides.
+ *
+ * All of them work a row of <code>X</code> at a time and only read rows of
+ * <code>B</code> that have not been overwritten, so they may work in place
+ * (<code>pDst->pData == pSrcB->pData</code>).
+ * If a diagonal element of the triangular matrix is zero the function returns
+ * <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point lower triangular solve.
+ * @param[in]       *pSrcT points to the lower triangular matrix structure
+ * @param[in]       *pSrcB points to the right-hand side matrix structure
+ * @param[out]      *pDst points to the solution matrix structure, may be equal to <code>pSrcB</code>
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if a diagonal element is zero and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * @details
+ * The upper triangle of <code>pSrcT</code> is not read.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcT,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pT = pSrcT->pData;                  /* triangular matrix pointer */
+  float32_t *pB = pSrcB->pData;                  /* right-hand side pointer */
+  float32_t *pX = pDst->pData;                   /* solution pointer */
+  float32_t *pXi, *pXk;                          /* rows of the solution */
+  float32_t t;                                   /* Temporary matrix element */
+  uint32_t n = pSrcT->numRows;                   /* matrix dimension */
+  uint32_t m = pSrcB->numCols;                   /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcT->numRows != pSrcT->numCols) || (pSrcT->numCols != pSrcB->numRows)
+     || (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; i < n; i++)
+    {
+      pXi = pX + i * m;
+
+      /* X(i,:) = (B(i,:) - sum(T(i,k) * X(k,:), k < i)) / T(i,i) */
+      if (pXi != pB + i * m)
+      {
+        arm_copy_f32(pB + i * m, pXi, m);
+      }
+
+      for (k = 0u; k < i; k++)
+      {
+        t = pT[i * n + k];
+        pXk = pX + k * m;
+
+        for (c = 0u; c < m; c++)
+        {
+          pXi[c] -= t * pXk[c];
+        }
+      }
+
+      t = pT[i * n + i];
+
+      if (t == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+        break;
+      }
+
+      for (c = 0u; c < m; c++)
+      {
+        pXi[c] /= t;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sliding_max_q15.c
+*
+* Description:	Maximum value of the Q15 sliding window.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Maximum value of the Q15 sliding window.
+ * @param[in]  *S        points to an instance of the Q15 sliding window statistics structure.
+ * @param[out] *pResult  maximum value returned here
+ * @param[out] *pIndex   index of the maximum value in the window, 0 being the oldest sample
+ * @return     none.
+ */
+
+void arm_sliding_max_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex)
+{
+  uint32_t pos, oldest;
+
+  if(S->maxCount == 0u)
+  {
+    *pResult = 0;
+    *pIndex = 0u;
+    return;
+  }
+
+  /* The front of the queue holds the position of the maximum */
+  pos = S->pMaxQueue[S->maxFront];
+  *pResult = S->pHistory[pos];
+
+  /* Once the window is full, the oldest sample is the one overwritten next */
+  oldest = (S->numSamples == S->windowLen) ? S->head : 0u;
+  *pIndex = (pos >= oldest) ? (pos - oldest) : ((pos + S->windowLen) - oldest);
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,187 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sliding_stats_f32.c
+*
+* Description:	Adds a block of floating-point samples to the sliding window statistics.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of floating-point samples to the sliding window statistics.
+ * @param[in,out] *S         points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples in the block.
+ * @return        none.
+ */
+
+void arm_sliding_stats_f32(
+  arm_sliding_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t *pHistory = S->pHistory;             /* window samples                 */
+  uint16_t *pMaxQueue = S->pMaxQueue;            /* maxima candidates              */
+  uint16_t *pMinQueue = S->pMinQueue;            /* minima candidates              */
+  uint32_t windowLen = S->windowLen;             /* window length                  */
+  uint32_t numSamples = S->numSamples;           /* samples in the window          */
+  uint32_t pos = S->head;                        /* position of the new sample     */
+  uint32_t maxFront = S->maxFront, maxCount = S->maxCount;
+  uint32_t minFront = S->minFront, minCount = S->minCount;
+  uint32_t blkCnt = blockSize;                   /* loop counter                   */
+  uint32_t back;
+  float32_t mean = S->mean;                      /* running mean                   */
+  float32_t m2 = S->m2;                          /* running sum of squared deviations */
+  float32_t invWindow = 1.0f / (float32_t) windowLen;
+  float32_t delta, meanNew, old;
+  float32_t in, sum;
+  uint32_t i;
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(numSamples == windowLen)
+    {
+      /* Welford update with the oldest sample leaving the window */
+      old = pHistory[pos];
+      delta = in - old;
+      meanNew = mean + (delta * invWindow);
+      m2 += delta * ((in - meanNew) + (old - mean));
+      mean = meanNew;
+
+      /* The oldest sample leaves the queues if it is at their front */
+      if((maxCount > 0u) && (pMaxQueue[maxFront] == pos))
+      {
+        maxFront = (maxFront + 1u == windowLen) ? 0u : (maxFront + 1u);
+        maxCount--;
+      }
+      if((minCount > 0u) && (pMinQueue[minFront] == pos))
+      {
+        minFront = (minFront + 1u == windowLen) ? 0u : (minFront + 1u);
+        minCount--;
+      }
+    }
+    else
+    {
+      /* Welford update while the window fills */
+      numSamples++;
+      delta = in - mean;
+      mean += delta / (float32_t) numSamples;
+      m2 += delta * (in - mean);
+    }
+
+    pHistory[pos] = in;
+
+    /* Drop the candidates the new sample dominates, then append it */
+    while(maxCount > 0u)
+    {
+      back = maxFront + maxCount - 1u;
+      back = (back >= windowLen) ? (back - windowLen) : back;
+      if(pHistory[pMaxQueue[back]] >= in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    back = maxFront + maxCount;
+    pMaxQueue[(back >= windowLen) ? (back - windowLen) : back] = (uint16_t) pos;
+    maxCount++;
+
+    while(minCount > 0u)
+    {
+      back = minFront + minCount - 1u;
+      back = (back >= windowLen) ? (back - windowLen) : back;
+      if(pHistory[pMinQueue[back]] <= in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    back = minFront + minCount;
+    pMinQueue[(back >= windowLen) ? (back - windowLen) : back] = (uint16_t) pos;
+    minCount++;
+
+    pos = (pos + 1u == windowLen) ? 0u : (pos + 1u);
+
+    /* The Welford sums accumulate rounding errors without bound on a long stream.
+     * Once per window they are recomputed from the window samples, which keeps
+     * the update O(1) amortized. */
+    if((pos == 0u) && (numSamples == windowLen))
+    {
+      sum = 0.0f;
+      for (i = 0u; i < windowLen; i++)
+      {
+        sum += pHistory[i];
+      }
+      mean = sum * invWindow;
+
+      sum = 0.0f;
+      for (i = 0u; i < windowLen; i++)
+      {
+        delta = pHistory[i] - mean;
+        sum += delta * delta;
+      }
+      m2 = sum;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->numSamples = (uint16_t) numSamples;
+  S->head = (uint16_t) pos;
+  S->maxFront = (uint16_t) maxFront;
+  S->maxCount = (uint16_t) maxCount;
+  S->minFront = (uint16_t) minFront;
+  S->minCount = (uint16_t) minCount;
+  /* Rounding can leave a tiny negative sum on a constant signal */
+  S->mean = mean;
+  S->m2 = (m2 > 0.0f) ? m2 : 0.0f;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sliding_stats_init_f32.c
+*
+* Description:	floating-point sliding window statistics initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup SlidingStats Sliding Window Statistics
+ *
+ * These functions keep statistics of the last <code>windowLen</code> samples of a stream.
+ * The batch functions such as <code>arm_mean_f32()</code> or <code>arm_max_f32()</code> cost
+ * O(windowLen) for every evaluation; here each new sample is folded into the instance in O(1)
+ * amortized time, so overlapping windows can be monitored at any hop size.
+ *
+ * \par Algorithm:
+ * - The mean and variance of the floating-point version are updated with the sliding window form
+ *   of Welford's algorithm, and recomputed from the window samples every <code>windowLen</code>
+ *   samples so that rounding errors do not build up on long streams.  The fixed-point versions keep exact running sums in 64 bits and
+ *   evaluate the same expressions as the batch functions, so the results match them exactly,
+ *   except the Q31 RMS.  That one is computed from the 8-bit shifted sums of the Q31 variance,
+ *   which do not overflow at full scale as the 64-bit sum of squares of <code>arm_rms_q31()</code> can.
+ * - The RMS value is derived from the same state as the variance.
+ * - The maximum and minimum are tracked with monotonic queues of history positions:
+ *   a sample that is smaller than a newer sample can never become the maximum again and is dropped.
+ *   Each sample enters and leaves each queue once.
+ * \par
+ * Until <code>windowLen</code> samples have been added, the statistics cover the samples seen so far.
+ * The index returned with the maximum and minimum counts from the oldest sample of the window,
+ * the first occurrence wins as in <code>arm_max_f32()</code>.
+ *
+ * \par Instance Structure
+ * The window samples, queues and running values are stored together in an instance data structure.
+ * A separate instance structure must be defined for each stream.
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding window statistics.
+ * @param[in,out] *S         points to an instance of the floating-point sliding window statistics structure.
+ * @param[in]     windowLen  number of samples in the window.
+ * @param[in]     *pHistory  points to the window buffer of <code>windowLen</code> samples.
+ * @param[in]     *pQueue    points to the queue buffer of <code>2*windowLen</code> entries.
+ * @return        none.
+ */
+
+void arm_sliding_stats_init_f32(
+  arm_sliding_stats_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pHistory,
+  uint16_t * pQueue)
+{
+  S->windowLen = windowLen;
+  S->numSamples = 0u;
+  S->head = 0u;
+
+  /* The maximum and minimum queues share the queue buffer */
+  S->pHistory = pHistory;
+  S->pMaxQueue = pQueue;
+  S->pMinQueue = pQueue + windowLen;
+  S->maxFront = 0u;
+  S->maxCount = 0u;
+  S->minFront = 0u;
+  S->minCount = 0u;
+
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sliding_stats_init_q15.c
+*
+* Description:	Q15 sliding window statistics initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 sliding window statistics.
+ * @param[in,out] *S         points to an instance of the Q15 sliding window statistics structure.
+ * @param[in]     windowLen  number of samples in the window.
+ * @param[in]     *pHistory  points to the window buffer of <code>windowLen</code> samples.
+ * @param[in]     *pQueue    points to the queue buffer of <code>2*windowLen</code> entries.
+ * @return        none.
+ */
+
+void arm_sliding_stats_init_q15(
+  arm_sliding_stats_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pHistory,
+  uint16_t * pQueue)
+{
+  S->windowLen = windowLen;
+  S->numSamples = 0u;
+  S->head = 0u;
+
+  /* The maximum and minimum queues share the queue buffer */
+  S->pHistory = pHistory;
+  S->pMaxQueue = pQueue;
+  S->pMinQueue = pQueue + windowLen;
+  S->maxFront = 0u;
+  S->maxCount = 0u;
+  S->minFront = 0u;
+  S->minCount = 0u;
+
+  S->sum = 0;
+  S->sumOfSquares = 0;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
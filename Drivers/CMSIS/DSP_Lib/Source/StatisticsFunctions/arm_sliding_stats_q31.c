@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sliding_stats_q31.c
+*
+* Description:	Adds a block of Q31 samples to the sliding window statistics.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of Q31 samples to the sliding window statistics.
+ * @param[in,out] *S         points to an instance of the Q31 sliding window statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples in the block.
+ * @return        none.
+ */
+
+void arm_sliding_stats_q31(
+  arm_sliding_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t *pHistory = S->pHistory;                 /* window samples                 */
+  uint16_t *pMaxQueue = S->pMaxQueue;            /* maxima candidates              */
+  uint16_t *pMinQueue = S->pMinQueue;            /* minima candidates              */
+  uint32_t windowLen = S->windowLen;             /* window length                  */
+  uint32_t numSamples = S->numSamples;           /* samples in the window          */
+  uint32_t pos = S->head;                        /* position of the new sample     */
+  uint32_t maxFront = S->maxFront, maxCount = S->maxCount;
+  uint32_t minFront = S->minFront, minCount = S->minCount;
+  uint32_t blkCnt = blockSize;                   /* loop counter                   */
+  uint32_t back;
+  q63_t sum = S->sum;                            /* running sums                   */
+  q63_t sum8 = S->sum8;
+  q63_t sumOfSquares8 = S->sumOfSquares8;
+  q31_t old, in8;
+  q31_t in;
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(numSamples == windowLen)
+    {
+      /* Remove the oldest sample from the running sums */
+      old = pHistory[pos];
+      sum -= old;
+      old = old >> 8;
+      sum8 -= old;
+      sumOfSquares8 -= (q63_t) old * old;
+
+      /* The oldest sample leaves the queues if it is at their front */
+      if((maxCount > 0u) && (pMaxQueue[maxFront] == pos))
+      {
+        maxFront = (maxFront + 1u == windowLen) ? 0u : (maxFront + 1u);
+        maxCount--;
+      }
+      if((minCount > 0u) && (pMinQueue[minFront] == pos))
+      {
+        minFront = (minFront + 1u == windowLen) ? 0u : (minFront + 1u);
+        minCount--;
+      }
+    }
+    else
+    {
+      numSamples++;
+    }
+
+    /* Add the new sample to the running sums */
+    sum += in;
+    in8 = in >> 8;
+    sum8 += in8;
+    sumOfSquares8 += (q63_t) in8 * in8;
+
+    pHistory[pos] = in;
+
+    /* Drop the candidates the new sample dominates, then append it */
+    while(maxCount > 0u)
+    {
+      back = maxFront + maxCount - 1u;
+      back = (back >= windowLen) ? (back - windowLen) : back;
+      if(pHistory[pMaxQueue[back]] >= in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    back = maxFront + maxCount;
+    pMaxQueue[(back >= windowLen) ? (back - windowLen) : back] = (uint16_t) pos;
+    maxCount++;
+
+    while(minCount > 0u)
+    {
+      back = minFront + minCount - 1u;
+      back = (back >= windowLen) ? (back - windowLen) : back;
+      if(pHistory[pMinQueue[back]] <= in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    back = minFront + minCount;
+    pMinQueue[(back >= windowLen) ? (back - windowLen) : back] = (uint16_t) pos;
+    minCount++;
+
+    pos = (pos + 1u == windowLen) ? 0u : (pos + 1u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->numSamples = (uint16_t) numSamples;
+  S->head = (uint16_t) pos;
+  S->maxFront = (uint16_t) maxFront;
+  S->maxCount = (uint16_t) maxCount;
+  S->minFront = (uint16_t) minFront;
+  S->minCount = (uint16_t) minCount;
+  S->sum = sum;
+  S->sum8 = sum8;
+  S->sumOfSquares8 = sumOfSquares8;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sliding_std_q15.c
+*
+* Description:	Standard deviation of the Q15 sliding window.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Standard deviation of the Q15 sliding window.
+ * @param[in]  *S        points to an instance of the Q15 sliding window statistics structure.
+ * @param[out] *pResult  standard deviation value returned here
+ * @return     none.
+ */
+
+void arm_sliding_std_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult)
+{
+  q31_t meanOfSquares, squareOfMean;             /* intermediate results           */
+  uint32_t numSamples = S->numSamples;           /* samples in the window          */
+
+  if(numSamples < 2u)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Same expressions as arm_std_q15() */
+  meanOfSquares = (q31_t) (S->sumOfSquares / (q63_t) (numSamples - 1u));
+  squareOfMean = (q31_t) ((q63_t) S->sum * S->sum / (q63_t) (numSamples * (numSamples - 1u)));
+  arm_sqrt_q15((q15_t) __SSAT((meanOfSquares - squareOfMean) >> 15, 16u), pResult);
+}
+
+/**
+ * @} end of SlidingStats group
+ */
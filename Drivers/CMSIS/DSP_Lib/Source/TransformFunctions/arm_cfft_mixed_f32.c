@@ -0,0 +1,429 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_mixed_f32.c
+*
+* Description:	Floating-point mixed-radix (2, 3, 4, 5) CFFT/CIFFT process function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @defgroup MixedRadixFFT Mixed-Radix Complex FFT Functions
+*
+* \par
+* The mixed-radix complex FFT computes the DFT of lengths that are products
+* of the factors 2, 3, 4 and 5, such as 300, 480, 500, 600, 960 and 1000 points.
+* This avoids zero-padding frames of these sizes to the next power of two,
+* which costs both cycles and a change in the frequency resolution.
+*
+* \par Algorithm:
+* The transform is computed with a Stockham autosort formulation. Each stage
+* applies a radix-r butterfly, multiplies by the twiddle factors and writes
+* its result in natural order into the other of two buffers, so no bit or digit
+* reversal is needed. The source buffer is used as the second buffer and is
+* therefore modified by the function.
+* \par
+* The radix of each stage is stored in the instance structure. Radix-4 stages
+* are used first, followed by radix-2, radix-3 and radix-5 stages.
+*
+* \par Twiddle factor tables:
+* A single table holding one full circle of <code>N</code> complex twiddle factors
+* serves the <code>N</code> point transform and, with a twiddle coefficient modifier
+* of 2, the <code>N/2</code> point transform used by the real FFT of length <code>N</code>.
+* Tables are provided for <code>N</code> = 600, 960 and 1000, and preinitialized
+* instance structures are provided in <code>arm_const_structs.h</code>:
+* <pre>
+*   arm_cfft_mixed_sR_f32_len300
+*   arm_cfft_mixed_sR_f32_len480
+*   arm_cfft_mixed_sR_f32_len500
+*   arm_cfft_mixed_sR_f32_len600
+*   arm_cfft_mixed_sR_f32_len960
+*   arm_cfft_mixed_sR_f32_len1000
+* </pre>
+*
+* \par Buffers:
+* <code>pSrc</code> and <code>pDst</code> each hold <code>2*fftLen</code> values in
+* interleaved {real, imag} order. They must not overlap.
+* The inverse transform is scaled by <code>1/fftLen</code>, as for <code>arm_cfft_f32()</code>.
+*/
+
+/**
+* @addtogroup MixedRadixFFT
+* @{
+*/
+
+/* cos(2*pi/3), sin(2*pi/3), cos(2*pi/5), sin(2*pi/5), cos(4*pi/5), sin(4*pi/5) */
+#define MIXED_S3    0.866025404f
+#define MIXED_C51   0.309016994f
+#define MIXED_S51   0.951056516f
+#define MIXED_C52  -0.809016994f
+#define MIXED_S52   0.587785252f
+
+/*
+* Radix-r Stockham stages. For every p < m the twiddle factors W^(p*k) are loaded
+* once, then the butterfly is applied to the s input groups:
+*   y[k] = sum_j x[q + s*(p + j*m)] * W_r^(j*k)
+*   x'[q + s*(r*p + k)] = y[k] * W^(p*k*s)
+* sgn is 1 for the forward transform and -1 for the inverse.
+*/
+
+/* (xr + j*xi) * (wr - j*wi) stored to pOut[2*idx] */
+#define MIXED_TWIDDLE_F32(pOut, idx, xr, xi, wr, wi)     \
+  do                                                      \
+  {                                                       \
+    (pOut)[2u * (idx)] = (xr) * (wr) + (xi) * (wi);        \
+    (pOut)[2u * (idx) + 1u] = (xi) * (wr) - (xr) * (wi);   \
+  } while (0)
+
+static void arm_radix2_mixed_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t m,
+  uint32_t s,
+  const float32_t * pTw,
+  uint32_t twStep,
+  float32_t sgn)
+{
+  const float32_t *pA, *pB;
+  float32_t *pY;
+  float32_t a0r, a0i, a1r, a1i, w1r, w1i, y1r, y1i;
+  uint32_t p, q;
+
+  for (p = 0u; p < m; p++)
+  {
+    w1r = pTw[2u * (p * s * twStep)];
+    w1i = sgn * pTw[2u * (p * s * twStep) + 1u];
+
+    pA = pIn + 2u * (s * p);
+    pB = pA + 2u * (s * m);
+    pY = pOut + 2u * (s * 2u * p);
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[2u * q];
+      a0i = pA[2u * q + 1u];
+      a1r = pB[2u * q];
+      a1i = pB[2u * q + 1u];
+
+      pY[2u * q] = a0r + a1r;
+      pY[2u * q + 1u] = a0i + a1i;
+      y1r = a0r - a1r;
+      y1i = a0i - a1i;
+      MIXED_TWIDDLE_F32(pY, q + s, y1r, y1i, w1r, w1i);
+    }
+  }
+}
+
+static void arm_radix3_mixed_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t m,
+  uint32_t s,
+  const float32_t * pTw,
+  uint32_t twStep,
+  float32_t sgn)
+{
+  const float32_t *pA;
+  float32_t *pY;
+  float32_t a0r, a0i, a1r, a1i, a2r, a2i;
+  float32_t t1r, t1i, t2r, t2i, m1r, m1i, yr, yi;
+  float32_t w1r, w1i, w2r, w2i;
+  float32_t s3 = sgn * MIXED_S3;
+  uint32_t p, q, sm = s * m;
+
+  for (p = 0u; p < m; p++)
+  {
+    w1r = pTw[2u * (p * s * twStep)];
+    w1i = sgn * pTw[2u * (p * s * twStep) + 1u];
+    w2r = pTw[2u * (2u * p * s * twStep)];
+    w2i = sgn * pTw[2u * (2u * p * s * twStep) + 1u];
+
+    pA = pIn + 2u * (s * p);
+    pY = pOut + 2u * (s * 3u * p);
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[2u * q];
+      a0i = pA[2u * q + 1u];
+      a1r = pA[2u * (q + sm)];
+      a1i = pA[2u * (q + sm) + 1u];
+      a2r = pA[2u * (q + 2u * sm)];
+      a2i = pA[2u * (q + 2u * sm) + 1u];
+
+      t1r = a1r + a2r;
+      t1i = a1i + a2i;
+      t2r = s3 * (a1r - a2r);
+      t2i = s3 * (a1i - a2i);
+      m1r = a0r - 0.5f * t1r;
+      m1i = a0i - 0.5f * t1i;
+
+      pY[2u * q] = a0r + t1r;
+      pY[2u * q + 1u] = a0i + t1i;
+
+      /* y1 = m1 - j*t2, y2 = m1 + j*t2 */
+      yr = m1r + t2i;
+      yi = m1i - t2r;
+      MIXED_TWIDDLE_F32(pY, q + s, yr, yi, w1r, w1i);
+      yr = m1r - t2i;
+      yi = m1i + t2r;
+      MIXED_TWIDDLE_F32(pY, q + 2u * s, yr, yi, w2r, w2i);
+    }
+  }
+}
+
+static void arm_radix4_mixed_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t m,
+  uint32_t s,
+  const float32_t * pTw,
+  uint32_t twStep,
+  float32_t sgn)
+{
+  const float32_t *pA;
+  float32_t *pY;
+  float32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+  float32_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i, yr, yi;
+  float32_t w1r, w1i, w2r, w2i, w3r, w3i;
+  uint32_t p, q, sm = s * m;
+
+  for (p = 0u; p < m; p++)
+  {
+    w1r = pTw[2u * (p * s * twStep)];
+    w1i = sgn * pTw[2u * (p * s * twStep) + 1u];
+    w2r = pTw[2u * (2u * p * s * twStep)];
+    w2i = sgn * pTw[2u * (2u * p * s * twStep) + 1u];
+    w3r = pTw[2u * (3u * p * s * twStep)];
+    w3i = sgn * pTw[2u * (3u * p * s * twStep) + 1u];
+
+    pA = pIn + 2u * (s * p);
+    pY = pOut + 2u * (s * 4u * p);
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[2u * q];
+      a0i = pA[2u * q + 1u];
+      a1r = pA[2u * (q + sm)];
+      a1i = pA[2u * (q + sm) + 1u];
+      a2r = pA[2u * (q + 2u * sm)];
+      a2i = pA[2u * (q + 2u * sm) + 1u];
+      a3r = pA[2u * (q + 3u * sm)];
+      a3i = pA[2u * (q + 3u * sm) + 1u];
+
+      t1r = a0r + a2r;
+      t1i = a0i + a2i;
+      t2r = a0r - a2r;
+      t2i = a0i - a2i;
+      t3r = a1r + a3r;
+      t3i = a1i + a3i;
+      t4r = sgn * (a1r - a3r);
+      t4i = sgn * (a1i - a3i);
+
+      pY[2u * q] = t1r + t3r;
+      pY[2u * q + 1u] = t1i + t3i;
+
+      /* y1 = t2 - j*t4, y2 = t1 - t3, y3 = t2 + j*t4 */
+      yr = t2r + t4i;
+      yi = t2i - t4r;
+      MIXED_TWIDDLE_F32(pY, q + s, yr, yi, w1r, w1i);
+      yr = t1r - t3r;
+      yi = t1i - t3i;
+      MIXED_TWIDDLE_F32(pY, q + 2u * s, yr, yi, w2r, w2i);
+      yr = t2r - t4i;
+      yi = t2i + t4r;
+      MIXED_TWIDDLE_F32(pY, q + 3u * s, yr, yi, w3r, w3i);
+    }
+  }
+}
+
+static void arm_radix5_mixed_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t m,
+  uint32_t s,
+  const float32_t * pTw,
+  uint32_t twStep,
+  float32_t sgn)
+{
+  const float32_t *pA;
+  float32_t *pY;
+  float32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, a4r, a4i;
+  float32_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  float32_t m1r, m1i, m2r, m2i, n1r, n1i, n2r, n2i, yr, yi;
+  float32_t w1r, w1i, w2r, w2i, w3r, w3i, w4r, w4i;
+  uint32_t p, q, sm = s * m;
+
+  for (p = 0u; p < m; p++)
+  {
+    w1r = pTw[2u * (p * s * twStep)];
+    w1i = sgn * pTw[2u * (p * s * twStep) + 1u];
+    w2r = pTw[2u * (2u * p * s * twStep)];
+    w2i = sgn * pTw[2u * (2u * p * s * twStep) + 1u];
+    w3r = pTw[2u * (3u * p * s * twStep)];
+    w3i = sgn * pTw[2u * (3u * p * s * twStep) + 1u];
+    w4r = pTw[2u * (4u * p * s * twStep)];
+    w4i = sgn * pTw[2u * (4u * p * s * twStep) + 1u];
+
+    pA = pIn + 2u * (s * p);
+    pY = pOut + 2u * (s * 5u * p);
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[2u * q];
+      a0i = pA[2u * q + 1u];
+      a1r = pA[2u * (q + sm)];
+      a1i = pA[2u * (q + sm) + 1u];
+      a2r = pA[2u * (q + 2u * sm)];
+      a2i = pA[2u * (q + 2u * sm) + 1u];
+      a3r = pA[2u * (q + 3u * sm)];
+      a3i = pA[2u * (q + 3u * sm) + 1u];
+      a4r = pA[2u * (q + 4u * sm)];
+      a4i = pA[2u * (q + 4u * sm) + 1u];
+
+      t1r = a1r + a4r;
+      t1i = a1i + a4i;
+      t2r = a2r + a3r;
+      t2i = a2i + a3i;
+      t3r = sgn * (a1r - a4r);
+      t3i = sgn * (a1i - a4i);
+      t4r = sgn * (a2r - a3r);
+      t4i = sgn * (a2i - a3i);
+
+      m1r = a0r + MIXED_C51 * t1r + MIXED_C52 * t2r;
+      m1i = a0i + MIXED_C51 * t1i + MIXED_C52 * t2i;
+      m2r = a0r + MIXED_C52 * t1r + MIXED_C51 * t2r;
+      m2i = a0i + MIXED_C52 * t1i + MIXED_C51 * t2i;
+      n1r = MIXED_S51 * t3r + MIXED_S52 * t4r;
+      n1i = MIXED_S51 * t3i + MIXED_S52 * t4i;
+      n2r = MIXED_S52 * t3r - MIXED_S51 * t4r;
+      n2i = MIXED_S52 * t3i - MIXED_S51 * t4i;
+
+      pY[2u * q] = a0r + t1r + t2r;
+      pY[2u * q + 1u] = a0i + t1i + t2i;
+
+      /* y1 = m1 - j*n1, y2 = m2 - j*n2, y3 = m2 + j*n2, y4 = m1 + j*n1 */
+      yr = m1r + n1i;
+      yi = m1i - n1r;
+      MIXED_TWIDDLE_F32(pY, q + s, yr, yi, w1r, w1i);
+      yr = m2r + n2i;
+      yi = m2i - n2r;
+      MIXED_TWIDDLE_F32(pY, q + 2u * s, yr, yi, w2r, w2i);
+      yr = m2r - n2i;
+      yi = m2i + n2r;
+      MIXED_TWIDDLE_F32(pY, q + 3u * s, yr, yi, w3r, w3i);
+      yr = m1r - n1i;
+      yi = m1i + n1r;
+      MIXED_TWIDDLE_F32(pY, q + 4u * s, yr, yi, w4r, w4i);
+    }
+  }
+}
+
+/**
+* @brief  Processing function for the floating-point mixed-radix CFFT/CIFFT.
+* @param[in]      *S        points to an instance of the floating-point mixed-radix CFFT structure.
+* @param[in, out] *pSrc     points to the complex input buffer of size <code>2*fftLen</code>. Used as scratch and modified.
+* @param[out]     *pDst     points to the complex output buffer of size <code>2*fftLen</code>.
+* @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @return none.
+*/
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint8_t ifftFlag)
+{
+  uint32_t fftLen = S->fftLen;                   /* length of the FFT          */
+  uint32_t m = fftLen;                           /* remaining length           */
+  uint32_t s = 1u;                               /* stride                     */
+  uint32_t stage, radix;
+  float32_t sgn = (ifftFlag == 1u) ? -1.0f : 1.0f;
+  float32_t invL;
+  float32_t *pIn = pSrc;
+  float32_t *pOut;
+  float32_t *pTmp;
+
+  /* Ping-pong so that the last stage writes into pDst */
+  pOut = ((S->numStages & 1u) != 0u) ? pDst : pSrc;
+  if (pOut == pSrc)
+  {
+    /* Even number of stages: start from a copy in pDst */
+    memcpy(pDst, pSrc, 2u * fftLen * sizeof(float32_t));
+    pIn = pDst;
+  }
+
+  for (stage = 0u; stage < S->numStages; stage++)
+  {
+    radix = S->factors[stage];
+    m /= radix;
+
+    switch (radix)
+    {
+    case 2u:
+      arm_radix2_mixed_f32(pIn, pOut, m, s, S->pTwiddle, S->twidCoefModifier, sgn);
+      break;
+    case 3u:
+      arm_radix3_mixed_f32(pIn, pOut, m, s, S->pTwiddle, S->twidCoefModifier, sgn);
+      break;
+    case 4u:
+      arm_radix4_mixed_f32(pIn, pOut, m, s, S->pTwiddle, S->twidCoefModifier, sgn);
+      break;
+    default:
+      arm_radix5_mixed_f32(pIn, pOut, m, s, S->pTwiddle, S->twidCoefModifier, sgn);
+      break;
+    }
+
+    s *= radix;
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  if (ifftFlag == 1u)
+  {
+    /* Scale the inverse by 1/fftLen */
+    invL = 1.0f / (float32_t) fftLen;
+    arm_scale_f32(pDst, invL, pDst, 2u * fftLen);
+  }
+}
+
+/**
+* @} end of MixedRadixFFT group
+*/
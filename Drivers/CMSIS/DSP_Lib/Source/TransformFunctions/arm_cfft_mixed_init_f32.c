@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_mixed_init_f32.c
+*
+* Description:	Initialization function for the floating-point mixed-radix CFFT/CIFFT
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+* @brief  Splits an FFT length into radix-4, radix-2, radix-3 and radix-5 stages.
+* @param[in]  fftLen     length of the FFT.
+* @param[out] *pFactors  points to the radix of each stage (ARM_CFFT_MIXED_MAX_STAGES entries).
+* @param[out] *pNumStages points to the number of stages.
+* @return     ARM_MATH_ARGUMENT_ERROR if fftLen has a prime factor greater than 5.
+*/
+arm_status arm_cfft_mixed_factorize(
+  uint32_t fftLen,
+  uint8_t * pFactors,
+  uint8_t * pNumStages)
+{
+  static const uint8_t radixOrder[4] = {4u, 2u, 3u, 5u};
+  uint32_t n = fftLen;
+  uint32_t i, numStages = 0u;
+
+  for (i = 0u; i < 4u; i++)
+  {
+    while (((n % radixOrder[i]) == 0u) && (numStages < ARM_CFFT_MIXED_MAX_STAGES))
+    {
+      pFactors[numStages++] = radixOrder[i];
+      n /= radixOrder[i];
+    }
+  }
+
+  *pNumStages = (uint8_t) numStages;
+
+  return ((n == 1u) && (fftLen > 1u)) ? ARM_MATH_SUCCESS : ARM_MATH_ARGUMENT_ERROR;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+* @param[in,out] *S       points to an instance of the floating-point mixed-radix CFFT structure.
+* @param[in]     fftLen   length of the FFT.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+* <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* Supported lengths are 300, 480, 500, 600, 960 and 1000 points.
+* The function selects the twiddle factor table and computes the radix of every stage.
+*/
+
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the FFT length */
+  S->fftLen = fftLen;
+
+  /*  Initializations of the twiddle table depending on the FFT length */
+  switch (fftLen)
+  {
+  case 1000u:
+  case 500u:
+    S->pTwiddle = twiddleCoefMixed_1000;
+    S->twidCoefModifier = 1000u / fftLen;
+    break;
+  case 960u:
+  case 480u:
+    S->pTwiddle = twiddleCoefMixed_960;
+    S->twidCoefModifier = 960u / fftLen;
+    break;
+  case 600u:
+  case 300u:
+    S->pTwiddle = twiddleCoefMixed_600;
+    S->twidCoefModifier = 600u / fftLen;
+    break;
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = arm_cfft_mixed_factorize(fftLen, S->factors, &S->numStages);
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
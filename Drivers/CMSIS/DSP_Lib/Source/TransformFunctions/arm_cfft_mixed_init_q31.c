@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_mixed_init_q31.c
+*
+* Description:	Initialization function for the Q31 mixed-radix CFFT/CIFFT
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q31 mixed-radix CFFT/CIFFT.
+* @param[in,out] *S       points to an instance of the Q31 mixed-radix CFFT structure.
+* @param[in]     fftLen   length of the FFT.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+* <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* Supported lengths are 300, 480, 500, 600, 960 and 1000 points.
+* The function selects the twiddle factor table and computes the radix of every stage.
+*/
+
+arm_status arm_cfft_mixed_init_q31(
+  arm_cfft_mixed_instance_q31 * S,
+  uint16_t fftLen)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the FFT length */
+  S->fftLen = fftLen;
+
+  /*  Initializations of the twiddle table depending on the FFT length */
+  switch (fftLen)
+  {
+  case 1000u:
+  case 500u:
+    S->pTwiddle = twiddleCoefMixed_1000_q31;
+    S->twidCoefModifier = 1000u / fftLen;
+    break;
+  case 960u:
+  case 480u:
+    S->pTwiddle = twiddleCoefMixed_960_q31;
+    S->twidCoefModifier = 960u / fftLen;
+    break;
+  case 600u:
+  case 300u:
+    S->pTwiddle = twiddleCoefMixed_600_q31;
+    S->twidCoefModifier = 600u / fftLen;
+    break;
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = arm_cfft_mixed_factorize(fftLen, S->factors, &S->numStages);
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,385 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_mixed_q31.c
+*
+* Description:	Q31 mixed-radix (2, 3, 4, 5) CFFT/CIFFT process function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup MixedRadixFFT
+* @{
+*/
+
+/* Q31 constants: sin(2*pi/3), cos(2*pi/5), sin(2*pi/5), cos(4*pi/5), sin(4*pi/5), 1/3, 1/5 */
+#define MIXED_S3_Q31    ((q31_t) 0x6ED9EBA1)
+#define MIXED_C51_Q31   ((q31_t) 0x278DDE6E)
+#define MIXED_S51_Q31   ((q31_t) 0x79BC384D)
+#define MIXED_C52_Q31   ((q31_t) 0x98722192)
+#define MIXED_S52_Q31   ((q31_t) 0x4B3C8C12)
+#define MIXED_INV3_Q31  ((q31_t) 0x2AAAAAAB)
+#define MIXED_INV5_Q31  ((q31_t) 0x1999999A)
+
+#define MIXED_MULT_Q31(a, b)  ((q31_t) (((q63_t) (a) * (b)) >> 31))
+
+/*
+* Radix-r Stockham stages, see arm_cfft_mixed_f32.c. The inputs of every
+* butterfly are scaled down by 1/r so that the stage cannot overflow.
+* The sign of the twiddle imaginary part is applied in 64 bits since the
+* table holds -1.0 (0x80000000) entries.
+*/
+
+/* (xr + j*xi) * (wr - j*sgn*wi) stored to pOut[2*idx] */
+#define MIXED_TWIDDLE_Q31(pOut, idx, xr, xi, wr, wi, sgn)                                   \
+  do                                                                                         \
+  {                                                                                          \
+    (pOut)[2u * (idx)] = (q31_t) ((((q63_t) (xr) * (wr)) + (sgn) * ((q63_t) (xi) * (wi))) >> 31);      \
+    (pOut)[2u * (idx) + 1u] = (q31_t) ((((q63_t) (xi) * (wr)) - (sgn) * ((q63_t) (xr) * (wi))) >> 31); \
+  } while (0)
+
+static void arm_radix2_mixed_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  uint32_t m,
+  uint32_t s,
+  const q31_t * pTw,
+  uint32_t twStep,
+  int32_t sgn)
+{
+  const q31_t *pA, *pB;
+  q31_t *pY;
+  q31_t a0r, a0i, a1r, a1i, w1r, w1i, y1r, y1i;
+  uint32_t p, q;
+
+  for (p = 0u; p < m; p++)
+  {
+    w1r = pTw[2u * (p * s * twStep)];
+    w1i = pTw[2u * (p * s * twStep) + 1u];
+
+    pA = pIn + 2u * (s * p);
+    pB = pA + 2u * (s * m);
+    pY = pOut + 2u * (s * 2u * p);
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[2u * q] >> 1;
+      a0i = pA[2u * q + 1u] >> 1;
+      a1r = pB[2u * q] >> 1;
+      a1i = pB[2u * q + 1u] >> 1;
+
+      pY[2u * q] = a0r + a1r;
+      pY[2u * q + 1u] = a0i + a1i;
+      y1r = a0r - a1r;
+      y1i = a0i - a1i;
+      MIXED_TWIDDLE_Q31(pY, q + s, y1r, y1i, w1r, w1i, sgn);
+    }
+  }
+}
+
+static void arm_radix3_mixed_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  uint32_t m,
+  uint32_t s,
+  const q31_t * pTw,
+  uint32_t twStep,
+  int32_t sgn)
+{
+  const q31_t *pA;
+  q31_t *pY;
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i;
+  q31_t t1r, t1i, t2r, t2i, m1r, m1i, yr, yi;
+  q31_t w1r, w1i, w2r, w2i;
+  uint32_t p, q, sm = s * m;
+
+  for (p = 0u; p < m; p++)
+  {
+    w1r = pTw[2u * (p * s * twStep)];
+    w1i = pTw[2u * (p * s * twStep) + 1u];
+    w2r = pTw[2u * (2u * p * s * twStep)];
+    w2i = pTw[2u * (2u * p * s * twStep) + 1u];
+
+    pA = pIn + 2u * (s * p);
+    pY = pOut + 2u * (s * 3u * p);
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = MIXED_MULT_Q31(pA[2u * q], MIXED_INV3_Q31);
+      a0i = MIXED_MULT_Q31(pA[2u * q + 1u], MIXED_INV3_Q31);
+      a1r = MIXED_MULT_Q31(pA[2u * (q + sm)], MIXED_INV3_Q31);
+      a1i = MIXED_MULT_Q31(pA[2u * (q + sm) + 1u], MIXED_INV3_Q31);
+      a2r = MIXED_MULT_Q31(pA[2u * (q + 2u * sm)], MIXED_INV3_Q31);
+      a2i = MIXED_MULT_Q31(pA[2u * (q + 2u * sm) + 1u], MIXED_INV3_Q31);
+
+      t1r = a1r + a2r;
+      t1i = a1i + a2i;
+      t2r = sgn * MIXED_MULT_Q31(a1r - a2r, MIXED_S3_Q31);
+      t2i = sgn * MIXED_MULT_Q31(a1i - a2i, MIXED_S3_Q31);
+      m1r = a0r - (t1r >> 1);
+      m1i = a0i - (t1i >> 1);
+
+      pY[2u * q] = a0r + t1r;
+      pY[2u * q + 1u] = a0i + t1i;
+
+      yr = m1r + t2i;
+      yi = m1i - t2r;
+      MIXED_TWIDDLE_Q31(pY, q + s, yr, yi, w1r, w1i, sgn);
+      yr = m1r - t2i;
+      yi = m1i + t2r;
+      MIXED_TWIDDLE_Q31(pY, q + 2u * s, yr, yi, w2r, w2i, sgn);
+    }
+  }
+}
+
+static void arm_radix4_mixed_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  uint32_t m,
+  uint32_t s,
+  const q31_t * pTw,
+  uint32_t twStep,
+  int32_t sgn)
+{
+  const q31_t *pA;
+  q31_t *pY;
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+  q31_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i, yr, yi;
+  q31_t w1r, w1i, w2r, w2i, w3r, w3i;
+  uint32_t p, q, sm = s * m;
+
+  for (p = 0u; p < m; p++)
+  {
+    w1r = pTw[2u * (p * s * twStep)];
+    w1i = pTw[2u * (p * s * twStep) + 1u];
+    w2r = pTw[2u * (2u * p * s * twStep)];
+    w2i = pTw[2u * (2u * p * s * twStep) + 1u];
+    w3r = pTw[2u * (3u * p * s * twStep)];
+    w3i = pTw[2u * (3u * p * s * twStep) + 1u];
+
+    pA = pIn + 2u * (s * p);
+    pY = pOut + 2u * (s * 4u * p);
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = pA[2u * q] >> 2;
+      a0i = pA[2u * q + 1u] >> 2;
+      a1r = pA[2u * (q + sm)] >> 2;
+      a1i = pA[2u * (q + sm) + 1u] >> 2;
+      a2r = pA[2u * (q + 2u * sm)] >> 2;
+      a2i = pA[2u * (q + 2u * sm) + 1u] >> 2;
+      a3r = pA[2u * (q + 3u * sm)] >> 2;
+      a3i = pA[2u * (q + 3u * sm) + 1u] >> 2;
+
+      t1r = a0r + a2r;
+      t1i = a0i + a2i;
+      t2r = a0r - a2r;
+      t2i = a0i - a2i;
+      t3r = a1r + a3r;
+      t3i = a1i + a3i;
+      t4r = sgn * (a1r - a3r);
+      t4i = sgn * (a1i - a3i);
+
+      pY[2u * q] = t1r + t3r;
+      pY[2u * q + 1u] = t1i + t3i;
+
+      yr = t2r + t4i;
+      yi = t2i - t4r;
+      MIXED_TWIDDLE_Q31(pY, q + s, yr, yi, w1r, w1i, sgn);
+      yr = t1r - t3r;
+      yi = t1i - t3i;
+      MIXED_TWIDDLE_Q31(pY, q + 2u * s, yr, yi, w2r, w2i, sgn);
+      yr = t2r - t4i;
+      yi = t2i + t4r;
+      MIXED_TWIDDLE_Q31(pY, q + 3u * s, yr, yi, w3r, w3i, sgn);
+    }
+  }
+}
+
+static void arm_radix5_mixed_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  uint32_t m,
+  uint32_t s,
+  const q31_t * pTw,
+  uint32_t twStep,
+  int32_t sgn)
+{
+  const q31_t *pA;
+  q31_t *pY;
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, a4r, a4i;
+  q31_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  q31_t m1r, m1i, m2r, m2i, n1r, n1i, n2r, n2i, yr, yi;
+  q31_t w1r, w1i, w2r, w2i, w3r, w3i, w4r, w4i;
+  uint32_t p, q, sm = s * m;
+
+  for (p = 0u; p < m; p++)
+  {
+    w1r = pTw[2u * (p * s * twStep)];
+    w1i = pTw[2u * (p * s * twStep) + 1u];
+    w2r = pTw[2u * (2u * p * s * twStep)];
+    w2i = pTw[2u * (2u * p * s * twStep) + 1u];
+    w3r = pTw[2u * (3u * p * s * twStep)];
+    w3i = pTw[2u * (3u * p * s * twStep) + 1u];
+    w4r = pTw[2u * (4u * p * s * twStep)];
+    w4i = pTw[2u * (4u * p * s * twStep) + 1u];
+
+    pA = pIn + 2u * (s * p);
+    pY = pOut + 2u * (s * 5u * p);
+
+    for (q = 0u; q < s; q++)
+    {
+      a0r = MIXED_MULT_Q31(pA[2u * q], MIXED_INV5_Q31);
+      a0i = MIXED_MULT_Q31(pA[2u * q + 1u], MIXED_INV5_Q31);
+      a1r = MIXED_MULT_Q31(pA[2u * (q + sm)], MIXED_INV5_Q31);
+      a1i = MIXED_MULT_Q31(pA[2u * (q + sm) + 1u], MIXED_INV5_Q31);
+      a2r = MIXED_MULT_Q31(pA[2u * (q + 2u * sm)], MIXED_INV5_Q31);
+      a2i = MIXED_MULT_Q31(pA[2u * (q + 2u * sm) + 1u], MIXED_INV5_Q31);
+      a3r = MIXED_MULT_Q31(pA[2u * (q + 3u * sm)], MIXED_INV5_Q31);
+      a3i = MIXED_MULT_Q31(pA[2u * (q + 3u * sm) + 1u], MIXED_INV5_Q31);
+      a4r = MIXED_MULT_Q31(pA[2u * (q + 4u * sm)], MIXED_INV5_Q31);
+      a4i = MIXED_MULT_Q31(pA[2u * (q + 4u * sm) + 1u], MIXED_INV5_Q31);
+
+      t1r = a1r + a4r;
+      t1i = a1i + a4i;
+      t2r = a2r + a3r;
+      t2i = a2i + a3i;
+      t3r = sgn * (a1r - a4r);
+      t3i = sgn * (a1i - a4i);
+      t4r = sgn * (a2r - a3r);
+      t4i = sgn * (a2i - a3i);
+
+      m1r = a0r + MIXED_MULT_Q31(t1r, MIXED_C51_Q31) + MIXED_MULT_Q31(t2r, MIXED_C52_Q31);
+      m1i = a0i + MIXED_MULT_Q31(t1i, MIXED_C51_Q31) + MIXED_MULT_Q31(t2i, MIXED_C52_Q31);
+      m2r = a0r + MIXED_MULT_Q31(t1r, MIXED_C52_Q31) + MIXED_MULT_Q31(t2r, MIXED_C51_Q31);
+      m2i = a0i + MIXED_MULT_Q31(t1i, MIXED_C52_Q31) + MIXED_MULT_Q31(t2i, MIXED_C51_Q31);
+      n1r = MIXED_MULT_Q31(t3r, MIXED_S51_Q31) + MIXED_MULT_Q31(t4r, MIXED_S52_Q31);
+      n1i = MIXED_MULT_Q31(t3i, MIXED_S51_Q31) + MIXED_MULT_Q31(t4i, MIXED_S52_Q31);
+      n2r = MIXED_MULT_Q31(t3r, MIXED_S52_Q31) - MIXED_MULT_Q31(t4r, MIXED_S51_Q31);
+      n2i = MIXED_MULT_Q31(t3i, MIXED_S52_Q31) - MIXED_MULT_Q31(t4i, MIXED_S51_Q31);
+
+      pY[2u * q] = a0r + t1r + t2r;
+      pY[2u * q + 1u] = a0i + t1i + t2i;
+
+      yr = m1r + n1i;
+      yi = m1i - n1r;
+      MIXED_TWIDDLE_Q31(pY, q + s, yr, yi, w1r, w1i, sgn);
+      yr = m2r + n2i;
+      yi = m2i - n2r;
+      MIXED_TWIDDLE_Q31(pY, q + 2u * s, yr, yi, w2r, w2i, sgn);
+      yr = m2r - n2i;
+      yi = m2i + n2r;
+      MIXED_TWIDDLE_Q31(pY, q + 3u * s, yr, yi, w3r, w3i, sgn);
+      yr = m1r - n1i;
+      yi = m1i + n1r;
+      MIXED_TWIDDLE_Q31(pY, q + 4u * s, yr, yi, w4r, w4i, sgn);
+    }
+  }
+}
+
+/**
+* @brief  Processing function for the Q31 mixed-radix CFFT/CIFFT.
+* @param[in]      *S        points to an instance of the Q31 mixed-radix CFFT structure.
+* @param[in, out] *pSrc     points to the complex input buffer of size <code>2*fftLen</code>. Used as scratch and modified.
+* @param[out]     *pDst     points to the complex output buffer of size <code>2*fftLen</code>.
+* @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @return none.
+*
+* \par Scaling:
+* Every stage scales its input down by its radix, so both the forward and the
+* inverse transform are scaled by <code>1/fftLen</code>. Unlike <code>arm_cfft_q31()</code>
+* the output stays in 1.31 format whatever the length.
+*/
+
+void arm_cfft_mixed_q31(
+  const arm_cfft_mixed_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint8_t ifftFlag)
+{
+  uint32_t fftLen = S->fftLen;                   /* length of the FFT          */
+  uint32_t m = fftLen;                           /* remaining length           */
+  uint32_t s = 1u;                               /* stride                     */
+  uint32_t stage, radix;
+  int32_t sgn = (ifftFlag == 1u) ? -1 : 1;
+  q31_t *pIn = pSrc;
+  q31_t *pOut;
+  q31_t *pTmp;
+
+  /* Ping-pong so that the last stage writes into pDst */
+  pOut = ((S->numStages & 1u) != 0u) ? pDst : pSrc;
+  if (pOut == pSrc)
+  {
+    /* Even number of stages: start from a copy in pDst */
+    memcpy(pDst, pSrc, 2u * fftLen * sizeof(q31_t));
+    pIn = pDst;
+  }
+
+  for (stage = 0u; stage < S->numStages; stage++)
+  {
+    radix = S->factors[stage];
+    m /= radix;
+
+    switch (radix)
+    {
+    case 2u:
+      arm_radix2_mixed_q31(pIn, pOut, m, s, S->pTwiddle, S->twidCoefModifier, sgn);
+      break;
+    case 3u:
+      arm_radix3_mixed_q31(pIn, pOut, m, s, S->pTwiddle, S->twidCoefModifier, sgn);
+      break;
+    case 4u:
+      arm_radix4_mixed_q31(pIn, pOut, m, s, S->pTwiddle, S->twidCoefModifier, sgn);
+      break;
+    default:
+      arm_radix5_mixed_q31(pIn, pOut, m, s, S->pTwiddle, S->twidCoefModifier, sgn);
+      break;
+    }
+
+    s *= radix;
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+}
+
+/**
+* @} end of MixedRadixFFT group
+*/
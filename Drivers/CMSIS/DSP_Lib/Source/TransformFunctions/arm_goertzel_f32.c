@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_f32.c
+*
+* Description:	Floating-point Goertzel filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Filter Bank
+ *
+ * The Goertzel algorithm computes the DFT of a frame at a few chosen frequencies.
+ * Each bin costs one multiply and two additions per sample, so for a handful of bins,
+ * as in DTMF or pilot tone detection, it is much cheaper than a full FFT followed by
+ * a magnitude computation, and the frequencies need not lie on the FFT grid.
+ * The benchmark example prints the number of bins where <code>arm_rfft_fast_f32()</code> becomes cheaper.
+ *
+ * \par Algorithm:
+ * For a bin at normalized frequency <code>f</code>, with <code>w = 2*pi*f</code> and <code>coef = 2*cos(w)</code>:
+ * <pre>
+ *    s[n] = x[n] + coef * s[n-1] - s[n-2]
+ * </pre>
+ * After the <code>frameLen</code> samples of a frame the power of the bin is
+ * <pre>
+ *    |X(w)|^2 = s[N-1]^2 + s[N-2]^2 - coef * s[N-1] * s[N-2]
+ * </pre>
+ * and the state is cleared for the next frame.
+ * \par
+ * The functions are block-streaming: the samples of a frame may arrive over any number of calls.
+ * Each call returns the number of frames that were completed, and writes the power of every bin
+ * for the last of them to <code>pPower</code>.
+ *
+ * \par Fixed-Point Behavior
+ * The recursion can grow by a factor <code>frameLen</code>, so the fixed-point versions scale the
+ * input down by <code>shift = ceil(log2(frameLen))</code> bits and keep a Q31 state, the Q15 version
+ * included.  The power is returned as <code>|X(w)|^2 / 2^(2*shift)</code>, in 3.29 format for Q31 and
+ * 3.13 format for Q15, as <code>arm_cmplx_mag_squared_q31()</code> and <code>arm_cmplx_mag_squared_q15()</code>.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ * @param[out]    *pPower    points to the power of each bin for the last frame completed in this call.
+ * @return        number of frames completed in this call.
+ */
+
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pPower)
+{
+  float32_t *pState = S->pState;                 /* state pointer                  */
+  float32_t *pCoeffs = S->pCoeffs;               /* coefficient pointer            */
+  float32_t *pIn;                                /* input pointer                  */
+  float32_t coef, s1, s2;                        /* coefficient and state          */
+  uint32_t numBins = S->numBins;                 /* number of bins                 */
+  uint32_t numFrames = 0u;                       /* frames completed               */
+  uint32_t len, i, sample;
+
+  while (blockSize > 0u)
+  {
+    /* Run up to the end of the current frame */
+    len = (uint32_t) S->frameLen - S->count;
+    len = (blockSize < len) ? blockSize : len;
+
+    for (i = 0u; i < numBins; i++)
+    {
+      coef = pCoeffs[i];
+      s1 = pState[2u * i];
+      s2 = pState[(2u * i) + 1u];
+      pIn = pSrc;
+
+      /* Two samples per iteration; s1 and s2 swap roles instead of being copied */
+      sample = len >> 1u;
+
+      while (sample > 0u)
+      {
+        s2 = (pIn[0] + (coef * s1)) - s2;
+        s1 = (pIn[1] + (coef * s2)) - s1;
+        pIn += 2u;
+
+        sample--;
+      }
+
+      if ((len & 1u) != 0u)
+      {
+        s2 = (pIn[0] + (coef * s1)) - s2;
+
+        /* s2 holds the newest value */
+        pState[2u * i] = s2;
+        pState[(2u * i) + 1u] = s1;
+      }
+      else
+      {
+        pState[2u * i] = s1;
+        pState[(2u * i) + 1u] = s2;
+      }
+    }
+
+    pSrc += len;
+    blockSize -= len;
+    S->count += (uint16_t) len;
+
+    if (S->count == S->frameLen)
+    {
+      /* End of frame: power of each bin, then clear the state */
+      for (i = 0u; i < numBins; i++)
+      {
+        s1 = pState[2u * i];
+        s2 = pState[(2u * i) + 1u];
+        pPower[i] = ((s1 * s1) + (s2 * s2)) - (pCoeffs[i] * s1 * s2);
+      }
+
+      memset(pState, 0, (2u * numBins) * sizeof(float32_t));
+      S->count = 0u;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of Goertzel group
+ */
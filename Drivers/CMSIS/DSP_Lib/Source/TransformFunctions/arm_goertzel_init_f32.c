@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_init_f32.c
+*
+* Description:	floating-point Goertzel filter bank initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]     numBins    number of frequencies analyzed.
+ * @param[in]     frameLen   number of samples per analysis frame.
+ * @param[in]     *pFreqs    points to the normalized frequencies f/fs of the bins.
+ * @param[in]     *pCoeffs   points to the coefficient buffer, <code>numBins</code> values.
+ * @param[in]     *pState    points to the state buffer, <code>2*numBins</code> values.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>frameLen</code> is zero.
+ *
+ * \par
+ * A bin at index <code>k</code> of an <code>N</code> point DFT has the normalized frequency <code>k/N</code>.
+ * For DTMF at 8 kHz with <code>frameLen = 205</code> the 697 Hz row tone uses <code>697/8000</code>.
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  float32_t sinVal, cosVal;
+  uint32_t i;
+
+  if ((numBins == 0u) || (frameLen == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numBins = numBins;
+  S->frameLen = frameLen;
+  S->count = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* arm_sin_cos_f32() is more accurate than arm_cos_f32(), which matters for weak bins */
+  for (i = 0u; i < numBins; i++)
+  {
+    arm_sin_cos_f32(360.0f * pFreqs[i], &sinVal, &cosVal);
+    pCoeffs[i] = 2.0f * cosVal;
+  }
+
+  memset(pState, 0, (2u * (uint32_t) numBins) * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
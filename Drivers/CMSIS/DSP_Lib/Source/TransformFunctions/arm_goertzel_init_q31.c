@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_init_q31.c
+*
+* Description:	Q31 Goertzel filter bank initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins    number of frequencies analyzed.
+ * @param[in]     frameLen   number of samples per analysis frame.
+ * @param[in]     *pFreqs    points to the normalized frequencies f/fs of the bins.
+ * @param[in]     *pCoeffs   points to the coefficient buffer, <code>numBins</code> values.
+ * @param[in]     *pState    points to the state buffer, <code>2*numBins</code> values.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>frameLen</code> is zero.
+ *
+ * \par
+ * A bin at index <code>k</code> of an <code>N</code> point DFT has the normalized frequency <code>k/N</code>.
+ * For DTMF at 8 kHz with <code>frameLen = 205</code> the 697 Hz row tone uses <code>697/8000</code>.
+ * \par
+ * The input scaling <code>shift</code> is chosen for the bin whose state can grow the most,
+ * about <code>frameLen/|sin(2*pi*f)|</code>, so bins close to DC or to Nyquist cost precision
+ * in every bin of the bank.  Such bins are better served by a separate instance.
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const float32_t * pFreqs,
+  q31_t * pCoeffs,
+  q31_t * pState)
+{
+  q31_t sinVal, theta;
+  q63_t angle;
+  float32_t invSin, gain, maxGain = 0.0f;
+  uint32_t i, m;
+
+  if ((numBins == 0u) || (frameLen == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numBins = numBins;
+  S->frameLen = frameLen;
+  S->count = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* The Q31 angle of arm_sin_cos_q31() is 1.0 for 180 degrees, so f = 0.5 wraps to -1.0.
+   * cos(w) in 1.31 is 2*cos(w) in 2.30. */
+  for (i = 0u; i < numBins; i++)
+  {
+    angle = (q63_t) (pFreqs[i] * 4294967296.0f);
+    theta = (q31_t) ((angle >= 0x80000000LL) ? (angle - 0x100000000LL) : angle);
+    arm_sin_cos_q31(theta, &sinVal, &pCoeffs[i]);
+
+    /* After n samples the state is the input filtered by sin((k+1)w)/sin(w), k < n, and
+     * |sin((k+1)w)/sin(w)| <= min(k+1, 1/|sin(w)|).  Summed over the frame this gain is about
+     * frameLen/|sin(w)|, and up to frameLen*(frameLen+1)/2 for the bins at DC and Nyquist. */
+    invSin = (sinVal == 0) ? (float32_t) frameLen : (2147483648.0f / (float32_t) sinVal);
+    invSin = (invSin < 0.0f) ? -invSin : invSin;
+    m = (invSin >= (float32_t) frameLen) ? frameLen : (uint32_t) invSin;
+    gain = (0.5f * (float32_t) m * (float32_t) (m + 1u)) + ((float32_t) (frameLen - m) * invSin);
+    maxGain = (gain > maxGain) ? gain : maxGain;
+  }
+
+  /* Scale the input so that the state cannot overflow in the bin with the largest gain */
+  S->shift = 0u;
+  while ((S->shift < 31u) && ((float32_t) (1u << S->shift) < maxGain))
+  {
+    S->shift++;
+  }
+
+  memset(pState, 0, (2u * (uint32_t) numBins) * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_q31.c
+*
+* Description:	Q31 Goertzel filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ * @param[out]    *pPower    points to the power of each bin for the last frame completed in this call.
+ * @return        number of frames completed in this call.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is shifted right by <code>shift</code> bits into a Q31 state, and the recursion is
+ * evaluated with a 64-bit intermediate product.  The state cannot overflow.
+ * The power is returned in 3.29 format, scaled by <code>2^(-2*shift)</code>.
+ */
+
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pPower)
+{
+  q31_t *pState = S->pState;                     /* state pointer                  */
+  q31_t *pCoeffs = S->pCoeffs;                   /* coefficient pointer, 2.30      */
+  q31_t *pIn;                                  /* input pointer                  */
+  q31_t coef, s0, s1, s2;                        /* coefficient and state          */
+  uint32_t shift = S->shift;                     /* input scaling                  */
+  uint32_t numBins = S->numBins;                 /* number of bins                 */
+  uint32_t numFrames = 0u;                       /* frames completed               */
+  uint32_t len, i, sample;
+
+  while (blockSize > 0u)
+  {
+    /* Run up to the end of the current frame */
+    len = (uint32_t) S->frameLen - S->count;
+    len = (blockSize < len) ? blockSize : len;
+
+    for (i = 0u; i < numBins; i++)
+    {
+      coef = pCoeffs[i];
+      s1 = pState[2u * i];
+      s2 = pState[(2u * i) + 1u];
+      pIn = pSrc;
+
+      sample = len;
+
+      while (sample > 0u)
+      {
+        /* s0 = x + 2*cos(w)*s1 - s2; the sum fits in Q31 but the product alone may not */
+        s0 = (q31_t) ((q63_t) ((*pIn++) >> shift) + (((q63_t) coef * s1) >> 30) - s2);
+        s2 = s1;
+        s1 = s0;
+
+        sample--;
+      }
+
+      pState[2u * i] = s1;
+      pState[(2u * i) + 1u] = s2;
+    }
+
+    pSrc += len;
+    blockSize -= len;
+    S->count += (uint16_t) len;
+
+    if (S->count == S->frameLen)
+    {
+      /* End of frame: power of each bin in 3.29, then clear the state */
+      for (i = 0u; i < numBins; i++)
+      {
+        s1 = pState[2u * i];
+        s2 = pState[(2u * i) + 1u];
+        pPower[i] = (q31_t) (((q63_t) s1 * s1) >> 33) + (q31_t) (((q63_t) s2 * s2) >> 33)
+                    - (q31_t) (((((q63_t) pCoeffs[i] * s1) >> 31) * s2) >> 32);
+      }
+
+      memset(pState, 0, (2u * numBins) * sizeof(q31_t));
+      S->count = 0u;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of Goertzel group
+ */
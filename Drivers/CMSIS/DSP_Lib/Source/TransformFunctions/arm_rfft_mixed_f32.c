@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rfft_mixed_f32.c
+*
+* Description:	Floating-point mixed-radix RFFT/RIFFT process function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup MixedRadixFFT
+* @{
+*/
+
+/**
+* @brief  Processing function for the floating-point mixed-radix RFFT/RIFFT.
+* @param[in]      *S        points to an instance of the floating-point mixed-radix RFFT structure.
+* @param[in, out] *p        points to the input buffer of <code>fftLenRFFT</code> values. Used as scratch and modified.
+* @param[out]     *pOut     points to the output buffer of <code>fftLenRFFT</code> values.
+* @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @return none.
+*
+* \par
+* The real sequence of length <code>N</code> is packed into a complex sequence of
+* length <code>N/2</code>, transformed with <code>arm_cfft_mixed_f32()</code> and
+* split into the spectrum of the real sequence.
+* The output format is the same as for <code>arm_rfft_fast_f32()</code>:
+* <code>{X[0].real, X[N/2].real, X[1].real, X[1].imag, ..., X[N/2-1].real, X[N/2-1].imag}</code>.
+* The inverse transform takes the same format as input and produces the real sequence,
+* scaled so that the inverse of the forward transform returns the original data.
+*/
+
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  const float32_t *pTw = S->pTwiddleRFFT;        /* full circle table of length N */
+  uint32_t M = S->fftLenRFFT / 2u;               /* length of the internal CFFT   */
+  uint32_t k;
+  float32_t *pZ;
+  float32_t zkR, zkI, zmR, zmI;                  /* Z[k] and conj(Z[M-k])        */
+  float32_t eR, eI, oR, oI, wR, wI, tR, tI;
+
+  if (ifftFlag == 0u)
+  {
+    /* Complex FFT of the packed even/odd samples, result in pOut */
+    arm_cfft_mixed_f32(&S->Sint, p, pOut, 0u);
+    pZ = pOut;
+
+    /* X[0] and X[M] are real and are packed together */
+    zkR = pZ[0];
+    zkI = pZ[1];
+    pZ[0] = zkR + zkI;
+    pZ[1] = zkR - zkI;
+
+    /* X[k] = E[k] + W^k O[k] with E = (Z[k] + conj(Z[M-k]))/2, O = -j(Z[k] - conj(Z[M-k]))/2 */
+    for (k = 1u; k <= M / 2u; k++)
+    {
+      zkR = pZ[2u * k];
+      zkI = pZ[2u * k + 1u];
+      zmR = pZ[2u * (M - k)];
+      zmI = -pZ[2u * (M - k) + 1u];
+
+      eR = 0.5f * (zkR + zmR);
+      eI = 0.5f * (zkI + zmI);
+      oR = 0.5f * (zkI - zmI);
+      oI = -0.5f * (zkR - zmR);
+
+      /* W^k = cos - j sin */
+      wR = pTw[2u * k];
+      wI = pTw[2u * k + 1u];
+      tR = oR * wR + oI * wI;
+      tI = oI * wR - oR * wI;
+
+      pZ[2u * k] = eR + tR;
+      pZ[2u * k + 1u] = eI + tI;
+
+      /* X[M-k] = conj(E[k] - W^k O[k]) */
+      if (k != (M - k))
+      {
+        pZ[2u * (M - k)] = eR - tR;
+        pZ[2u * (M - k) + 1u] = -(eI - tI);
+      }
+    }
+  }
+  else
+  {
+    pZ = p;
+
+    /* Unpack X[0] and X[M] */
+    zkR = pZ[0];
+    zkI = pZ[1];
+    pZ[0] = 0.5f * (zkR + zkI);
+    pZ[1] = 0.5f * (zkR - zkI);
+
+    /* Z[k] = E[k] + j O[k] with E = (X[k] + conj(X[M-k]))/2, O = W^-k (X[k] - conj(X[M-k]))/2 */
+    for (k = 1u; k <= M / 2u; k++)
+    {
+      zkR = pZ[2u * k];
+      zkI = pZ[2u * k + 1u];
+      zmR = pZ[2u * (M - k)];
+      zmI = -pZ[2u * (M - k) + 1u];
+
+      eR = 0.5f * (zkR + zmR);
+      eI = 0.5f * (zkI + zmI);
+      tR = 0.5f * (zkR - zmR);
+      tI = 0.5f * (zkI - zmI);
+
+      /* W^-k = cos + j sin */
+      wR = pTw[2u * k];
+      wI = pTw[2u * k + 1u];
+      oR = tR * wR - tI * wI;
+      oI = tI * wR + tR * wI;
+
+      pZ[2u * k] = eR - oI;
+      pZ[2u * k + 1u] = eI + oR;
+
+      /* Z[M-k] = conj(E[k]) + j conj(O[k]) */
+      if (k != (M - k))
+      {
+        pZ[2u * (M - k)] = eR + oI;
+        pZ[2u * (M - k) + 1u] = -eI + oR;
+      }
+    }
+
+    /* Inverse complex FFT, scaled by 1/M, gives the interleaved real sequence */
+    arm_cfft_mixed_f32(&S->Sint, p, pOut, 1u);
+  }
+}
+
+/**
+* @} end of MixedRadixFFT group
+*/
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sliding_dft_f32.c
+*
+* Description:	Floating-point sliding DFT.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SlidingDFT Sliding DFT
+ *
+ * The sliding DFT keeps a few bins of the <code>N</code> point DFT of the last <code>N</code> samples
+ * up to date for every new sample.  Where the Goertzel filter bank gives one result per frame,
+ * the sliding DFT gives one per sample at a cost of one complex multiply per bin and sample,
+ * independent of <code>N</code>.
+ *
+ * \par Algorithm:
+ * With <code>W = r*exp(j*2*pi*k/N)</code> the bin <code>k</code> is updated as
+ * <pre>
+ *    X[k] = W * X[k] + exp(j*2*pi*k/N) * (x[n] - r^N * x[n-N])
+ * </pre>
+ * For <code>r = 1</code> this is exactly the DFT bin of the window <code>x[n-N+1] ... x[n]</code>.
+ * Rounding errors are never forgotten in that case, so a damping factor <code>r</code> slightly below 1
+ * is recommended; the bins are then the DFT of the window weighted by <code>r^m</code>, <code>m</code>
+ * being the age of a sample.
+ * \par
+ * The bins are stored as interleaved complex values in <code>pState</code>, in the order of <code>pBins</code>.
+ * <code>arm_cmplx_mag_squared_f32()</code> gives their power.
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point sliding DFT.
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ */
+
+void arm_sliding_dft_f32(
+  arm_sliding_dft_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t *pTwiddle = S->pTwiddle;             /* r*exp(j*w) of each bin         */
+  float32_t *pState = S->pState;                 /* complex bins                   */
+  float32_t *pHistory = S->pHistory;             /* window samples                 */
+  float32_t invDamping = 1.0f / S->damping;      /* exp(j*w) = W / r               */
+  float32_t dampingN = S->dampingN;              /* r^N                            */
+  float32_t delta, re, im, wr, wi;
+  uint32_t numBins = S->numBins;                 /* number of bins                 */
+  uint32_t windowLen = S->windowLen;             /* window length                  */
+  uint32_t pos = S->head;                        /* position of the oldest sample  */
+  uint32_t i;
+
+  while (blockSize > 0u)
+  {
+    /* The new sample replaces the oldest one in the window */
+    delta = (*pSrc - (dampingN * pHistory[pos])) * invDamping;
+    pHistory[pos] = *pSrc++;
+    pos = (pos + 1u == windowLen) ? 0u : (pos + 1u);
+
+    for (i = 0u; i < numBins; i++)
+    {
+      /* X = W * (X + delta/r) */
+      re = pState[2u * i] + delta;
+      im = pState[(2u * i) + 1u];
+      wr = pTwiddle[2u * i];
+      wi = pTwiddle[(2u * i) + 1u];
+
+      pState[2u * i] = (re * wr) - (im * wi);
+      pState[(2u * i) + 1u] = (re * wi) + (im * wr);
+    }
+
+    blockSize--;
+  }
+
+  S->head = (uint16_t) pos;
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
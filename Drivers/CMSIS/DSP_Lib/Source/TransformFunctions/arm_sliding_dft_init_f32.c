@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        17. October 2026
+* $Revision: 	V.1.4.5
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sliding_dft_init_f32.c
+*
+* Description:	Floating-point sliding DFT initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding DFT.
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     windowLen  DFT length N.
+ * @param[in]     numBins    number of DFT bins updated.
+ * @param[in]     *pBins     points to the bin indices k, <code>numBins</code> values below <code>windowLen</code>.
+ * @param[in]     damping    damping factor r in (0, 1].
+ * @param[in]     *pTwiddle  points to the twiddle buffer, <code>2*numBins</code> values.
+ * @param[in]     *pState    points to the bin buffer, <code>2*numBins</code> values.
+ * @param[in]     *pHistory  points to the history buffer, <code>windowLen</code> values.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+ *
+ * \par
+ * The window and the bins are cleared, as if <code>windowLen</code> zeros had been processed.
+ */
+
+arm_status arm_sliding_dft_init_f32(
+  arm_sliding_dft_instance_f32 * S,
+  uint16_t windowLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  float32_t damping,
+  float32_t * pTwiddle,
+  float32_t * pState,
+  float32_t * pHistory)
+{
+  float32_t theta, dampingN, sinVal, cosVal;
+  uint32_t i;
+
+  if ((windowLen == 0u) || (numBins == 0u) || (damping <= 0.0f) || (damping > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if (pBins[i] >= windowLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* Angle in degrees, in the range [-180 180] of arm_sin_cos_f32() */
+    theta = (360.0f * (float32_t) pBins[i]) / (float32_t) windowLen;
+    theta = (theta > 180.0f) ? (theta - 360.0f) : theta;
+    arm_sin_cos_f32(theta, &sinVal, &cosVal);
+    pTwiddle[2u * i] = damping * cosVal;
+    pTwiddle[(2u * i) + 1u] = damping * sinVal;
+  }
+
+  /* r^N */
+  dampingN = 1.0f;
+  for (i = 0u; i < windowLen; i++)
+  {
+    dampingN *= damping;
+  }
+
+  S->numBins = numBins;
+  S->windowLen = windowLen;
+  S->head = 0u;
+  S->damping = damping;
+  S->dampingN = dampingN;
+  S->pTwiddle = pTwiddle;
+  S->pState = pState;
+  S->pHistory = pHistory;
+
+  memset(pState, 0, (2u * (uint32_t) numBins) * sizeof(float32_t));
+  memset(pHistory, 0, (uint32_t) windowLen * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
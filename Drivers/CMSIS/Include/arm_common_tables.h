@@ -84,6 +84,12 @@ extern const float32_t twiddleCoef_rfft_512[512];
 extern const float32_t twiddleCoef_rfft_1024[1024];
 extern const float32_t twiddleCoef_rfft_2048[2048];
 extern const float32_t twiddleCoef_rfft_4096[4096];
+extern const float32_t twiddleCoefMixed_600[1200];
+extern const float32_t twiddleCoefMixed_960[1920];
+extern const float32_t twiddleCoefMixed_1000[2000];
+extern const q31_t twiddleCoefMixed_600_q31[1200];
+extern const q31_t twiddleCoefMixed_960_q31[1920];
+extern const q31_t twiddleCoefMixed_1000_q31[2000];
 
 
 /* floating-point bit reversal tables */
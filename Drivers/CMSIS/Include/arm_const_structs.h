@@ -76,4 +76,18 @@
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048;
    extern const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096;
 
+   extern const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len300;
+   extern const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len480;
+   extern const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len500;
+   extern const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len600;
+   extern const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len960;
+   extern const arm_cfft_mixed_instance_f32 arm_cfft_mixed_sR_f32_len1000;
+
+   extern const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len300;
+   extern const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len480;
+   extern const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len500;
+   extern const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len600;
+   extern const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len960;
+   extern const arm_cfft_mixed_instance_q31 arm_cfft_mixed_sR_q31_len1000;
+
 #endif
@@ -378,7 +378,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix factorization if the input matrix cannot be factored. */
   } arm_status;
 
   /**
@@ -1334,6 +1335,48 @@ extern "C"
   q31_t * pState,
   int8_t postShift);
 
+  /**
+   * @brief Instance structure for the multichannel Q31 Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint8_t numChannels;     /**< number of interleaved channels. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_multichannel_df1_instance_q31;
+
+  /**
+   * @brief Processing function for the multichannel Q31 Biquad cascade filter.
+   * @param[in]  S          points to an instance of the multichannel Q31 Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples per channel to process.
+   */
+  void arm_biquad_cascade_multichannel_df1_q31(
+  const arm_biquad_cascade_multichannel_df1_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the multichannel Q31 Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the multichannel Q31 Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all channels.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_multichannel_df1_init_q31(
+  arm_biquad_cascade_multichannel_df1_instance_q31 * S,
+  uint8_t numStages,
+  uint8_t numChannels,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
 
   /**
    * @brief Processing function for the floating-point Biquad cascade filter.
@@ -1600,6 +1643,34 @@ extern "C"
   arm_matrix_instance_q31 * pDst);
 
 
+  /**
+   * @brief Floating-point matrix multiplication, cache-tiled with 4 x 4 (2 x 2 on Cortex-M0) register blocks
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_tiled_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Q31 matrix multiplication, cache-tiled with 2 x 2 register blocks
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_tiled_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst);
+
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -1834,6 +1905,137 @@ extern "C"
   arm_pid_instance_q15 * S);
 
 
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+    uint16_t numStates;        /**< number of states, n. */
+    float32_t *pX;             /**< points to the state vector, of length n. */
+    float32_t *pP;             /**< points to the upper triangle of the state covariance, packed by rows, of length n*(n+1)/2. */
+    float32_t *pScratch;       /**< points to the working buffer, of length 2*n*n+n. */
+    uint16_t *pIndex;          /**< points to the working buffer of measurement-row indices, of length n. */
+  } arm_kalman_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Kalman filter.
+   */
+  typedef struct
+  {
+    uint16_t numStates;        /**< number of states, n. */
+    uint8_t fShift;            /**< the transition matrix is in Q(31-fShift) format. */
+    uint8_t hShift;            /**< the measurement matrix is in Q(31-hShift) format. */
+    q31_t *pX;                 /**< points to the state vector, of length n. */
+    q31_t *pP;                 /**< points to the upper triangle of the state covariance, packed by rows, of length n*(n+1)/2. */
+    q31_t *pScratch;           /**< points to the working buffer, of length 2*n*n+n. */
+    uint16_t *pIndex;          /**< points to the working buffer of measurement-row indices, of length n. */
+  } arm_kalman_instance_q31;
+
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[out] S          points to an instance of the floating-point Kalman filter structure.
+   * @param[in]  numStates  number of states.
+   * @param[in]  pX         points to the state vector, holding the initial state.
+   * @param[in]  pP         points to the packed upper triangle of the covariance, holding the initial covariance.
+   * @param[in]  pScratch   points to the working buffer, of length 2*numStates*numStates+numStates.
+   * @param[in]  pIndex     points to the index buffer, of length numStates.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if numStates is zero.
+   */
+  arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  float32_t * pX,
+  float32_t * pP,
+  float32_t * pScratch,
+  uint16_t * pIndex);
+
+
+  /**
+   * @brief  Prediction step of the floating-point Kalman filter.
+   * @param[in,out] S          points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pF         points to the n x n state transition matrix (or its Jacobian).
+   * @param[in]     pQ         points to the packed upper triangle of the process noise covariance, or NULL.
+   * @param[in]     stateFlag  1 = propagate the state as x = F * x, 0 = the state was already propagated by the caller.
+   */
+  void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pF,
+  const float32_t * pQ,
+  uint8_t stateFlag);
+
+
+  /**
+   * @brief  Measurement update step of the floating-point Kalman filter.
+   * @param[in,out] S    points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pH   points to the m x n measurement matrix (or its Jacobian).
+   * @param[in]     pZ   points to the m measurements.
+   * @param[in]     pR   points to the m measurement noise variances.
+   * @param[in]     pHx  points to the m predicted measurements h(x), or NULL to use H * x.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if a measurement was skipped because its innovation variance was not positive.
+   */
+  arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  const float32_t * pZ,
+  const float32_t * pR,
+  const float32_t * pHx);
+
+
+  /**
+   * @brief  Initialization function for the Q31 Kalman filter.
+   * @param[out] S          points to an instance of the Q31 Kalman filter structure.
+   * @param[in]  numStates  number of states.
+   * @param[in]  fShift     the transition matrix is in Q(31-fShift) format, at most 15.
+   * @param[in]  hShift     the measurement matrix is in Q(31-hShift) format, at most 31.
+   * @param[in]  pX         points to the state vector, holding the initial state.
+   * @param[in]  pP         points to the packed upper triangle of the covariance, holding the initial covariance.
+   * @param[in]  pScratch   points to the working buffer, of length 2*numStates*numStates+numStates.
+   * @param[in]  pIndex     points to the index buffer, of length numStates.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if numStates is zero or a shift is out of range.
+   */
+  arm_status arm_kalman_init_q31(
+  arm_kalman_instance_q31 * S,
+  uint16_t numStates,
+  uint8_t fShift,
+  uint8_t hShift,
+  q31_t * pX,
+  q31_t * pP,
+  q31_t * pScratch,
+  uint16_t * pIndex);
+
+
+  /**
+   * @brief  Prediction step of the Q31 Kalman filter.
+   * @param[in,out] S          points to an instance of the Q31 Kalman filter structure.
+   * @param[in]     pF         points to the n x n state transition matrix (or its Jacobian), in Q(31-fShift) format.
+   * @param[in]     pQ         points to the packed upper triangle of the process noise covariance, or NULL.
+   * @param[in]     stateFlag  1 = propagate the state as x = F * x, 0 = the state was already propagated by the caller.
+   */
+  void arm_kalman_predict_q31(
+  arm_kalman_instance_q31 * S,
+  const arm_matrix_instance_q31 * pF,
+  const q31_t * pQ,
+  uint8_t stateFlag);
+
+
+  /**
+   * @brief  Measurement update step of the Q31 Kalman filter.
+   * @param[in,out] S    points to an instance of the Q31 Kalman filter structure.
+   * @param[in]     pH   points to the m x n measurement matrix (or its Jacobian), in Q(31-hShift) format.
+   * @param[in]     pZ   points to the m measurements.
+   * @param[in]     pR   points to the m measurement noise variances.
+   * @param[in]     pHx  points to the m predicted measurements h(x), or NULL to use H * x.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_SINGULAR if a measurement was skipped because its innovation variance was not positive.
+   */
+  arm_status arm_kalman_update_q31(
+  arm_kalman_instance_q31 * S,
+  const arm_matrix_instance_q31 * pH,
+  const q31_t * pZ,
+  const q31_t * pR,
+  const q31_t * pHx);
+
+
   /**
    * @brief Instance structure for the floating-point Linear Interpolate function.
    */
@@ -2248,6 +2450,410 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Maximum number of radix stages of a mixed-radix CFFT.
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES  16u
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                                /**< length of the FFT. */
+    uint16_t twidCoefModifier;                      /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const float32_t *pTwiddle;                      /**< points to the Twiddle factor table. */
+    uint8_t numStages;                              /**< number of radix stages. */
+    uint8_t factors[ARM_CFFT_MIXED_MAX_STAGES];     /**< radix (2, 3, 4 or 5) of each stage. */
+  } arm_cfft_mixed_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                                /**< length of the FFT. */
+    uint16_t twidCoefModifier;                      /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const q31_t *pTwiddle;                          /**< points to the Twiddle factor table. */
+    uint8_t numStages;                              /**< number of radix stages. */
+    uint8_t factors[ARM_CFFT_MIXED_MAX_STAGES];     /**< radix (2, 3, 4 or 5) of each stage. */
+  } arm_cfft_mixed_instance_q31;
+
+  /**
+   * @brief  Splits an FFT length into radix-4, radix-2, radix-3 and radix-5 stages, shared by the mixed-radix initialization functions.
+   * @param[in]  fftLen      length of the FFT.
+   * @param[out] *pFactors   points to the radix of each stage (ARM_CFFT_MIXED_MAX_STAGES entries).
+   * @param[out] *pNumStages points to the number of stages.
+   * @return     ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> has a prime factor greater than 5.
+   */
+  arm_status arm_cfft_mixed_factorize(
+  uint32_t fftLen,
+  uint8_t * pFactors,
+  uint8_t * pNumStages);
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[in,out] S       points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]     fftLen  length of the FFT.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported length.
+   */
+  arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen);
+
+  /**
+   * @brief Processing function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in,out] pSrc      points to the complex input buffer, which is used as scratch and is modified.
+   * @param[out]    pDst      points to the complex output buffer.
+   * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   */
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief  Initialization function for the Q31 mixed-radix CFFT/CIFFT.
+   * @param[in,out] S       points to an instance of the Q31 mixed-radix CFFT structure.
+   * @param[in]     fftLen  length of the FFT.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported length.
+   */
+  arm_status arm_cfft_mixed_init_q31(
+  arm_cfft_mixed_instance_q31 * S,
+  uint16_t fftLen);
+
+  /**
+   * @brief Processing function for the Q31 mixed-radix CFFT/CIFFT.
+   * @param[in]     S         points to an instance of the Q31 mixed-radix CFFT structure.
+   * @param[in,out] pSrc      points to the complex input buffer, which is used as scratch and is modified.
+   * @param[out]    pDst      points to the complex output buffer.
+   * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   */
+  void arm_cfft_mixed_q31(
+  const arm_cfft_mixed_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mixed_instance_f32 Sint;   /**< Internal mixed-radix CFFT structure of length fftLenRFFT/2. */
+    uint16_t fftLenRFFT;                /**< length of the real sequence */
+    const float32_t * pTwiddleRFFT;     /**< Twiddle factors real stage  */
+  } arm_rfft_mixed_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix RFFT/RIFFT.
+   * @param[in,out] S       points to an instance of the floating-point mixed-radix RFFT structure.
+   * @param[in]     fftLen  length of the real sequence.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported length.
+   */
+  arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen);
+
+  /**
+   * @brief Processing function for the floating-point mixed-radix RFFT/RIFFT.
+   * @param[in]     S         points to an instance of the floating-point mixed-radix RFFT structure.
+   * @param[in,out] p         points to the input buffer, which is used as scratch and is modified.
+   * @param[out]    pOut      points to the output buffer.
+   * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   */
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;           /**< number of frequencies analyzed. */
+    uint16_t frameLen;          /**< number of samples per analysis frame. */
+    uint16_t count;             /**< number of samples of the current frame already processed. */
+    float32_t *pCoeffs;         /**< points to the coefficients 2*cos(w), numBins values. */
+    float32_t *pState;          /**< points to the state, 2*numBins values. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel filter bank.
+   * @param[in,out] S         points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins   number of frequencies analyzed.
+   * @param[in]     frameLen  number of samples per analysis frame.
+   * @param[in]     pFreqs    points to the normalized frequencies f/fs of the bins, numBins values in [0, 0.5].
+   * @param[in]     pCoeffs   points to the coefficient buffer, numBins values.
+   * @param[in]     pState    points to the state buffer, 2*numBins values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numBins or frameLen is zero.
+   */
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point Goertzel filter bank.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[out]    pPower     points to the power of each bin for the last frame completed in this call, numBins values.
+   * @return        number of frames completed in this call.
+   */
+  uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pPower);
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;           /**< number of frequencies analyzed. */
+    uint16_t frameLen;          /**< number of samples per analysis frame. */
+    uint16_t count;             /**< number of samples of the current frame already processed. */
+    uint8_t shift;              /**< input scaling, log2 of the largest state gain of the bins, rounded up. */
+    q31_t *pCoeffs;             /**< points to the coefficients 2*cos(w), numBins values. */
+    q31_t *pState;              /**< points to the state, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel filter bank.
+   * @param[in,out] S         points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins   number of frequencies analyzed.
+   * @param[in]     frameLen  number of samples per analysis frame.
+   * @param[in]     pFreqs    points to the normalized frequencies f/fs of the bins, numBins values in [0, 0.5].
+   * @param[in]     pCoeffs   points to the coefficient buffer, numBins values.
+   * @param[in]     pState    points to the state buffer, 2*numBins values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numBins or frameLen is zero.
+   */
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const float32_t * pFreqs,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 Goertzel filter bank.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[out]    pPower     points to the power of each bin for the last frame completed in this call, numBins values.
+   * @return        number of frames completed in this call.
+   */
+  uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pPower);
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;           /**< number of frequencies analyzed. */
+    uint16_t frameLen;          /**< number of samples per analysis frame. */
+    uint16_t count;             /**< number of samples of the current frame already processed. */
+    uint8_t shift;              /**< input scaling, log2 of the largest state gain of the bins, rounded up. */
+    q31_t *pCoeffs;             /**< points to the coefficients 2*cos(w), numBins values. */
+    q31_t *pState;              /**< points to the state, 2*numBins values. */
+  } arm_goertzel_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 Goertzel filter bank.
+   * @param[in,out] S         points to an instance of the Q15 Goertzel structure.
+   * @param[in]     numBins   number of frequencies analyzed.
+   * @param[in]     frameLen  number of samples per analysis frame.
+   * @param[in]     pFreqs    points to the normalized frequencies f/fs of the bins, numBins values in [0, 0.5].
+   * @param[in]     pCoeffs   points to the coefficient buffer, numBins values.
+   * @param[in]     pState    points to the state buffer, 2*numBins values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numBins or frameLen is zero.
+   */
+  arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const float32_t * pFreqs,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q15 Goertzel filter bank.
+   * @param[in,out] S          points to an instance of the Q15 Goertzel structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[out]    pPower     points to the power of each bin for the last frame completed in this call, numBins values.
+   * @return        number of frames completed in this call.
+   */
+  uint32_t arm_goertzel_q15(
+  arm_goertzel_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pPower);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;           /**< number of DFT bins updated. */
+    uint16_t windowLen;         /**< DFT length N, the number of samples in the window. */
+    uint16_t head;              /**< history position of the oldest sample. */
+    float32_t damping;          /**< damping factor r applied per sample, 1.0 for none. */
+    float32_t dampingN;         /**< r to the power windowLen. */
+    float32_t *pTwiddle;        /**< points to r*exp(j*2*pi*k/N) for each bin, 2*numBins values. */
+    float32_t *pState;          /**< points to the complex bin values, 2*numBins values. */
+    float32_t *pHistory;        /**< points to the window samples, windowLen values. */
+  } arm_sliding_dft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     windowLen  DFT length N.
+   * @param[in]     numBins    number of DFT bins updated.
+   * @param[in]     pBins      points to the bin indices k, numBins values below windowLen.
+   * @param[in]     damping    damping factor r in (0, 1], for example 0.99999.
+   * @param[in]     pTwiddle   points to the twiddle buffer, 2*numBins values.
+   * @param[in]     pState     points to the bin buffer, 2*numBins values.
+   * @param[in]     pHistory   points to the history buffer, windowLen values.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+  arm_status arm_sliding_dft_init_f32(
+  arm_sliding_dft_instance_f32 * S,
+  uint16_t windowLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  float32_t damping,
+  float32_t * pTwiddle,
+  float32_t * pState,
+  float32_t * pHistory);
+
+  /**
+   * @brief  Processing function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_dft_f32(
+  arm_sliding_dft_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point FFT-based (overlap-save) FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+    uint16_t fftLen;                    /**< length of the FFT, or 0 when the direct arm_fir_f32() path is used. */
+    uint32_t blockSize;                 /**< maximum number of samples processed per call. */
+    float32_t *pState;                  /**< points to the input history buffer of length fftLen. */
+    float32_t *pSpectrum;               /**< points to the filter spectrum of length fftLen, in arm_rfft_fast_f32() format. */
+    float32_t *pScratch;                /**< points to the scratch buffer of length 2*fftLen. */
+    arm_rfft_fast_instance_f32 rfft;    /**< real FFT instance of length fftLen. */
+    arm_fir_instance_f32 fir;           /**< direct FIR instance, used when the FFT path is slower. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point FFT-based FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point FFT-based FIR filter structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in time reversed order.
+   * @param[in]     pState     points to the state buffer of length 4*fftLen.
+   * @param[in]     blockSize  maximum number of samples that are processed per call.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numTaps or blockSize is zero.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FFT-based FIR filter.
+   * @param[in]  S          points to an instance of the floating-point FFT-based FIR filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process, at most the blockSize given at initialization.
+   */
+  void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Reset function for the floating-point FFT-based FIR filter.
+   * @param[in,out] S  points to an instance of the floating-point FFT-based FIR filter structure.
+   */
+  void arm_fir_fft_reset_f32(
+  arm_fir_fft_instance_f32 * S);
+
+  /**
+   * @brief Instance structure for the floating-point uniformly partitioned convolution FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;                 /**< partition size and number of samples processed per call. */
+    uint16_t fftLen;                    /**< length of the FFT, 2*blockSize. */
+    uint16_t numParts;                  /**< number of partitions of the impulse response. */
+    uint16_t fdlIndex;                  /**< position of the newest spectrum in the frequency-domain delay line. */
+    float32_t *pSpectra;                /**< points to the partition spectra, numParts*fftLen values. */
+    float32_t *pFdl;                    /**< points to the frequency-domain delay line, numParts*fftLen values. */
+    float32_t *pFrame;                  /**< points to the last two input blocks, fftLen values. */
+    float32_t *pScratch;                /**< points to the scratch buffer, 3*fftLen values. */
+    arm_rfft_fast_instance_f32 rfft;    /**< real FFT instance of length fftLen. */
+  } arm_fir_partitioned_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned convolution FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned convolution structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in time reversed order.
+   * @param[in]     pState     points to the state buffer of length (2*numParts + 4)*2*blockSize.
+   * @param[in]     blockSize  number of samples processed per call; a power of two from 16 to 2048.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if blockSize is not supported.
+   */
+  arm_status arm_fir_partitioned_init_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint16_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point partitioned convolution FIR filter.
+   * @param[in]  S     points to an instance of the floating-point partitioned convolution structure.
+   * @param[in]  pSrc  points to the block of blockSize input samples.
+   * @param[out] pDst  points to the block of blockSize output samples.
+   */
+  void arm_fir_partitioned_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief  Reset function for the floating-point partitioned convolution FIR filter.
+   * @param[in,out] S  points to an instance of the floating-point partitioned convolution structure.
+   */
+  void arm_fir_partitioned_reset_f32(
+  arm_fir_partitioned_instance_f32 * S);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3561,6 +4167,104 @@ void arm_rfft_fast_f32(
   float32_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 rational L/M resampler.
+   * The first four fields match arm_fir_interpolate_instance_q15.
+   */
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+    uint16_t M;                     /**< downsample factor. */
+    uint32_t phase;                 /**< position of the next output on the upsampled grid, relative to the next input block. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point rational L/M resampler.
+   * The first four fields match arm_fir_interpolate_instance_f32.
+   */
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+    uint16_t M;                     /**< downsample factor. */
+    uint32_t phase;                 /**< position of the next output on the upsampled grid, relative to the next input block. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 rational L/M resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, at least ceil(blockSize*L/M) values.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 rational L/M resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer, laid out as for arm_fir_interpolate_init_q15().
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if numTaps is not a multiple of L,
+   *                or ARM_MATH_ARGUMENT_ERROR if L or M is zero.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint8_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point rational L/M resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, at least ceil(blockSize*L/M) values.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point rational L/M resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer, laid out as for arm_fir_interpolate_init_f32().
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if numTaps is not a multiple of L,
+   *                or ARM_MATH_ARGUMENT_ERROR if L or M is zero.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint8_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
@@ -3716,6 +4420,45 @@ void arm_rfft_fast_f32(
   float64_t * pCoeffs,
   float64_t * pState);
 
+  /**
+   * @brief Instance structure for the multichannel floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint8_t numChannels;       /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_multichannel_df2T_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. numChannels interleaved channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples per channel to process.
+   */
+  void arm_biquad_cascade_multichannel_df2T_f32(
+  const arm_biquad_cascade_multichannel_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the multichannel floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all channels.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_multichannel_df2T_init_f32(
+  arm_biquad_cascade_multichannel_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint8_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
 
   /**
    * @brief Instance structure for the Q15 FIR lattice filter.
@@ -4944,6 +5687,86 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky factorization A = L * L^T.
+   * @param[in]  pSrc   points to the symmetric positive-definite input matrix structure.
+   * @param[out] pDst   points to the output matrix structure, may be equal to pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point LDL^T factorization A = L * D * L^T, in compact form.
+   * @param[in]  pSrc   points to the symmetric input matrix structure.
+   * @param[out] pDst   points to the output matrix structure, may be equal to pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a zero pivot is found, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point lower triangular solve T * X = B.
+   * @param[in]  pSrcT  points to the lower triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be equal to pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcT,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point upper triangular solve T * X = B.
+   * @param[in]  pSrcT  points to the upper triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be equal to pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcT,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point solve L * L^T * X = B with the factor of arm_mat_cholesky_f32().
+   * @param[in]  pSrcL  points to the Cholesky factor.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be equal to pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point solve L * D * L^T * X = B with the factors of arm_mat_ldlt_f32().
+   * @param[in]  pSrcL  points to the compact LDL^T factors.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be equal to pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if an element of D is zero.
+   */
+  arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
 
   /**
    * @ingroup groupController
@@ -6540,6 +7363,310 @@ void arm_rfft_fast_f32(
   float32_t * pResult,
   uint32_t * pIndex);
 
+  /**
+   * @brief Instance structure for the floating-point sliding window statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window. */
+    uint16_t numSamples;        /**< number of samples currently in the window, up to windowLen. */
+    uint16_t head;              /**< history position of the next sample. */
+    uint16_t maxFront;          /**< first entry of the maximum queue. */
+    uint16_t maxCount;          /**< number of entries in the maximum queue. */
+    uint16_t minFront;          /**< first entry of the minimum queue. */
+    uint16_t minCount;          /**< number of entries in the minimum queue. */
+    float32_t *pHistory;        /**< points to the window samples. The array is of length windowLen. */
+    uint16_t *pMaxQueue;        /**< points to the history positions of the decreasing maxima candidates, windowLen entries. */
+    uint16_t *pMinQueue;        /**< points to the history positions of the increasing minima candidates, windowLen entries. */
+    float32_t mean;             /**< running mean of the window. */
+    float32_t m2;               /**< running sum of squared deviations from the mean (Welford). */
+  } arm_sliding_stats_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding window statistics.
+   * @param[in,out] S          points to an instance of the floating-point sliding window statistics structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pHistory   points to the window buffer of windowLen samples.
+   * @param[in]     pQueue     points to the queue buffer of 2*windowLen entries.
+   */
+  void arm_sliding_stats_init_f32(
+  arm_sliding_stats_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pHistory,
+  uint16_t * pQueue);
+
+  /**
+   * @brief  Adds a block of floating-point samples to the sliding window statistics.
+   * @param[in,out] S          points to an instance of the floating-point sliding window statistics structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
+   */
+  void arm_sliding_stats_f32(
+  arm_sliding_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Mean value of the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  mean value returned here
+   */
+  void arm_sliding_mean_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult);
+
+  /**
+   * @brief  Variance of the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  variance value returned here
+   */
+  void arm_sliding_var_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  standard deviation value returned here
+   */
+  void arm_sliding_std_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  rms value returned here
+   */
+  void arm_sliding_rms_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult);
+
+  /**
+   * @brief  Maximum value of the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  maximum value returned here
+   * @param[out] pIndex   index of the maximum value in the window, 0 being the oldest sample
+   */
+  void arm_sliding_max_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Minimum value of the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding window statistics structure.
+   * @param[out] pResult  minimum value returned here
+   * @param[out] pIndex   index of the minimum value in the window, 0 being the oldest sample
+   */
+  void arm_sliding_min_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief Instance structure for the Q31 sliding window statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window. */
+    uint16_t numSamples;        /**< number of samples currently in the window, up to windowLen. */
+    uint16_t head;              /**< history position of the next sample. */
+    uint16_t maxFront;          /**< first entry of the maximum queue. */
+    uint16_t maxCount;          /**< number of entries in the maximum queue. */
+    uint16_t minFront;          /**< first entry of the minimum queue. */
+    uint16_t minCount;          /**< number of entries in the minimum queue. */
+    q31_t *pHistory;            /**< points to the window samples. The array is of length windowLen. */
+    uint16_t *pMaxQueue;        /**< points to the history positions of the decreasing maxima candidates, windowLen entries. */
+    uint16_t *pMinQueue;        /**< points to the history positions of the increasing minima candidates, windowLen entries. */
+    q63_t sum;                  /**< running sum of the window. */
+    q63_t sum8;                 /**< running sum of the window samples shifted right by 8 bits. */
+    q63_t sumOfSquares8;        /**< running sum of squares of the window samples shifted right by 8 bits. */
+  } arm_sliding_stats_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 sliding window statistics.
+   * @param[in,out] S          points to an instance of the Q31 sliding window statistics structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pHistory   points to the window buffer of windowLen samples.
+   * @param[in]     pQueue     points to the queue buffer of 2*windowLen entries.
+   */
+  void arm_sliding_stats_init_q31(
+  arm_sliding_stats_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pHistory,
+  uint16_t * pQueue);
+
+  /**
+   * @brief  Adds a block of Q31 samples to the sliding window statistics.
+   * @param[in,out] S          points to an instance of the Q31 sliding window statistics structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
+   */
+  void arm_sliding_stats_q31(
+  arm_sliding_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Mean value of the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  mean value returned here
+   */
+  void arm_sliding_mean_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult);
+
+  /**
+   * @brief  Variance of the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  variance value returned here
+   */
+  void arm_sliding_var_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  standard deviation value returned here
+   */
+  void arm_sliding_std_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  rms value returned here
+   */
+  void arm_sliding_rms_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult);
+
+  /**
+   * @brief  Maximum value of the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  maximum value returned here
+   * @param[out] pIndex   index of the maximum value in the window, 0 being the oldest sample
+   */
+  void arm_sliding_max_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Minimum value of the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding window statistics structure.
+   * @param[out] pResult  minimum value returned here
+   * @param[out] pIndex   index of the minimum value in the window, 0 being the oldest sample
+   */
+  void arm_sliding_min_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief Instance structure for the Q15 sliding window statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;         /**< number of samples in the window. */
+    uint16_t numSamples;        /**< number of samples currently in the window, up to windowLen. */
+    uint16_t head;              /**< history position of the next sample. */
+    uint16_t maxFront;          /**< first entry of the maximum queue. */
+    uint16_t maxCount;          /**< number of entries in the maximum queue. */
+    uint16_t minFront;          /**< first entry of the minimum queue. */
+    uint16_t minCount;          /**< number of entries in the minimum queue. */
+    q15_t *pHistory;            /**< points to the window samples. The array is of length windowLen. */
+    uint16_t *pMaxQueue;        /**< points to the history positions of the decreasing maxima candidates, windowLen entries. */
+    uint16_t *pMinQueue;        /**< points to the history positions of the increasing minima candidates, windowLen entries. */
+    q31_t sum;                  /**< running sum of the window. */
+    q63_t sumOfSquares;         /**< running sum of squares of the window. */
+  } arm_sliding_stats_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 sliding window statistics.
+   * @param[in,out] S          points to an instance of the Q15 sliding window statistics structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pHistory   points to the window buffer of windowLen samples.
+   * @param[in]     pQueue     points to the queue buffer of 2*windowLen entries.
+   */
+  void arm_sliding_stats_init_q15(
+  arm_sliding_stats_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pHistory,
+  uint16_t * pQueue);
+
+  /**
+   * @brief  Adds a block of Q15 samples to the sliding window statistics.
+   * @param[in,out] S          points to an instance of the Q15 sliding window statistics structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples in the block.
+   */
+  void arm_sliding_stats_q15(
+  arm_sliding_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Mean value of the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  mean value returned here
+   */
+  void arm_sliding_mean_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult);
+
+  /**
+   * @brief  Variance of the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  variance value returned here
+   */
+  void arm_sliding_var_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  standard deviation value returned here
+   */
+  void arm_sliding_std_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  rms value returned here
+   */
+  void arm_sliding_rms_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult);
+
+  /**
+   * @brief  Maximum value of the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  maximum value returned here
+   * @param[out] pIndex   index of the maximum value in the window, 0 being the oldest sample
+   */
+  void arm_sliding_max_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Minimum value of the Q15 sliding window.
+   * @param[in]  S        points to an instance of the Q15 sliding window statistics structure.
+   * @param[out] pResult  minimum value returned here
+   * @param[out] pIndex   index of the minimum value in the window, 0 being the oldest sample
+   */
+  void arm_sliding_min_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex);
+
 
   /**
    * @brief  Q15 complex-by-complex multiplication
@@ -0,0 +1,1144 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MCD Application Team
+  * @brief   FatFs host benchmark on RAM disk images
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "ff_gen_drv.h"
+#include "ramdisk_diskio.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Driver counters and time at the start of a workload
+  */
+typedef struct
+{
+  uint64_t  start_ns;
+  uint64_t  max_ns;               /* Longest operation timed with Bench_Lap() */
+  uint64_t  busy_ns;              /* Total time of the operations timed with Bench_Lap() */
+  DWORD     read_calls;
+  DWORD     write_calls;
+
+}Bench_MarkTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* RAM disk images: 128 MB each */
+#define IMAGE_SECTORS             262144
+
+/* Volume of the cache group: 64 MB, FAT16 with 2 KB clusters */
+#define VOLUME_SECTORS            131072
+#define VOLUME_AU                 2048
+
+/* Fragmented files: FRAG_FILES files grown one cluster at a time in turn */
+#define FRAG_FILES                8
+#define FRAG_FILE_SIZE            (1024 * 1024)
+#define FRAG_CHUNK                VOLUME_AU
+
+/* Random reads of RANDOM_SIZE bytes in the fragmented files */
+#define RANDOM_READS              5000
+#define RANDOM_SIZE               512
+
+/* Directory lookups among DIR_FILES files */
+#define DIR_FILES                 64
+#define DIR_LOOKUPS               5000
+
+/* Volume of the alloc group: 128 MB, FAT32 with 512 byte clusters, filled by
+   FILL_FILES files grown one cluster at a time in turn, FILL_HOLES of which
+   are deleted to leave scattered free clusters */
+#define ALLOC_SECTORS             IMAGE_SECTORS
+#define ALLOC_AU                  512
+#define FILL_FILES                128
+#define FILL_HOLES                2
+
+/* Allocations: ALLOC_FILES files grown by a cluster in turn, then one file
+   written by APPEND_CHUNK bytes */
+#define ALLOC_FILES               4
+#define ALLOC_CLUSTERS            2000
+#define APPEND_CHUNK              (32 * 1024)
+#define APPEND_SIZE               (1024 * 1024)
+
+/* Volume of the stream group: 128 MB, FAT16 with 4 KB clusters, holding
+   STREAM_SIZE byte capture files written by STREAM_CHUNK bytes */
+#define STREAM_SECTORS            IMAGE_SECTORS
+#define STREAM_AU                 4096
+#define STREAM_SIZE               (16 * 1024 * 1024)
+#define STREAM_CHUNK              (64 * 1024)
+
+/* Asynchronous transfers, on the volume of the stream group: ASYNC_SIZE byte
+   files produced or consumed by ASYNC_CHUNK bytes, each chunk taking
+   ASYNC_COMPUTE_NS of processing */
+#define ASYNC_SIZE                (8 * 1024 * 1024)
+#define ASYNC_CHUNK               (8 * 1024)
+#define ASYNC_COMPUTE_NS          200000
+
+/* Directory of the dir group, on the volume of the cache group: NAME_FILES
+   files of 1 to 128 bytes with long names, found by NAME_LOOKUPS random
+   lookups, then every NAME_CHURN th file deleted and created again and the
+   next one renamed; the name cache has NAME_CACHE_SIZE slots */
+#define NAME_FILES                5000
+#define NAME_LOOKUPS              2000
+#define NAME_CHURN                10
+#define NAME_CACHE_SIZE           16384
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static FATFS  VolumeFs, CheckFs;
+static char   VolumePath[4], CheckPath[4];
+static char   Variant[64];
+static BYTE   Buffer[64 * 1024];
+static DWORD  RandomSeed = 0x12345678;
+static unsigned Failures;
+#if _FS_FREEMAP
+static DWORD  FreeMap[(IMAGE_SECTORS + 2 + 31) / 32];
+#endif
+#if _FS_NAMECACHE
+static DWORD  NameCache[NAME_CACHE_SIZE];
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t Bench_Nanoseconds(void);
+static DWORD Bench_Random(void);
+static BYTE Bench_Pattern(UINT file, DWORD offset);
+static void Bench_Check(int ok, const char *what);
+static void Bench_Start(Bench_MarkTypeDef *mark);
+static uint64_t Bench_Lap(Bench_MarkTypeDef *mark, uint64_t start_ns);
+static void Bench_Report(const char *group, const char *workload, DWORD ops, DWORD bytes, const Bench_MarkTypeDef *mark);
+static void Bench_FragPath(char *path, const char *drive, UINT file);
+static FRESULT Bench_VerifyFile(const char *path, UINT file, DWORD size);
+static FRESULT Bench_WriteFile(const char *path, UINT file, DWORD size);
+static FRESULT Bench_Format(DWORD sectors, UINT au);
+static FRESULT Bench_CheckCopy(DWORD *free_clusters);
+static DWORD Bench_FatEntry(const FATFS *fs, DWORD clst);
+static DWORD Bench_FatFree(const FATFS *fs);
+static void Bench_Cache(void);
+static void Bench_Alloc(void);
+static void Bench_Stream(void);
+static FRESULT Bench_StreamPass(FIL *fp, const char *workload, UINT file, BYTE write);
+#if _FS_ASYNC_SECTORS > 0
+static void Bench_Async(void);
+static FRESULT Bench_AsyncPass(const char *workload, const char *path, UINT file, BYTE write);
+static void Bench_AsyncDriver(BYTE on);
+#endif
+static void Bench_Dir(void);
+static FRESULT Bench_DirLookups(const char *workload, BYTE open);
+static DWORD Bench_DirFile(char *path, const char *drive, UINT file, BYTE churned);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  argc: Number of arguments
+  * @param  argv: Group to run (cache, alloc, stream, async, dir or all, default all), then the simulated
+  *         command and sector access times of the RAM disk in microseconds
+  * @retval 0 if all the oracles passed, 1 otherwise
+  */
+int main(int argc, char *argv[])
+{
+  const char *group = (argc > 1) ? argv[1] : "all";
+
+  RAMDISK_Disk[0].access_ns = (argc > 2) ? (DWORD)(atof(argv[2]) * 1000.0) : 0;
+  RAMDISK_Disk[0].sector_ns = (argc > 3) ? (DWORD)(atof(argv[3]) * 1000.0) : 0;
+  RAMDISK_Disk[0].image = malloc((size_t)IMAGE_SECTORS * _MAX_SS);
+  RAMDISK_Disk[1].image = malloc((size_t)IMAGE_SECTORS * _MAX_SS);
+  if((RAMDISK_Disk[0].image == NULL) || (RAMDISK_Disk[1].image == NULL)
+     || (FATFS_LinkDriverEx(&RAMDISK_Driver, VolumePath, 0) != 0)
+     || (FATFS_LinkDriverEx(&RAMDISK_Driver, CheckPath, 1) != 0))
+  {
+    printf("# cannot set up the RAM disks\n");
+    return 1;
+  }
+  memset(RAMDISK_Disk[0].image, 0, (size_t)IMAGE_SECTORS * _MAX_SS);  /* Map the pages before any timing */
+  memset(RAMDISK_Disk[1].image, 0, (size_t)IMAGE_SECTORS * _MAX_SS);
+
+#if (_FS_CACHE_FAT + _FS_CACHE_DATA) > 0
+  snprintf(Variant, sizeof(Variant), "cache_fat%u_data%u", (unsigned)_FS_CACHE_FAT, (unsigned)_FS_CACHE_DATA);
+#else
+  snprintf(Variant, sizeof(Variant), "nocache");
+#endif
+#if _FS_FREEMAP
+  strcat(Variant, "_freemap");
+#endif
+#if _FS_ASYNC_SECTORS > 0
+  snprintf(Variant + strlen(Variant), sizeof(Variant) - strlen(Variant), "_async%u", (unsigned)_FS_ASYNC_SECTORS);
+#endif
+#if _FS_NAMECACHE
+  strcat(Variant, "_namecache");
+#endif
+  printf("# FatFs R0.11 (%u), %u byte sectors, %s\n", (unsigned)_FATFS, (unsigned)_MAX_SS, Variant);
+  printf("# simulated access: %lu ns per command, %lu ns per sector\n",
+         (unsigned long)RAMDISK_Disk[0].access_ns, (unsigned long)RAMDISK_Disk[0].sector_ns);
+  printf("group,workload,variant,operations,bytes,ops_per_sec,mb_per_sec,avg_ns,max_ns,disk_reads,disk_writes\n");
+
+  if((strcmp(group, "all") == 0) || (strcmp(group, "cache") == 0))
+  {
+    Bench_Cache();
+  }
+  if((strcmp(group, "all") == 0) || (strcmp(group, "alloc") == 0))
+  {
+    Bench_Alloc();
+  }
+  if((strcmp(group, "all") == 0) || (strcmp(group, "stream") == 0))
+  {
+    Bench_Stream();
+  }
+#if _FS_ASYNC_SECTORS > 0
+  if((strcmp(group, "all") == 0) || (strcmp(group, "async") == 0))
+  {
+    Bench_Async();
+  }
+#endif
+  if((strcmp(group, "all") == 0) || (strcmp(group, "dir") == 0))
+  {
+    Bench_Dir();
+  }
+
+  printf("# %u check(s) failed\n", Failures);
+  return (Failures != 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Sector cache: fragmented appends with f_sync, sequential and
+  *         random reads of fragmented files, directory lookups, then an
+  *         oracle on a copy of the image taken after f_sync
+  * @param  None
+  * @retval None
+  */
+static void Bench_Cache(void)
+{
+  static FIL files[FRAG_FILES];
+  Bench_MarkTypeDef mark;
+  FRESULT res;
+  FILINFO info;
+  DWORD offset, pos, free0, free1;
+  FATFS *fs;
+  UINT file, i, n;
+  char path[32];
+
+  res = Bench_Format(VOLUME_SECTORS, VOLUME_AU);
+  if(res == FR_OK) res = f_mkdir("frag");
+  if(res == FR_OK) res = f_mkdir("dir");
+  Bench_Check(res == FR_OK, "format and mount the volume");
+  if(res != FR_OK)
+  {
+    return;
+  }
+
+  /* Logging pattern: each file grows by a cluster in turn and is synced */
+  for(file = 0; (res == FR_OK) && (file < FRAG_FILES); file++)
+  {
+    Bench_FragPath(path, VolumePath, file);
+    res = f_open(&files[file], path, FA_CREATE_ALWAYS | FA_WRITE | FA_READ);
+  }
+  Bench_Start(&mark);
+  for(offset = 0; (res == FR_OK) && (offset < FRAG_FILE_SIZE); offset += FRAG_CHUNK)
+  {
+    for(file = 0; (res == FR_OK) && (file < FRAG_FILES); file++)
+    {
+      for(i = 0; i < FRAG_CHUNK; i++)
+      {
+        Buffer[i] = Bench_Pattern(file, offset + i);
+      }
+      res = f_write(&files[file], Buffer, FRAG_CHUNK, &n);
+      if((res == FR_OK) && (n != FRAG_CHUNK)) res = FR_DENIED;
+      if(res == FR_OK) res = f_sync(&files[file]);
+    }
+  }
+  Bench_Report("cache", "fragmented_append", FRAG_FILES * (FRAG_FILE_SIZE / FRAG_CHUNK), FRAG_FILES * FRAG_FILE_SIZE, &mark);
+  Bench_Check(res == FR_OK, "fragmented appends");
+
+  /* Sequential reads, one sector at a time, of every fragmented file */
+  Bench_Start(&mark);
+  for(file = 0; (res == FR_OK) && (file < FRAG_FILES); file++)
+  {
+    res = f_lseek(&files[file], 0);
+    for(offset = 0; (res == FR_OK) && (offset < FRAG_FILE_SIZE); offset += n)
+    {
+      res = f_read(&files[file], Buffer, _MAX_SS, &n);
+      if((res == FR_OK) && (n != _MAX_SS)) res = FR_INT_ERR;
+      for(i = 0; (res == FR_OK) && (i < n); i++)
+      {
+        if(Buffer[i] != Bench_Pattern(file, offset + i)) res = FR_INT_ERR;
+      }
+    }
+  }
+  Bench_Report("cache", "sequential_read", FRAG_FILES * (FRAG_FILE_SIZE / _MAX_SS), FRAG_FILES * FRAG_FILE_SIZE, &mark);
+  Bench_Check(res == FR_OK, "sequential reads return the written data");
+
+  /* Random reads: a backward seek walks the cluster chain from its start */
+  Bench_Start(&mark);
+  for(i = 0; (res == FR_OK) && (i < RANDOM_READS); i++)
+  {
+    file = Bench_Random() % FRAG_FILES;
+    pos = (Bench_Random() % (FRAG_FILE_SIZE / RANDOM_SIZE)) * RANDOM_SIZE;
+    res = f_lseek(&files[file], pos);
+    if(res == FR_OK) res = f_read(&files[file], Buffer, RANDOM_SIZE, &n);
+    if((res == FR_OK) && (n != RANDOM_SIZE)) res = FR_INT_ERR;
+    if((res == FR_OK) && ((Buffer[0] != Bench_Pattern(file, pos))
+                          || (Buffer[RANDOM_SIZE - 1] != Bench_Pattern(file, pos + RANDOM_SIZE - 1))))
+    {
+      res = FR_INT_ERR;
+    }
+  }
+  Bench_Report("cache", "random_read", RANDOM_READS, RANDOM_READS * RANDOM_SIZE, &mark);
+  Bench_Check(res == FR_OK, "random reads return the written data");
+
+  for(file = 0; file < FRAG_FILES; file++)
+  {
+    if(f_close(&files[file]) != FR_OK) res = FR_INT_ERR;
+  }
+
+  /* Directory lookups: f_stat() of random names of a populated directory */
+#if _USE_LFN
+  info.lfname = NULL;
+  info.lfsize = 0;
+#endif
+  for(i = 0; (res == FR_OK) && (i < DIR_FILES); i++)
+  {
+    sprintf(path, "%sdir/entry_%04u.dat", VolumePath, i);
+    res = f_open(&files[0], path, FA_CREATE_NEW | FA_WRITE);
+    if(res == FR_OK) res = f_write(&files[0], &i, sizeof(i), &n);
+    if(res == FR_OK) res = f_close(&files[0]);
+  }
+  Bench_Start(&mark);
+  for(i = 0; (res == FR_OK) && (i < DIR_LOOKUPS); i++)
+  {
+    sprintf(path, "%sdir/entry_%04u.dat", VolumePath, (unsigned)(Bench_Random() % DIR_FILES));
+    res = f_stat(path, &info);
+    if((res == FR_OK) && (info.fsize != sizeof(i))) res = FR_INT_ERR;
+  }
+  Bench_Report("cache", "dir_lookup", DIR_LOOKUPS, 0, &mark);
+  Bench_Check(res == FR_OK, "directory lookups");
+
+  /* Everything synced must be on the medium: check a cold copy of the image */
+  res = Bench_CheckCopy(&free1);
+  for(file = 0; (res == FR_OK) && (file < FRAG_FILES); file++)
+  {
+    Bench_FragPath(path, CheckPath, file);
+    res = Bench_VerifyFile(path, file, FRAG_FILE_SIZE);
+  }
+  if(res == FR_OK) res = f_getfree(VolumePath, &free0, &fs);
+  Bench_Check((res == FR_OK) && (free0 == free1), "image copied after f_sync holds the files");
+  f_mount(NULL, CheckPath, 0);
+  f_mount(NULL, VolumePath, 0);
+}
+
+/**
+  * @brief  Cluster allocation: a nearly full volume with scattered free
+  *         clusters, files grown a cluster at a time and a file written in
+  *         large chunks, the first f_getfree() after mount, then an oracle
+  *         on the free cluster count and the files of a cold copy
+  * @param  None
+  * @retval None
+  */
+static void Bench_Alloc(void)
+{
+  static FIL files[FILL_FILES];
+  Bench_MarkTypeDef mark;
+  FRESULT res;
+  DWORD offset, free0, free1;
+  DWORD size[FILL_FILES];
+  uint64_t t;
+  FATFS *fs;
+  UINT file, i, n;
+  char path[32];
+
+  res = Bench_Format(ALLOC_SECTORS, ALLOC_AU);
+  if(res == FR_OK) res = f_mkdir("fill");
+  if(res == FR_OK) res = f_mkdir("new");
+
+  /* Fill the volume with interleaved files, then delete some of them */
+  for(file = 0; (res == FR_OK) && (file < FILL_FILES); file++)
+  {
+    sprintf(path, "%sfill/f%03u.bin", VolumePath, file);
+    res = f_open(&files[file], path, FA_CREATE_ALWAYS | FA_WRITE);
+    size[file] = 0;
+  }
+  Bench_Start(&mark);
+  for(offset = 0, n = ALLOC_AU; (res == FR_OK) && (n == ALLOC_AU); offset += ALLOC_AU)
+  {
+    for(file = 0; (res == FR_OK) && (n == ALLOC_AU) && (file < FILL_FILES); file++)
+    {
+      for(i = 0; i < ALLOC_AU; i++)
+      {
+        Buffer[i] = Bench_Pattern(file, offset + i);
+      }
+      res = f_write(&files[file], Buffer, ALLOC_AU, &n);
+      size[file] += n;
+    }
+  }
+  Bench_Report("alloc", "fill_interleaved", offset / ALLOC_AU * FILL_FILES, offset * FILL_FILES, &mark);
+  for(file = 0; file < FILL_FILES; file++)
+  {
+    if(f_close(&files[file]) != FR_OK) res = FR_INT_ERR;
+  }
+  for(file = 0; (res == FR_OK) && (file < FILL_HOLES); file++)
+  {
+    sprintf(path, "%sfill/f%03u.bin", VolumePath, file * (FILL_FILES / FILL_HOLES));
+    res = f_unlink(path);
+  }
+  Bench_Check(res == FR_OK, "fill the volume");
+  if(res != FR_OK)
+  {
+    return;
+  }
+
+  /* Mount again, the allocator knows nothing of the volume */
+  res = f_mount(&VolumeFs, VolumePath, 1);
+#if _FS_FREEMAP
+  if(res == FR_OK) res = f_freemap(VolumePath, FreeMap, sizeof(FreeMap) / sizeof(FreeMap[0]));
+#endif
+
+  /* Files grown by a cluster in turn: one cluster allocation per f_write() */
+  for(file = 0; (res == FR_OK) && (file < ALLOC_FILES); file++)
+  {
+    sprintf(path, "%snew/a%u.bin", VolumePath, file);
+    res = f_open(&files[file], path, FA_CREATE_ALWAYS | FA_WRITE);
+  }
+  Bench_Start(&mark);
+  for(i = 0; (res == FR_OK) && (i < ALLOC_CLUSTERS); i++)
+  {
+    file = i % ALLOC_FILES;
+    offset = (i / ALLOC_FILES) * ALLOC_AU;
+    memset(Buffer, 0, ALLOC_AU);
+    for(n = 0; n < ALLOC_AU; n++)
+    {
+      Buffer[n] = Bench_Pattern(FILL_FILES + file, offset + n);
+    }
+    t = Bench_Nanoseconds();
+    res = f_write(&files[file], Buffer, ALLOC_AU, &n);
+    Bench_Lap(&mark, t);
+    if((res == FR_OK) && (n != ALLOC_AU)) res = FR_DENIED;
+  }
+  Bench_Report("alloc", "cluster_alloc", ALLOC_CLUSTERS, ALLOC_CLUSTERS * ALLOC_AU, &mark);
+  for(file = 0; file < ALLOC_FILES; file++)
+  {
+    if(f_close(&files[file]) != FR_OK) res = FR_INT_ERR;
+  }
+  Bench_Check(res == FR_OK, "cluster allocations");
+
+  /* One file written by large chunks */
+  sprintf(path, "%snew/append.bin", VolumePath);
+  if(res == FR_OK) res = f_open(&files[0], path, FA_CREATE_ALWAYS | FA_WRITE);
+  Bench_Start(&mark);
+  for(offset = 0; (res == FR_OK) && (offset < APPEND_SIZE); offset += APPEND_CHUNK)
+  {
+    for(i = 0; i < APPEND_CHUNK; i++)
+    {
+      Buffer[i] = Bench_Pattern(FILL_FILES + ALLOC_FILES, offset + i);
+    }
+    t = Bench_Nanoseconds();
+    res = f_write(&files[0], Buffer, APPEND_CHUNK, &n);
+    Bench_Lap(&mark, t);
+    if((res == FR_OK) && (n != APPEND_CHUNK)) res = FR_DENIED;
+  }
+  if(res == FR_OK) res = f_close(&files[0]);
+  Bench_Report("alloc", "append", APPEND_SIZE / APPEND_CHUNK, APPEND_SIZE, &mark);
+  Bench_Check(res == FR_OK, "appends");
+
+  /* Number of free clusters, the FSINFO count is not trusted (_FS_NOFSINFO) */
+  Bench_Start(&mark);
+  if(res == FR_OK) res = f_getfree(VolumePath, &free0, &fs);
+  Bench_Report("alloc", "getfree", 1, 0, &mark);
+  Bench_Start(&mark);
+  if(res == FR_OK) res = f_getfree(VolumePath, &free0, &fs);
+  Bench_Report("alloc", "getfree_again", 1, 0, &mark);
+
+  /* The free clusters are those of the FAT, and the files hold their data */
+  Bench_Check((res == FR_OK) && (free0 == Bench_FatFree(fs)), "free cluster count matches the FAT");
+  res = Bench_CheckCopy(&free1);
+  Bench_Check((res == FR_OK) && (free1 == free0), "free cluster count of the cold copy");
+  for(file = 0; (res == FR_OK) && (file < FILL_FILES); file++)
+  {
+    if((file % (FILL_FILES / FILL_HOLES) == 0) && (file / (FILL_FILES / FILL_HOLES) < FILL_HOLES))
+    {
+      continue;
+    }
+    sprintf(path, "%sfill/f%03u.bin", CheckPath, file);
+    res = Bench_VerifyFile(path, file, size[file]);
+  }
+  for(file = 0; (res == FR_OK) && (file < ALLOC_FILES); file++)
+  {
+    sprintf(path, "%snew/a%u.bin", CheckPath, file);
+    res = Bench_VerifyFile(path, FILL_FILES + file, ALLOC_CLUSTERS / ALLOC_FILES * ALLOC_AU);
+  }
+  sprintf(path, "%snew/append.bin", CheckPath);
+  if(res == FR_OK) res = Bench_VerifyFile(path, FILL_FILES + ALLOC_FILES, APPEND_SIZE);
+  Bench_Check(res == FR_OK, "files of the cold copy");
+  f_mount(NULL, CheckPath, 0);
+  f_mount(NULL, VolumePath, 0);
+}
+
+/**
+  * @brief  Streaming: capture files written, rewritten and read back by large
+  *         chunks, with a cluster chain grown by f_write() and with a
+  *         contiguous block given by f_expand(), then oracles on the FAT
+  *         and the files of a cold copy
+  * @param  None
+  * @retval None
+  */
+static void Bench_Stream(void)
+{
+  static FIL file;
+  Bench_MarkTypeDef mark;
+  FRESULT res;
+  DWORD free0, free1, clst, sclust;
+  FATFS *fs;
+  UINT n;
+
+  res = Bench_Format(STREAM_SECTORS, STREAM_AU);
+
+  /* Cluster chain grown by f_write() at each cluster boundary */
+  if(res == FR_OK) res = f_open(&file, "chain.bin", FA_CREATE_ALWAYS | FA_READ | FA_WRITE);
+  if(res == FR_OK) res = Bench_StreamPass(&file, "write_chain", 0, 1);
+  if(res == FR_OK) res = Bench_StreamPass(&file, "rewrite_chain", 2, 1);
+  if(res == FR_OK) res = Bench_StreamPass(&file, "read_chain", 2, 0);
+  if(res == FR_OK) res = f_close(&file);
+  Bench_Check(res == FR_OK, "streaming on a cluster chain");
+
+#if _USE_EXPAND
+  /* Contiguous block allocated at once, mapped without the FAT */
+  if(res == FR_OK) res = f_open(&file, "expand.bin", FA_CREATE_ALWAYS | FA_READ | FA_WRITE);
+  Bench_Start(&mark);
+  if(res == FR_OK) res = f_expand(&file, STREAM_SIZE, 1);
+  Bench_Report("stream", "expand", 1, 0, &mark);
+  sclust = file.sclust;
+  if(res == FR_OK) res = Bench_StreamPass(&file, "write_expand", 1, 1);
+  if(res == FR_OK) res = Bench_StreamPass(&file, "rewrite_expand", 3, 1);
+  if(res == FR_OK) res = Bench_StreamPass(&file, "read_expand", 3, 0);
+  if(res == FR_OK) res = f_close(&file);
+  Bench_Check(res == FR_OK, "streaming on a contiguous block");
+#endif
+
+  /* The FAT and the cold copy hold the files */
+  if(res == FR_OK) res = f_getfree(VolumePath, &free0, &fs);
+  Bench_Check((res == FR_OK) && (free0 == Bench_FatFree(fs)), "free cluster count matches the FAT");
+#if _USE_EXPAND
+  for(n = 0, clst = sclust; (res == FR_OK) && (n < STREAM_SIZE / STREAM_AU); n++, clst++)
+  {
+    if(Bench_FatEntry(fs, clst) != ((n + 1 < STREAM_SIZE / STREAM_AU) ? clst + 1 : 0x0FFFFFFF)) break;
+  }
+  Bench_Check((res == FR_OK) && (n == STREAM_SIZE / STREAM_AU), "f_expand() block is contiguous on the FAT");
+#endif
+  res = Bench_CheckCopy(&free1);
+  Bench_Check((res == FR_OK) && (free1 == free0), "free cluster count of the cold copy");
+  if(res == FR_OK) res = Bench_VerifyFile("1:chain.bin", 2, STREAM_SIZE);
+#if _USE_EXPAND
+  if(res == FR_OK) res = Bench_VerifyFile("1:expand.bin", 3, STREAM_SIZE);
+#endif
+  Bench_Check(res == FR_OK, "files of the cold copy");
+  f_mount(NULL, CheckPath, 0);
+  f_mount(NULL, VolumePath, 0);
+}
+
+/**
+  * @brief  Writes or reads a whole capture file from its start by STREAM_CHUNK
+  *         bytes, timing each access
+  * @param  fp: Open file
+  * @param  workload: Name of the workload in the report
+  * @param  file: Index of the file in Bench_Pattern()
+  * @param  write: 1 to write the file, 0 to read and check it
+  * @retval FRESULT: Operation result
+  */
+static FRESULT Bench_StreamPass(FIL *fp, const char *workload, UINT file, BYTE write)
+{
+  Bench_MarkTypeDef mark;
+  FRESULT res;
+  DWORD offset;
+  uint64_t t;
+  UINT i, n;
+
+  res = f_lseek(fp, 0);
+  Bench_Start(&mark);
+  for(offset = 0; (res == FR_OK) && (offset < STREAM_SIZE); offset += STREAM_CHUNK)
+  {
+    if(write)
+    {
+      for(i = 0; i < STREAM_CHUNK; i++)
+      {
+        Buffer[i] = Bench_Pattern(file, offset + i);
+      }
+    }
+    t = Bench_Nanoseconds();
+    res = write ? f_write(fp, Buffer, STREAM_CHUNK, &n) : f_read(fp, Buffer, STREAM_CHUNK, &n);
+    Bench_Lap(&mark, t);
+    if((res == FR_OK) && (n != STREAM_CHUNK)) res = FR_DENIED;
+    for(i = 0; (res == FR_OK) && !write && (i < STREAM_CHUNK); i++)
+    {
+      if(Buffer[i] != Bench_Pattern(file, offset + i)) res = FR_INT_ERR;
+    }
+  }
+  if((res == FR_OK) && write) res = f_sync(fp);
+  Bench_Report("stream", workload, STREAM_SIZE / STREAM_CHUNK, STREAM_SIZE, &mark);
+  return res;
+}
+
+#if _FS_ASYNC_SECTORS > 0
+/**
+  * @brief  Asynchronous transfers: files produced and written, then read and
+  *         consumed by chunks taking some processing each, with the RAM disk
+  *         driver synchronous then asynchronous, then oracles on the files of
+  *         a cold copy
+  * @param  None
+  * @retval None
+  */
+static void Bench_Async(void)
+{
+  FRESULT res;
+  DWORD free0, free1;
+  FATFS *fs;
+
+  res = Bench_Format(STREAM_SECTORS, STREAM_AU);
+
+  /* The RAM disk blocks the caller for the whole transfer */
+  if(res == FR_OK) res = Bench_AsyncPass("write_compute_sync", "sync.bin", 4, 1);
+  if(res == FR_OK) res = Bench_AsyncPass("read_compute_sync", "sync.bin", 4, 0);
+  Bench_Check(res == FR_OK, "synchronous transfers");
+
+  /* The RAM disk moves the data from its thread, diskio.c reads ahead and
+     writes behind while the chunks are processed */
+  Bench_AsyncDriver(1);
+  if(res == FR_OK) res = Bench_AsyncPass("write_compute_async", "async.bin", 5, 1);
+  if(res == FR_OK) res = Bench_AsyncPass("read_compute_async", "async.bin", 5, 0);
+  Bench_AsyncDriver(0);
+  Bench_Check(res == FR_OK, "asynchronous transfers");
+
+  /* The cold copy holds the files */
+  if(res == FR_OK) res = f_getfree(VolumePath, &free0, &fs);
+  Bench_Check((res == FR_OK) && (free0 == Bench_FatFree(fs)), "free cluster count matches the FAT");
+  res = Bench_CheckCopy(&free1);
+  Bench_Check((res == FR_OK) && (free1 == free0), "free cluster count of the cold copy");
+  if(res == FR_OK) res = Bench_VerifyFile("1:sync.bin", 4, ASYNC_SIZE);
+  if(res == FR_OK) res = Bench_VerifyFile("1:async.bin", 5, ASYNC_SIZE);
+  Bench_Check(res == FR_OK, "files of the cold copy");
+  f_mount(NULL, CheckPath, 0);
+  f_mount(NULL, VolumePath, 0);
+}
+
+/**
+  * @brief  Writes or reads a whole file by ASYNC_CHUNK bytes, each chunk taking
+  *         ASYNC_COMPUTE_NS to produce or to consume, the pattern included
+  * @param  workload: Name of the workload in the report
+  * @param  path: File name
+  * @param  file: Index of the file in Bench_Pattern()
+  * @param  write: 1 to create the file, 0 to read and check it
+  * @retval FRESULT: Operation result
+  */
+static FRESULT Bench_AsyncPass(const char *workload, const char *path, UINT file, BYTE write)
+{
+  static FIL fil;
+  Bench_MarkTypeDef mark;
+  FRESULT res;
+  DWORD offset;
+  uint64_t t;
+  UINT i, n;
+
+  res = f_open(&fil, path, write ? (FA_CREATE_ALWAYS | FA_WRITE) : FA_READ);
+  Bench_Start(&mark);
+  for(offset = 0; (res == FR_OK) && (offset < ASYNC_SIZE); offset += ASYNC_CHUNK)
+  {
+    t = Bench_Nanoseconds();
+    if(!write)
+    {
+      res = f_read(&fil, Buffer, ASYNC_CHUNK, &n);
+      if((res == FR_OK) && (n != ASYNC_CHUNK)) res = FR_DENIED;
+      t = Bench_Nanoseconds();
+    }
+    for(i = 0; (res == FR_OK) && (i < ASYNC_CHUNK); i++)
+    {
+      if(write)
+      {
+        Buffer[i] = Bench_Pattern(file, offset + i);
+      }
+      else if(Buffer[i] != Bench_Pattern(file, offset + i))
+      {
+        res = FR_INT_ERR;
+      }
+    }
+    while(Bench_Nanoseconds() - t < ASYNC_COMPUTE_NS)
+    {
+    }
+    if((res == FR_OK) && write)
+    {
+      res = f_write(&fil, Buffer, ASYNC_CHUNK, &n);
+      if((res == FR_OK) && (n != ASYNC_CHUNK)) res = FR_DENIED;
+    }
+  }
+  if(res == FR_OK) res = f_close(&fil);
+  Bench_Report("async", workload, ASYNC_SIZE / ASYNC_CHUNK, ASYNC_SIZE, &mark);
+  return res;
+}
+
+/**
+  * @brief  Makes the RAM disk driver asynchronous or synchronous
+  * @note   CTRL_SYNC first waits for the transfers in progress and drops the
+  *         read-ahead data of diskio.c
+  * @param  on: 1 for asynchronous transfers
+  * @retval None
+  */
+static void Bench_AsyncDriver(BYTE on)
+{
+  disk_ioctl(0, CTRL_SYNC, NULL);
+  RAMDISK_Driver.disk_submit = on ? RAMDISK_submit : NULL;
+}
+#endif /* _FS_ASYNC_SECTORS > 0 */
+
+/**
+  * @brief  Directory lookups: a directory of data logger files with long
+  *         names, created, then found by random f_stat() and f_open() calls
+  *         walking the directory, then with the name cache of ff.c, then
+  *         oracles on the names deleted, created again and renamed with the
+  *         name cache attached, and on the directory of a cold copy
+  * @param  None
+  * @retval None
+  */
+static void Bench_Dir(void)
+{
+  static BYTE seen[NAME_FILES];
+#if _USE_LFN
+  static TCHAR lfn[_MAX_LFN + 1];
+#endif
+  Bench_MarkTypeDef mark;
+  FRESULT res;
+  FILINFO info;
+  DIR dir;
+  DWORD size, free1;
+  const TCHAR *name;
+  UINT file, count;
+  char path[32], path_new[32];
+
+  res = Bench_Format(VOLUME_SECTORS, VOLUME_AU);
+  if(res == FR_OK) res = f_mkdir("dir");
+  Bench_Check(res == FR_OK, "format and mount the volume");
+  if(res != FR_OK)
+  {
+    return;
+  }
+#if _USE_LFN
+  info.lfname = NULL;
+  info.lfsize = 0;
+#endif
+
+  /* Each new name is first looked for in the whole directory */
+  Bench_Start(&mark);
+  for(file = 0; (res == FR_OK) && (file < NAME_FILES); file++)
+  {
+    size = Bench_DirFile(path, VolumePath, file, 0);
+    res = Bench_WriteFile(path, file, size);
+  }
+  Bench_Report("dir", "create", NAME_FILES, 0, &mark);
+  Bench_Check(res == FR_OK, "files created");
+
+  /* Every lookup walks the directory up to the name */
+  if(res == FR_OK) res = Bench_DirLookups("stat_walk", 0);
+  if(res == FR_OK) res = Bench_DirLookups("open_walk", 1);
+  Bench_Check(res == FR_OK, "lookups walking the directory");
+#if _FS_NAMECACHE
+  /* The first lookup walks the directory and fills the name cache */
+  if(res == FR_OK) res = f_namecache(VolumePath, NameCache, NAME_CACHE_SIZE);
+  if(res == FR_OK) res = Bench_DirLookups("stat_namecache", 0);
+  if(res == FR_OK) res = Bench_DirLookups("open_namecache", 1);
+  Bench_Check(res == FR_OK, "lookups with the name cache");
+#endif
+
+  /* Names deleted, created again with another size and renamed */
+  for(file = 0; (res == FR_OK) && (file < NAME_FILES); file += NAME_CHURN)
+  {
+    Bench_DirFile(path, VolumePath, file, 0);
+    res = f_unlink(path);
+    if(res == FR_OK) res = (f_stat(path, &info) == FR_NO_FILE) ? FR_OK : FR_INT_ERR;
+    if(res == FR_OK)
+    {
+      size = Bench_DirFile(path, VolumePath, file, 1);
+      res = Bench_WriteFile(path, file, size);
+    }
+    if((res == FR_OK) && (file + 1 < NAME_FILES))
+    {
+      Bench_DirFile(path, VolumePath, file + 1, 0);
+      Bench_DirFile(path_new, VolumePath, file + 1, 1);
+      res = f_rename(path, path_new);
+      if(res == FR_OK) res = (f_stat(path, &info) == FR_NO_FILE) ? FR_OK : FR_INT_ERR;
+    }
+  }
+  Bench_Check(res == FR_OK, "names deleted and renamed are not found");
+  for(count = 0; (res == FR_OK) && (count < NAME_LOOKUPS); count++)
+  {
+    file = Bench_Random() % NAME_FILES;
+    size = Bench_DirFile(path, VolumePath, file, 1);
+    res = f_stat(path, &info);
+    if((res == FR_OK) && (info.fsize != size)) res = FR_INT_ERR;
+  }
+  Bench_Check(res == FR_OK, "names created again and renamed are found with their size");
+
+  /* The directory of the cold copy holds every file once under its name */
+  memset(seen, 0, sizeof(seen));
+  count = 0;
+  res = Bench_CheckCopy(&free1);
+  if(res == FR_OK) res = f_opendir(&dir, "1:dir");
+#if _USE_LFN
+  info.lfname = lfn;
+  info.lfsize = sizeof(lfn) / sizeof(lfn[0]);
+#endif
+  while(res == FR_OK)
+  {
+    res = f_readdir(&dir, &info);
+    if((res != FR_OK) || (info.fname[0] == 0)) break;
+    name = info.fname;
+#if _USE_LFN
+    if(lfn[0] != 0) name = lfn;
+#endif
+    file = (strlen(name) > 4) ? (UINT)atoi(name + 4) % NAME_FILES : 0;  /* "log_" or "old_" then the number */
+    size = Bench_DirFile(path, "", file, 1);
+    if(seen[file] || (strcmp(path + 4, name) != 0) || (info.fsize != size)) res = FR_INT_ERR;
+    seen[file] = 1;
+    count++;
+  }
+  if(res == FR_OK) res = f_closedir(&dir);
+  Bench_Check((res == FR_OK) && (count == NAME_FILES), "directory of the cold copy");
+  f_mount(NULL, CheckPath, 0);
+  f_mount(NULL, VolumePath, 0);
+}
+
+/**
+  * @brief  Looks for NAME_LOOKUPS random files of the dir group by name
+  * @param  workload: Name of the workload in the report
+  * @param  open: 0 for f_stat(), 1 to open the file and read it back
+  * @retval FRESULT: Operation result
+  */
+static FRESULT Bench_DirLookups(const char *workload, BYTE open)
+{
+  Bench_MarkTypeDef mark;
+  FRESULT res = FR_OK;
+  FILINFO info;
+  DWORD size;
+  uint64_t t;
+  UINT i, file;
+  char path[32];
+
+#if _USE_LFN
+  info.lfname = NULL;
+  info.lfsize = 0;
+#endif
+  Bench_Start(&mark);
+  for(i = 0; (res == FR_OK) && (i < NAME_LOOKUPS); i++)
+  {
+    file = Bench_Random() % NAME_FILES;
+    size = Bench_DirFile(path, VolumePath, file, 0);
+    t = Bench_Nanoseconds();
+    if(open)
+    {
+      res = Bench_VerifyFile(path, file, size);
+    }
+    else
+    {
+      res = f_stat(path, &info);
+      if((res == FR_OK) && (info.fsize != size)) res = FR_INT_ERR;
+    }
+    Bench_Lap(&mark, t);
+  }
+  Bench_Report("dir", workload, NAME_LOOKUPS, 0, &mark);
+  return res;
+}
+
+/**
+  * @brief  Formats the volume under test as a single FAT volume and mounts it
+  * @param  sectors: Size of the volume in sectors
+  * @param  au: Cluster size in bytes
+  * @retval FRESULT: Operation result
+  */
+static FRESULT Bench_Format(DWORD sectors, UINT au)
+{
+  FRESULT res;
+
+  RAMDISK_Disk[0].sectors = sectors;
+  RAMDISK_Disk[1].sectors = sectors;
+  res = f_mount(&VolumeFs, VolumePath, 0);
+  if(res == FR_OK) res = f_mkfs(VolumePath, 1, au);
+  if(res == FR_OK) res = f_mount(&VolumeFs, VolumePath, 1);
+  return res;
+}
+
+/**
+  * @brief  Mounts a cold copy of the volume under test, as it is on the medium
+  * @note   The copy is written through diskio.c, so that sectors of drive 1
+  *         cached by an earlier check are not taken for the new copy
+  * @param  free_clusters: Returns the number of free clusters of the copy
+  * @retval FRESULT: Operation result
+  */
+static FRESULT Bench_CheckCopy(DWORD *free_clusters)
+{
+  FRESULT res;
+  FATFS *fs;
+
+  if(disk_write(1, RAMDISK_Disk[0].image, 0, RAMDISK_Disk[0].sectors) != RES_OK)
+  {
+    return FR_DISK_ERR;
+  }
+  res = f_mount(&CheckFs, CheckPath, 1);
+  if(res == FR_OK) res = f_getfree(CheckPath, free_clusters, &fs);
+  return res;
+}
+
+/**
+  * @brief  Reads a FAT16 or FAT32 entry in the image of the volume under test
+  * @param  fs: Mounted volume
+  * @param  clst: Cluster number
+  * @retval Value of the entry, end of chain marks read as 0x0FFFFFFF
+  */
+static DWORD Bench_FatEntry(const FATFS *fs, DWORD clst)
+{
+  const BYTE *fat = RAMDISK_Disk[0].image + (size_t)fs->fatbase * _MAX_SS;
+  DWORD val;
+
+  if(fs->fs_type == FS_FAT32)
+  {
+    val = (fat[clst * 4] | ((DWORD)fat[clst * 4 + 1] << 8) | ((DWORD)fat[clst * 4 + 2] << 16)
+           | ((DWORD)fat[clst * 4 + 3] << 24)) & 0x0FFFFFFF;
+    return (val >= 0x0FFFFFF8) ? 0x0FFFFFFF : val;
+  }
+  val = fat[clst * 2] | ((DWORD)fat[clst * 2 + 1] << 8);
+  return (val >= 0xFFF8) ? 0x0FFFFFFF : val;
+}
+
+/**
+  * @brief  Counts the free entries of the FAT in the image of the volume under test
+  * @param  fs: Mounted volume
+  * @retval Number of free clusters
+  */
+static DWORD Bench_FatFree(const FATFS *fs)
+{
+  DWORD clst, n = 0;
+
+  for(clst = 2; clst < fs->n_fatent; clst++)
+  {
+    if(Bench_FatEntry(fs, clst) == 0) n++;
+  }
+  return n;
+}
+
+/**
+  * @brief  Reads a file back and compares it with its pattern
+  * @param  path: File name
+  * @param  file: Pattern number
+  * @param  size: Expected file size
+  * @retval FRESULT: FR_OK if the file matches, FR_INT_ERR if it differs
+  */
+static FRESULT Bench_VerifyFile(const char *path, UINT file, DWORD size)
+{
+  FIL fil;
+  FRESULT res;
+  DWORD offset = 0;
+  UINT i, n;
+
+  res = f_open(&fil, path, FA_OPEN_EXISTING | FA_READ);
+  if((res == FR_OK) && (f_size(&fil) != size)) res = FR_INT_ERR;
+  while((res == FR_OK) && (offset < size))
+  {
+    res = f_read(&fil, Buffer, sizeof(Buffer), &n);
+    if((res == FR_OK) && (n == 0)) res = FR_INT_ERR;
+    for(i = 0; (res == FR_OK) && (i < n); i++)
+    {
+      if(Buffer[i] != Bench_Pattern(file, offset + i)) res = FR_INT_ERR;
+    }
+    offset += n;
+  }
+  f_close(&fil);
+  return res;
+}
+
+/**
+  * @brief  Creates a file filled with its pattern
+  * @param  path: File name
+  * @param  file: Pattern number
+  * @param  size: File size, up to the size of Buffer
+  * @retval FRESULT: Operation result
+  */
+static FRESULT Bench_WriteFile(const char *path, UINT file, DWORD size)
+{
+  FIL fil;
+  FRESULT res;
+  DWORD i;
+  UINT n;
+
+  for(i = 0; i < size; i++)
+  {
+    Buffer[i] = Bench_Pattern(file, i);
+  }
+  res = f_open(&fil, path, FA_CREATE_NEW | FA_WRITE);
+  if(res == FR_OK) res = f_write(&fil, Buffer, size, &n);
+  if((res == FR_OK) && (n != size)) res = FR_DENIED;
+  if(res == FR_OK) res = f_close(&fil);
+  return res;
+}
+
+/**
+  * @brief  Builds the name of a file of the dir group and gives its size
+  * @param  path: Returns the file name
+  * @param  drive: Drive path ("0:/" or "1:/")
+  * @param  file: File number
+  * @param  churned: 1 once every NAME_CHURN th file was created again with
+  *         another size and the next one renamed
+  * @retval Size of the file in bytes
+  */
+static DWORD Bench_DirFile(char *path, const char *drive, UINT file, BYTE churned)
+{
+  if(churned && (file % NAME_CHURN == 1))
+  {
+    sprintf(path, "%sdir/old_%05u.csv", drive, file);
+    return 1 + file % 64;
+  }
+  sprintf(path, "%sdir/log_%05u.csv", drive, file);
+  return (churned && (file % NAME_CHURN == 0)) ? 65 + file % 64 : 1 + file % 64;
+}
+
+/**
+  * @brief  Builds the name of a fragmented file
+  * @param  path: Returns the file name
+  * @param  drive: Drive path ("0:/" or "1:/")
+  * @param  file: File number
+  * @retval None
+  */
+static void Bench_FragPath(char *path, const char *drive, UINT file)
+{
+  sprintf(path, "%sfrag/log_%u.bin", drive, file);
+}
+
+/**
+  * @brief  Content of a test file: a byte of its offset mixed with its number
+  * @param  file: File number
+  * @param  offset: Byte offset in the file
+  * @retval Byte value
+  */
+static BYTE Bench_Pattern(UINT file, DWORD offset)
+{
+  DWORD x = (offset / 4) * 2654435761u + file * 40503u;
+
+  return (BYTE)((x >> ((offset & 3) * 8)) ^ (x >> 24));
+}
+
+/**
+  * @brief  Pseudo random number (LCG)
+  * @param  None
+  * @retval 31-bit random number
+  */
+static DWORD Bench_Random(void)
+{
+  RandomSeed = RandomSeed * 1103515245u + 12345u;
+  return (RandomSeed >> 1) & 0x7FFFFFFF;
+}
+
+/**
+  * @brief  Monotonic time
+  * @param  None
+  * @retval Time in nanoseconds
+  */
+static uint64_t Bench_Nanoseconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+  * @brief  Counts an oracle result
+  * @param  ok: Non zero if the check passed
+  * @param  what: Description of the check
+  * @retval None
+  */
+static void Bench_Check(int ok, const char *what)
+{
+  if(!ok)
+  {
+    printf("# FAILED: %s\n", what);
+    Failures++;
+  }
+}
+
+/**
+  * @brief  Records the driver counters and the time before a workload
+  * @param  mark: Returns the counters and the time
+  * @retval None
+  */
+static void Bench_Start(Bench_MarkTypeDef *mark)
+{
+  mark->max_ns = 0;
+  mark->busy_ns = 0;
+  mark->read_calls = RAMDISK_Disk[0].read_calls;
+  mark->write_calls = RAMDISK_Disk[0].write_calls;
+  mark->start_ns = Bench_Nanoseconds();
+}
+
+/**
+  * @brief  Times one operation of a workload
+  * @param  mark: Counters and time at the start of the workload
+  * @param  start_ns: Time at the start of the operation
+  * @retval Time at the end of the operation
+  */
+static uint64_t Bench_Lap(Bench_MarkTypeDef *mark, uint64_t start_ns)
+{
+  uint64_t now = Bench_Nanoseconds();
+
+  mark->busy_ns += now - start_ns;
+  if(now - start_ns > mark->max_ns)
+  {
+    mark->max_ns = now - start_ns;
+  }
+  return now;
+}
+
+/**
+  * @brief  Prints the CSV record of a workload
+  * @param  group: Benchmark group
+  * @param  workload: Workload name
+  * @param  ops: Number of operations (writes, reads or lookups)
+  * @param  bytes: Number of bytes transferred
+  * @param  mark: Counters and time at the start of the workload
+  * @note   When the operations are timed with Bench_Lap(), the rates only
+  *         count their time, not the preparation of the data in between
+  * @retval None
+  */
+static void Bench_Report(const char *group, const char *workload, DWORD ops, DWORD bytes, const Bench_MarkTypeDef *mark)
+{
+  double seconds = (double)(Bench_Nanoseconds() - mark->start_ns) / 1e9;
+
+  if(mark->busy_ns != 0)
+  {
+    seconds = (double)mark->busy_ns / 1e9;
+  }
+  if(seconds <= 0.0)
+  {
+    seconds = 1e-9;
+  }
+  printf("%s,%s,%s,%lu,%lu,%.0f,%.2f,%.0f,%llu,%lu,%lu\n", group, workload, Variant,
+         (unsigned long)ops, (unsigned long)bytes, (double)ops / seconds, (double)bytes / seconds / 1e6,
+         seconds * 1e9 / (double)ops, (unsigned long long)mark->max_ns,
+         (unsigned long)(RAMDISK_Disk[0].read_calls - mark->read_calls),
+         (unsigned long)(RAMDISK_Disk[0].write_calls - mark->write_calls));
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
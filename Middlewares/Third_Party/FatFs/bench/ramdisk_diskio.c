@@ -0,0 +1,372 @@
+/**
+  ******************************************************************************
+  * @file    ramdisk_diskio.c
+  * @author  MCD Application Team
+  * @brief   RAM Disk I/O driver of the host benchmark, counting the calls
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */ 
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ramdisk_diskio.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Block Size in Bytes */
+#define BLOCK_SIZE                _MAX_SS
+
+/* Private variables ---------------------------------------------------------*/
+RAMDISK_TypeDef RAMDISK_Disk[RAMDISK_LUNS];
+
+#if _FS_ASYNC_SECTORS > 0
+/* Transfers started by RAMDISK_submit(), done by the device thread */
+static pthread_once_t         RAMDISK_Once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t        RAMDISK_Mutex;
+static pthread_cond_t         RAMDISK_Cond;
+static pthread_t              RAMDISK_Thread;
+static Diskio_requestTypeDef  *RAMDISK_Pending[RAMDISK_LUNS];
+static uint64_t               RAMDISK_Deadline[RAMDISK_LUNS];
+#endif /* _FS_ASYNC_SECTORS > 0 */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t RAMDISK_Now(void);
+static void RAMDISK_Busy(RAMDISK_TypeDef *d, UINT count);
+#if _FS_ASYNC_SECTORS > 0
+static void RAMDISK_Start(void);
+static void *RAMDISK_Device(void *arg);
+#endif /* _FS_ASYNC_SECTORS > 0 */
+DSTATUS RAMDISK_initialize (BYTE);
+DSTATUS RAMDISK_status (BYTE);
+DRESULT RAMDISK_read (BYTE, BYTE*, DWORD, UINT);
+#if _USE_WRITE == 1
+  DRESULT RAMDISK_write (BYTE, const BYTE*, DWORD, UINT);
+#endif /* _USE_WRITE == 1 */
+#if _USE_IOCTL == 1
+  DRESULT RAMDISK_ioctl (BYTE, BYTE, void*);
+#endif /* _USE_IOCTL == 1 */
+  
+Diskio_drvTypeDef RAMDISK_Driver =
+{
+  RAMDISK_initialize,
+  RAMDISK_status,
+  RAMDISK_read, 
+#if  _USE_WRITE == 1
+  RAMDISK_write,
+#endif /* _USE_WRITE == 1 */  
+#if  _USE_IOCTL == 1
+  RAMDISK_ioctl,
+#endif /* _USE_IOCTL == 1 */
+#if _FS_ASYNC_SECTORS > 0
+  NULL,
+#endif /* _FS_ASYNC_SECTORS > 0 */
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Reads the monotonic clock
+  * @retval Time in ns
+  */
+static uint64_t RAMDISK_Now(void)
+{
+  struct timespec now;
+  
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+/**
+  * @brief  Spins for the simulated access time of a command
+  * @param  d: RAM disk
+  * @param  count: Number of sectors transferred
+  * @retval None
+  */
+static void RAMDISK_Busy(RAMDISK_TypeDef *d, UINT count)
+{
+  uint64_t end;
+  
+  if((d->access_ns == 0) && (d->sector_ns == 0))
+  {
+    return;
+  }
+  end = RAMDISK_Now() + d->access_ns + (uint64_t)d->sector_ns * count;
+  while(RAMDISK_Now() < end)
+  {
+  }
+}
+
+#if _FS_ASYNC_SECTORS > 0
+/**
+  * @brief  Creates the lock and the device thread, once
+  * @retval None
+  */
+static void RAMDISK_Start(void)
+{
+  pthread_mutexattr_t attr;
+  
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&RAMDISK_Mutex, &attr);
+  pthread_mutexattr_destroy(&attr);
+  pthread_cond_init(&RAMDISK_Cond, NULL);
+  pthread_create(&RAMDISK_Thread, NULL, RAMDISK_Device, NULL);
+}
+
+/**
+  * @brief  Device thread, standing for the DMA: sleeps until the simulated end
+  *         of the pending transfer, moves the data and calls disk_complete()
+  *         as the transfer complete interrupt would
+  * @param  arg: Not used
+  * @retval None
+  */
+static void *RAMDISK_Device(void *arg)
+{
+  Diskio_requestTypeDef *req;
+  RAMDISK_TypeDef *d;
+  struct timespec end;
+  uint64_t deadline;
+  BYTE lun;
+  
+  for(;;)
+  {
+    pthread_mutex_lock(&RAMDISK_Mutex);
+    for(;;)
+    {
+      for(lun = 0; (lun < RAMDISK_LUNS) && (RAMDISK_Pending[lun] == NULL); lun++)
+      {
+      }
+      if(lun < RAMDISK_LUNS)
+      {
+        break;
+      }
+      pthread_cond_wait(&RAMDISK_Cond, &RAMDISK_Mutex);
+    }
+    req = RAMDISK_Pending[lun];
+    deadline = RAMDISK_Deadline[lun];
+    RAMDISK_Pending[lun] = NULL;
+    pthread_mutex_unlock(&RAMDISK_Mutex);
+    
+    end.tv_sec = deadline / 1000000000u;
+    end.tv_nsec = deadline % 1000000000u;
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &end, NULL) != 0)
+    {
+    }
+    d = &RAMDISK_Disk[lun];
+    if(req->write)
+    {
+      d->write_calls++;
+      d->write_sectors += req->count;
+      memcpy(d->image + (size_t)req->sector * BLOCK_SIZE, req->buff, (size_t)req->count * BLOCK_SIZE);
+    }
+    else
+    {
+      d->read_calls++;
+      d->read_sectors += req->count;
+      memcpy(req->buff, d->image + (size_t)req->sector * BLOCK_SIZE, (size_t)req->count * BLOCK_SIZE);
+    }
+    disk_complete(req, RES_OK);
+  }
+  return arg;
+}
+#endif /* _FS_ASYNC_SECTORS > 0 */
+
+/**
+  * @brief  Initializes a Drive
+  * @param  lun : RAM disk number (0..RAMDISK_LUNS-1)
+  * @retval DSTATUS: Operation status
+  */
+DSTATUS RAMDISK_initialize(BYTE lun)
+{
+  return RAMDISK_status(lun);
+}
+
+/**
+  * @brief  Gets Disk Status
+  * @param  lun : RAM disk number (0..RAMDISK_LUNS-1)
+  * @retval DSTATUS: Operation status
+  */
+DSTATUS RAMDISK_status(BYTE lun)
+{
+  if((lun >= RAMDISK_LUNS) || (RAMDISK_Disk[lun].image == NULL))
+  {
+    return STA_NOINIT | STA_NODISK;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Reads Sector(s)
+  * @param  lun : RAM disk number (0..RAMDISK_LUNS-1)
+  * @param  *buff: Data buffer to store read data
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to read (1..128)
+  * @retval DRESULT: Operation result
+  */
+DRESULT RAMDISK_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
+{
+  RAMDISK_TypeDef *d = &RAMDISK_Disk[lun];
+  
+  if((sector >= d->sectors) || (count > d->sectors - sector))
+  {
+    return RES_PARERR;
+  }
+  d->read_calls++;
+  d->read_sectors += count;
+  RAMDISK_Busy(d, count);
+  memcpy(buff, d->image + (size_t)sector * BLOCK_SIZE, (size_t)count * BLOCK_SIZE);
+  
+  return RES_OK;
+}
+
+/**
+  * @brief  Writes Sector(s)
+  * @param  lun : RAM disk number (0..RAMDISK_LUNS-1)
+  * @param  *buff: Data to be written
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to write (1..128)
+  * @retval DRESULT: Operation result
+  */
+#if _USE_WRITE == 1
+DRESULT RAMDISK_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count)
+{
+  RAMDISK_TypeDef *d = &RAMDISK_Disk[lun];
+  
+  if((sector >= d->sectors) || (count > d->sectors - sector))
+  {
+    return RES_PARERR;
+  }
+  d->write_calls++;
+  d->write_sectors += count;
+  RAMDISK_Busy(d, count);
+  memcpy(d->image + (size_t)sector * BLOCK_SIZE, buff, (size_t)count * BLOCK_SIZE);
+  
+  return RES_OK;
+}
+#endif /* _USE_WRITE == 1 */
+
+/**
+  * @brief  I/O control operation
+  * @param  lun : RAM disk number (0..RAMDISK_LUNS-1)
+  * @param  cmd: Control code
+  * @param  *buff: Buffer to send/receive control data
+  * @retval DRESULT: Operation result
+  */
+#if _USE_IOCTL == 1
+DRESULT RAMDISK_ioctl(BYTE lun, BYTE cmd, void *buff)
+{
+  DRESULT res = RES_ERROR;
+  
+  if (RAMDISK_status(lun) & STA_NOINIT) return RES_NOTRDY;
+  
+  switch (cmd)
+  {
+  /* Make sure that no pending write process */
+  case CTRL_SYNC :
+    res = RES_OK;
+    break;
+  
+  /* Get number of sectors on the disk (DWORD) */
+  case GET_SECTOR_COUNT :
+    *(DWORD*)buff = RAMDISK_Disk[lun].sectors;
+    res = RES_OK;
+    break;
+  
+  /* Get R/W sector size (WORD) */
+  case GET_SECTOR_SIZE :
+    *(WORD*)buff = BLOCK_SIZE;
+    res = RES_OK;
+    break;
+  
+  /* Get erase block size in unit of sector (DWORD) */
+  case GET_BLOCK_SIZE :
+    *(DWORD*)buff = 1;
+    res = RES_OK;
+    break;
+  
+  default:
+    res = RES_PARERR;
+  }
+  
+  return res;
+}
+#endif /* _USE_IOCTL == 1 */
+
+#if _FS_ASYNC_SECTORS > 0
+/**
+  * @brief  Starts a transfer, finished by the device thread after the simulated
+  *         access and transfer times
+  * @param  lun : RAM disk number (0..RAMDISK_LUNS-1)
+  * @param  req: Transfer, given back to disk_complete()
+  * @retval DRESULT: RES_OK if the transfer is started
+  */
+DRESULT RAMDISK_submit(BYTE lun, Diskio_requestTypeDef *req)
+{
+  RAMDISK_TypeDef *d = &RAMDISK_Disk[lun];
+  
+  if((req->sector >= d->sectors) || (req->count > d->sectors - req->sector))
+  {
+    return RES_PARERR;
+  }
+  RAMDISK_Lock();
+  RAMDISK_Pending[lun] = req;
+  RAMDISK_Deadline[lun] = RAMDISK_Now() + d->access_ns + (uint64_t)d->sector_ns * req->count;
+  pthread_cond_signal(&RAMDISK_Cond);
+  RAMDISK_Unlock();
+  
+  return RES_OK;
+}
+
+/**
+  * @brief  Takes the lock shared with the device thread, in place of masking
+  *         the interrupts
+  * @retval None
+  */
+void RAMDISK_Lock(void)
+{
+  pthread_once(&RAMDISK_Once, RAMDISK_Start);
+  pthread_mutex_lock(&RAMDISK_Mutex);
+}
+
+/**
+  * @brief  Releases the lock shared with the device thread
+  * @retval None
+  */
+void RAMDISK_Unlock(void)
+{
+  pthread_mutex_unlock(&RAMDISK_Mutex);
+}
+
+/**
+  * @brief  Lets the device thread run while diskio.c waits for a transfer
+  * @param  pdrv: Physical drive number (0..)
+  * @retval None
+  */
+void disk_idle(BYTE pdrv)
+{
+  (void)pdrv;
+  sched_yield();
+}
+#endif /* _FS_ASYNC_SECTORS > 0 */
+  
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
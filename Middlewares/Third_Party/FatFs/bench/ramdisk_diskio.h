@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    ramdisk_diskio.h
+  * @author  MCD Application Team
+  * @brief   Header for ramdisk_diskio.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __RAMDISK_DISKIO_H
+#define __RAMDISK_DISKIO_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ff_gen_drv.h"
+
+/* Exported types ------------------------------------------------------------*/
+/** 
+  * @brief  RAM disk of one lun, with the counters of the driver calls
+  */ 
+typedef struct
+{
+  BYTE    *image;                 /*!< Sector storage, sectors * _MAX_SS bytes   */
+  DWORD   sectors;                /*!< Number of sectors                         */
+  DWORD   access_ns;              /*!< Simulated time of a command               */
+  DWORD   sector_ns;              /*!< Simulated transfer time of a sector       */
+  DWORD   read_calls;             /*!< Number of RAMDISK_read() calls            */
+  DWORD   read_sectors;           /*!< Number of sectors read                    */
+  DWORD   write_calls;            /*!< Number of RAMDISK_write() calls           */
+  DWORD   write_sectors;          /*!< Number of sectors written                 */
+
+}RAMDISK_TypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define RAMDISK_LUNS              2
+
+/* Exported functions ------------------------------------------------------- */
+extern Diskio_drvTypeDef  RAMDISK_Driver;
+extern RAMDISK_TypeDef    RAMDISK_Disk[RAMDISK_LUNS];
+#if _FS_ASYNC_SECTORS > 0
+DRESULT RAMDISK_submit(BYTE lun, Diskio_requestTypeDef *req);
+#endif /* _FS_ASYNC_SECTORS > 0 */
+
+#endif /* __RAMDISK_DISKIO_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -36,17 +36,651 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include <string.h>
 #include "diskio.h"
 #include "ff_gen_drv.h"
 
 /* Private typedef -----------------------------------------------------------*/
+#define ASYNC_QUEUE      4        /* Two buffers and a direct transfer at most */
+
+#if (_FS_CACHE_FAT + _FS_CACHE_DATA) > 0
+/** 
+  * @brief  Sector cache slot
+  */ 
+typedef struct
+{
+  DWORD   sector;                 /*!< Sector held by the slot                   */
+  DWORD   stamp;                  /*!< Cache clock at the last access (LRU)      */
+  BYTE    state;                  /*!< CACHE_VALID and CACHE_DIRTY flags         */
+  union
+  {
+    UINT  d32[_MAX_SS/4];         /*!< Force 32bits alignement                   */
+    BYTE  d8[_MAX_SS];            /*!< Sector data                               */
+  }buf;
+
+}Cache_slotTypeDef;
+
+/** 
+  * @brief  Sector cache of a physical drive: the _FS_CACHE_FAT first slots
+  *         form the FAT pool, the _FS_CACHE_DATA next ones the data pool
+  */ 
+typedef struct
+{
+  DWORD              fat_start;   /*!< First sector of the FAT area              */
+  DWORD              fat_size;    /*!< Number of sectors of the FAT area         */
+  DWORD              clock;       /*!< Incremented on every access               */
+  Cache_slotTypeDef  slot[_FS_CACHE_FAT + _FS_CACHE_DATA];
+
+}Disk_cacheTypeDef;
+#endif /* (_FS_CACHE_FAT + _FS_CACHE_DATA) > 0 */
+
+#if _FS_ASYNC_SECTORS > 0
+/** 
+  * @brief  Read-ahead or write-behind buffer
+  */ 
+typedef struct
+{
+  Diskio_requestTypeDef  req;     /*!< Last transfer of the buffer               */
+  BYTE    state;                  /*!< ASYNC_FREE, ASYNC_READ, ASYNC_WRITE or ASYNC_FILL */
+  union
+  {
+    UINT  d32[_FS_ASYNC_SECTORS * _MAX_SS / 4]; /*!< Force 32bits alignement     */
+    BYTE  d8[_FS_ASYNC_SECTORS * _MAX_SS];      /*!< Sector data                 */
+  }buf;
+
+}Async_bufferTypeDef;
+
+/** 
+  * @brief  Asynchronous transfers of a physical drive: a FIFO of requests, of
+  *         which the driver transfers the first one, and two buffers
+  */ 
+typedef struct
+{
+  Diskio_requestTypeDef  *queue[ASYNC_QUEUE]; /*!< Requests in submission order  */
+  __IO BYTE              head;    /*!< Index of the request in progress          */
+  __IO BYTE              count;   /*!< Number of queued requests                 */
+  DRESULT                error;   /*!< Failure of a deferred write, to report    */
+  DWORD                  next;    /*!< Sector following the last read            */
+  Async_bufferTypeDef    buffer[2];
+
+}Disk_asyncTypeDef;
+#endif /* _FS_ASYNC_SECTORS > 0 */
+
 /* Private define ------------------------------------------------------------*/
+#define CACHE_SLOTS      (_FS_CACHE_FAT + _FS_CACHE_DATA)
+#define CACHE_VALID      0x01
+#define CACHE_DIRTY      0x02
+
+#if (CACHE_SLOTS > 0) && (_MAX_SS != _MIN_SS)
+#error The sector cache requires a fixed sector size (_MAX_SS == _MIN_SS)
+#endif
+#if (CACHE_SLOTS > 0) && ((_USE_WRITE == 0) || (_USE_IOCTL == 0))
+#error The sector cache requires disk_write() and disk_ioctl()
+#endif
+
+#define ASYNC_FREE       0
+#define ASYNC_READ       1
+#define ASYNC_WRITE      2
+#define ASYNC_FILL       3        /* Write data gathered, not submitted yet */
+
+#if (_FS_ASYNC_SECTORS > 0) && (_MAX_SS != _MIN_SS)
+#error The asynchronous transfers require a fixed sector size (_MAX_SS == _MIN_SS)
+#endif
+#if (_FS_ASYNC_SECTORS > 0) && ((_USE_WRITE == 0) || (_USE_IOCTL == 0))
+#error The asynchronous transfers require disk_write() and disk_ioctl()
+#endif
+
+#if (_FS_ASYNC_SECTORS > 0) && !defined(DISKIO_LOCK)
+/* Masks the interrupts, among them the transfer complete ones of the drivers */
+#define DISKIO_LOCK(s)   do { (s) = __get_PRIMASK(); __disable_irq(); } while(0)
+#define DISKIO_UNLOCK(s) __set_PRIMASK(s)
+#endif
+
 /* Private variables ---------------------------------------------------------*/
 extern Disk_drvTypeDef  disk;
 
+#if CACHE_SLOTS > 0
+static Disk_cacheTypeDef cache[_VOLUMES];
+#endif
+#if _FS_ASYNC_SECTORS > 0
+static Disk_asyncTypeDef async[_VOLUMES];
+#endif
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
+#if _FS_ASYNC_SECTORS > 0
+/**
+  * @brief  Starts the request at the head of the queue of a drive, completing
+  *         with an error those the driver refuses
+  * @note   Called with the queues locked
+  * @param  pdrv: Physical drive number (0..)
+  * @retval None
+  */
+static void async_start(BYTE pdrv)
+{
+  Disk_asyncTypeDef *a = &async[pdrv];
+  Diskio_requestTypeDef *req;
+  
+  while(a->count > 0)
+  {
+    req = a->queue[a->head];
+    if(disk.drv[pdrv]->disk_submit(disk.lun[pdrv], req) == RES_OK)
+    {
+      return;
+    }
+    req->result = RES_ERROR;
+    req->done = 1;
+    a->head = (a->head + 1) % ASYNC_QUEUE;
+    a->count--;
+  }
+}
+
+/**
+  * @brief  Queues a request, started at once if the drive is idle
+  * @param  pdrv: Physical drive number (0..)
+  * @param  req: Request, its buffer, sector, count and write fields set
+  * @retval None
+  */
+static void async_submit(BYTE pdrv, Diskio_requestTypeDef *req)
+{
+  Disk_asyncTypeDef *a = &async[pdrv];
+  DWORD s;
+  
+  req->pdrv = pdrv;
+  req->done = 0;
+  DISKIO_LOCK(s);
+  a->queue[(a->head + a->count) % ASYNC_QUEUE] = req;
+  a->count++;
+  if(a->count == 1)
+  {
+    async_start(pdrv);
+  }
+  DISKIO_UNLOCK(s);
+}
+
+/**
+  * @brief  Tells whether a request is over
+  * @param  req: Submitted request
+  * @retval 1 once disk_complete() has been called for the request
+  */
+static BYTE async_done(Diskio_requestTypeDef *req)
+{
+  DWORD s;
+  BYTE done;
+  
+  DISKIO_LOCK(s);
+  done = req->done;
+  DISKIO_UNLOCK(s);
+  return done;
+}
+
+/**
+  * @brief  Waits for the end of a request
+  * @param  req: Submitted request
+  * @retval DRESULT: Operation result of the request
+  */
+static DRESULT async_wait(Diskio_requestTypeDef *req)
+{
+  while(!async_done(req))
+  {
+    disk_idle(req->pdrv);
+  }
+  return req->result;
+}
+
+/**
+  * @brief  Submits the write data gathered in a buffer, if any
+  * @param  pdrv: Physical drive number (0..)
+  * @retval None
+  */
+static void async_fill_end(BYTE pdrv)
+{
+  Async_bufferTypeDef *b;
+  UINT i;
+  
+  for(i = 0; i < 2; i++)
+  {
+    b = &async[pdrv].buffer[i];
+    if(b->state == ASYNC_FILL)
+    {
+      b->state = ASYNC_WRITE;
+      async_submit(pdrv, &b->req);
+    }
+  }
+}
+
+/**
+  * @brief  Gets a buffer for a new transfer: a free one, a finished write or a
+  *         read-ahead no longer needed
+  * @param  pdrv: Physical drive number (0..)
+  * @param  from: First sector of the read-ahead window to keep, read-ahead
+  *         buffers outside of it are recycled (0xFFFFFFFF: recycle all)
+  * @param  wait: 1 to wait for a buffer to finish if none is available
+  * @retval Buffer, its state set to ASYNC_FREE, NULL if none is available
+  */
+static Async_bufferTypeDef *async_buffer(BYTE pdrv, DWORD from, BYTE wait)
+{
+  Disk_asyncTypeDef *a = &async[pdrv];
+  Async_bufferTypeDef *b;
+  UINT i;
+  
+  for(;;)
+  {
+    for(i = 0; i < 2; i++)
+    {
+      b = &a->buffer[i];
+      if((b->state == ASYNC_FILL) || ((b->state != ASYNC_FREE) && !async_done(&b->req)))
+      {
+        continue;
+      }
+      if(b->state == ASYNC_WRITE)
+      {
+        if((b->req.result != RES_OK) && (a->error == RES_OK))
+        {
+          a->error = b->req.result;
+        }
+      }
+      else if((b->state == ASYNC_READ) && (from != 0xFFFFFFFF) &&
+              (b->req.sector + b->req.count > from) &&
+              (b->req.sector < from + 2 * _FS_ASYNC_SECTORS))
+      {
+        continue;
+      }
+      b->state = ASYNC_FREE;
+      return b;
+    }
+    if(!wait)
+    {
+      return NULL;
+    }
+    disk_idle(pdrv);
+  }
+}
+
+/**
+  * @brief  Keeps the two buffers reading the sectors that follow a sequential
+  *         read, as far as no write holds them
+  * @param  pdrv: Physical drive number (0..)
+  * @param  from: Sector following the read
+  * @retval None
+  */
+static void async_readahead(BYTE pdrv, DWORD from)
+{
+  Disk_asyncTypeDef *a = &async[pdrv];
+  Async_bufferTypeDef *b;
+  DWORD sector = from;
+  UINT i;
+  
+  for(;;)
+  {
+    /* Skip the sectors already read ahead, by one buffer or both in turn */
+    for(i = 0; i < 4; i++)
+    {
+      b = &a->buffer[i % 2];
+      if((b->state == ASYNC_READ) && (sector - b->req.sector < b->req.count))
+      {
+        sector = b->req.sector + b->req.count;
+      }
+    }
+    if(sector - from >= 2 * _FS_ASYNC_SECTORS)
+    {
+      return;
+    }
+    b = async_buffer(pdrv, from, 0);
+    if(b == NULL)
+    {
+      return;
+    }
+    b->req.buff = b->buf.d8;
+    b->req.sector = sector;
+    b->req.count = _FS_ASYNC_SECTORS;
+    b->req.write = 0;
+    b->state = ASYNC_READ;
+    async_submit(pdrv, &b->req);
+  }
+}
+
+/**
+  * @brief  Drops the read-ahead data of sectors, once their reads are over
+  * @param  pdrv: Physical drive number (0..)
+  * @param  sector: First sector
+  * @param  count: Number of sectors
+  * @retval None
+  */
+static void async_discard(BYTE pdrv, DWORD sector, DWORD count)
+{
+  Async_bufferTypeDef *b;
+  UINT i;
+  
+  for(i = 0; i < 2; i++)
+  {
+    b = &async[pdrv].buffer[i];
+    if((b->state == ASYNC_READ) && (b->req.sector < sector + count) &&
+       (sector < b->req.sector + b->req.count))
+    {
+      async_wait(&b->req);
+      b->state = ASYNC_FREE;
+    }
+  }
+}
+#endif /* _FS_ASYNC_SECTORS > 0 */
+
+/**
+  * @brief  Reads sectors from the driver: from the read-ahead buffers or with a
+  *         direct transfer for an asynchronous driver, then reading ahead when
+  *         the access is sequential
+  * @param  pdrv: Physical drive number (0..)
+  * @param  *buff: Data buffer to store read data
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to read
+  * @retval DRESULT: Operation result
+  */
+static DRESULT io_read(BYTE pdrv, BYTE *buff, DWORD sector, UINT count)
+{
+#if _FS_ASYNC_SECTORS > 0
+  Disk_asyncTypeDef *a = &async[pdrv];
+  Async_bufferTypeDef *b;
+  Diskio_requestTypeDef req;
+  DRESULT res;
+  BYTE sequential;
+  UINT i, n;
+  
+  if(disk.drv[pdrv]->disk_submit != NULL)
+  {
+    res = a->error;
+    a->error = RES_OK;
+    sequential = (sector == a->next);
+    async_fill_end(pdrv);
+    while((res == RES_OK) && (count > 0))
+    {
+      /* Buffer holding the sector, direct transfer up to the next one */
+      b = NULL;
+      n = count;
+      for(i = 0; i < 2; i++)
+      {
+        if(a->buffer[i].state != ASYNC_READ)
+        {
+          continue;
+        }
+        if(sector - a->buffer[i].req.sector < a->buffer[i].req.count)
+        {
+          b = &a->buffer[i];
+        }
+        else if(a->buffer[i].req.sector - sector < n)
+        {
+          n = a->buffer[i].req.sector - sector;
+        }
+      }
+      if((b != NULL) && (async_wait(&b->req) == RES_OK))
+      {
+        n = b->req.sector + b->req.count - sector;
+        if(n > count)
+        {
+          n = count;
+        }
+        memcpy(buff, b->buf.d8 + (sector - b->req.sector) * _MAX_SS, n * _MAX_SS);
+        if(sector + n == b->req.sector + b->req.count)
+        {
+          b->state = ASYNC_FREE;
+        }
+        sequential = 1;
+      }
+      else
+      {
+        if(b != NULL)
+        {
+          b->state = ASYNC_FREE;
+        }
+        req.buff = buff;
+        req.sector = sector;
+        req.count = n;
+        req.write = 0;
+        async_submit(pdrv, &req);
+        res = async_wait(&req);
+      }
+      buff += n * _MAX_SS;
+      sector += n;
+      count -= n;
+    }
+    if((res == RES_OK) && sequential)
+    {
+      async_readahead(pdrv, sector);
+    }
+    a->next = sector;
+    return res;
+  }
+#endif /* _FS_ASYNC_SECTORS > 0 */
+  return disk.drv[pdrv]->disk_read(disk.lun[pdrv], buff, sector, count);
+}
+
+/**
+  * @brief  Writes sectors to the driver, behind the caller for an asynchronous
+  *         driver: the data is gathered in a buffer while the writes are
+  *         contiguous, the buffer is submitted once full or at the next read,
+  *         non contiguous write or CTRL_SYNC
+  * @param  pdrv: Physical drive number (0..)
+  * @param  *buff: Data to be written
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to write
+  * @retval DRESULT: Operation result, or the failure of an earlier deferred write
+  */
+#if _USE_WRITE == 1
+static DRESULT io_write(BYTE pdrv, const BYTE *buff, DWORD sector, UINT count)
+{
+#if _FS_ASYNC_SECTORS > 0
+  Disk_asyncTypeDef *a = &async[pdrv];
+  Async_bufferTypeDef *b;
+  DRESULT res;
+  UINT n;
+  
+  if(disk.drv[pdrv]->disk_submit != NULL)
+  {
+    res = a->error;
+    a->error = RES_OK;
+    if(res != RES_OK)
+    {
+      return res;
+    }
+    async_discard(pdrv, sector, count);
+    while(count > 0)
+    {
+      /* Continue the gathered data, else start a new buffer */
+      b = &a->buffer[0];
+      if(b->state != ASYNC_FILL)
+      {
+        b = &a->buffer[1];
+      }
+      if((b->state != ASYNC_FILL) || (sector != b->req.sector + b->req.count))
+      {
+        async_fill_end(pdrv);
+        b = async_buffer(pdrv, 0xFFFFFFFF, 1);
+        b->req.buff = b->buf.d8;
+        b->req.sector = sector;
+        b->req.count = 0;
+        b->req.write = 1;
+        b->state = ASYNC_FILL;
+      }
+      n = _FS_ASYNC_SECTORS - b->req.count;
+      if(n > count)
+      {
+        n = count;
+      }
+      memcpy(b->buf.d8 + b->req.count * _MAX_SS, buff, n * _MAX_SS);
+      b->req.count += n;
+      if(b->req.count == _FS_ASYNC_SECTORS)
+      {
+        async_fill_end(pdrv);
+      }
+      buff += n * _MAX_SS;
+      sector += n;
+      count -= n;
+    }
+    return RES_OK;
+  }
+#endif /* _FS_ASYNC_SECTORS > 0 */
+  return disk.drv[pdrv]->disk_write(disk.lun[pdrv], buff, sector, count);
+}
+#endif /* _USE_WRITE == 1 */
+
+#if _FS_ASYNC_SECTORS > 0
+/**
+  * @brief  Waits for the transfers of a drive to finish and drops the read-ahead
+  *         data, leaving every buffer free
+  * @param  pdrv: Physical drive number (0..)
+  * @retval DRESULT: Failure of a deferred write, RES_OK if none
+  */
+static DRESULT io_sync(BYTE pdrv)
+{
+  Disk_asyncTypeDef *a = &async[pdrv];
+  Async_bufferTypeDef *b;
+  DRESULT res;
+  UINT i;
+  
+  async_fill_end(pdrv);
+  for(i = 0; i < 2; i++)
+  {
+    b = &a->buffer[i];
+    if(b->state != ASYNC_FREE)
+    {
+      if((async_wait(&b->req) != RES_OK) && (b->state == ASYNC_WRITE) && (a->error == RES_OK))
+      {
+        a->error = b->req.result;
+      }
+      b->state = ASYNC_FREE;
+    }
+  }
+  res = a->error;
+  a->error = RES_OK;
+  return res;
+}
+#endif /* _FS_ASYNC_SECTORS > 0 */
+
+#if CACHE_SLOTS > 0
+/**
+  * @brief  Looks a sector up in the cache of a drive
+  * @param  pdrv: Physical drive number (0..)
+  * @param  sector: Sector address (LBA)
+  * @retval Slot holding the sector, NULL if it is not cached
+  */
+static Cache_slotTypeDef *cache_find(BYTE pdrv, DWORD sector)
+{
+  Cache_slotTypeDef *slot = cache[pdrv].slot;
+  UINT i;
+  
+  for(i = 0; i < CACHE_SLOTS; i++, slot++)
+  {
+    if((slot->state & CACHE_VALID) && (slot->sector == sector))
+    {
+      return slot;
+    }
+  }
+  return NULL;
+}
+
+/**
+  * @brief  Gets the slot for a sector, recycling the least recently used slot
+  *         of its pool on a miss
+  * @param  pdrv: Physical drive number (0..)
+  * @param  sector: Sector address (LBA)
+  * @param  pslot: Returns the slot, NULL if the pool of the sector is empty.
+  *         A recycled slot is returned with its state cleared.
+  * @retval DRESULT: Operation result of the write back of the recycled slot
+  */
+static DRESULT cache_get(BYTE pdrv, DWORD sector, Cache_slotTypeDef **pslot)
+{
+  Disk_cacheTypeDef *c = &cache[pdrv];
+  Cache_slotTypeDef *slot;
+  UINT first, last, i;
+  
+  c->clock++;
+  slot = cache_find(pdrv, sector);
+  if(slot == NULL)
+  {
+    /* FAT sectors go to the FAT pool, if any, all others to the data pool */
+    first = 0;
+    last = CACHE_SLOTS;
+    if(_FS_CACHE_FAT > 0)
+    {
+      if(sector - c->fat_start < c->fat_size)
+      {
+        last = _FS_CACHE_FAT;
+      }
+      else
+      {
+        first = _FS_CACHE_FAT;
+      }
+    }
+    if(first == last)
+    {
+      *pslot = NULL;
+      return RES_OK;
+    }
+    
+    /* Take a free slot, else the least recently used one */
+    slot = &c->slot[first];
+    for(i = first; i < last; i++)
+    {
+      if(!(c->slot[i].state & CACHE_VALID))
+      {
+        slot = &c->slot[i];
+        break;
+      }
+      if((c->clock - c->slot[i].stamp) > (c->clock - slot->stamp))
+      {
+        slot = &c->slot[i];
+      }
+    }
+    if(slot->state & CACHE_DIRTY)
+    {
+      if(io_write(pdrv, slot->buf.d8, slot->sector, 1) != RES_OK)
+      {
+        return RES_ERROR;
+      }
+    }
+    slot->state = 0;
+    slot->sector = sector;
+  }
+  slot->stamp = c->clock;
+  *pslot = slot;
+  return RES_OK;
+}
+
+/**
+  * @brief  Writes back the dirty sectors of a drive, in ascending order
+  * @param  pdrv: Physical drive number (0..)
+  * @retval DRESULT: Operation result
+  */
+static DRESULT cache_flush(BYTE pdrv)
+{
+  Cache_slotTypeDef *slot, *next;
+  UINT i;
+  
+  do
+  {
+    next = NULL;
+    for(i = 0; i < CACHE_SLOTS; i++)
+    {
+      slot = &cache[pdrv].slot[i];
+      if((slot->state & CACHE_DIRTY) && ((next == NULL) || (slot->sector < next->sector)))
+      {
+        next = slot;
+      }
+    }
+    if(next != NULL)
+    {
+      if(io_write(pdrv, next->buf.d8, next->sector, 1) != RES_OK)
+      {
+        return RES_ERROR;
+      }
+      next->state &= ~CACHE_DIRTY;
+    }
+  }while(next != NULL);
+  
+  return RES_OK;
+}
+#endif /* CACHE_SLOTS > 0 */
+
 /**
   * @brief  Gets Disk Status 
   * @param  pdrv: Physical drive number (0..)
@@ -76,6 +710,13 @@ DSTATUS disk_initialize (
   if(disk.is_initialized[pdrv] == 0)
   { 
     disk.is_initialized[pdrv] = 1;
+#if CACHE_SLOTS > 0
+    /* The medium may have changed, forget everything cached for the drive */
+    memset(&cache[pdrv], 0, sizeof(cache[pdrv]));
+#endif
+#if _FS_ASYNC_SECTORS > 0
+    memset(&async[pdrv], 0, sizeof(async[pdrv]));
+#endif
     stat = disk.drv[pdrv]->disk_initialize(disk.lun[pdrv]);
   }
   return stat;
@@ -97,8 +738,46 @@ DRESULT disk_read (
 )
 {
   DRESULT res;
+#if CACHE_SLOTS > 0
+  Cache_slotTypeDef *slot;
+  UINT i;
+  
+  if(count == 1)
+  {
+    res = cache_get(pdrv, sector, &slot);
+    if((res == RES_OK) && (slot != NULL))
+    {
+      if(!(slot->state & CACHE_VALID))
+      {
+        res = io_read(pdrv, slot->buf.d8, sector, 1);
+        if(res != RES_OK)
+        {
+          return res;
+        }
+        slot->state = CACHE_VALID;
+      }
+      memcpy(buff, slot->buf.d8, _MAX_SS);
+      return RES_OK;
+    }
+    if(res != RES_OK)
+    {
+      return res;
+    }
+  }
+#endif /* CACHE_SLOTS > 0 */
  
-  res = disk.drv[pdrv]->disk_read(disk.lun[pdrv], buff, sector, count);
+  res = io_read(pdrv, buff, sector, count);
+#if CACHE_SLOTS > 0
+  /* Sectors modified in the cache are newer than the medium */
+  for(i = 0; (res == RES_OK) && (i < CACHE_SLOTS); i++)
+  {
+    slot = &cache[pdrv].slot[i];
+    if((slot->state & CACHE_DIRTY) && (slot->sector - sector < count))
+    {
+      memcpy(buff + (slot->sector - sector) * _MAX_SS, slot->buf.d8, _MAX_SS);
+    }
+  }
+#endif /* CACHE_SLOTS > 0 */
   return res;
 }
 
@@ -119,8 +798,40 @@ DRESULT disk_write (
 )
 {
   DRESULT res;
+#if CACHE_SLOTS > 0
+  Cache_slotTypeDef *slot;
+  UINT i;
+  
+  if(count == 1)
+  {
+    res = cache_get(pdrv, sector, &slot);
+    if((res == RES_OK) && (slot != NULL))
+    {
+      /* Write back is deferred until the slot is recycled or CTRL_SYNC */
+      memcpy(slot->buf.d8, buff, _MAX_SS);
+      slot->state = CACHE_VALID | CACHE_DIRTY;
+      return RES_OK;
+    }
+    if(res != RES_OK)
+    {
+      return res;
+    }
+  }
+#endif /* CACHE_SLOTS > 0 */
   
-  res = disk.drv[pdrv]->disk_write(disk.lun[pdrv], buff, sector, count);
+  res = io_write(pdrv, buff, sector, count);
+#if CACHE_SLOTS > 0
+  /* Keep the cached copies of the written sectors up to date */
+  for(i = 0; (res == RES_OK) && (i < CACHE_SLOTS); i++)
+  {
+    slot = &cache[pdrv].slot[i];
+    if((slot->state & CACHE_VALID) && (slot->sector - sector < count))
+    {
+      memcpy(slot->buf.d8, buff + (slot->sector - sector) * _MAX_SS, _MAX_SS);
+      slot->state = CACHE_VALID;
+    }
+  }
+#endif /* CACHE_SLOTS > 0 */
   return res;
 }
 #endif /* _USE_WRITE == 1 */
@@ -140,12 +851,107 @@ DRESULT disk_ioctl (
 )
 {
   DRESULT res;
+#if CACHE_SLOTS > 0
+  Cache_slotTypeDef *slot;
+  UINT i;
+
+  switch(cmd)
+  {
+  /* FAT area of the mounted volume, routes its sectors to the FAT pool */
+  case CTRL_CACHE_FAT :
+    cache[pdrv].fat_start = ((DWORD*)buff)[0];
+    cache[pdrv].fat_size = ((DWORD*)buff)[1];
+    return RES_OK;
+
+  /* Pending writes of the cache go first */
+  case CTRL_SYNC :
+    res = cache_flush(pdrv);
+    if(res != RES_OK)
+    {
+      return res;
+    }
+    break;
+
+  /* Sectors no longer used need not be written back */
+  case CTRL_TRIM :
+    for(i = 0; i < CACHE_SLOTS; i++)
+    {
+      slot = &cache[pdrv].slot[i];
+      if((slot->sector >= ((DWORD*)buff)[0]) && (slot->sector <= ((DWORD*)buff)[1]))
+      {
+        slot->state = 0;
+      }
+    }
+    break;
+
+  default:
+    break;
+  }
+#endif /* CACHE_SLOTS > 0 */
+#if _FS_ASYNC_SECTORS > 0
+  if(disk.drv[pdrv]->disk_submit != NULL)
+  {
+    /* Deferred writes are over before the driver syncs */
+    if(cmd == CTRL_SYNC)
+    {
+      res = io_sync(pdrv);
+      if(res != RES_OK)
+      {
+        return res;
+      }
+    }
+    /* Trimmed sectors read ahead are stale */
+    if(cmd == CTRL_TRIM)
+    {
+      async_discard(pdrv, ((DWORD*)buff)[0], ((DWORD*)buff)[1] - ((DWORD*)buff)[0] + 1);
+    }
+  }
+#endif /* _FS_ASYNC_SECTORS > 0 */
 
   res = disk.drv[pdrv]->disk_ioctl(disk.lun[pdrv], cmd, buff);
   return res;
 }
 #endif /* _USE_IOCTL == 1 */
 
+#if _FS_ASYNC_SECTORS > 0
+/**
+  * @brief  Ends the transfer in progress on a drive and starts the next queued
+  *         one, called by an asynchronous driver, usually from its transfer
+  *         complete interrupt
+  * @param  req: Request given to the disk_submit function of the driver
+  * @param  res: Operation result
+  * @retval None
+  */
+void disk_complete (
+	Diskio_requestTypeDef *req,	/* Finished request */
+	DRESULT res			/* Operation result */
+)
+{
+  BYTE pdrv = req->pdrv;
+  Disk_asyncTypeDef *a = &async[pdrv];
+  DWORD s;
+  
+  DISKIO_LOCK(s);
+  req->result = res;
+  req->done = 1;
+  a->head = (a->head + 1) % ASYNC_QUEUE;
+  a->count--;
+  async_start(pdrv);
+  DISKIO_UNLOCK(s);
+}
+
+/**
+  * @brief  Called in a loop while waiting for a transfer of an asynchronous
+  *         driver, may sleep until the next interrupt or let other tasks run
+  * @param  pdrv: Physical drive number (0..)
+  * @retval None
+  */
+__weak void disk_idle (BYTE pdrv)
+{
+  (void)pdrv;
+}
+#endif /* _FS_ASYNC_SECTORS > 0 */
+
 /**
   * @brief  Gets Time from RTC 
   * @param  None
@@ -61,6 +61,9 @@ DWORD get_fattime (void);
 #define CTRL_EJECT			7	/* Eject media */
 #define CTRL_FORMAT			8	/* Create physical format on the media */
 
+/* Sector cache command (Used by FatFs at _FS_CACHE_FAT > 0, consumed by diskio.c) */
+#define CTRL_CACHE_FAT		9	/* Set FAT area of the sector cache {start sector, number of sectors} */
+
 /* MMC/SDC specific ioctl command */
 #define MMC_GET_TYPE		10	/* Get card type */
 #define MMC_GET_CSD			11	/* Get CSD */
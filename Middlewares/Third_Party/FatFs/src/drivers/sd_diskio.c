@@ -61,6 +61,9 @@ const Diskio_drvTypeDef  SD_Driver =
 #if  _USE_IOCTL == 1
   SD_ioctl,
 #endif /* _USE_IOCTL == 1 */
+#if _FS_ASYNC_SECTORS > 0
+  NULL,
+#endif /* _FS_ASYNC_SECTORS > 0 */
 };
 
 /* Private functions ---------------------------------------------------------*/
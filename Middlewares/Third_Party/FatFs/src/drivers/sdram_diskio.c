@@ -60,6 +60,9 @@ const Diskio_drvTypeDef  SDRAMDISK_Driver =
 #if  _USE_IOCTL == 1
   SDRAMDISK_ioctl,
 #endif /* _USE_IOCTL == 1 */
+#if _FS_ASYNC_SECTORS > 0
+  NULL,
+#endif /* _FS_ASYNC_SECTORS > 0 */
 };
 
 /* Private functions ---------------------------------------------------------*/
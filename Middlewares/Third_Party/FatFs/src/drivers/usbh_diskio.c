@@ -62,6 +62,9 @@ const Diskio_drvTypeDef  USBH_Driver =
 #if  _USE_IOCTL == 1
   USBH_ioctl,
 #endif /* _USE_IOCTL == 1 */
+#if _FS_ASYNC_SECTORS > 0
+  NULL,
+#endif /* _FS_ASYNC_SECTORS > 0 */
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -175,6 +175,20 @@
 #endif
 
 
+/* Free cluster bitmap */
+#if _FS_FREEMAP && !_FS_READONLY
+#define FMAP_CHUNK	512		/* Maximum number of clusters mapped at a time */
+#define FMAP_OK(fs)	((fs)->fmap && (fs)->fmap_len >= ((fs)->n_fatent + 31) / 32)
+#define FMAP_BIT(fs, clst)	((fs)->fmap[(clst) / 32] & (1UL << ((clst) % 32)))
+#endif
+
+
+/* Contiguous block given by f_expand() */
+#if _USE_EXPAND
+#define IN_CONT(fp)	((fp)->fptr / SS((fp)->fs) < (fp)->ncont * (fp)->fs->csize)	/* Is the sector at fptr in the block? */
+#endif
+
+
 /* File access control feature */
 #if _FS_LOCK
 #if _FS_READONLY
@@ -937,6 +951,118 @@ DWORD get_fat (	/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x0FFFFFFF:Cluste
 
 
 
+/*-----------------------------------------------------------------------*/
+/* FAT access - Free cluster bitmap                                      */
+/*-----------------------------------------------------------------------*/
+#if _FS_FREEMAP && !_FS_READONLY
+static
+DWORD fmap_index (	/* Position of the cluster in the mapping order */
+	FATFS* fs,		/* File system object */
+	DWORD clst		/* Cluster# */
+)
+{
+	return (clst >= fs->fmap_start) ? clst - fs->fmap_start : clst + (fs->n_fatent - 2) - fs->fmap_start;
+}
+
+
+static
+void fmap_set (
+	FATFS* fs,		/* File system object */
+	DWORD clst,		/* Cluster# whose FAT entry has been changed */
+	DWORD val		/* New value of the entry */
+)
+{
+	DWORD *p = &fs->fmap[clst / 32], m = 1UL << (clst % 32);
+
+
+	if (fmap_index(fs, clst) >= fs->fmap_cnt) return;	/* Not mapped yet */
+	if (val) {
+		if (!(*p & m)) { *p |= m; fs->fmap_free--; }
+	} else {
+		if (*p & m) { *p &= ~m; fs->fmap_free++; }
+	}
+}
+
+
+static
+FRESULT fmap_extend (	/* Map the next chunk of clusters from the FAT */
+	FATFS* fs		/* File system object */
+)
+{
+	DWORD clst, n, val;
+
+
+	clst = fs->fmap_start + fs->fmap_cnt;	/* First cluster not mapped */
+	if (clst >= fs->n_fatent) clst -= fs->n_fatent - 2;
+	n = fs->n_fatent - 2 - fs->fmap_cnt;
+	if (fs->fs_type != FS_FAT12) {	/* Up to the end of the FAT sector, not to thrash the window */
+		val = SS(fs) / (fs->fs_type == FS_FAT16 ? 2 : 4);
+		if (n > val - clst % val) n = val - clst % val;
+	}
+	if (n > FMAP_CHUNK) n = FMAP_CHUNK;
+	for ( ; n; n--) {
+		val = get_fat(fs, clst);
+		if (val == 1) return FR_INT_ERR;
+		if (val == 0xFFFFFFFF) return FR_DISK_ERR;
+		if (val) {
+			fs->fmap[clst / 32] |= 1UL << (clst % 32);
+		} else {
+			fs->fmap[clst / 32] &= ~(1UL << (clst % 32));
+			fs->fmap_free++;
+		}
+		fs->fmap_cnt++;
+		if (++clst >= fs->n_fatent) clst = 2;
+	}
+	if (fs->fmap_cnt == fs->n_fatent - 2 && fs->free_clust != fs->fmap_free) {	/* Whole FAT mapped: the free cluster count is exact */
+		fs->free_clust = fs->fmap_free;
+		fs->fsi_flag |= 1;
+	}
+	return FR_OK;
+}
+
+
+static
+DWORD fmap_find (	/* 0:No free run, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:First cluster of the run */
+	FATFS* fs,		/* File system object */
+	DWORD scl,		/* Cluster# to start the search after */
+	DWORD ncl		/* Number of contiguous free clusters to find */
+)
+{
+	DWORD clst, scan, run;
+	FRESULT res;
+
+
+	if (!fs->fmap_cnt) {	/* Start mapping where the search starts */
+		fs->fmap_start = (scl + 1 < fs->n_fatent) ? scl + 1 : 2;
+		fs->fmap_free = 0;
+	}
+	clst = scl; run = 0;
+	for (scan = 0; scan < fs->n_fatent - 2; scan++) {
+		if (++clst >= fs->n_fatent) {	/* Wrap around (a run cannot) */
+			clst = 2; run = 0;
+		}
+		while (fmap_index(fs, clst) >= fs->fmap_cnt) {	/* Map the FAT up to the cluster */
+			res = fmap_extend(fs);
+			if (res != FR_OK) return (res == FR_DISK_ERR) ? 0xFFFFFFFF : 1;
+		}
+		if (FMAP_BIT(fs, clst)) {
+			run = 0;
+			if (clst % 32 == 0 && fs->fmap[clst / 32] == 0xFFFFFFFF && clst + 31 < fs->n_fatent	/* Skip 32 used clusters at once if all mapped */
+				&& (fs->fmap_start <= clst || fs->fmap_start > clst + 31 || fs->fmap_cnt == fs->n_fatent - 2)
+				&& fmap_index(fs, clst + 31) < fs->fmap_cnt) {
+				clst += 31; scan += 31;
+			}
+		} else {
+			if (++run == ncl) return clst - ncl + 1;	/* Found a run of free clusters */
+		}
+	}
+	return 0;
+}
+#endif /* _FS_FREEMAP && !_FS_READONLY */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* FAT access - Change value of a FAT entry                              */
 /*-----------------------------------------------------------------------*/
@@ -994,6 +1120,9 @@ FRESULT put_fat (
 			res = FR_INT_ERR;
 		}
 	}
+#if _FS_FREEMAP
+	if (res == FR_OK && FMAP_OK(fs)) fmap_set(fs, clst, val);	/* Keep the free cluster bitmap in sync */
+#endif
 
 	return res;
 }
@@ -1082,6 +1211,12 @@ DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk err
 	}
 
 	ncl = scl;				/* Start cluster */
+#if _FS_FREEMAP
+	if (FMAP_OK(fs)) {		/* Search the free cluster bitmap */
+		ncl = fmap_find(fs, scl, 1);
+		if (ncl == 0 || ncl == 1 || ncl == 0xFFFFFFFF) return ncl;
+	} else
+#endif
 	for (;;) {
 		ncl++;							/* Next cluster */
 		if (ncl >= fs->n_fatent) {		/* Check wrap around */
@@ -1520,13 +1655,173 @@ BYTE sum_sfn (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Name cache - Hash names and record the entries holding them           */
+/*-----------------------------------------------------------------------*/
+#if _FS_NAMECACHE
+#define NC_WAYS		8			/* Slots per bucket */
+#define NC_FREE		0xFFFFFFFF	/* Unused slot */
+
+static
+DWORD nc_final (	/* Final mix of a name hash */
+	DWORD h
+)
+{
+	h ^= h >> 16; h *= 0x85EBCA6B;
+	h ^= h >> 13;
+	return h;
+}
+
+
+#if _USE_LFN
+static
+DWORD nc_char (		/* Add a character to a hash (FNV-1a), case-insensitive as cmp_lfn() */
+	DWORD h,		/* Hash so far */
+	WCHAR wc		/* Character */
+)
+{
+	if (wc < 0x80) {	/* ASCII characters need no conversion table */
+		if (IsLower(wc)) wc -= 0x20;
+	} else {
+		wc = ff_wtoupper(wc);
+	}
+	return (h ^ wc) * 16777619;
+}
+
+
+static
+DWORD nc_lfn_entry (	/* Hash of the part of a long name held by an LFN entry */
+	const BYTE* dir		/* Pointer to the LFN entry */
+)
+{
+	DWORD h;
+	UINT s;
+	WCHAR wc;
+
+
+	h = 2166136261UL + (dir[LDIR_Ord] & ~LLEF);	/* Seeded with the order of the part */
+	for (s = 0; s < 13; s++) {
+		wc = LD_WORD(dir + LfnOfs[s]);
+		if (!wc) break;
+		h = nc_char(h, wc);
+	}
+	return nc_final(h);
+}
+
+
+static
+DWORD nc_lfn (		/* Hash of a long name, the sum of the hashes of its LFN entries */
+	const WCHAR* lfn	/* Pointer to the LFN */
+)
+{
+	DWORD h, sum = 0;
+	UINT i = 0, s, ord;
+
+
+	for (ord = 1; lfn[i]; ord++) {	/* Split the name in 13 character parts as fit_lfn() */
+		h = 2166136261UL + ord;
+		for (s = 0; s < 13 && lfn[i]; s++) h = nc_char(h, lfn[i++]);
+		sum += nc_final(h);
+	}
+	return sum;
+}
+#endif
+
+
+static
+DWORD nc_sfn (		/* Hash of a short name */
+	const BYTE* sfn		/* Pointer to the 11 byte SFN */
+)
+{
+	DWORD h = 0;
+	UINT n;
+
+
+	for (n = 0; n < 11; n++) h = (h ^ sfn[n]) * 16777619;
+	return nc_final(h);
+}
+
+
+static
+void nc_clear (
+	FATFS* fs		/* File system object */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < fs->ncache_len; i++) fs->ncache[i] = NC_FREE;
+}
+
+
+static
+DWORD* nc_bucket (	/* Pointer to the bucket of a name in the directory */
+	DIR* dp,		/* Directory object */
+	DWORD* hash		/* Name hash in, tag of the name in the upper 16 bits out */
+)
+{
+	DWORD k;
+
+
+	k = nc_final(*hash ^ dp->sclust * 0x9E3779B1UL);	/* Keyed by the directory */
+	*hash = k & 0xFFFF0000;
+	return dp->fs->ncache + k % (dp->fs->ncache_len / NC_WAYS) * NC_WAYS;
+}
+
+
+static
+void nc_put (
+	DIR* dp,		/* Directory object */
+	DWORD hash,		/* Name hash */
+	UINT idx		/* Index of the first entry of the object */
+)
+{
+	DWORD *b;
+	UINT i;
+
+
+	b = nc_bucket(dp, &hash);
+	hash |= idx;
+	for (i = 0; i < NC_WAYS && b[i] != hash; i++) ;
+	if (i < NC_WAYS) return;				/* Already recorded */
+	for (i = 0; i < NC_WAYS && b[i] != NC_FREE; i++) ;
+	if (i == NC_WAYS) i = idx % NC_WAYS;	/* Bucket full: replace a slot */
+	b[i] = hash;
+}
+
+
+#if !_FS_READONLY && !_FS_MINIMIZE
+static
+void nc_drop (
+	DIR* dp,		/* Directory object */
+	DWORD hash,		/* Name hash */
+	UINT idx		/* Index of the first entry of the object */
+)
+{
+	DWORD *b;
+	UINT i;
+
+
+	b = nc_bucket(dp, &hash);
+	for (i = 0; i < NC_WAYS; i++) {
+		if (b[i] == (hash | idx)) b[i] = NC_FREE;
+	}
+}
+#endif
+#endif /* _FS_NAMECACHE */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Find an object in the directory                  */
 /*-----------------------------------------------------------------------*/
 
 static
-FRESULT dir_find (
-	DIR* dp			/* Pointer to the directory object linked to the file name */
+FRESULT dir_match (	/* FR_OK:Found, FR_NO_FILE:Not found, others:Error */
+	DIR* dp,		/* Pointer to the directory object linked to the file name */
+	UINT idx,		/* Index of the entry to start at */
+	int one			/* 0:Search up to the end of the table, 1:Check only the object at idx */
 )
 {
 	FRESULT res;
@@ -1534,8 +1829,13 @@ FRESULT dir_find (
 #if _USE_LFN
 	BYTE a, ord, sum;
 #endif
+#if _FS_NAMECACHE && _USE_LFN
+	BYTE nord = 0xFF, nsum = 0;
+	UINT nidx = 0;
+	DWORD nh = 0;
+#endif
 
-	res = dir_sdi(dp, 0);			/* Rewind directory object */
+	res = dir_sdi(dp, idx);			/* Rewind directory object */
 	if (res != FR_OK) return res;
 
 #if _USE_LFN
@@ -1551,8 +1851,24 @@ FRESULT dir_find (
 		a = dir[DIR_Attr] & AM_MASK;
 		if (c == DDEM || ((a & AM_VOL) && a != AM_LFN)) {	/* An entry without valid data */
 			ord = 0xFF; dp->lfn_idx = 0xFFFF;	/* Reset LFN sequence */
+#if _FS_NAMECACHE
+			nord = 0xFF;
+#endif
 		} else {
 			if (a == AM_LFN) {			/* An LFN entry is found */
+#if _FS_NAMECACHE
+				if (dp->fs->ncache && dp->lfn) {	/* Hash the long name as its entries go (not in SFN collision checks) */
+					if (c & LLEF) {
+						nord = c & ~LLEF; nsum = dir[LDIR_Chksum];
+						nh = 0; nidx = dp->index;
+					}
+					if ((c & ~LLEF) == nord && nsum == dir[LDIR_Chksum]) {
+						nh += nc_lfn_entry(dir); nord--;
+					} else {
+						nord = 0xFF;
+					}
+				}
+#endif
 				if (dp->lfn) {
 					if (c & LLEF) {		/* Is it start of LFN sequence? */
 						sum = dir[LDIR_Chksum];
@@ -1563,14 +1879,31 @@ FRESULT dir_find (
 					ord = (c == ord && sum == dir[LDIR_Chksum] && cmp_lfn(dp->lfn, dir)) ? ord - 1 : 0xFF;
 				}
 			} else {					/* An SFN entry is found */
+#if _FS_NAMECACHE
+				if (dp->fs->ncache && dp->lfn) {	/* Record the object under the name on the disk */
+					if (!nord && nsum == sum_sfn(dir))
+						nc_put(dp, nh, nidx);
+					else
+						nc_put(dp, nc_sfn(dir), dp->index);
+					nord = 0xFF;
+				}
+#endif
 				if (!ord && sum == sum_sfn(dir)) break;	/* LFN matched? */
 				if (!(dp->fn[NSFLAG] & NS_LOSS) && !mem_cmp(dir, dp->fn, 11)) break;	/* SFN matched? */
 				ord = 0xFF; dp->lfn_idx = 0xFFFF;	/* Reset LFN sequence */
 			}
 		}
+		if (one && (dir[DIR_Name] == DDEM || (dir[DIR_Attr] & AM_MASK) != AM_LFN)) {	/* The object at idx did not match */
+			res = FR_NO_FILE; break;
+		}
 #else		/* Non LFN configuration */
+#if _FS_NAMECACHE
+		if (dp->fs->ncache && c != DDEM && !(dir[DIR_Attr] & AM_VOL))	/* Record the object */
+			nc_put(dp, nc_sfn(dir), dp->index);
+#endif
 		if (!(dir[DIR_Attr] & AM_VOL) && !mem_cmp(dir, dp->fn, 11)) /* Is it a valid entry? */
 			break;
+		if (one) { res = FR_NO_FILE; break; }	/* The object at idx did not match */
 #endif
 		res = dir_next(dp, 0);		/* Next entry */
 	} while (res == FR_OK);
@@ -1579,6 +1912,36 @@ FRESULT dir_find (
 }
 
 
+static
+FRESULT dir_find (
+	DIR* dp			/* Pointer to the directory object linked to the file name */
+)
+{
+#if _FS_NAMECACHE
+	FRESULT res;
+	DWORD hash[2], *b;
+	UINT n = 0, k, i;
+
+
+	if (dp->fs->ncache) {		/* Check the objects the name cache gives first */
+#if _USE_LFN
+		if (dp->lfn) hash[n++] = nc_lfn(dp->lfn);
+#endif
+		if (!(dp->fn[NSFLAG] & NS_LOSS)) hash[n++] = nc_sfn(dp->fn);
+		for (k = 0; k < n; k++) {
+			b = nc_bucket(dp, &hash[k]);
+			for (i = 0; i < NC_WAYS; i++) {
+				if (b[i] == NC_FREE || (b[i] & 0xFFFF0000) != hash[k]) continue;
+				res = dir_match(dp, (WORD)b[i], 1);
+				if (res != FR_NO_FILE && res != FR_INT_ERR) return res;	/* Found or disk error (FR_INT_ERR:Index out of a shrunk table) */
+			}
+		}
+	}
+#endif
+	return dir_match(dp, 0, 0);	/* Walk the whole directory */
+}
+
+
 
 
 /*-----------------------------------------------------------------------*/
@@ -1683,6 +2046,7 @@ FRESULT dir_register (	/* FR_OK:Successful, FR_DENIED:No free entry or too many
 	res = dir_alloc(dp, nent);		/* Allocate entries */
 
 	if (res == FR_OK && --nent) {	/* Set LFN entry if needed */
+		dp->lfn_idx = dp->index - nent;	/* Top of the LFN entries */
 		res = dir_sdi(dp, dp->index - nent);
 		if (res == FR_OK) {
 			sum = sum_sfn(dp->fn);	/* Sum value of the SFN tied to the LFN */
@@ -1708,6 +2072,16 @@ FRESULT dir_register (	/* FR_OK:Successful, FR_DENIED:No free entry or too many
 			dp->dir[DIR_NTres] = dp->fn[NSFLAG] & (NS_BODY | NS_EXT);	/* Put NT flag */
 #endif
 			dp->fs->wflag = 1;
+#if _FS_NAMECACHE
+			if (dp->fs->ncache) {	/* Record the new object */
+#if _USE_LFN
+				if (sn[NSFLAG] & NS_LFN)
+					nc_put(dp, nc_lfn(dp->lfn), dp->lfn_idx);
+				else
+#endif
+					nc_put(dp, nc_sfn(dp->fn), dp->index);
+			}
+#endif
 		}
 	}
 
@@ -1730,6 +2104,9 @@ FRESULT dir_remove (	/* FR_OK: Successful, FR_DISK_ERR: A disk error */
 	FRESULT res;
 #if _USE_LFN	/* LFN configuration */
 	UINT i;
+#if _FS_NAMECACHE
+	DWORD nh = 0;
+#endif
 
 	i = dp->index;	/* SFN index */
 	res = dir_sdi(dp, (dp->lfn_idx == 0xFFFF) ? i : dp->lfn_idx);	/* Goto the SFN or top of the LFN entries */
@@ -1737,6 +2114,16 @@ FRESULT dir_remove (	/* FR_OK: Successful, FR_DISK_ERR: A disk error */
 		do {
 			res = move_window(dp->fs, dp->sect);
 			if (res != FR_OK) break;
+#if _FS_NAMECACHE
+			if (dp->fs->ncache) {	/* Forget the object under the names it can be recorded with */
+				if (dp->index < i) {
+					nh += nc_lfn_entry(dp->dir);
+				} else {
+					if (dp->lfn_idx != 0xFFFF) nc_drop(dp, nh, dp->lfn_idx);
+					nc_drop(dp, nc_sfn(dp->dir), i);
+				}
+			}
+#endif
 			mem_set(dp->dir, 0, SZ_DIRE);	/* Clear and mark the entry "deleted" */
 			*dp->dir = DDEM;
 			dp->fs->wflag = 1;
@@ -1751,6 +2138,9 @@ FRESULT dir_remove (	/* FR_OK: Successful, FR_DISK_ERR: A disk error */
 	if (res == FR_OK) {
 		res = move_window(dp->fs, dp->sect);
 		if (res == FR_OK) {
+#if _FS_NAMECACHE
+			if (dp->fs->ncache) nc_drop(dp, nc_sfn(dp->dir), dp->index);	/* Forget the object */
+#endif
 			mem_set(dp->dir, 0, SZ_DIRE);	/* Clear and mark the entry "deleted" */
 			*dp->dir = DDEM;
 			dp->fs->wflag = 1;
@@ -2399,6 +2789,9 @@ FRESULT find_volume (	/* FR_OK(0): successful, !=0: any error occurred */
 #if !_FS_READONLY
 	/* Initialize cluster allocation information */
 	fs->last_clust = fs->free_clust = 0xFFFFFFFF;
+#if _FS_FREEMAP
+	fs->fmap_cnt = 0;	/* Free cluster bitmap is built again */
+#endif
 
 	/* Get fsinfo if available */
 	fs->fsi_flag = 0x80;
@@ -2421,9 +2814,16 @@ FRESULT find_volume (	/* FR_OK(0): successful, !=0: any error occurred */
 		}
 	}
 #endif
+#endif
+#if _FS_CACHE_FAT
+	br[0] = fs->fatbase; br[1] = fasize;	/* Tell the sector cache in diskio.c where the FAT area is */
+	disk_ioctl(fs->drv, CTRL_CACHE_FAT, br);
 #endif
 	fs->fs_type = fmt;	/* FAT sub-type */
 	fs->id = ++Fsid;	/* File system mount ID */
+#if _FS_NAMECACHE
+	if (fs->ncache) nc_clear(fs);	/* Name cache is filled again */
+#endif
 #if _FS_RPATH
 	fs->cdir = 0;		/* Set current directory to root */
 #endif
@@ -2500,6 +2900,12 @@ FRESULT f_mount (
 
 	if (fs) {
 		fs->fs_type = 0;				/* Clear new fs object */
+#if _FS_FREEMAP && !_FS_READONLY
+		fs->fmap = 0;					/* No free cluster bitmap until f_freemap() */
+#endif
+#if _FS_NAMECACHE
+		fs->ncache = 0;					/* No name cache until f_namecache() */
+#endif
 #if _FS_REENTRANT						/* Create sync object for the new volume */
 		if (!ff_cre_syncobj((BYTE)vol, &fs->sobj)) return FR_INT_ERR;
 #endif
@@ -2515,6 +2921,71 @@ FRESULT f_mount (
 
 
 
+#if _FS_FREEMAP && !_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Give a Work Area to the Free Cluster Bitmap                           */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_freemap (
+	const TCHAR* path,	/* Path name of the logical drive number */
+	DWORD* map,			/* Work area of (number of clusters + 2 + 31) / 32 DWORDs (NULL:Detach) */
+	UINT len			/* Size of the work area in unit of DWORD */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	res = find_volume(&fs, &path, 0);	/* Mount the volume to know its number of clusters */
+	if (res == FR_OK) {
+		if (map && len < (fs->n_fatent + 31) / 32) {
+			res = FR_NOT_ENOUGH_CORE;
+		} else {
+			fs->fmap = map;
+			fs->fmap_len = len;
+			fs->fmap_cnt = 0;			/* Built from the FAT as the allocation goes */
+		}
+	}
+
+	LEAVE_FF(fs, res);
+}
+#endif
+
+
+
+#if _FS_NAMECACHE
+/*-----------------------------------------------------------------------*/
+/* Give a Work Area to the Name Cache                                    */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_namecache (
+	const TCHAR* path,	/* Path name of the logical drive number */
+	DWORD* tbl,			/* Work area of at least 8 DWORDs (NULL:Detach) */
+	UINT len			/* Size of the work area in unit of DWORD */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	res = find_volume(&fs, &path, 0);
+	if (res == FR_OK) {
+		if (tbl && len < NC_WAYS) {
+			res = FR_NOT_ENOUGH_CORE;
+		} else {
+			fs->ncache = tbl;
+			fs->ncache_len = len;
+			if (tbl) nc_clear(fs);	/* Filled as the directories are searched */
+		}
+	}
+
+	LEAVE_FF(fs, res);
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Open or Create a File                                                 */
 /*-----------------------------------------------------------------------*/
@@ -2639,6 +3110,9 @@ FRESULT f_open (
 			fp->dsect = 0;
 #if _USE_FASTSEEK
 			fp->cltbl = 0;						/* Normal seek mode */
+#endif
+#if _USE_EXPAND
+			fp->ncont = 0;						/* Not known to be contiguous */
 #endif
 			fp->fs = dj.fs;	 					/* Validate file object */
 			fp->id = fp->fs->id;
@@ -2687,6 +3161,11 @@ FRESULT f_read (
 				if (fp->fptr == 0) {			/* On the top of the file? */
 					clst = fp->sclust;			/* Follow from the origin */
 				} else {						/* Middle or end of the file */
+#if _USE_EXPAND
+					if (IN_CONT(fp))
+						clst = fp->clust + 1;		/* Next cluster of the contiguous block */
+					else
+#endif
 #if _USE_FASTSEEK
 					if (fp->cltbl)
 						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
@@ -2703,6 +3182,12 @@ FRESULT f_read (
 			sect += csect;
 			cc = btr / SS(fp->fs);				/* When remaining bytes >= sector size, */
 			if (cc) {							/* Read maximum contiguous sectors directly */
+#if _USE_EXPAND
+				if (IN_CONT(fp)) {				/* Clip at end of the contiguous block */
+					if (cc > fp->ncont * fp->fs->csize - fp->fptr / SS(fp->fs))
+						cc = fp->ncont * fp->fs->csize - fp->fptr / SS(fp->fs);
+				} else
+#endif
 				if (csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
 					cc = fp->fs->csize - csect;
 				if (disk_read(fp->fs->drv, rbuff, sect, cc) != RES_OK)
@@ -2717,6 +3202,9 @@ FRESULT f_read (
 #endif
 #endif
 				rcnt = SS(fp->fs) * cc;			/* Number of bytes transferred */
+#if _USE_EXPAND
+				fp->clust += (csect + cc - 1) / fp->fs->csize;	/* Cluster of the last sector read */
+#endif
 				continue;
 			}
 #if !_FS_TINY
@@ -2790,6 +3278,11 @@ FRESULT f_write (
 					if (clst == 0)			/* When no cluster is allocated, */
 						clst = create_chain(fp->fs, 0);	/* Create a new cluster chain */
 				} else {					/* Middle or end of the file */
+#if _USE_EXPAND
+					if (IN_CONT(fp))
+						clst = fp->clust + 1;	/* Next cluster of the contiguous block */
+					else
+#endif
 #if _USE_FASTSEEK
 					if (fp->cltbl)
 						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
@@ -2818,6 +3311,12 @@ FRESULT f_write (
 			sect += csect;
 			cc = btw / SS(fp->fs);			/* When remaining bytes >= sector size, */
 			if (cc) {						/* Write maximum contiguous sectors directly */
+#if _USE_EXPAND
+				if (IN_CONT(fp)) {			/* Clip at end of the contiguous block */
+					if (cc > fp->ncont * fp->fs->csize - fp->fptr / SS(fp->fs))
+						cc = fp->ncont * fp->fs->csize - fp->fptr / SS(fp->fs);
+				} else
+#endif
 				if (csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
 					cc = fp->fs->csize - csect;
 				if (disk_write(fp->fs->drv, wbuff, sect, cc) != RES_OK)
@@ -2836,6 +3335,9 @@ FRESULT f_write (
 #endif
 #endif
 				wcnt = SS(fp->fs) * cc;		/* Number of bytes transferred */
+#if _USE_EXPAND
+				fp->clust += (csect + cc - 1) / fp->fs->csize;	/* Cluster of the last sector written */
+#endif
 				continue;
 			}
 #if _FS_TINY
@@ -3109,6 +3611,9 @@ FRESULT f_lseek (
 #if _USE_FASTSEEK
 	DWORD cl, pcl, ncl, tcl, dsc, tlen, ulen, *tbl;
 #endif
+#if _USE_EXPAND
+	DWORD skip;
+#endif
 
 
 	res = validate(fp);					/* Check validity of the object */
@@ -3201,6 +3706,16 @@ FRESULT f_lseek (
 				fp->clust = clst;
 			}
 			if (clst != 0) {
+#if _USE_EXPAND
+				if (fp->fptr / bcs < fp->ncont) {		/* Skip clusters in the contiguous block without the FAT */
+					skip = (ofs - 1) / bcs;
+					if (skip > fp->ncont - 1 - fp->fptr / bcs) skip = fp->ncont - 1 - fp->fptr / bcs;
+					clst += skip;
+					fp->clust = clst;
+					fp->fptr += skip * bcs;
+					ofs -= skip * bcs;
+				}
+#endif
 				while (ofs > bcs) {						/* Cluster following loop */
 #if !_FS_READONLY
 					if (fp->flag & FA_WRITE) {			/* Check if in write mode or not */
@@ -3494,7 +4009,20 @@ FRESULT f_getfree (
 		/* If free_clust is valid, return it without full cluster scan */
 		if (fs->free_clust <= fs->n_fatent - 2) {
 			*nclst = fs->free_clust;
-		} else {
+		} else
+#if _FS_FREEMAP
+		if (FMAP_OK(fs)) {
+			/* Complete the free cluster bitmap, it counts the free clusters */
+			if (!fs->fmap_cnt) {
+				fs->fmap_start = 2;
+				fs->fmap_free = 0;
+			}
+			while (res == FR_OK && fs->fmap_cnt < fs->n_fatent - 2)
+				res = fmap_extend(fs);
+			if (res == FR_OK) *nclst = fs->free_clust;
+		} else
+#endif
+		{
 			/* Get number of free clusters */
 			fat = fs->fs_type;
 			n = 0;
@@ -3575,6 +4103,10 @@ FRESULT f_truncate (
 					if (res == FR_OK) res = remove_chain(fp->fs, ncl);
 				}
 			}
+#if _USE_EXPAND
+			ncl = fp->fptr ? (fp->fptr - 1) / ((DWORD)fp->fs->csize * SS(fp->fs)) + 1 : 0;
+			if (fp->ncont > ncl) fp->ncont = ncl;	/* The contiguous block ends with the file */
+#endif
 #if !_FS_TINY
 			if (res == FR_OK && (fp->flag & FA__DIRTY)) {
 				if (disk_write(fp->fs->drv, fp->buf.d8, fp->dsect, 1) != RES_OK)
@@ -4067,6 +4599,92 @@ FRESULT f_setlabel (
 
 
 
+#if _USE_EXPAND && !_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Allocate a Contiguous Block to the File                               */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_expand (
+	FIL* fp,		/* Pointer to the file object */
+	DWORD fsz,		/* File size to be expanded to */
+	BYTE opt		/* Operation mode 0:Find and prepare or 1:Find and allocate */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD n, clst, stcl, scl, ncl, tcl, lclst = 0;
+
+
+	res = validate(fp);						/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	if (fp->err)							/* Check error */
+		LEAVE_FF(fp->fs, (FRESULT)fp->err);
+	if (fsz == 0 || fp->fsize != 0 || fp->sclust != 0 || !(fp->flag & FA_WRITE))	/* Check if an empty file in write mode */
+		LEAVE_FF(fp->fs, FR_DENIED);
+	fs = fp->fs;
+	n = (DWORD)fs->csize * SS(fs);			/* Cluster size */
+	tcl = fsz / n + ((fsz & (n - 1)) ? 1 : 0);	/* Number of clusters required */
+	stcl = fs->last_clust;
+	if (stcl < 2 || stcl >= fs->n_fatent) stcl = 2;
+
+#if _FS_FREEMAP
+	if (FMAP_OK(fs)) {						/* Search the free cluster bitmap */
+		scl = fmap_find(fs, stcl - 1, tcl);
+		if (scl == 0) res = FR_DENIED;
+		if (scl == 1) res = FR_INT_ERR;
+		if (scl == 0xFFFFFFFF) res = FR_DISK_ERR;
+	} else
+#endif
+	{										/* Find a contiguous cluster block on the FAT */
+		clst = stcl; scl = clst; ncl = 0;
+		for (;;) {
+			n = get_fat(fs, clst);
+			if (++clst >= fs->n_fatent) clst = 2;
+			if (n == 1) { res = FR_INT_ERR; break; }
+			if (n == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+			if (n == 0) {					/* Is it a free cluster? */
+				if (++ncl == tcl) break;	/* Break if a contiguous cluster block is found */
+			} else {
+				scl = clst; ncl = 0;		/* Not a free cluster */
+			}
+			if (clst == stcl) { res = FR_DENIED; break; }	/* No contiguous cluster block? */
+			if (clst == 2) { scl = 2; ncl = 0; }	/* The block cannot wrap around */
+		}
+	}
+
+	if (res == FR_OK) {						/* A contiguous free block is found */
+		if (opt) {							/* Allocate it now */
+			for (clst = scl, n = tcl; n; clst++, n--) {	/* Create a cluster chain on the FAT */
+				res = put_fat(fs, clst, (n == 1) ? 0x0FFFFFFF : clst + 1);
+				if (res != FR_OK) break;
+				lclst = clst;
+			}
+		} else {							/* Set it as suggested point for next allocation */
+			lclst = scl - 1;
+		}
+	}
+
+	if (res == FR_OK) {
+		fs->last_clust = lclst;				/* Set suggested start cluster to start next */
+		if (opt) {							/* Is it allocated now? */
+			fp->sclust = scl;				/* Update object allocation information */
+			fp->fsize = fsz;
+			fp->ncont = tcl;				/* The sectors are mapped without the FAT from now */
+			fp->flag |= FA__WRITTEN;
+			if (fs->free_clust != 0xFFFFFFFF) {	/* Update FSINFO */
+				fs->free_clust -= tcl;
+				fs->fsi_flag |= 1;
+			}
+		}
+	}
+
+	LEAVE_FF(fs, res);
+}
+#endif /* _USE_EXPAND && !_FS_READONLY */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Forward data to the stream directly (available on only tiny cfg)      */
 /*-----------------------------------------------------------------------*/
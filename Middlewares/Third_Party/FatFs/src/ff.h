@@ -29,6 +29,25 @@ extern "C" {
 #error Wrong configuration file (ffconf.h).
 #endif
 
+#ifndef _FS_CACHE_FAT		/* Sector cache in diskio.c (not in older ffconf.h) */
+#define _FS_CACHE_FAT	0
+#endif
+#ifndef _FS_CACHE_DATA
+#define _FS_CACHE_DATA	0
+#endif
+#ifndef _FS_ASYNC_SECTORS	/* Read-ahead and write-behind in diskio.c (not in older ffconf.h) */
+#define _FS_ASYNC_SECTORS	0
+#endif
+#ifndef _FS_FREEMAP			/* Free cluster bitmap (not in older ffconf.h) */
+#define _FS_FREEMAP		0
+#endif
+#ifndef _FS_NAMECACHE		/* Directory name cache (not in older ffconf.h) */
+#define _FS_NAMECACHE	0
+#endif
+#ifndef _USE_EXPAND			/* f_expand() (not in older ffconf.h) */
+#define _USE_EXPAND		0
+#endif
+
 
 
 /* Definitions of volume management */
@@ -97,6 +116,17 @@ typedef struct {
 #if !_FS_READONLY
 	DWORD	last_clust;		/* Last allocated cluster */
 	DWORD	free_clust;		/* Number of free clusters */
+#if _FS_FREEMAP
+	DWORD*	fmap;			/* Free cluster bitmap (bit=1:used) given by f_freemap() (0:none) */
+	UINT	fmap_len;		/* Size of fmap[] in unit of DWORD */
+	DWORD	fmap_start;		/* First mapped cluster */
+	DWORD	fmap_cnt;		/* Number of mapped clusters from fmap_start, wrapping around (0:not started) */
+	DWORD	fmap_free;		/* Number of free clusters in the mapped area */
+#endif
+#endif
+#if _FS_NAMECACHE
+	DWORD*	ncache;			/* Name cache slots (tag << 16 | entry index) given by f_namecache() (0:none) */
+	UINT	ncache_len;		/* Number of slots */
 #endif
 #if _FS_RPATH
 	DWORD	cdir;			/* Current directory start cluster (0:root) */
@@ -138,6 +168,9 @@ typedef struct {
 #if _USE_FASTSEEK
 	DWORD*	cltbl;			/* Pointer to the cluster link map table (Nulled on file open) */
 #endif
+#if _USE_EXPAND
+	DWORD	ncont;			/* Number of contiguous clusters from sclust given by f_expand() (Zeroed on file open) */
+#endif
 #if _FS_LOCK
 	UINT	lockid;			/* File lock ID origin from 1 (index of file semaphore table Files[]) */
 #endif
@@ -230,6 +263,7 @@ FRESULT f_write (FIL* fp, const void* buff, UINT btw, UINT* bw);	/* Write data t
 FRESULT f_forward (FIL* fp, UINT(*func)(const BYTE*,UINT), UINT btf, UINT* bf);	/* Forward data to the stream */
 FRESULT f_lseek (FIL* fp, DWORD ofs);								/* Move file pointer of a file object */
 FRESULT f_truncate (FIL* fp);										/* Truncate file */
+FRESULT f_expand (FIL* fp, DWORD fsz, BYTE opt);					/* Allocate a contiguous block to the file */
 FRESULT f_sync (FIL* fp);											/* Flush cached data of a writing file */
 FRESULT f_opendir (DIR* dp, const TCHAR* path);						/* Open a directory */
 FRESULT f_closedir (DIR* dp);										/* Close an open directory */
@@ -246,6 +280,8 @@ FRESULT f_chdir (const TCHAR* path);								/* Change current directory */
 FRESULT f_chdrive (const TCHAR* path);								/* Change current drive */
 FRESULT f_getcwd (TCHAR* buff, UINT len);							/* Get current directory */
 FRESULT f_getfree (const TCHAR* path, DWORD* nclst, FATFS** fatfs);	/* Get number of free clusters on the drive */
+FRESULT f_freemap (const TCHAR* path, DWORD* map, UINT len);		/* Give a work area to the free cluster bitmap of the volume */
+FRESULT f_namecache (const TCHAR* path, DWORD* tbl, UINT len);		/* Give a work area to the name cache of the volume */
 FRESULT f_getlabel (const TCHAR* path, TCHAR* label, DWORD* vsn);	/* Get volume label */
 FRESULT f_setlabel (const TCHAR* label);							/* Set volume label */
 FRESULT f_mount (FATFS* fs, const TCHAR* path, BYTE opt);			/* Mount/Unmount a logical drive */
@@ -39,6 +39,21 @@
 
 /* Exported types ------------------------------------------------------------*/
 
+/** 
+  * @brief  Sector transfer started with the disk_submit function of a driver
+  */ 
+typedef struct
+{
+  BYTE                    *buff;    /*!< Data buffer                               */
+  DWORD                   sector;   /*!< Sector address (LBA)                      */
+  UINT                    count;    /*!< Number of sectors                         */
+  BYTE                    write;    /*!< 0: read, 1: write                         */
+  BYTE                    pdrv;     /*!< Physical drive, set by diskio.c           */
+  __IO BYTE               done;     /*!< Set by disk_complete()                    */
+  __IO DRESULT            result;   /*!< Operation result, valid once done         */
+
+}Diskio_requestTypeDef;
+
 /** 
   * @brief  Disk IO Driver structure definition  
   */ 
@@ -53,6 +68,9 @@ typedef struct
 #if _USE_IOCTL == 1  
   DRESULT (*disk_ioctl)      (BYTE, BYTE, void*);              /*!< I/O control operation when _USE_IOCTL = 1 */
 #endif /* _USE_IOCTL == 1 */
+#if _FS_ASYNC_SECTORS > 0
+  DRESULT (*disk_submit)     (BYTE, Diskio_requestTypeDef*);   /*!< Start a transfer, NULL for a synchronous driver */
+#endif /* _FS_ASYNC_SECTORS > 0 */
 
 }Diskio_drvTypeDef;
 
@@ -77,6 +95,10 @@ uint8_t FATFS_UnLinkDriver(char *path);
 uint8_t FATFS_LinkDriverEx(Diskio_drvTypeDef *drv, char *path, BYTE lun);
 uint8_t FATFS_UnLinkDriverEx(char *path, BYTE lun);
 uint8_t FATFS_GetAttachedDriversNbr(void);
+#if _FS_ASYNC_SECTORS > 0
+void disk_complete(Diskio_requestTypeDef *req, DRESULT res);
+void disk_idle(BYTE pdrv);
+#endif /* _FS_ASYNC_SECTORS > 0 */
 
 #ifdef __cplusplus
 }
@@ -73,6 +73,14 @@
 /* This option switches fast seek feature. (0:Disable or 1:Enable) */
 
 
+#define	_USE_EXPAND             0
+/* This option switches f_expand() function. (0:Disable or 1:Enable)
+/  f_expand() allocates a contiguous block of clusters to an empty file. While
+/  the file stays open, f_read(), f_write() and f_lseek() map its sectors
+/  arithmetically without reading the FAT, and transfer the data across the
+/  cluster boundaries in a single multiple sector access. */
+
+
 #define _USE_LABEL              0
 /* This option switches volume label functions, f_getlabel() and f_setlabel().
 /  (0:Disable or 1:Enable) */
@@ -209,6 +217,52 @@
 /  disk_ioctl() function. */
 
 
+#define _FS_CACHE_FAT           0
+#define _FS_CACHE_DATA          0
+/* These options configure the sector cache of diskio.c, in number of sectors per
+/  physical drive. (0:Disabled) The cache sits between FatFs and the disk I/O
+/  drivers and keeps the most recently used sectors in two pools, one for the FAT
+/  area and one for the directory and file data, each with LRU replacement.
+/  Single sector writes are held in the cache and written back when the slot is
+/  reused or at CTRL_SYNC, i.e. on f_sync(), f_close() and every function that
+/  updates the volume. Multiple sector transfers bypass the pools.
+/  When _FS_CACHE_FAT is 0, FAT sectors are cached in the data pool. Each slot
+/  takes _MAX_SS + 12 bytes, and _MAX_SS must be equal to _MIN_SS. */
+
+
+#define _FS_ASYNC_SECTORS       0
+/* This option sets the size, in sectors, of each of the two transfer buffers
+/  diskio.c gives to a physical drive whose driver provides disk_submit, i.e.
+/  starts a transfer and reports its end with disk_complete(). (0:Disabled)
+/  Sequential reads are then read ahead and writes are written behind while the
+/  application goes on: disk_write() returns once the data is copied and the
+/  error of a deferred write is reported by the next call or by CTRL_SYNC. The
+/  drivers without disk_submit stay synchronous. It takes
+/  2 * _FS_ASYNC_SECTORS * _MAX_SS + 72 bytes of RAM per volume, and _MAX_SS
+/  must be equal to _MIN_SS. */
+
+
+#define _FS_FREEMAP             0
+/* This option switches the free cluster bitmap. (0:Disable or 1:Enable)
+/  When enabled, f_freemap() gives the volume a work area of one bit per cluster,
+/  (number of clusters + 2 + 31) / 32 DWORDs, which create_chain() searches for
+/  free clusters, and for runs of contiguous free clusters, instead of reading
+/  the FAT entry by entry. The bitmap is built incrementally from the FAT as the
+/  allocation moves forward, and the free cluster count becomes exact once the
+/  whole FAT has been mapped. It has no effect at read-only configuration. */
+
+
+#define _FS_NAMECACHE           0
+/* This option switches the directory name cache. (0:Disable or 1:Enable)
+/  When enabled, f_namecache() gives the volume a work area of DWORDs, one per
+/  cached name, where dir_find() records the index of the entries it walks past,
+/  keyed by a hash of the directory and of the name. A lookup checks the entries
+/  given by the cache first and walks the directory only on a miss. The entries
+/  found in the cache are checked against the name, and creating, removing and
+/  renaming objects update it. A work area of 2 DWORDs per entry of the largest
+/  directory keeps most of its names. */
+
+
 #define	_USE_TRIM                0
 /* This option switches ATA-TRIM feature. (0:Disable or 1:Enable)
 /  To enable Trim feature, also CTRL_TRIM command should be implemented to the
@@ -0,0 +1,2098 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Benchmarks of the kernel primitives, of the CMSIS-RTOS wrapper and of the
+ * heap implementations, run on the POSIX port so they can run on any Linux
+ * host without hardware.
+ *
+ * Each benchmark prints one CSV record per variant:
+ *   group,benchmark,variant,size,ops_per_sec,avg_ns,max_ns
+ * where avg_ns and max_ns are the time per operation, or the latency measured
+ * when the benchmark is about latency.  Lines starting with '#' are comments.
+ * Every benchmark also checks the data it moves, and the exit code is non-zero
+ * if any check failed.
+ *
+ * The figures are for the simulator, in which a context switch hands over from
+ * one host thread to another, so they are only meaningful compared with each
+ * other - the variants of a benchmark - or with earlier runs on the same host.
+ *
+ * Usage: freertos_benchmark [group [heap_trace.txt]]
+ * where group is kernel, cmsis, pool, timers, heap or all.  The heap benchmark replays the
+ * trace file if one is given, a synthetic trace otherwise.  Each line of the
+ * trace is either "a <slot> <size>", allocate size bytes and keep the pointer
+ * in slot, or "f <slot>", free the pointer kept in slot.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "event_flags.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+#include "timers.h"
+
+/* CMSIS-RTOS wrapper. */
+#include "cmsis_os.h"
+
+#include "heap_replay.h"
+
+/* Task priorities.  The control task runs the benchmarks one after the other
+and waits at the highest priority for the tasks of each one to finish. */
+#define mainCONTROL_PRIORITY		( configMAX_PRIORITIES - 1 )
+#define mainHIGH_PRIORITY			( tskIDLE_PRIORITY + 4 )
+#define mainLOW_PRIORITY			( tskIDLE_PRIORITY + 3 )
+#define mainSTACK_SIZE				( configMINIMAL_STACK_SIZE * 2 )
+
+/* Sizes of the benchmarks. */
+#define mainQUEUE_ITEMS				( 200000UL )
+#define mainQUEUE_LENGTH			( 64 )
+#define mainWAKE_SAMPLES			( 20000UL )
+#define mainSTREAM_BYTES			( 1024UL * 1024UL )
+#define mainSTREAM_CHUNK			( 16 )
+#define mainMESSAGE_BUFFER_LENGTH	( 61 )
+#define mainMESSAGE_MAX_LENGTH		( 24 )
+#define mainMESSAGE_ROUNDS			( 200000UL )
+#define mainMESSAGE_ISR_MESSAGES	( 100000UL )
+#define mainMESSAGE_TIMEOUT			( 100 )
+#define mainMAIL_MESSAGES			( 100000UL )
+#define mainMAIL_QUEUE_LENGTH		( 16 )
+#define mainPOOL_TASKS				( 4 )
+#define mainPOOL_BLOCKS				( 8 )
+#define mainPOOL_HELD				( 2 )
+#define mainPOOL_ROUNDS				( 200000UL )
+#define mainHEAP_TRACE_OPS			( 200000UL )
+#define mainHEAP_TRACE_SLOTS		( 512 )
+#define mainTIMER_ROUNDS			( 20000UL )
+#define mainTIMER_MAX_TIMERS		( 1000 )
+#define mainTIMER_ORACLE_TIMERS		( 64 )
+#define mainTIMER_ORACLE_TICKS		( 2500 )
+
+/* The timer benchmark sends this many commands, and a pended function call
+that tells the control task they were processed, at a time.  They fit in the
+timer queue, so they are all queued before the timer task runs. */
+#define mainTIMER_COMMANDS			( 7 )
+#if ( mainTIMER_COMMANDS + 1 ) > configTIMER_QUEUE_LENGTH
+	#error The timer benchmark needs a longer timer queue.
+#endif
+
+/* The simulated interrupt the stream benchmark uses as its device. */
+#define mainDEVICE_INTERRUPT		( 1UL )
+
+/* The simulated interrupt of the interrupt to task wake up benchmark. */
+#define mainSIGNAL_INTERRUPT		( 2UL )
+
+/* The simulated interrupt that allocates and frees in the pool stress test. */
+#define mainPOOL_INTERRUPT			( 3UL )
+
+/* The simulated interrupt that writes to the message buffer. */
+#define mainMESSAGE_INTERRUPT		( 4UL )
+
+/* The primitives the wake up latency benchmark goes through. */
+typedef enum
+{
+	eWakeSemaphore = 0,
+	eWakeEventGroup,
+	eWakeNotification
+} WakeKind_t;
+
+/* The primitives the interrupt to task wake up benchmark goes through. */
+typedef enum
+{
+	eIsrEventGroup = 0,
+	eIsrEventFlags,
+	eIsrNotification
+} IsrWakeKind_t;
+
+/* The payload of the mail benchmark. */
+typedef struct MAIL_MESSAGE
+{
+	uint32_t ulSequence;
+	uint32_t ulPayload[ 7 ];
+} MailMessage_t;
+
+/* A block of the pool stress test, stamped by its owner. */
+typedef struct POOL_BLOCK
+{
+	uint32_t ulOwner;
+	uint32_t ulRound;
+} PoolBlock_t;
+
+/* Time per operation, or latency, accumulated over a benchmark. */
+typedef struct LATENCY
+{
+	uint64_t ullTotal;
+	uint64_t ullMax;
+	uint32_t ulCount;
+} Latency_t;
+
+/* What the timer oracle expects of one timer. */
+typedef struct TIMER_ORACLE
+{
+	TickType_t xFirstExpiry;
+	TickType_t xPeriod;
+	UBaseType_t uxAutoReload;
+	uint32_t ulFired;
+} TimerOracle_t;
+
+/* One step of a heap trace. */
+typedef struct TRACE_OP
+{
+	uint8_t ucFree;
+	uint16_t usSlot;
+	uint32_t ulSize;
+} TraceOp_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that runs the benchmarks selected on the command line.
+ */
+static void prvControlTask( void *pvParameters );
+
+/*
+ * The benchmarks.  Each one creates the tasks it needs, waits for them to
+ * finish and prints its records.
+ */
+static void prvQueueWakeBenchmark( void );
+static void prvQueueThroughputBenchmark( UBaseType_t uxBatch );
+static void prvWakeLatencyBenchmark( WakeKind_t eKind );
+static void prvIsrWakeBenchmark( IsrWakeKind_t eKind );
+static void prvStreamBenchmark( BaseType_t xUseStreamBuffer );
+static void prvMessageBufferOracle( void );
+static void prvMailBenchmark( BaseType_t xUseMailQueue );
+static void prvMailRoundTrip( BaseType_t xUseMailQueue );
+static void prvMessageBenchmark( UBaseType_t uxBatch );
+static void prvPoolStress( void );
+static void prvHeapBenchmark( const ReplayHeap_t *pxHeap );
+static void prvTimerCommandBenchmark( UBaseType_t uxTimers );
+static void prvTimerOracle( void );
+
+/*
+ * Build the synthetic heap trace, or read the one given on the command line.
+ */
+static BaseType_t prvLoadHeapTrace( const char *pcFileName );
+
+/*
+ * Helpers to time, check and report.
+ */
+static uint64_t prvNanoseconds( void );
+static void prvLatencyAdd( Latency_t *pxLatency, uint64_t ullNanoseconds );
+static void prvCheck( BaseType_t xCondition, const char *pcWhat );
+static void prvReport( const char *pcGroup, const char *pcBenchmark, const char *pcVariant, unsigned long ulSize, unsigned long ulOperations, uint64_t ullElapsed, const Latency_t *pxLatency );
+static void prvStartWorkers( TaskFunction_t pxFirst, UBaseType_t uxFirstPriority, TaskFunction_t pxSecond, UBaseType_t uxSecondPriority, void *pvParameters );
+static void prvWorkerDone( void );
+
+/*-----------------------------------------------------------*/
+
+/* The command line. */
+static const char *pcSelectedGroup = "all";
+static const char *pcHeapTraceFile = NULL;
+
+/* Set by the benchmarks, which report through the exit code. */
+static volatile UBaseType_t uxFailures = 0;
+
+/* The control task, notified by each worker task as it finishes. */
+static TaskHandle_t xControlTask = NULL;
+
+/* Shared between the two tasks of a benchmark. */
+static QueueHandle_t xBenchQueue = NULL;
+static SemaphoreHandle_t xBenchSemaphore = NULL;
+static EventGroupHandle_t xBenchEventGroup = NULL;
+static StreamBufferHandle_t xBenchStream = NULL;
+static TaskHandle_t xBenchWaiter = NULL;
+static TaskHandle_t xBenchSignaller = NULL;
+static EventFlagsHandle_t xBenchEventFlags = NULL;
+static volatile IsrWakeKind_t eBenchIsrKind = eIsrEventGroup;
+static volatile uint32_t ulBenchIsrFailures = 0;
+static volatile uint64_t ullWakeStamp = 0;
+static Latency_t xBenchLatency;
+
+/* The state of the simulated device of the stream benchmark. */
+static volatile BaseType_t xDeviceUsesStreamBuffer = pdFALSE;
+static uint8_t ucDeviceNextByte = 0;
+static volatile uint32_t ulDeviceDropped = 0;
+
+/* The message buffer of its oracle, the next message its interrupt sends,
+and whether its reader has finished. */
+static MessageBufferHandle_t xBenchMessageBuffer = NULL;
+static volatile uint32_t ulMessageIsrSequence = 0;
+static volatile uint32_t ulMessageIsrFailures = 0;
+static volatile BaseType_t xMessageReaderDone = pdFALSE;
+
+/* The CMSIS-RTOS objects of the mail and message benchmarks. */
+osMailQDef( bench_mail, mainMAIL_QUEUE_LENGTH, MailMessage_t );
+osPoolDef( bench_pool, mainMAIL_QUEUE_LENGTH, MailMessage_t );
+osMessageQDef( bench_pointers, mainMAIL_QUEUE_LENGTH, uint32_t );
+osMessageQDef( bench_messages, mainQUEUE_LENGTH, uint32_t );
+static osMailQId xBenchMail = NULL;
+static osPoolId xBenchPool = NULL;
+static osMessageQId xBenchPointers = NULL;
+static osMessageQId xBenchMessages = NULL;
+
+/* The pool of the stress test, its blocks in address order and who owns each
+one: 0 when free, the task number (from 1) or mainPOOL_TASKS + 1 for the
+interrupt. */
+osPoolDef( stress_pool, mainPOOL_BLOCKS, PoolBlock_t );
+static osPoolId xStressPool = NULL;
+static PoolBlock_t *pxStressBlocks[ mainPOOL_BLOCKS ];
+static volatile uint32_t ulStressOwner[ mainPOOL_BLOCKS ];
+static volatile uint32_t ulStressViolations = 0;
+static PoolBlock_t *pxStressIsrBlock = NULL;
+static uint32_t ulStressIsrRound = 0;
+
+/* The timers of the timer benchmark and oracle. */
+static TimerHandle_t xBenchTimers[ mainTIMER_MAX_TIMERS ];
+static TimerOracle_t xTimerOracles[ mainTIMER_ORACLE_TIMERS ];
+static volatile uint32_t ulTimerUnexpected = 0;
+static volatile uint32_t ulTimerMistimed = 0;
+static volatile TickType_t xTimerMaxLateness = 0;
+
+/* The heap trace, and the pointers it allocates. */
+static TraceOp_t xHeapTrace[ mainHEAP_TRACE_OPS ];
+static uint32_t ulHeapTraceLength = 0;
+static void *pvHeapSlots[ mainHEAP_TRACE_SLOTS ];
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+	if( argc > 1 )
+	{
+		pcSelectedGroup = argv[ 1 ];
+	}
+
+	if( argc > 2 )
+	{
+		pcHeapTraceFile = argv[ 2 ];
+	}
+
+	printf( "# FreeRTOS %s, POSIX port, %u Hz tick\n", tskKERNEL_VERSION_NUMBER, ( unsigned ) configTICK_RATE_HZ );
+	printf( "group,benchmark,variant,size,ops_per_sec,avg_ns,max_ns\n" );
+
+	xTaskCreate( prvControlTask, "Control", mainSTACK_SIZE, NULL, mainCONTROL_PRIORITY, &xControlTask );
+
+	/* Returns when the control task ends the scheduler. */
+	vTaskStartScheduler();
+
+	printf( "# %lu check(s) failed\n", ( unsigned long ) uxFailures );
+
+	return ( uxFailures == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvGroupSelected( const char *pcGroup )
+{
+	return ( ( strcmp( pcSelectedGroup, "all" ) == 0 ) || ( strcmp( pcSelectedGroup, pcGroup ) == 0 ) ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	if( prvGroupSelected( "kernel" ) != pdFALSE )
+	{
+		prvQueueWakeBenchmark();
+		prvQueueThroughputBenchmark( 0 );
+		prvQueueThroughputBenchmark( 8 );
+		prvQueueThroughputBenchmark( 32 );
+		prvWakeLatencyBenchmark( eWakeSemaphore );
+		prvWakeLatencyBenchmark( eWakeEventGroup );
+		prvWakeLatencyBenchmark( eWakeNotification );
+		prvIsrWakeBenchmark( eIsrEventGroup );
+		prvIsrWakeBenchmark( eIsrEventFlags );
+		prvIsrWakeBenchmark( eIsrNotification );
+		prvStreamBenchmark( pdFALSE );
+		prvStreamBenchmark( pdTRUE );
+		prvMessageBufferOracle();
+	}
+
+	if( prvGroupSelected( "cmsis" ) != pdFALSE )
+	{
+		prvMailBenchmark( pdFALSE );
+		prvMailBenchmark( pdTRUE );
+		prvMailRoundTrip( pdFALSE );
+		prvMailRoundTrip( pdTRUE );
+		prvMessageBenchmark( 0 );
+		prvMessageBenchmark( 8 );
+	}
+
+	if( prvGroupSelected( "pool" ) != pdFALSE )
+	{
+		prvPoolStress();
+	}
+
+	if( prvGroupSelected( "timers" ) != pdFALSE )
+	{
+		prvTimerOracle();
+		prvTimerCommandBenchmark( 10 );
+		prvTimerCommandBenchmark( 100 );
+		prvTimerCommandBenchmark( 1000 );
+	}
+
+	if( prvGroupSelected( "heap" ) != pdFALSE )
+	{
+		if( prvLoadHeapTrace( pcHeapTraceFile ) != pdFALSE )
+		{
+			prvHeapBenchmark( &xReplayHeap4 );
+			prvHeapBenchmark( &xReplayHeap5 );
+			prvHeapBenchmark( &xReplayHeap6 );
+		}
+	}
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Queue wake up: a low priority task sends to a queue of length one that a
+ * high priority task is blocked on, so every item costs a send, a switch to
+ * the receiver, a receive and a switch back.  The latency is from just before
+ * the send to the receiver running.
+ */
+static void prvQueueWakeSender( void *pvParameters )
+{
+uint32_t ulItem;
+
+	( void ) pvParameters;
+
+	for( ulItem = 0; ulItem < mainWAKE_SAMPLES; ulItem++ )
+	{
+		ullWakeStamp = prvNanoseconds();
+		xQueueSend( xBenchQueue, &ulItem, portMAX_DELAY );
+	}
+
+	prvWorkerDone();
+}
+
+static void prvQueueWakeReceiver( void *pvParameters )
+{
+uint32_t ulItem, ulExpected;
+
+	( void ) pvParameters;
+
+	for( ulExpected = 0; ulExpected < mainWAKE_SAMPLES; ulExpected++ )
+	{
+		xQueueReceive( xBenchQueue, &ulItem, portMAX_DELAY );
+		prvLatencyAdd( &xBenchLatency, prvNanoseconds() - ullWakeStamp );
+		prvCheck( ulItem == ulExpected, "queue wake order" );
+	}
+
+	prvWorkerDone();
+}
+
+static void prvQueueWakeBenchmark( void )
+{
+uint64_t ullStart;
+
+	xBenchQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	memset( &xBenchLatency, 0, sizeof( xBenchLatency ) );
+
+	ullStart = prvNanoseconds();
+	prvStartWorkers( prvQueueWakeSender, mainLOW_PRIORITY, prvQueueWakeReceiver, mainHIGH_PRIORITY, NULL );
+
+	prvReport( "kernel", "queue", "send_to_wake", sizeof( uint32_t ), mainWAKE_SAMPLES, prvNanoseconds() - ullStart, &xBenchLatency );
+
+	vQueueDelete( xBenchQueue );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Queue throughput: a producer and a consumer of the same priority move
+ * mainQUEUE_ITEMS items through a queue, one per call or uxBatch per call
+ * with the bulk API.
+ */
+static void prvQueueProducer( void *pvParameters )
+{
+UBaseType_t uxBatch = ( UBaseType_t ) ( size_t ) pvParameters;
+uint32_t ulItems[ 32 ], ulNext = 0;
+UBaseType_t uxCount, uxSent, x;
+
+	while( ulNext < mainQUEUE_ITEMS )
+	{
+		if( uxBatch == 0 )
+		{
+			xQueueSend( xBenchQueue, &ulNext, portMAX_DELAY );
+			ulNext++;
+		}
+		else
+		{
+			uxCount = ( ( mainQUEUE_ITEMS - ulNext ) < uxBatch ) ? ( UBaseType_t ) ( mainQUEUE_ITEMS - ulNext ) : uxBatch;
+
+			for( x = 0; x < uxCount; x++ )
+			{
+				ulItems[ x ] = ulNext + ( uint32_t ) x;
+			}
+
+			/* A partial send means the queue filled up, send the rest. */
+			for( uxSent = 0; uxSent < uxCount; )
+			{
+				uxSent += xQueueSendMultiple( xBenchQueue, &( ulItems[ uxSent ] ), uxCount - uxSent, portMAX_DELAY );
+			}
+
+			ulNext += ( uint32_t ) uxCount;
+		}
+	}
+
+	prvWorkerDone();
+}
+
+static void prvQueueConsumer( void *pvParameters )
+{
+UBaseType_t uxBatch = ( UBaseType_t ) ( size_t ) pvParameters;
+uint32_t ulItems[ 32 ], ulExpected = 0;
+UBaseType_t uxReceived, x;
+BaseType_t xInOrder = pdTRUE;
+
+	while( ulExpected < mainQUEUE_ITEMS )
+	{
+		if( uxBatch == 0 )
+		{
+			xQueueReceive( xBenchQueue, &( ulItems[ 0 ] ), portMAX_DELAY );
+			uxReceived = 1;
+		}
+		else
+		{
+			uxReceived = xQueueReceiveMultiple( xBenchQueue, ulItems, uxBatch, portMAX_DELAY );
+		}
+
+		for( x = 0; x < uxReceived; x++ )
+		{
+			if( ulItems[ x ] != ulExpected++ )
+			{
+				xInOrder = pdFALSE;
+			}
+		}
+	}
+
+	prvCheck( xInOrder, "queue throughput order" );
+	prvWorkerDone();
+}
+
+static void prvQueueThroughputBenchmark( UBaseType_t uxBatch )
+{
+uint64_t ullStart, ullElapsed;
+
+	xBenchQueue = xQueueCreate( mainQUEUE_LENGTH, sizeof( uint32_t ) );
+
+	ullStart = prvNanoseconds();
+	prvStartWorkers( prvQueueProducer, mainLOW_PRIORITY, prvQueueConsumer, mainLOW_PRIORITY, ( void * ) ( size_t ) uxBatch );
+	ullElapsed = prvNanoseconds() - ullStart;
+
+	prvReport( "kernel", "queue", ( uxBatch == 0 ) ? "per_item" : "bulk", ( uxBatch == 0 ) ? 1 : uxBatch, mainQUEUE_ITEMS, ullElapsed, NULL );
+
+	vQueueDelete( xBenchQueue );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Wake up latency: a low priority task gives a semaphore, sets an event bit or
+ * sends a notification that a high priority task is waiting for.
+ */
+static void prvWakeSignaller( void *pvParameters )
+{
+WakeKind_t eKind = ( WakeKind_t ) ( size_t ) pvParameters;
+uint32_t ulSample;
+
+	for( ulSample = 0; ulSample < mainWAKE_SAMPLES; ulSample++ )
+	{
+		ullWakeStamp = prvNanoseconds();
+
+		switch( eKind )
+		{
+			case eWakeSemaphore:	xSemaphoreGive( xBenchSemaphore );
+									break;
+
+			case eWakeEventGroup:	xEventGroupSetBits( xBenchEventGroup, 0x01 );
+									break;
+
+			default:				xTaskNotifyGive( xBenchWaiter );
+									break;
+		}
+	}
+
+	prvWorkerDone();
+}
+
+static void prvWakeWaiter( void *pvParameters )
+{
+WakeKind_t eKind = ( WakeKind_t ) ( size_t ) pvParameters;
+uint32_t ulSample;
+BaseType_t xWoken = pdTRUE;
+
+	for( ulSample = 0; ulSample < mainWAKE_SAMPLES; ulSample++ )
+	{
+		switch( eKind )
+		{
+			case eWakeSemaphore:	xWoken = ( xSemaphoreTake( xBenchSemaphore, portMAX_DELAY ) == pdPASS ) ? xWoken : pdFALSE;
+									break;
+
+			case eWakeEventGroup:	xWoken = ( xEventGroupWaitBits( xBenchEventGroup, 0x01, pdTRUE, pdTRUE, portMAX_DELAY ) == 0x01 ) ? xWoken : pdFALSE;
+									break;
+
+			default:				xWoken = ( ulTaskNotifyTake( pdTRUE, portMAX_DELAY ) == 1 ) ? xWoken : pdFALSE;
+									break;
+		}
+
+		prvLatencyAdd( &xBenchLatency, prvNanoseconds() - ullWakeStamp );
+	}
+
+	prvCheck( xWoken, "wake up" );
+	prvWorkerDone();
+}
+
+static void prvWakeLatencyBenchmark( WakeKind_t eKind )
+{
+static const char * const pcBenchmarks[] = { "semaphore", "event_group", "notification" };
+uint64_t ullStart, ullElapsed;
+
+	xBenchSemaphore = xSemaphoreCreateBinary();
+	xBenchEventGroup = xEventGroupCreate();
+	memset( &xBenchLatency, 0, sizeof( xBenchLatency ) );
+
+	ullStart = prvNanoseconds();
+
+	/* The waiter is created first so the signaller knows its handle. */
+	xTaskCreate( prvWakeWaiter, "Waiter", mainSTACK_SIZE, ( void * ) ( size_t ) eKind, mainHIGH_PRIORITY, &xBenchWaiter );
+	prvStartWorkers( prvWakeSignaller, mainLOW_PRIORITY, NULL, 0, ( void * ) ( size_t ) eKind );
+	ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+
+	ullElapsed = prvNanoseconds() - ullStart;
+	prvReport( "kernel", pcBenchmarks[ eKind ], "signal_to_wake", 0, mainWAKE_SAMPLES, ullElapsed, &xBenchLatency );
+
+	vEventGroupDelete( xBenchEventGroup );
+	vSemaphoreDelete( xBenchSemaphore );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Interrupt to task wake up latency: a low priority task raises a simulated
+ * interrupt that sets an event group bit, sets an event flags bit or gives a
+ * notification, then waits for the high priority task waiting for it to
+ * acknowledge.  The latency is from the interrupt to the waiting task running.
+ * xEventGroupSetBitsFromISR() defers to the timer service task, which only
+ * runs once the low priority task blocks for the acknowledgement; the event
+ * flags and the notification wake the waiting task from the interrupt.
+ */
+static uint32_t prvSignalInterrupt( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	ullWakeStamp = prvNanoseconds();
+
+	switch( eBenchIsrKind )
+	{
+		case eIsrEventGroup:	if( xEventGroupSetBitsFromISR( xBenchEventGroup, 0x01, &xHigherPriorityTaskWoken ) != pdPASS )
+								{
+									ulBenchIsrFailures++;
+								}
+								break;
+
+		case eIsrEventFlags:	( void ) xEventFlagsSetBitsFromISR( xBenchEventFlags, 0x01, &xHigherPriorityTaskWoken );
+								break;
+
+		default:				vTaskNotifyGiveFromISR( xBenchWaiter, &xHigherPriorityTaskWoken );
+								break;
+	}
+
+	return ( uint32_t ) xHigherPriorityTaskWoken;
+}
+
+static void prvIsrSignaller( void *pvParameters )
+{
+uint32_t ulSample;
+
+	( void ) pvParameters;
+
+	xBenchSignaller = xTaskGetCurrentTaskHandle();
+
+	for( ulSample = 0; ulSample < mainWAKE_SAMPLES; ulSample++ )
+	{
+		vPortGenerateSimulatedInterrupt( mainSIGNAL_INTERRUPT );
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	}
+
+	prvWorkerDone();
+}
+
+static void prvIsrWaiter( void *pvParameters )
+{
+IsrWakeKind_t eKind = ( IsrWakeKind_t ) ( size_t ) pvParameters;
+uint32_t ulSample;
+BaseType_t xWoken = pdTRUE;
+
+	for( ulSample = 0; ulSample < mainWAKE_SAMPLES; ulSample++ )
+	{
+		switch( eKind )
+		{
+			case eIsrEventGroup:	xWoken = ( xEventGroupWaitBits( xBenchEventGroup, 0x01, pdTRUE, pdTRUE, portMAX_DELAY ) == 0x01 ) ? xWoken : pdFALSE;
+									break;
+
+			case eIsrEventFlags:	xWoken = ( xEventFlagsWaitBits( xBenchEventFlags, 0x01, pdTRUE, pdTRUE, portMAX_DELAY ) == 0x01 ) ? xWoken : pdFALSE;
+									break;
+
+			default:				xWoken = ( ulTaskNotifyTake( pdTRUE, portMAX_DELAY ) == 1 ) ? xWoken : pdFALSE;
+									break;
+		}
+
+		prvLatencyAdd( &xBenchLatency, prvNanoseconds() - ullWakeStamp );
+		xTaskNotifyGive( xBenchSignaller );
+	}
+
+	/* The bits were cleared on exit each time. */
+	if( eKind == eIsrEventGroup )
+	{
+		xWoken = ( xEventGroupGetBits( xBenchEventGroup ) == 0 ) ? xWoken : pdFALSE;
+	}
+	else if( eKind == eIsrEventFlags )
+	{
+		xWoken = ( xEventFlagsGetBits( xBenchEventFlags ) == 0 ) ? xWoken : pdFALSE;
+	}
+
+	prvCheck( xWoken, "interrupt wake up" );
+	prvWorkerDone();
+}
+
+static void prvIsrWakeBenchmark( IsrWakeKind_t eKind )
+{
+static const char * const pcVariants[] = { "event_group_deferred", "event_flags", "notification" };
+uint64_t ullStart, ullElapsed;
+
+	xBenchEventGroup = xEventGroupCreate();
+	xBenchEventFlags = xEventFlagsCreate();
+	eBenchIsrKind = eKind;
+	ulBenchIsrFailures = 0;
+	memset( &xBenchLatency, 0, sizeof( xBenchLatency ) );
+	vPortSetInterruptHandler( mainSIGNAL_INTERRUPT, prvSignalInterrupt );
+
+	ullStart = prvNanoseconds();
+
+	/* The waiter is created first so the interrupt knows its handle. */
+	xTaskCreate( prvIsrWaiter, "Waiter", mainSTACK_SIZE, ( void * ) ( size_t ) eKind, mainHIGH_PRIORITY, &xBenchWaiter );
+	prvStartWorkers( prvIsrSignaller, mainLOW_PRIORITY, NULL, 0, NULL );
+	ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+
+	ullElapsed = prvNanoseconds() - ullStart;
+	prvReport( "kernel", "isr_wake", pcVariants[ eKind ], 0, mainWAKE_SAMPLES, ullElapsed, &xBenchLatency );
+	prvCheck( ulBenchIsrFailures == 0, "timer queue had room for the deferred set bits" );
+
+	vEventFlagsDelete( xBenchEventFlags );
+	vEventGroupDelete( xBenchEventGroup );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Interrupt to task streaming: a device interrupt delivers mainSTREAM_CHUNK
+ * bytes each time it fires, to a higher priority task, either with one
+ * xStreamBufferSendFromISR() call or with one xQueueSendFromISR() call per
+ * byte.  The device is a low priority task that keeps raising the simulated
+ * interrupt.
+ */
+static uint32_t prvDeviceInterrupt( void )
+{
+uint8_t ucChunk[ mainSTREAM_CHUNK ];
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+size_t x, xSent = 0;
+
+	for( x = 0; x < mainSTREAM_CHUNK; x++ )
+	{
+		ucChunk[ x ] = ucDeviceNextByte++;
+	}
+
+	if( xDeviceUsesStreamBuffer != pdFALSE )
+	{
+		xSent = xStreamBufferSendFromISR( xBenchStream, ucChunk, sizeof( ucChunk ), &xHigherPriorityTaskWoken );
+	}
+	else
+	{
+		for( x = 0; x < mainSTREAM_CHUNK; x++ )
+		{
+			if( xQueueSendFromISR( xBenchQueue, &( ucChunk[ x ] ), &xHigherPriorityTaskWoken ) == pdPASS )
+			{
+				xSent++;
+			}
+		}
+	}
+
+	ulDeviceDropped += ( uint32_t ) ( mainSTREAM_CHUNK - xSent );
+
+	return ( uint32_t ) xHigherPriorityTaskWoken;
+}
+
+static void prvDeviceTask( void *pvParameters )
+{
+uint32_t ulBytes;
+
+	( void ) pvParameters;
+
+	for( ulBytes = 0; ulBytes < mainSTREAM_BYTES; ulBytes += mainSTREAM_CHUNK )
+	{
+		vPortGenerateSimulatedInterrupt( mainDEVICE_INTERRUPT );
+	}
+
+	prvWorkerDone();
+}
+
+static void prvStreamReader( void *pvParameters )
+{
+uint8_t ucBuffer[ 64 ], ucExpected = 0;
+uint32_t ulBytes = 0;
+size_t x, xReceived;
+BaseType_t xInOrder = pdTRUE;
+
+	( void ) pvParameters;
+
+	while( ulBytes < ( mainSTREAM_BYTES - ulDeviceDropped ) )
+	{
+		if( xDeviceUsesStreamBuffer != pdFALSE )
+		{
+			xReceived = xStreamBufferReceive( xBenchStream, ucBuffer, sizeof( ucBuffer ), portMAX_DELAY );
+		}
+		else
+		{
+			xReceived = ( xQueueReceive( xBenchQueue, &( ucBuffer[ 0 ] ), portMAX_DELAY ) == pdPASS ) ? 1 : 0;
+		}
+
+		for( x = 0; x < xReceived; x++ )
+		{
+			if( ucBuffer[ x ] != ucExpected++ )
+			{
+				xInOrder = pdFALSE;
+			}
+		}
+
+		ulBytes += ( uint32_t ) xReceived;
+	}
+
+	prvCheck( xInOrder, "stream order" );
+	prvCheck( ulDeviceDropped == 0, "stream overflow" );
+	prvWorkerDone();
+}
+
+static void prvStreamBenchmark( BaseType_t xUseStreamBuffer )
+{
+uint64_t ullStart, ullElapsed;
+
+	xBenchQueue = xQueueCreate( mainQUEUE_LENGTH, sizeof( uint8_t ) );
+	xBenchStream = xStreamBufferCreate( mainQUEUE_LENGTH, 1 );
+	xDeviceUsesStreamBuffer = xUseStreamBuffer;
+	ucDeviceNextByte = 0;
+	ulDeviceDropped = 0;
+	vPortSetInterruptHandler( mainDEVICE_INTERRUPT, prvDeviceInterrupt );
+
+	ullStart = prvNanoseconds();
+	prvStartWorkers( prvDeviceTask, mainLOW_PRIORITY, prvStreamReader, mainHIGH_PRIORITY, NULL );
+	ullElapsed = prvNanoseconds() - ullStart;
+
+	prvReport( "kernel", "isr_to_task", ( xUseStreamBuffer != pdFALSE ) ? "stream_buffer" : "queue_per_byte", mainSTREAM_CHUNK, mainSTREAM_BYTES, ullElapsed, NULL );
+
+	vStreamBufferDelete( xBenchStream );
+	vQueueDelete( xBenchQueue );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Message buffers: an oracle rather than a benchmark.  The control task sends
+ * and receives messages of random lengths against a model of the ring, so
+ * that both the length header and the payload wrap around the end of the
+ * buffer, receives into a buffer that is too small, and sends messages that
+ * can never be written.  Then a simulated interrupt writes numbered messages
+ * to a higher priority reader.
+ */
+static void prvMessageFill( uint8_t *pucMessage, size_t xLength, uint32_t ulSequence )
+{
+size_t x;
+
+	for( x = 0; x < xLength; x++ )
+	{
+		pucMessage[ x ] = ( uint8_t ) ( ( ulSequence * 7U ) + x );
+	}
+}
+
+static BaseType_t prvMessageMatches( const uint8_t *pucMessage, size_t xLength, uint32_t ulSequence )
+{
+size_t x;
+
+	for( x = 0; x < xLength; x++ )
+	{
+		if( pucMessage[ x ] != ( uint8_t ) ( ( ulSequence * 7U ) + x ) )
+		{
+			return pdFALSE;
+		}
+	}
+
+	return pdTRUE;
+}
+
+/* The length of the message of a sequence number, in the interrupt test. */
+#define prvMessageIsrLength( ulSequence )	( ( size_t ) 1 + ( ( ulSequence ) % mainMESSAGE_MAX_LENGTH ) )
+
+static uint32_t prvMessageInterrupt( void )
+{
+uint8_t ucMessage[ mainMESSAGE_MAX_LENGTH ];
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+size_t xLength, xSent;
+
+	xLength = prvMessageIsrLength( ulMessageIsrSequence );
+	prvMessageFill( ucMessage, xLength, ulMessageIsrSequence );
+	xSent = xMessageBufferSendFromISR( xBenchMessageBuffer, ucMessage, xLength, &xHigherPriorityTaskWoken );
+
+	/* A message that does not fit is sent again the next time. */
+	if( xSent == xLength )
+	{
+		ulMessageIsrSequence++;
+	}
+	else if( xSent != 0 )
+	{
+		ulMessageIsrFailures++;
+	}
+
+	return ( uint32_t ) xHigherPriorityTaskWoken;
+}
+
+static void prvMessageWriterTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	/* The reader gives up if the messages stop, so must the writer. */
+	while( ( ulMessageIsrSequence < mainMESSAGE_ISR_MESSAGES ) && ( xMessageReaderDone == pdFALSE ) )
+	{
+		vPortGenerateSimulatedInterrupt( mainMESSAGE_INTERRUPT );
+	}
+
+	prvWorkerDone();
+}
+
+static void prvMessageReaderTask( void *pvParameters )
+{
+uint8_t ucMessage[ mainMESSAGE_MAX_LENGTH ];
+uint32_t ulSequence;
+size_t xReceived;
+BaseType_t xInOrder = pdTRUE;
+
+	( void ) pvParameters;
+
+	for( ulSequence = 0; ulSequence < mainMESSAGE_ISR_MESSAGES; ulSequence++ )
+	{
+		xReceived = xMessageBufferReceive( xBenchMessageBuffer, ucMessage, sizeof( ucMessage ), mainMESSAGE_TIMEOUT );
+
+		if( ( xReceived != prvMessageIsrLength( ulSequence ) ) || ( prvMessageMatches( ucMessage, xReceived, ulSequence ) == pdFALSE ) )
+		{
+			xInOrder = pdFALSE;
+
+			if( xReceived == 0 )
+			{
+				break;
+			}
+		}
+	}
+
+	xMessageReaderDone = pdTRUE;
+	prvCheck( xInOrder, "message buffer messages from an interrupt" );
+	prvWorkerDone();
+}
+
+static void prvMessageBufferOracle( void )
+{
+uint8_t ucOut[ mainMESSAGE_BUFFER_LENGTH ], ucIn[ mainMESSAGE_BUFFER_LENGTH ];
+size_t xQueued[ mainMESSAGE_BUFFER_LENGTH ];
+size_t xHead = 0, xUsed = 0, xLength, xReceived, xHeaderLength = sizeof( configMESSAGE_BUFFER_LENGTH_TYPE );
+const size_t xRing = mainMESSAGE_BUFFER_LENGTH + 1;
+uint32_t ulRound, ulSent = 0, ulGot = 0, ulRandom = 1;
+uint32_t ulHeaderWraps = 0, ulPayloadWraps = 0, ulTooSmall = 0;
+uint64_t ullStart, ullElapsed;
+BaseType_t xModel = pdTRUE, xKept = pdTRUE;
+
+	xBenchMessageBuffer = xMessageBufferCreate( mainMESSAGE_BUFFER_LENGTH );
+	prvCheck( xBenchMessageBuffer != NULL, "message buffer creation" );
+
+	/* The model: xHead is where the next length header goes, xUsed the bytes
+	held, and xQueued the lengths of the messages not yet received.  The ring
+	is one byte longer than the size asked for, so that all of it can be
+	used. */
+	for( ulRound = 0; ulRound < mainMESSAGE_ROUNDS; ulRound++ )
+	{
+		ulRandom = ( ulRandom * 1103515245UL ) + 12345UL;
+
+		if( ( ulRandom & 0x10000 ) != 0 )
+		{
+			xLength = 1 + ( ( ulRandom >> 17 ) % mainMESSAGE_MAX_LENGTH );
+			prvMessageFill( ucOut, xLength, ulSent );
+
+			if( xMessageBufferSend( xBenchMessageBuffer, ucOut, xLength, 0 ) != ( ( ( mainMESSAGE_BUFFER_LENGTH - xUsed ) >= ( xHeaderLength + xLength ) ) ? xLength : 0 ) )
+			{
+				xModel = pdFALSE;
+			}
+			else if( ( mainMESSAGE_BUFFER_LENGTH - xUsed ) >= ( xHeaderLength + xLength ) )
+			{
+				if( ( xHead + xHeaderLength ) > xRing )
+				{
+					ulHeaderWraps++;
+				}
+				else if( ( ( ( xHead + xHeaderLength ) % xRing ) + xLength ) > xRing )
+				{
+					ulPayloadWraps++;
+				}
+
+				xHead = ( xHead + xHeaderLength + xLength ) % xRing;
+				xUsed += xHeaderLength + xLength;
+				xQueued[ ulSent % mainMESSAGE_BUFFER_LENGTH ] = xLength;
+				ulSent++;
+			}
+		}
+		else if( ulGot == ulSent )
+		{
+			if( xMessageBufferReceive( xBenchMessageBuffer, ucIn, sizeof( ucIn ), 0 ) != 0 )
+			{
+				xModel = pdFALSE;
+			}
+		}
+		else
+		{
+			xLength = xQueued[ ulGot % mainMESSAGE_BUFFER_LENGTH ];
+
+			/* Once in eight, first into a buffer one byte too small: nothing
+			is received and the message stays queued. */
+			if( ( ( ulRandom >> 17 ) & 7 ) == 0 )
+			{
+				ulTooSmall++;
+
+				if( ( xMessageBufferReceive( xBenchMessageBuffer, ucIn, xLength - 1, 0 ) != 0 ) ||
+					( xMessageBufferNextLengthBytes( xBenchMessageBuffer ) != xLength ) ||
+					( xMessageBufferSpaceAvailable( xBenchMessageBuffer ) != ( mainMESSAGE_BUFFER_LENGTH - xUsed ) ) )
+				{
+					xKept = pdFALSE;
+				}
+			}
+
+			xReceived = xMessageBufferReceive( xBenchMessageBuffer, ucIn, sizeof( ucIn ), 0 );
+
+			if( ( xReceived != xLength ) || ( prvMessageMatches( ucIn, xLength, ulGot ) == pdFALSE ) )
+			{
+				xModel = pdFALSE;
+			}
+
+			xUsed -= xHeaderLength + xLength;
+			ulGot++;
+		}
+
+		if( xMessageBufferSpaceAvailable( xBenchMessageBuffer ) != ( mainMESSAGE_BUFFER_LENGTH - xUsed ) )
+		{
+			xModel = pdFALSE;
+		}
+	}
+
+	printf( "# message buffer oracle: %lu messages, %lu length and %lu payload wraps, %lu receives into too small a buffer\n",
+			( unsigned long ) ulSent, ( unsigned long ) ulHeaderWraps, ( unsigned long ) ulPayloadWraps, ( unsigned long ) ulTooSmall );
+	prvCheck( xModel, "message buffer against its model" );
+	prvCheck( ( ulHeaderWraps != 0 ) && ( ulPayloadWraps != 0 ), "message buffer wraps" );
+	prvCheck( xKept && ( ulTooSmall != 0 ), "message kept by a receive into too small a buffer" );
+
+	/* Messages that can never be written fail at once, even with a timeout:
+	an empty one, into a buffer that has less room than a length header, and
+	one longer than the buffer can ever hold. */
+	prvCheck( xMessageBufferReset( xBenchMessageBuffer ) == pdPASS, "message buffer reset" );
+	xLength = mainMESSAGE_BUFFER_LENGTH - xHeaderLength - ( xHeaderLength / 2 );
+	prvCheck( xMessageBufferSend( xBenchMessageBuffer, ucOut, xLength, 0 ) == xLength, "message buffer filled" );
+
+	ullStart = prvNanoseconds();
+	xLength = xMessageBufferSend( xBenchMessageBuffer, ucOut, 0, mainMESSAGE_TIMEOUT );
+	ullElapsed = prvNanoseconds() - ullStart;
+	prvCheck( ( xLength == 0 ) && ( ullElapsed < ( mainMESSAGE_TIMEOUT * portTICK_PERIOD_MS * 500000ULL ) ), "empty message refused without blocking" );
+
+	prvCheck( xMessageBufferReset( xBenchMessageBuffer ) == pdPASS, "message buffer reset" );
+	ullStart = prvNanoseconds();
+	xLength = xMessageBufferSend( xBenchMessageBuffer, ucOut, mainMESSAGE_BUFFER_LENGTH - xHeaderLength + 1, mainMESSAGE_TIMEOUT );
+	ullElapsed = prvNanoseconds() - ullStart;
+	prvCheck( ( xLength == 0 ) && ( ullElapsed < ( mainMESSAGE_TIMEOUT * portTICK_PERIOD_MS * 500000ULL ) ), "too large message refused without blocking" );
+	prvCheck( xMessageBufferIsEmpty( xBenchMessageBuffer ) != pdFALSE, "message buffer empty after the refused sends" );
+
+	/* An interrupt writes, a higher priority task reads. */
+	ulMessageIsrSequence = 0;
+	ulMessageIsrFailures = 0;
+	xMessageReaderDone = pdFALSE;
+	vPortSetInterruptHandler( mainMESSAGE_INTERRUPT, prvMessageInterrupt );
+
+	ullStart = prvNanoseconds();
+	prvStartWorkers( prvMessageWriterTask, mainLOW_PRIORITY, prvMessageReaderTask, mainHIGH_PRIORITY, NULL );
+	ullElapsed = prvNanoseconds() - ullStart;
+
+	prvReport( "kernel", "isr_to_task", "message_buffer", mainMESSAGE_MAX_LENGTH, mainMESSAGE_ISR_MESSAGES, ullElapsed, NULL );
+	prvCheck( ulMessageIsrFailures == 0, "message buffer sends from an interrupt are whole" );
+
+	vMessageBufferDelete( xBenchMessageBuffer );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * CMSIS-RTOS mail: a producer hands messages to a higher priority consumer,
+ * either through a mail queue or the way it was done before mail queues
+ * passed pointers: a block from a memory pool whose address is sent through
+ * a message queue.
+ */
+static void prvMailProducer( void *pvParameters )
+{
+BaseType_t xUseMailQueue = ( BaseType_t ) ( size_t ) pvParameters;
+MailMessage_t *pxMessage;
+uint32_t ulSequence;
+
+	for( ulSequence = 0; ulSequence < mainMAIL_MESSAGES; ulSequence++ )
+	{
+		if( xUseMailQueue != pdFALSE )
+		{
+			pxMessage = osMailAlloc( xBenchMail, osWaitForever );
+		}
+		else
+		{
+			/* Pools cannot be waited on, so yield until a block is free. */
+			while( ( pxMessage = osPoolAlloc( xBenchPool ) ) == NULL )
+			{
+				taskYIELD();
+			}
+		}
+
+		pxMessage->ulSequence = ulSequence;
+		pxMessage->ulPayload[ 0 ] = ~ulSequence;
+
+		if( xUseMailQueue != pdFALSE )
+		{
+			osMailPut( xBenchMail, pxMessage );
+		}
+		else
+		{
+			osMessagePut( xBenchPointers, ( uint32_t ) ( size_t ) pxMessage, osWaitForever );
+		}
+	}
+
+	prvWorkerDone();
+}
+
+static void prvMailConsumer( void *pvParameters )
+{
+BaseType_t xUseMailQueue = ( BaseType_t ) ( size_t ) pvParameters;
+MailMessage_t *pxMessage;
+osEvent xEvent;
+uint32_t ulExpected;
+BaseType_t xInOrder = pdTRUE;
+
+	for( ulExpected = 0; ulExpected < mainMAIL_MESSAGES; ulExpected++ )
+	{
+		if( xUseMailQueue != pdFALSE )
+		{
+			xEvent = osMailGet( xBenchMail, osWaitForever );
+			pxMessage = xEvent.value.p;
+		}
+		else
+		{
+			xEvent = osMessageGet( xBenchPointers, osWaitForever );
+			pxMessage = ( MailMessage_t * ) ( size_t ) xEvent.value.v;
+		}
+
+		if( ( pxMessage->ulSequence != ulExpected ) || ( pxMessage->ulPayload[ 0 ] != ~ulExpected ) )
+		{
+			xInOrder = pdFALSE;
+		}
+
+		if( xUseMailQueue != pdFALSE )
+		{
+			osMailFree( xBenchMail, pxMessage );
+		}
+		else
+		{
+			osPoolFree( xBenchPool, pxMessage );
+		}
+	}
+
+	prvCheck( xInOrder, "mail order" );
+	prvWorkerDone();
+}
+
+static void prvMailBenchmark( BaseType_t xUseMailQueue )
+{
+static uint32_t ulPoolAndMessageMasks = 0;
+uint64_t ullStart, ullElapsed;
+uint32_t ulMasks;
+void *pvBlock;
+
+	if( xBenchMail == NULL )
+	{
+		xBenchMail = osMailCreate( osMailQ( bench_mail ), NULL );
+		xBenchPool = osPoolCreate( osPool( bench_pool ) );
+		xBenchPointers = osMessageCreate( osMessageQ( bench_pointers ), NULL );
+	}
+
+	/* Message queues carry 32-bit values, so the legacy path only works when
+	the heap is in the low 4GB - link with -no-pie on 64-bit hosts. */
+	pvBlock = osPoolAlloc( xBenchPool );
+	prvCheck( ( ( size_t ) pvBlock & ~( size_t ) 0xffffffffUL ) == 0, "pool address fits in a message" );
+	osPoolFree( xBenchPool, pvBlock );
+
+	ulMasks = ulPortGetInterruptMaskCount();
+	ullStart = prvNanoseconds();
+	prvStartWorkers( prvMailProducer, mainLOW_PRIORITY, prvMailConsumer, mainHIGH_PRIORITY, ( void * ) ( size_t ) xUseMailQueue );
+	ullElapsed = prvNanoseconds() - ullStart;
+	ulMasks = ulPortGetInterruptMaskCount() - ulMasks;
+
+	prvReport( "cmsis", "mail", ( xUseMailQueue != pdFALSE ) ? "mail_queue" : "pool_and_message", sizeof( MailMessage_t ), mainMAIL_MESSAGES, ullElapsed, NULL );
+	printf( "# cmsis,mail,%s: %.2f critical sections per message\n", ( xUseMailQueue != pdFALSE ) ? "mail_queue" : "pool_and_message", ( double ) ulMasks / ( double ) mainMAIL_MESSAGES );
+
+	/* The timing of the host is too noisy to compare the two, so compare the
+	number of critical sections, which on this port are the system calls.
+	The tick interrupt adds a few whichever the variant. */
+	if( xUseMailQueue != pdFALSE )
+	{
+		prvCheck( ulMasks <= ulPoolAndMessageMasks + ( mainMAIL_MESSAGES / 100U ), "mail queue at parity with pool and message" );
+	}
+	else
+	{
+		ulPoolAndMessageMasks = ulMasks;
+	}
+}
+
+/*
+ * The same hand over without a second task, so no context switch hides the
+ * cost of the primitives: allocate, put, get and free in turn.  The mail
+ * queue run ends by checking that a block is only put or freed while it is
+ * allocated.
+ */
+static void prvMailRoundTrip( BaseType_t xUseMailQueue )
+{
+uint64_t ullStart, ullElapsed;
+MailMessage_t *pxMessage;
+osEvent xEvent;
+uint32_t ulSequence;
+BaseType_t xInOrder = pdTRUE;
+
+	ullStart = prvNanoseconds();
+	for( ulSequence = 0; ulSequence < mainMAIL_MESSAGES; ulSequence++ )
+	{
+		if( xUseMailQueue != pdFALSE )
+		{
+			pxMessage = osMailAlloc( xBenchMail, 0 );
+			pxMessage->ulSequence = ulSequence;
+			osMailPut( xBenchMail, pxMessage );
+			xEvent = osMailGet( xBenchMail, 0 );
+			pxMessage = xEvent.value.p;
+		}
+		else
+		{
+			pxMessage = osPoolAlloc( xBenchPool );
+			pxMessage->ulSequence = ulSequence;
+			osMessagePut( xBenchPointers, ( uint32_t ) ( size_t ) pxMessage, 0 );
+			xEvent = osMessageGet( xBenchPointers, 0 );
+			pxMessage = ( MailMessage_t * ) ( size_t ) xEvent.value.v;
+		}
+
+		if( pxMessage->ulSequence != ulSequence )
+		{
+			xInOrder = pdFALSE;
+		}
+
+		if( xUseMailQueue != pdFALSE )
+		{
+			osMailFree( xBenchMail, pxMessage );
+		}
+		else
+		{
+			osPoolFree( xBenchPool, pxMessage );
+		}
+	}
+	ullElapsed = prvNanoseconds() - ullStart;
+
+	prvCheck( xInOrder, "mail round trip order" );
+	prvReport( "cmsis", "mail_round_trip", ( xUseMailQueue != pdFALSE ) ? "mail_queue" : "pool_and_message", sizeof( MailMessage_t ), mainMAIL_MESSAGES, ullElapsed, NULL );
+
+	if( xUseMailQueue != pdFALSE )
+	{
+		pxMessage = osMailAlloc( xBenchMail, 0 );
+		prvCheck( osMailPut( xBenchMail, pxMessage ) == osOK, "mail put" );
+		prvCheck( osMailPut( xBenchMail, pxMessage ) == osErrorValue, "mail put twice refused" );
+		prvCheck( osMailFree( xBenchMail, pxMessage ) == osErrorValue, "queued mail free refused" );
+		xEvent = osMailGet( xBenchMail, 0 );
+		prvCheck( ( xEvent.status == osEventMail ) && ( xEvent.value.p == pxMessage ), "mail got once" );
+		prvCheck( osMailGet( xBenchMail, 0 ).status == osOK, "mail queue empty" );
+		prvCheck( osMailFree( xBenchMail, pxMessage ) == osOK, "mail free" );
+		prvCheck( osMailFree( xBenchMail, pxMessage ) == osErrorValue, "mail double free refused" );
+		prvCheck( osMailPut( xBenchMail, pxMessage ) == osErrorValue, "freed mail put refused" );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * CMSIS-RTOS messages: as the queue throughput benchmark, through
+ * osMessagePut()/osMessageGet() or osMessagePutMulti()/osMessageGetMulti().
+ */
+static void prvMessageProducer( void *pvParameters )
+{
+UBaseType_t uxBatch = ( UBaseType_t ) ( size_t ) pvParameters;
+uint32_t ulItems[ 32 ], ulNext = 0, ulCount, ulSent, x;
+
+	while( ulNext < mainQUEUE_ITEMS )
+	{
+		if( uxBatch == 0 )
+		{
+			osMessagePut( xBenchMessages, ulNext, osWaitForever );
+			ulNext++;
+		}
+		else
+		{
+			ulCount = ( ( mainQUEUE_ITEMS - ulNext ) < uxBatch ) ? ( mainQUEUE_ITEMS - ulNext ) : ( uint32_t ) uxBatch;
+
+			for( x = 0; x < ulCount; x++ )
+			{
+				ulItems[ x ] = ulNext + x;
+			}
+
+			for( ulSent = 0; ulSent < ulCount; )
+			{
+				ulSent += osMessagePutMulti( xBenchMessages, &( ulItems[ ulSent ] ), ulCount - ulSent, osWaitForever );
+			}
+
+			ulNext += ulCount;
+		}
+	}
+
+	prvWorkerDone();
+}
+
+static void prvMessageConsumer( void *pvParameters )
+{
+UBaseType_t uxBatch = ( UBaseType_t ) ( size_t ) pvParameters;
+uint32_t ulItems[ 32 ], ulExpected = 0, ulReceived, x;
+osEvent xEvent;
+BaseType_t xInOrder = pdTRUE;
+
+	while( ulExpected < mainQUEUE_ITEMS )
+	{
+		if( uxBatch == 0 )
+		{
+			xEvent = osMessageGet( xBenchMessages, osWaitForever );
+			ulItems[ 0 ] = xEvent.value.v;
+			ulReceived = 1;
+		}
+		else
+		{
+			ulReceived = osMessageGetMulti( xBenchMessages, ulItems, uxBatch, osWaitForever );
+		}
+
+		for( x = 0; x < ulReceived; x++ )
+		{
+			if( ulItems[ x ] != ulExpected++ )
+			{
+				xInOrder = pdFALSE;
+			}
+		}
+	}
+
+	prvCheck( xInOrder, "message order" );
+	prvWorkerDone();
+}
+
+static void prvMessageBenchmark( UBaseType_t uxBatch )
+{
+uint64_t ullStart, ullElapsed;
+
+	if( xBenchMessages == NULL )
+	{
+		xBenchMessages = osMessageCreate( osMessageQ( bench_messages ), NULL );
+	}
+
+	ullStart = prvNanoseconds();
+	prvStartWorkers( prvMessageProducer, mainLOW_PRIORITY, prvMessageConsumer, mainLOW_PRIORITY, ( void * ) ( size_t ) uxBatch );
+	ullElapsed = prvNanoseconds() - ullStart;
+
+	prvReport( "cmsis", "message", ( uxBatch == 0 ) ? "per_item" : "multi", ( uxBatch == 0 ) ? 1 : uxBatch, mainQUEUE_ITEMS, ullElapsed, NULL );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * CMSIS-RTOS pool stress: mainPOOL_TASKS tasks of the same priority allocate
+ * and free blocks of a small pool at random, holding up to mainPOOL_HELD
+ * blocks each, while a simulated interrupt they raise does the same from
+ * handler mode.  An ownership oracle records who holds each block: a block
+ * handed out while someone holds it, or whose stamp changed while it was
+ * held, is a violation.  The tick preempts the tasks anywhere outside the
+ * critical sections of the pool.
+ */
+static int32_t prvStressIndex( const void *pvBlock )
+{
+int32_t x;
+
+	for( x = 0; x < mainPOOL_BLOCKS; x++ )
+	{
+		if( pxStressBlocks[ x ] == pvBlock )
+		{
+			return x;
+		}
+	}
+
+	return -1;
+}
+
+/* Records pxBlock as allocated by ulOwner, if nobody holds it. */
+static void prvStressTake( PoolBlock_t *pxBlock, uint32_t ulOwner, uint32_t ulRound )
+{
+int32_t lIndex = prvStressIndex( pxBlock );
+
+	if( ( lIndex < 0 ) || ( ulStressOwner[ lIndex ] != 0 ) )
+	{
+		ulStressViolations++;
+		return;
+	}
+
+	ulStressOwner[ lIndex ] = ulOwner;
+	pxBlock->ulOwner = ulOwner;
+	pxBlock->ulRound = ulRound;
+}
+
+/* Checks that ulOwner still holds pxBlock untouched, then frees it. */
+static void prvStressGive( PoolBlock_t *pxBlock, uint32_t ulOwner, uint32_t ulRound )
+{
+int32_t lIndex = prvStressIndex( pxBlock );
+
+	if( ( lIndex < 0 ) || ( ulStressOwner[ lIndex ] != ulOwner ) || ( pxBlock->ulOwner != ulOwner ) || ( pxBlock->ulRound != ulRound ) )
+	{
+		ulStressViolations++;
+		return;
+	}
+
+	ulStressOwner[ lIndex ] = 0;
+
+	if( osPoolFree( xStressPool, pxBlock ) != osOK )
+	{
+		ulStressViolations++;
+	}
+}
+
+static uint32_t prvStressInterrupt( void )
+{
+PoolBlock_t *pxBlock;
+
+	if( pxStressIsrBlock != NULL )
+	{
+		prvStressGive( pxStressIsrBlock, mainPOOL_TASKS + 1, ulStressIsrRound );
+		pxStressIsrBlock = NULL;
+	}
+	else if( ( pxBlock = osPoolAlloc( xStressPool ) ) != NULL )
+	{
+		ulStressIsrRound++;
+		prvStressTake( pxBlock, mainPOOL_TASKS + 1, ulStressIsrRound );
+		pxStressIsrBlock = pxBlock;
+	}
+
+	return ( uint32_t ) pdFALSE;
+}
+
+static void prvStressTask( void *pvParameters )
+{
+uint32_t ulOwner = ( uint32_t ) ( size_t ) pvParameters;
+PoolBlock_t *pxHeld[ mainPOOL_HELD ], *pxBlock;
+uint32_t ulRounds[ mainPOOL_HELD ];
+uint32_t ulHeld = 0, ulRound, ulRandom = ulOwner, x;
+
+	for( ulRound = 1; ulRound <= mainPOOL_ROUNDS; ulRound++ )
+	{
+		ulRandom = ( ulRandom * 1103515245UL ) + 12345UL;
+
+		if( ( ulHeld < mainPOOL_HELD ) && ( ( ulHeld == 0 ) || ( ( ulRandom & 0x100 ) != 0 ) ) )
+		{
+			if( ( pxBlock = osPoolAlloc( xStressPool ) ) != NULL )
+			{
+				prvStressTake( pxBlock, ulOwner, ulRound );
+				pxHeld[ ulHeld ] = pxBlock;
+				ulRounds[ ulHeld ] = ulRound;
+				ulHeld++;
+			}
+		}
+		else
+		{
+			/* Free a random one of the held blocks. */
+			x = ( ulRandom >> 9 ) % ulHeld;
+			prvStressGive( pxHeld[ x ], ulOwner, ulRounds[ x ] );
+			ulHeld--;
+			pxHeld[ x ] = pxHeld[ ulHeld ];
+			ulRounds[ x ] = ulRounds[ ulHeld ];
+		}
+
+		if( ( ulRandom & 0x3000 ) == 0 )
+		{
+			vPortGenerateSimulatedInterrupt( mainPOOL_INTERRUPT );
+		}
+		else if( ( ulRandom & 0x3000 ) == 0x1000 )
+		{
+			taskYIELD();
+		}
+	}
+
+	while( ulHeld > 0 )
+	{
+		ulHeld--;
+		prvStressGive( pxHeld[ ulHeld ], ulOwner, ulRounds[ ulHeld ] );
+	}
+
+	prvWorkerDone();
+}
+
+static void prvPoolStress( void )
+{
+osPoolStats_t xStats;
+PoolBlock_t *pxBlock;
+uint64_t ullStart, ullElapsed;
+uint32_t x, ulWorkers = 0;
+BaseType_t xDistinct = pdTRUE;
+
+	if( xStressPool == NULL )
+	{
+		xStressPool = osPoolCreate( osPool( stress_pool ) );
+	}
+
+	/* Learn the address of every block. */
+	for( x = 0; x < mainPOOL_BLOCKS; x++ )
+	{
+		pxStressBlocks[ x ] = osPoolAlloc( xStressPool );
+		ulStressOwner[ x ] = 0;
+	}
+
+	for( x = 0; x < mainPOOL_BLOCKS; x++ )
+	{
+		osPoolFree( xStressPool, pxStressBlocks[ x ] );
+	}
+
+	ulStressViolations = 0;
+	pxStressIsrBlock = NULL;
+	vPortSetInterruptHandler( mainPOOL_INTERRUPT, prvStressInterrupt );
+
+	ullStart = prvNanoseconds();
+
+	/* The workers only start when this task blocks below. */
+	for( x = 1; x <= mainPOOL_TASKS; x++ )
+	{
+		if( xTaskCreate( prvStressTask, "Stress", mainSTACK_SIZE, ( void * ) ( size_t ) x, mainLOW_PRIORITY, NULL ) == pdPASS )
+		{
+			ulWorkers++;
+		}
+	}
+
+	prvCheck( ulWorkers == mainPOOL_TASKS, "worker creation" );
+
+	while( ulWorkers > 0 )
+	{
+		ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+		ulWorkers--;
+	}
+
+	ullElapsed = prvNanoseconds() - ullStart;
+
+	/* The interrupt frees the block it may still hold when raised once more. */
+	if( pxStressIsrBlock != NULL )
+	{
+		vPortGenerateSimulatedInterrupt( mainPOOL_INTERRUPT );
+	}
+
+	prvReport( "pool", "stress", "tasks_and_isr", mainPOOL_TASKS, mainPOOL_TASKS * mainPOOL_ROUNDS, ullElapsed, NULL );
+	prvCheck( ulStressViolations == 0, "pool block ownership" );
+
+	osPoolGetStats( xStressPool, &xStats );
+	prvCheck( ( xStats.used == 0 ) && ( xStats.max_used == mainPOOL_BLOCKS ), "pool statistics after the stress" );
+
+	/* The free list holds every block exactly once. */
+	for( x = 0; x < mainPOOL_BLOCKS; x++ )
+	{
+		pxBlock = osPoolAlloc( xStressPool );
+
+		if( ( prvStressIndex( pxBlock ) < 0 ) || ( ulStressOwner[ prvStressIndex( pxBlock ) ] != 0 ) )
+		{
+			xDistinct = pdFALSE;
+		}
+		else
+		{
+			ulStressOwner[ prvStressIndex( pxBlock ) ] = 1;
+		}
+	}
+
+	prvCheck( xDistinct && ( osPoolAlloc( xStressPool ) == NULL ), "pool free list after the stress" );
+
+	for( x = 0; x < mainPOOL_BLOCKS; x++ )
+	{
+		ulStressOwner[ x ] = 0;
+		osPoolFree( xStressPool, pxStressBlocks[ x ] );
+	}
+
+	/* A second free of the same block is refused and leaves the pool intact. */
+	pxBlock = osPoolAlloc( xStressPool );
+	prvCheck( osPoolFree( xStressPool, pxBlock ) == osOK, "pool free" );
+	prvCheck( osPoolFree( xStressPool, pxBlock ) == osErrorValue, "pool double free refused" );
+	osPoolGetStats( xStressPool, &xStats );
+	prvCheck( xStats.used == 0, "pool statistics after a double free" );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+static uint32_t ulState = 0x12345678UL;
+
+	/* A fixed linear congruential generator, so the synthetic trace is the
+	same on every host. */
+	ulState = ( ulState * 1103515245UL ) + 12345UL;
+	return ulState >> 8;
+}
+
+static BaseType_t prvLoadHeapTrace( const char *pcFileName )
+{
+FILE *pxFile;
+char cOp;
+unsigned int uiSlot;
+unsigned long ulSize;
+uint32_t ulPercent;
+BaseType_t xLive[ mainHEAP_TRACE_SLOTS ] = { pdFALSE };
+
+	ulHeapTraceLength = 0;
+
+	if( pcFileName != NULL )
+	{
+		pxFile = fopen( pcFileName, "r" );
+
+		if( pxFile == NULL )
+		{
+			printf( "# cannot open heap trace %s\n", pcFileName );
+			prvCheck( pdFALSE, "heap trace" );
+			return pdFALSE;
+		}
+
+		while( ulHeapTraceLength < mainHEAP_TRACE_OPS )
+		{
+			ulSize = 0;
+
+			if( fscanf( pxFile, " %c %u", &cOp, &uiSlot ) != 2 )
+			{
+				break;
+			}
+
+			if( ( cOp == 'a' ) && ( fscanf( pxFile, " %lu", &ulSize ) != 1 ) )
+			{
+				break;
+			}
+
+			if( uiSlot >= mainHEAP_TRACE_SLOTS )
+			{
+				continue;
+			}
+
+			xHeapTrace[ ulHeapTraceLength ].ucFree = ( cOp == 'f' ) ? 1 : 0;
+			xHeapTrace[ ulHeapTraceLength ].usSlot = ( uint16_t ) uiSlot;
+			xHeapTrace[ ulHeapTraceLength ].ulSize = ( uint32_t ) ulSize;
+			ulHeapTraceLength++;
+		}
+
+		fclose( pxFile );
+		printf( "# heap trace %s, %lu operations\n", pcFileName, ( unsigned long ) ulHeapTraceLength );
+	}
+	else
+	{
+		/* Mostly small blocks, some medium and a few large ones, freed in
+		random order, so the heap fragments the way a long running
+		application's does. */
+		while( ulHeapTraceLength < mainHEAP_TRACE_OPS )
+		{
+			uiSlot = prvRandom() % mainHEAP_TRACE_SLOTS;
+			xHeapTrace[ ulHeapTraceLength ].usSlot = ( uint16_t ) uiSlot;
+
+			if( xLive[ uiSlot ] != pdFALSE )
+			{
+				xHeapTrace[ ulHeapTraceLength ].ucFree = 1;
+				xHeapTrace[ ulHeapTraceLength ].ulSize = 0;
+				xLive[ uiSlot ] = pdFALSE;
+			}
+			else
+			{
+				ulPercent = prvRandom() % 100;
+
+				if( ulPercent < 60 )
+				{
+					ulSize = 8 + ( prvRandom() % 56 );
+				}
+				else if( ulPercent < 90 )
+				{
+					ulSize = 64 + ( prvRandom() % 448 );
+				}
+				else
+				{
+					ulSize = 512 + ( prvRandom() % 3584 );
+				}
+
+				xHeapTrace[ ulHeapTraceLength ].ucFree = 0;
+				xHeapTrace[ ulHeapTraceLength ].ulSize = ( uint32_t ) ulSize;
+				xLive[ uiSlot ] = pdTRUE;
+			}
+
+			ulHeapTraceLength++;
+		}
+
+		printf( "# synthetic heap trace, %lu operations\n", ( unsigned long ) ulHeapTraceLength );
+	}
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Heap trace replay: the trace is replayed once to warm up the heap and the
+ * host caches, then again to time every call.  Each call is timed with the
+ * tick masked, so the figures are those of the allocator alone.
+ */
+static void prvReplayHeapTrace( const ReplayHeap_t *pxHeap, Latency_t *pxMalloc, Latency_t *pxFree, uint32_t *pulFailures )
+{
+uint32_t ulOp;
+uint64_t ullStart, ullElapsed;
+const TraceOp_t *pxOp;
+void *pvBlock;
+
+	for( ulOp = 0; ulOp < ulHeapTraceLength; ulOp++ )
+	{
+		pxOp = &( xHeapTrace[ ulOp ] );
+
+		if( pxOp->ucFree != 0 )
+		{
+			if( pvHeapSlots[ pxOp->usSlot ] != NULL )
+			{
+				taskENTER_CRITICAL();
+				ullStart = prvNanoseconds();
+				pxHeap->pvFree( pvHeapSlots[ pxOp->usSlot ] );
+				ullElapsed = prvNanoseconds() - ullStart;
+				taskEXIT_CRITICAL();
+
+				pvHeapSlots[ pxOp->usSlot ] = NULL;
+				prvLatencyAdd( pxFree, ullElapsed );
+			}
+		}
+		else
+		{
+			/* A trace may reuse a slot without freeing it first. */
+			if( pvHeapSlots[ pxOp->usSlot ] != NULL )
+			{
+				pxHeap->pvFree( pvHeapSlots[ pxOp->usSlot ] );
+			}
+
+			taskENTER_CRITICAL();
+			ullStart = prvNanoseconds();
+			pvBlock = pxHeap->pvMalloc( pxOp->ulSize );
+			ullElapsed = prvNanoseconds() - ullStart;
+			taskEXIT_CRITICAL();
+
+			pvHeapSlots[ pxOp->usSlot ] = pvBlock;
+			prvLatencyAdd( pxMalloc, ullElapsed );
+
+			if( pvBlock == NULL )
+			{
+				( *pulFailures )++;
+			}
+			else
+			{
+				/* Touch the block, as the application would. */
+				memset( pvBlock, ( int ) pxOp->usSlot, pxOp->ulSize );
+			}
+		}
+	}
+
+	/* Free whatever the trace left allocated, untimed. */
+	for( ulOp = 0; ulOp < mainHEAP_TRACE_SLOTS; ulOp++ )
+	{
+		if( pvHeapSlots[ ulOp ] != NULL )
+		{
+			pxHeap->pvFree( pvHeapSlots[ ulOp ] );
+			pvHeapSlots[ ulOp ] = NULL;
+		}
+	}
+}
+
+static void prvHeapBenchmark( const ReplayHeap_t *pxHeap )
+{
+Latency_t xMalloc, xFree;
+uint32_t ulFailures = 0;
+size_t xFreeBefore;
+void *pvBlock;
+
+	if( pxHeap->pvInitialise != NULL )
+	{
+		pxHeap->pvInitialise();
+	}
+
+	/* The heaps set themselves up on the first allocation. */
+	pvBlock = pxHeap->pvMalloc( 1 );
+	pxHeap->pvFree( pvBlock );
+	xFreeBefore = pxHeap->pxGetFreeHeapSize();
+
+	memset( &xMalloc, 0, sizeof( xMalloc ) );
+	memset( &xFree, 0, sizeof( xFree ) );
+	prvReplayHeapTrace( pxHeap, &xMalloc, &xFree, &ulFailures );
+
+	memset( &xMalloc, 0, sizeof( xMalloc ) );
+	memset( &xFree, 0, sizeof( xFree ) );
+	ulFailures = 0;
+	prvReplayHeapTrace( pxHeap, &xMalloc, &xFree, &ulFailures );
+
+	prvReport( "heap", "malloc", pxHeap->pcName, configTOTAL_HEAP_SIZE, xMalloc.ulCount, xMalloc.ullTotal, &xMalloc );
+	prvReport( "heap", "free", pxHeap->pcName, configTOTAL_HEAP_SIZE, xFree.ulCount, xFree.ullTotal, &xFree );
+	printf( "# %s: %lu of %lu allocations failed\n", pxHeap->pcName, ( unsigned long ) ulFailures, ( unsigned long ) xMalloc.ulCount );
+
+	prvCheck( pxHeap->pxGetFreeHeapSize() == xFreeBefore, "heap returned to its initial size" );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Timer commands: the control task, above the timer task, queues a burst of
+ * reset, stop and start commands on random timers among the active ones, then
+ * a pended function call that notifies it once the timer task processed the
+ * burst.  The periods are long enough that no timer expires during the run,
+ * so the time per command is that of taking a timer out of the active timers
+ * and putting it back, plus a share of the switches to the timer task.
+ */
+static void prvTimerNotifyControl( void *pvParameter1, uint32_t ulParameter2 )
+{
+	( void ) pvParameter1;
+	( void ) ulParameter2;
+
+	xTaskNotifyGive( xControlTask );
+}
+
+static void prvTimerWaitForCommands( void )
+{
+	xTimerPendFunctionCall( prvTimerNotifyControl, NULL, 0, portMAX_DELAY );
+	ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+}
+
+static void prvTimerUnexpected( TimerHandle_t xTimer )
+{
+	( void ) xTimer;
+
+	ulTimerUnexpected++;
+}
+
+static void prvTimerCommandBenchmark( UBaseType_t uxTimers )
+{
+char cVariant[ 32 ];
+uint64_t ullStart, ullElapsed;
+uint32_t ulRound;
+UBaseType_t uxTimer, uxCreated = 0, uxCommand;
+TimerHandle_t xTimer;
+
+	ulTimerUnexpected = 0;
+
+	/* Periods of 30 to 60 seconds, so the timers end up in all levels of the
+	timer wheel but do not expire while the benchmark runs. */
+	for( uxTimer = 0; uxTimer < uxTimers; uxTimer++ )
+	{
+		xBenchTimers[ uxTimer ] = xTimerCreate( "Bench", pdMS_TO_TICKS( 30000UL + ( prvRandom() % 30000UL ) ), pdFALSE, NULL, prvTimerUnexpected );
+
+		if( xBenchTimers[ uxTimer ] != NULL )
+		{
+			xTimerStart( xBenchTimers[ uxTimer ], portMAX_DELAY );
+			uxCreated++;
+		}
+	}
+
+	prvCheck( uxCreated == uxTimers, "timer creation" );
+	prvTimerWaitForCommands();
+
+	ullStart = prvNanoseconds();
+
+	for( ulRound = 0; ulRound < mainTIMER_ROUNDS; ulRound++ )
+	{
+		for( uxCommand = 0; uxCommand < mainTIMER_COMMANDS - 2; uxCommand++ )
+		{
+			xTimerReset( xBenchTimers[ prvRandom() % uxCreated ], portMAX_DELAY );
+		}
+
+		xTimer = xBenchTimers[ prvRandom() % uxCreated ];
+		xTimerStop( xTimer, portMAX_DELAY );
+		xTimerStart( xTimer, portMAX_DELAY );
+
+		prvTimerWaitForCommands();
+	}
+
+	ullElapsed = prvNanoseconds() - ullStart;
+
+	snprintf( cVariant, sizeof( cVariant ), "%s_batch%u", ( configUSE_TIMER_WHEEL == 1 ) ? "wheel" : "list", ( unsigned ) configTIMER_COMMAND_BATCH_LENGTH );
+	prvReport( "timers", "command", cVariant, uxTimers, mainTIMER_ROUNDS * mainTIMER_COMMANDS, ullElapsed, NULL );
+
+	for( uxTimer = 0; uxTimer < uxCreated; uxTimer++ )
+	{
+		prvCheck( xTimerIsTimerActive( xBenchTimers[ uxTimer ] ) != pdFALSE, "timer still active" );
+		xTimerDelete( xBenchTimers[ uxTimer ], portMAX_DELAY );
+	}
+
+	prvTimerWaitForCommands();
+	prvCheck( ulTimerUnexpected == 0, "no timer expired during the command benchmark" );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Timer oracle: one shot and auto reload timers with periods from one tick to
+ * two seconds, which cross the slot boundaries of every level of the timer
+ * wheel.  Each expiry must happen at, or just after, the tick the timer was
+ * first due at plus a whole number of periods, and an auto reload timer must
+ * expire once per period however late the timer task runs, so a timer that
+ * drifted falls short of the expiries it should have had.
+ */
+static void prvTimerOracleCallback( TimerHandle_t xTimer )
+{
+TimerOracle_t *pxOracle = ( TimerOracle_t * ) pvTimerGetTimerID( xTimer );
+TickType_t xDue, xLateness;
+
+	xDue = pxOracle->xFirstExpiry + ( pxOracle->ulFired * pxOracle->xPeriod );
+	xLateness = xTaskGetTickCount() - xDue;
+
+	/* A timer that expired early shows as a huge lateness, one that drifted
+	as a lateness that grows with every expiry. */
+	if( xLateness > pdMS_TO_TICKS( 100UL ) )
+	{
+		ulTimerMistimed++;
+	}
+	else if( xLateness > xTimerMaxLateness )
+	{
+		xTimerMaxLateness = xLateness;
+	}
+
+	pxOracle->ulFired++;
+}
+
+static void prvTimerOracle( void )
+{
+UBaseType_t uxTimer;
+TimerOracle_t *pxOracle;
+TickType_t xEnd;
+uint32_t ulExpected, ulMissed;
+
+	ulTimerMistimed = 0;
+	xTimerMaxLateness = 0;
+
+	for( uxTimer = 0; uxTimer < mainTIMER_ORACLE_TIMERS; uxTimer++ )
+	{
+		pxOracle = &( xTimerOracles[ uxTimer ] );
+		pxOracle->uxAutoReload = ( ( uxTimer & 1U ) != 0U ) ? pdTRUE : pdFALSE;
+		pxOracle->ulFired = 0;
+
+		/* Short periods for the auto reload timers, so they fire many times,
+		and periods up to two seconds for the one shot timers. */
+		if( pxOracle->uxAutoReload != pdFALSE )
+		{
+			pxOracle->xPeriod = 1 + ( prvRandom() % 300 );
+		}
+		else
+		{
+			pxOracle->xPeriod = 1 + ( prvRandom() % ( mainTIMER_ORACLE_TICKS - 500 ) );
+		}
+
+		xBenchTimers[ uxTimer ] = xTimerCreate( "Oracle", pxOracle->xPeriod, pxOracle->uxAutoReload, pxOracle, prvTimerOracleCallback );
+		prvCheck( xBenchTimers[ uxTimer ] != NULL, "oracle timer creation" );
+		xTimerStart( xBenchTimers[ uxTimer ], portMAX_DELAY );
+
+		/* Let the timer task process the start before reading the expiry
+		time it computed. */
+		prvTimerWaitForCommands();
+		pxOracle->xFirstExpiry = xTimerGetExpiryTime( xBenchTimers[ uxTimer ] );
+	}
+
+	vTaskDelay( mainTIMER_ORACLE_TICKS );
+
+	/* Stop the auto reload timers, then count the expiries each timer should
+	have had up to the tick the stop was processed at. */
+	for( uxTimer = 0; uxTimer < mainTIMER_ORACLE_TIMERS; uxTimer++ )
+	{
+		xTimerStop( xBenchTimers[ uxTimer ], portMAX_DELAY );
+	}
+
+	prvTimerWaitForCommands();
+	xEnd = xTaskGetTickCount();
+
+	for( uxTimer = 0; uxTimer < mainTIMER_ORACLE_TIMERS; uxTimer++ )
+	{
+		pxOracle = &( xTimerOracles[ uxTimer ] );
+
+		if( pxOracle->uxAutoReload != pdFALSE )
+		{
+			/* The stop may be processed before the expiries that were due
+			while the timer task ran late, or while the stop was queued. */
+			ulExpected = ( uint32_t ) ( ( xEnd - pxOracle->xFirstExpiry ) / pxOracle->xPeriod ) + 1U;
+			ulMissed = 1U + ( uint32_t ) ( ( xTimerMaxLateness + 2U + pxOracle->xPeriod - 1U ) / pxOracle->xPeriod );
+			prvCheck( ( ( pxOracle->ulFired + ulMissed ) >= ulExpected ) && ( pxOracle->ulFired <= ulExpected ), "auto reload timer expiry count" );
+		}
+		else
+		{
+			prvCheck( pxOracle->ulFired == 1U, "one shot timer expired once" );
+		}
+
+		xTimerDelete( xBenchTimers[ uxTimer ], portMAX_DELAY );
+	}
+
+	prvTimerWaitForCommands();
+
+	printf( "# timer oracle: %u timers over %u ticks, latest expiry %u tick(s) late\n", ( unsigned ) mainTIMER_ORACLE_TIMERS, ( unsigned ) mainTIMER_ORACLE_TICKS, ( unsigned ) xTimerMaxLateness );
+	prvCheck( ulTimerMistimed == 0, "timer expiry times" );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNanoseconds( void )
+{
+struct timespec xNow;
+
+	clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static void prvLatencyAdd( Latency_t *pxLatency, uint64_t ullNanoseconds )
+{
+	pxLatency->ullTotal += ullNanoseconds;
+	pxLatency->ulCount++;
+
+	if( ullNanoseconds > pxLatency->ullMax )
+	{
+		pxLatency->ullMax = ullNanoseconds;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheck( BaseType_t xCondition, const char *pcWhat )
+{
+	if( xCondition == pdFALSE )
+	{
+		printf( "# FAILED: %s\n", pcWhat );
+		uxFailures++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReport( const char *pcGroup, const char *pcBenchmark, const char *pcVariant, unsigned long ulSize, unsigned long ulOperations, uint64_t ullElapsed, const Latency_t *pxLatency )
+{
+double dOpsPerSecond = 0.0, dAverage = 0.0;
+unsigned long long ullMax = 0;
+
+	if( ullElapsed != 0 )
+	{
+		dOpsPerSecond = ( double ) ulOperations * 1e9 / ( double ) ullElapsed;
+	}
+
+	/* Without a latency the average is the time per operation. */
+	if( ( pxLatency != NULL ) && ( pxLatency->ulCount != 0 ) )
+	{
+		dAverage = ( double ) pxLatency->ullTotal / ( double ) pxLatency->ulCount;
+		ullMax = ( unsigned long long ) pxLatency->ullMax;
+	}
+	else if( ulOperations != 0 )
+	{
+		dAverage = ( double ) ullElapsed / ( double ) ulOperations;
+	}
+
+	printf( "%s,%s,%s,%lu,%.0f,%.1f,%llu\n", pcGroup, pcBenchmark, pcVariant, ulSize, dOpsPerSecond, dAverage, ullMax );
+	fflush( stdout );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStartWorkers( TaskFunction_t pxFirst, UBaseType_t uxFirstPriority, TaskFunction_t pxSecond, UBaseType_t uxSecondPriority, void *pvParameters )
+{
+UBaseType_t uxWorkers = 0;
+
+	/* The workers only start when this task blocks below. */
+	if( xTaskCreate( pxFirst, "Worker1", mainSTACK_SIZE, pvParameters, uxFirstPriority, NULL ) == pdPASS )
+	{
+		uxWorkers++;
+	}
+
+	if( ( pxSecond != NULL ) && ( xTaskCreate( pxSecond, "Worker2", mainSTACK_SIZE, pvParameters, uxSecondPriority, NULL ) == pdPASS ) )
+	{
+		uxWorkers++;
+	}
+
+	prvCheck( uxWorkers == ( ( pxSecond != NULL ) ? 2U : 1U ), "worker creation" );
+
+	while( uxWorkers > 0 )
+	{
+		ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+		uxWorkers--;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWorkerDone( void )
+{
+	xTaskNotifyGive( xControlTask );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
@@ -169,10 +169,30 @@ static osPriority makeCmsisPriority (unsigned portBASE_TYPE fpriority)
 #endif
 
 
-/* Determine whether we are in thread mode or handler mode. */
+/* Determine whether we are in thread mode or handler mode. Ports that do not
+   run on a Cortex-M, such as the POSIX simulator, provide portIN_HANDLER_MODE. */
 static int inHandlerMode (void)
 {
+#ifdef portIN_HANDLER_MODE
+  return portIN_HANDLER_MODE() != pdFALSE;
+#else
   return __get_IPSR() != 0;
+#endif
+}
+
+/* Convert a CMSIS-RTOS timeout to ticks, rounding non-zero values up to one tick */
+static TickType_t millisecToTicks (uint32_t millisec)
+{
+  TickType_t ticks;
+  
+  if (millisec == osWaitForever) {
+    return portMAX_DELAY;
+  }
+  if (millisec == 0) {
+    return 0;
+  }
+  ticks = millisec / portTICK_PERIOD_MS;
+  return (ticks == 0) ? 1 : ticks;
 }
 
 /*********************** Kernel Control Functions *****************************/
@@ -903,19 +923,164 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id)
 
 #if (defined (osFeature_Pool)  &&  (osFeature_Pool != 0)) 
 
-//TODO
-//This is a primitive and inefficient wrapper around the existing FreeRTOS memory management.
-//A better implementation will have to modify heap_x.c!
-
+/* Free blocks are kept in a singly linked list threaded through their first
+ * word, so allocating and freeing take constant time. On cores with the
+ * exclusive access instructions (Cortex-M3 and up) the list head and the
+ * statistics are updated with LDREX/STREX and interrupts are never masked:
+ * any exception taken between LDREX and STREX clears the local monitor, which
+ * makes the STREX fail and the operation retry, so a block cannot be popped
+ * twice (no ABA). Other cores use a short critical section.
+ * One bit per block records whether it is allocated. osPoolFree clears it
+ * before the block goes back on the list and refuses a block whose bit is
+ * already clear, so a double free cannot link a block into the list twice. */
+
+typedef struct os_pool_block {
+  struct os_pool_block *next;
+} os_pool_block_t;
 
 typedef struct os_pool_cb {
   void *pool;
-  uint8_t *markers;
+  os_pool_block_t *free_list;           /* first free block, NULL when the pool is empty */
   uint32_t pool_sz;
   uint32_t item_sz;
-  uint32_t currentIndex;
+  uint32_t used;                        /* blocks currently allocated */
+  uint32_t max_used;                    /* high-water mark of used */
+  uint32_t alloc_fail;                  /* allocations that found the pool empty */
+  uint32_t *in_use;                     /* one bit per block, set while allocated */
 } os_pool_cb_t;
 
+#if defined (__CORTEX_M) && (__CORTEX_M >= 0x03U)
+#define osPoolExclusiveAccess   1
+#else
+#define osPoolExclusiveAccess   0
+#endif
+
+#if (osPoolExclusiveAccess == 0)
+static int poolLock (void)
+{
+  int mask = 0;
+  
+  if (inHandlerMode()) {
+    mask = portSET_INTERRUPT_MASK_FROM_ISR();
+  }
+  else {
+    vPortEnterCritical();
+  }
+  return mask;
+}
+
+static void poolUnlock (int mask)
+{
+  if (inHandlerMode()) {
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+  }
+  else {
+    vPortExitCritical();
+  }
+}
+#endif
+
+/* Takes the first block off the free list, marks it in use and updates the statistics */
+static void *poolPop (os_pool_cb_t *pool)
+{
+  os_pool_block_t *block;
+  uint32_t used;
+  uint32_t index;
+  
+#if (osPoolExclusiveAccess == 1)
+  do {
+    block = (os_pool_block_t *)__LDREXW((volatile uint32_t *)&pool->free_list);
+    if (block == NULL) {
+      __CLREX();
+      break;
+    }
+  } while (__STREXW((uint32_t)block->next, (volatile uint32_t *)&pool->free_list) != 0U);
+  
+  if (block == NULL) {
+    do {
+      used = __LDREXW((volatile uint32_t *)&pool->alloc_fail) + 1;
+    } while (__STREXW(used, (volatile uint32_t *)&pool->alloc_fail) != 0U);
+  }
+  else {
+    index = (uint32_t)((uint8_t *)block - (uint8_t *)pool->pool) / pool->item_sz;
+    do {
+      used = __LDREXW(&pool->in_use[index >> 5]) | (1UL << (index & 31U));
+    } while (__STREXW(used, &pool->in_use[index >> 5]) != 0U);
+    
+    do {
+      used = __LDREXW((volatile uint32_t *)&pool->used) + 1;
+    } while (__STREXW(used, (volatile uint32_t *)&pool->used) != 0U);
+    
+    do {
+      if (__LDREXW((volatile uint32_t *)&pool->max_used) >= used) {
+        __CLREX();
+        break;
+      }
+    } while (__STREXW(used, (volatile uint32_t *)&pool->max_used) != 0U);
+  }
+#else
+  int mask = poolLock();
+  
+  block = pool->free_list;
+  if (block == NULL) {
+    pool->alloc_fail++;
+  }
+  else {
+    pool->free_list = block->next;
+    index = (uint32_t)((uint8_t *)block - (uint8_t *)pool->pool) / pool->item_sz;
+    pool->in_use[index >> 5] |= 1UL << (index & 31U);
+    used = ++pool->used;
+    if (used > pool->max_used) {
+      pool->max_used = used;
+    }
+  }
+  
+  poolUnlock(mask);
+#endif
+  
+  return block;
+}
+
+/* Puts block number index back at the head of the free list, unless it is already free */
+static osStatus poolPush (os_pool_cb_t *pool, os_pool_block_t *block, uint32_t index)
+{
+  uint32_t bit = 1UL << (index & 31U);
+  uint32_t *word = &pool->in_use[index >> 5];
+#if (osPoolExclusiveAccess == 1)
+  uint32_t used;
+  
+  do {
+    used = __LDREXW(word);
+    if ((used & bit) == 0U) {
+      __CLREX();
+      return osErrorValue;
+    }
+  } while (__STREXW(used & ~bit, word) != 0U);
+  
+  do {
+    block->next = (os_pool_block_t *)__LDREXW((volatile uint32_t *)&pool->free_list);
+  } while (__STREXW((uint32_t)block, (volatile uint32_t *)&pool->free_list) != 0U);
+  
+  do {
+    used = __LDREXW((volatile uint32_t *)&pool->used) - 1;
+  } while (__STREXW(used, (volatile uint32_t *)&pool->used) != 0U);
+#else
+  int mask = poolLock();
+  
+  if ((*word & bit) == 0U) {
+    poolUnlock(mask);
+    return osErrorValue;
+  }
+  *word &= ~bit;
+  block->next = pool->free_list;
+  pool->free_list = block;
+  pool->used--;
+  
+  poolUnlock(mask);
+#endif
+  
+  return osOK;
+}
 
 /**
 * @brief Create and Initialize a memory pool
@@ -927,44 +1092,50 @@ osPoolId osPoolCreate (const osPoolDef_t *pool_def)
 {
 #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
   osPoolId thePool;
-  int itemSize = 4 * ((pool_def->item_sz + 3) / 4);
+  /* Blocks are pointer aligned and hold at least the free-list link */
+  uint32_t itemSize = sizeof(os_pool_block_t) *
+                      ((pool_def->item_sz + sizeof(os_pool_block_t) - 1) / sizeof(os_pool_block_t));
+  uint32_t words = (pool_def->pool_sz + 31) / 32;
   uint32_t i;
+  os_pool_block_t *block;
   
-  /* First have to allocate memory for the pool control block. */
- thePool = pvPortMalloc(sizeof(os_pool_cb_t));
-
+  if ((pool_def->pool_sz == 0) || (itemSize == 0)) {
+    return NULL;
+  }
+  
+  /* First have to allocate memory for the pool control block, followed by the in-use bits. */
+  thePool = pvPortMalloc(sizeof(os_pool_cb_t) + (words * sizeof(uint32_t)));
   
   if (thePool) {
     thePool->pool_sz = pool_def->pool_sz;
     thePool->item_sz = itemSize;
-    thePool->currentIndex = 0;
+    thePool->used = 0;
+    thePool->max_used = 0;
+    thePool->alloc_fail = 0;
+    thePool->in_use = (uint32_t *)(thePool + 1);
+    memset(thePool->in_use, 0, words * sizeof(uint32_t));
     
-    /* Memory for markers */
-    thePool->markers = pvPortMalloc(pool_def->pool_sz);
-   
-    if (thePool->markers) {
-      /* Now allocate the pool itself. */
-     thePool->pool = pvPortMalloc(pool_def->pool_sz * itemSize);
-      
-      if (thePool->pool) {
-        for (i = 0; i < pool_def->pool_sz; i++) {
-          thePool->markers[i] = 0;
-        }
-      }
-      else {
-        vPortFree(thePool->markers);
-        vPortFree(thePool);
-        thePool = NULL;
+    /* Now allocate the pool itself. */
+    thePool->pool = pvPortMalloc(pool_def->pool_sz * itemSize);
+    
+    if (thePool->pool) {
+      /* Chain all blocks in address order */
+      thePool->free_list = (os_pool_block_t *)thePool->pool;
+      block = thePool->free_list;
+      for (i = 1; i < pool_def->pool_sz; i++) {
+        block->next = (os_pool_block_t *)((uint8_t *)block + itemSize);
+        block = block->next;
       }
+      block->next = NULL;
     }
     else {
       vPortFree(thePool);
       thePool = NULL;
     }
   }
-
+  
   return thePool;
- 
+  
 #else
   return NULL;
 #endif
@@ -978,40 +1149,11 @@ osPoolId osPoolCreate (const osPoolDef_t *pool_def)
 */
 void *osPoolAlloc (osPoolId pool_id)
 {
-  int dummy = 0;
-  void *p = NULL;
-  uint32_t i;
-  uint32_t index;
-  
-  if (inHandlerMode()) {
-    dummy = portSET_INTERRUPT_MASK_FROM_ISR();
-  }
-  else {
-    vPortEnterCritical();
-  }
-  
-  for (i = 0; i < pool_id->pool_sz; i++) {
-    index = pool_id->currentIndex + i;
-    if (index >= pool_id->pool_sz) {
-      index = 0;
-    }
-    
-    if (pool_id->markers[index] == 0) {
-      pool_id->markers[index] = 1;
-      p = (void *)((uint32_t)(pool_id->pool) + (index * pool_id->item_sz));
-      pool_id->currentIndex = index;
-      break;
-    }
-  }
-  
-  if (inHandlerMode()) {
-    portCLEAR_INTERRUPT_MASK_FROM_ISR(dummy);
-  }
-  else {
-    vPortExitCritical();
+  if (pool_id == NULL) {
+    return NULL;
   }
   
-  return p;
+  return poolPop(pool_id);
 }
 
 /**
@@ -1026,7 +1168,7 @@ void *osPoolCAlloc (osPoolId pool_id)
   
   if (p != NULL)
   {
-    memset(p, 0, sizeof(pool_id->pool_sz));
+    memset(p, 0, pool_id->item_sz);
   }
   
   return p;
@@ -1036,7 +1178,8 @@ void *osPoolCAlloc (osPoolId pool_id)
 * @brief Return an allocated memory block back to a specific memory pool
 * @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
 * @param  block         address of the allocated memory block that is returned to the memory pool.
-* @retval  status code that indicates the execution status of the function.
+* @retval  status code that indicates the execution status of the function,
+*          \ref osErrorValue if the block is not allocated (freed twice).
 * @note   MUST REMAIN UNCHANGED: \b osPoolFree shall be consistent in every CMSIS-RTOS.
 */
 osStatus osPoolFree (osPoolId pool_id, void *block)
@@ -1051,11 +1194,11 @@ osStatus osPoolFree (osPoolId pool_id, void *block)
     return osErrorParameter;
   }
   
-  if (block < pool_id->pool) {
+  if ((uint8_t *)block < (uint8_t *)pool_id->pool) {
     return osErrorParameter;
   }
   
-  index = (uint32_t)block - (uint32_t)(pool_id->pool);
+  index = (uint32_t)((uint8_t *)block - (uint8_t *)pool_id->pool);
   if (index % pool_id->item_sz) {
     return osErrorParameter;
   }
@@ -1064,7 +1207,25 @@ osStatus osPoolFree (osPoolId pool_id, void *block)
     return osErrorParameter;
   }
   
-  pool_id->markers[index] = 0;
+  return poolPush(pool_id, (os_pool_block_t *)block, index);
+}
+
+/**
+* @brief  Get the usage statistics of a memory pool.
+* @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
+* @param  stats         structure that receives the statistics.
+* @retval  status code that indicates the execution status of the function.
+*/
+osStatus osPoolGetStats (osPoolId pool_id, osPoolStats_t *stats)
+{
+  if ((pool_id == NULL) || (stats == NULL)) {
+    return osErrorParameter;
+  }
+  
+  stats->pool_sz = pool_id->pool_sz;
+  stats->used = pool_id->used;
+  stats->max_used = pool_id->max_used;
+  stats->alloc_fail = pool_id->alloc_fail;
   
   return osOK;
 }
@@ -1197,13 +1358,175 @@ osEvent osMessageGet (osMessageQId queue_id, uint32_t millisec)
 /********************   Mail Queue Management Functions  ***********************/
 #if (defined (osFeature_MailQ)  &&  (osFeature_MailQ != 0))  /* Use Mail Queues */
 
+/* Each mail block starts with a header that links it into the list of free
+   blocks kept in the control block. Alloc pops a block and free pushes one,
+   each in a single short critical section, and no kernel object is touched
+   unless a task waits for a free block: then the push gives the list's
+   semaphore and the waiter pops again, until the list is not empty or its
+   timeout expires. The mails that were put and not yet got are pointers in a
+   FreeRTOS queue, so that put and get are one queue operation each and a put
+   hands the mail straight to a task blocked in get. Mails are never copied.
+   The header also records the state of the block, so that putting or freeing
+   a block that is not allocated is refused. */
+
+#define osMailBlockFree       0U     /* on the free list */
+#define osMailBlockAllocated  1U     /* owned by a task or an ISR */
+#define osMailBlockReady      2U     /* in the queue of mails put */
+
+typedef struct os_mail_block {
+  struct os_mail_block *next;         /* next block of the same list */
+  uint32_t state;                     /* osMailBlockFree, osMailBlockAllocated or osMailBlockReady */
+} os_mail_block_t;
+
+typedef struct os_mail_list {
+  os_mail_block_t *head;              /* block popped next */
+  os_mail_block_t *tail;              /* block pushed last */
+  uint32_t waiters;                   /* tasks waiting for a block */
+  SemaphoreHandle_t signal;           /* given by a push while waiters != 0 */
+} os_mail_list_t;
 
 typedef struct os_mailQ_cb {
   const osMailQDef_t *queue_def;
-  QueueHandle_t handle;
-  osPoolId pool;
+  os_mail_list_t free;                /* free blocks */
+  QueueHandle_t ready;                /* blocks of the mails put, oldest first */
+  uint8_t *pool;                      /* first block */
+  uint32_t item_sz;                   /* block size including the header, pointer aligned */
 } os_mailQ_cb_t;
 
+static int mailLock (void)
+{
+  int mask = 0;
+  
+  if (inHandlerMode()) {
+    mask = portSET_INTERRUPT_MASK_FROM_ISR();
+  }
+  else {
+    vPortEnterCritical();
+  }
+  return mask;
+}
+
+static void mailUnlock (int mask)
+{
+  if (inHandlerMode()) {
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+  }
+  else {
+    vPortExitCritical();
+  }
+}
+
+/* Returns the header of mail, or NULL if mail is not a block of the queue */
+static os_mail_block_t *mailBlock (os_mailQ_cb_t *queue, void *mail)
+{
+  uint32_t offset;
+  
+  if ((mail == NULL) || ((uint8_t *)mail < queue->pool + sizeof(os_mail_block_t))) {
+    return NULL;
+  }
+  
+  offset = (uint32_t)((uint8_t *)mail - sizeof(os_mail_block_t) - queue->pool);
+  if (((offset % queue->item_sz) != 0) ||
+      ((offset / queue->item_sz) >= queue->queue_def->queue_sz)) {
+    return NULL;
+  }
+  
+  return (os_mail_block_t *)mail - 1;
+}
+
+/* Pops the first block of list and marks it allocated, waiting up to ticks
+   (task context only) while the list is empty */
+static os_mail_block_t *mailPop (os_mail_list_t *list, TickType_t ticks)
+{
+  os_mail_block_t *block;
+  TimeOut_t timeout;
+  uint32_t waiting = 0;
+  uint32_t woken = 0;
+  int mask;
+  
+  for (;;) {
+    mask = mailLock();
+    if (waiting) {
+      list->waiters--;
+      waiting = 0;
+    }
+    block = list->head;
+    if (block != NULL) {
+      list->head = block->next;
+      if (list->head == NULL) {
+        list->tail = NULL;
+      }
+      block->state = osMailBlockAllocated;
+    }
+    else if (ticks != 0) {
+      list->waiters++;
+      waiting = 1;
+    }
+    mailUnlock(mask);
+    
+    if ((block != NULL) || (ticks == 0)) {
+      return block;
+    }
+    
+    /* Another waiter may take the block that was pushed, or the signal may
+       be left over from a waiter that timed out, so the list is empty again
+       after a wake up: wait for the rest of the timeout. Once it has expired
+       the loop makes a final attempt with ticks == 0 */
+    if (!woken) {
+      vTaskSetTimeOutState(&timeout);
+    }
+    else if (xTaskCheckForTimeOut(&timeout, &ticks) != pdFALSE) {
+      ticks = 0;
+      continue;
+    }
+    
+    if (xSemaphoreTake(list->signal, ticks) != pdTRUE) {
+      ticks = 0;
+    }
+    woken = 1;
+  }
+}
+
+/* Appends an allocated block to list in the given state, then wakes the
+   highest priority waiter, if any */
+static osStatus mailPush (os_mail_list_t *list, os_mail_block_t *block, uint32_t state)
+{
+  portBASE_TYPE taskWoken;
+  uint32_t waiters;
+  int mask;
+  
+  mask = mailLock();
+  if (block->state != osMailBlockAllocated) {
+    mailUnlock(mask);
+    return osErrorValue;
+  }
+  block->state = state;
+  block->next = NULL;
+  if (list->tail != NULL) {
+    list->tail->next = block;
+  }
+  else {
+    list->head = block;
+  }
+  list->tail = block;
+  waiters = list->waiters;
+  mailUnlock(mask);
+  
+  /* A full semaphore already wakes every waiter */
+  if (waiters != 0) {
+    if (inHandlerMode()) {
+      taskWoken = pdFALSE;
+      xSemaphoreGiveFromISR(list->signal, &taskWoken);
+      portEND_SWITCHING_ISR(taskWoken);
+    }
+    else {
+      xSemaphoreGive(list->signal);
+    }
+  }
+  
+  return osOK;
+}
+
 /**
 * @brief Create and Initialize mail queue
 * @param  queue_def     reference to the mail queue definition obtain with \ref osMailQ
@@ -1213,39 +1536,64 @@ typedef struct os_mailQ_cb {
 */
 osMailQId osMailCreate (const osMailQDef_t *queue_def, osThreadId thread_id)
 {
-#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
-  (void) thread_id;
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1) && (configUSE_COUNTING_SEMAPHORES == 1)
+  os_mailQ_cb_t *cb;
+  os_mail_block_t *block;
+  uint32_t item_sz;
+  uint32_t i;
   
-  osPoolDef_t pool_def = {queue_def->queue_sz, queue_def->item_sz, NULL};
+  (void) thread_id;
   
-  /* Create a mail queue control block */
-
-  *(queue_def->cb) = pvPortMalloc(sizeof(struct os_mailQ_cb));
-
-  if (*(queue_def->cb) == NULL) {
+  if ((queue_def->queue_sz == 0) || (queue_def->item_sz == 0)) {
     return NULL;
   }
-  (*(queue_def->cb))->queue_def = queue_def;
   
-  /* Create a queue in FreeRTOS */
-  (*(queue_def->cb))->handle = xQueueCreate(queue_def->queue_sz, sizeof(void *));
-
-
-  if ((*(queue_def->cb))->handle == NULL) {
-    vPortFree(*(queue_def->cb));
+  item_sz = sizeof(os_mail_block_t) +
+            ((queue_def->item_sz + sizeof(void *) - 1) & ~(uint32_t)(sizeof(void *) - 1));
+  
+  /* Control block and mail blocks share one allocation */
+  cb = pvPortMalloc(sizeof(os_mailQ_cb_t) + queue_def->queue_sz * item_sz);
+  if (cb == NULL) {
     return NULL;
   }
+  memset(cb, 0, sizeof(os_mailQ_cb_t));
+  cb->queue_def = queue_def;
+  cb->pool = (uint8_t *)(cb + 1);
+  cb->item_sz = item_sz;
   
-  /* Create a mail pool */
-  (*(queue_def->cb))->pool = osPoolCreate(&pool_def);
-  if ((*(queue_def->cb))->pool == NULL) {
-    //TODO: Delete queue. How to do it in FreeRTOS?
-    vPortFree(*(queue_def->cb));
+  cb->free.signal = xSemaphoreCreateCounting(queue_def->queue_sz, 0);
+  cb->ready = xQueueCreate(queue_def->queue_sz, sizeof(os_mail_block_t *));
+  if ((cb->free.signal == NULL) || (cb->ready == NULL)) {
+    if (cb->free.signal != NULL) {
+      vSemaphoreDelete(cb->free.signal);
+    }
+    if (cb->ready != NULL) {
+      vQueueDelete(cb->ready);
+    }
+    vPortFree(cb);
     return NULL;
   }
   
-  return *(queue_def->cb);
+  /* Chain all blocks in address order */
+  for (i = 0; i < queue_def->queue_sz; i++) {
+    block = (os_mail_block_t *)(cb->pool + i * item_sz);
+    block->next = NULL;
+    block->state = osMailBlockFree;
+    if (cb->free.tail != NULL) {
+      cb->free.tail->next = block;
+    }
+    else {
+      cb->free.head = block;
+    }
+    cb->free.tail = block;
+  }
+  
+  *(queue_def->cb) = cb;
+  
+  return cb;
 #else
+  (void) queue_def;
+  (void) thread_id;
   return NULL;
 #endif
 }
@@ -1256,20 +1604,21 @@ osMailQId osMailCreate (const osMailQDef_t *queue_def, osThreadId thread_id)
 * @param  millisec      timeout value or 0 in case of no time-out.
 * @retval pointer to memory block that can be filled with mail or NULL in case error.
 * @note   MUST REMAIN UNCHANGED: \b osMailAlloc shall be consistent in every CMSIS-RTOS.
+* @note   Blocks for up to millisec until a mail is freed when the pool is exhausted.
+*         From an ISR the timeout is ignored and the call never blocks.
 */
 void *osMailAlloc (osMailQId queue_id, uint32_t millisec)
 {
-  (void) millisec;
-  void *p;
+  os_mail_block_t *block;
   
   
   if (queue_id == NULL) {
     return NULL;
   }
   
-  p = osPoolAlloc(queue_id->pool);
+  block = mailPop(&queue_id->free, inHandlerMode() ? 0 : millisecToTicks(millisec));
   
-  return p;
+  return (block != NULL) ? (void *)(block + 1) : NULL;
 }
 
 /**
@@ -1281,13 +1630,10 @@ void *osMailAlloc (osMailQId queue_id, uint32_t millisec)
 */
 void *osMailCAlloc (osMailQId queue_id, uint32_t millisec)
 {
-  uint32_t i;
   void *p = osMailAlloc(queue_id, millisec);
   
   if (p) {
-    for (i = 0; i < queue_id->queue_def->item_sz; i++) {
-      ((uint8_t *)p)[i] = 0;
-    }
+    memset(p, 0, queue_id->queue_def->item_sz);
   }
   
   return p;
@@ -1297,30 +1643,41 @@ void *osMailCAlloc (osMailQId queue_id, uint32_t millisec)
 * @brief Put a mail to a queue
 * @param  queue_id      mail queue ID obtained with \ref osMailCreate.
 * @param  mail          memory block previously allocated with \ref osMailAlloc or \ref osMailCAlloc.
-* @retval status code that indicates the execution status of the function.
+* @retval status code that indicates the execution status of the function,
+*         \ref osErrorValue if the block is not allocated (already put or freed).
 * @note   MUST REMAIN UNCHANGED: \b osMailPut shall be consistent in every CMSIS-RTOS.
 */
 osStatus osMailPut (osMailQId queue_id, void *mail)
 {
   portBASE_TYPE taskWoken;
+  os_mail_block_t *block;
   
   
   if (queue_id == NULL) {
     return osErrorParameter;
   }
   
-  taskWoken = pdFALSE;
+  block = mailBlock(queue_id, mail);
+  if (block == NULL) {
+    return osErrorParameter;
+  }
+  
+  /* An allocated block belongs to the one task or ISR that allocated or got
+     it, which alone puts or frees it, so its state needs no critical section
+     here: the queue operation is the only one. The queue has room for every
+     block, so the send never waits */
+  if (block->state != osMailBlockAllocated) {
+    return osErrorValue;
+  }
+  block->state = osMailBlockReady;
   
   if (inHandlerMode()) {
-    if (xQueueSendFromISR(queue_id->handle, &mail, &taskWoken) != pdTRUE) {
-      return osErrorOS;
-    }
+    taskWoken = pdFALSE;
+    xQueueSendFromISR(queue_id->ready, &block, &taskWoken);
     portEND_SWITCHING_ISR(taskWoken);
   }
   else {
-    if (xQueueSend(queue_id->handle, &mail, 0) != pdTRUE) { 
-      return osErrorOS;
-    }
+    xQueueSend(queue_id->ready, &block, 0);
   }
   
   return osOK;
@@ -1337,6 +1694,7 @@ osEvent osMailGet (osMailQId queue_id, uint32_t millisec)
 {
   portBASE_TYPE taskWoken;
   TickType_t ticks;
+  os_mail_block_t *block;
   osEvent event;
   
   event.def.mail_id = queue_id;
@@ -1346,39 +1704,31 @@ osEvent osMailGet (osMailQId queue_id, uint32_t millisec)
     return event;
   }
   
-  taskWoken = pdFALSE;
-  
-  ticks = 0;
-  if (millisec == osWaitForever) {
-    ticks = portMAX_DELAY;
-  }
-  else if (millisec != 0) {
-    ticks = millisec / portTICK_PERIOD_MS;
-    if (ticks == 0) {
-      ticks = 1;
-    }
-  }
-  
   if (inHandlerMode()) {
-    if (xQueueReceiveFromISR(queue_id->handle, &event.value.p, &taskWoken) == pdTRUE) {
-      /* We have mail */
-      event.status = osEventMail;
-    }
-    else {
-      event.status = osOK;
+    ticks = 0;
+    taskWoken = pdFALSE;
+    if (xQueueReceiveFromISR(queue_id->ready, &block, &taskWoken) != pdTRUE) {
+      block = NULL;
     }
     portEND_SWITCHING_ISR(taskWoken);
   }
   else {
-    if (xQueueReceive(queue_id->handle, &event.value.p, ticks) == pdTRUE) {
-      /* We have mail */
-      event.status = osEventMail;
-    }
-    else {
-      event.status = (ticks == 0) ? osOK : osEventTimeout;
+    ticks = millisecToTicks(millisec);
+    if (xQueueReceive(queue_id->ready, &block, ticks) != pdTRUE) {
+      block = NULL;
     }
   }
   
+  if (block == NULL) {
+    event.status = (ticks == 0) ? osOK : osEventTimeout;
+    return event;
+  }
+  
+  /* We have mail, which now belongs to the caller alone */
+  block->state = osMailBlockAllocated;
+  event.value.p = block + 1;
+  event.status = osEventMail;
+  
   return event;
 }
 
@@ -1386,16 +1736,26 @@ osEvent osMailGet (osMailQId queue_id, uint32_t millisec)
 * @brief Free a memory block from a mail
 * @param  queue_id mail queue ID obtained with \ref osMailCreate.
 * @param  mail     pointer to the memory block that was obtained with \ref osMailGet.
-* @retval status code that indicates the execution status of the function.
+* @retval status code that indicates the execution status of the function,
+*         \ref osErrorValue if the block is not allocated (freed twice, or still in the queue).
 * @note   MUST REMAIN UNCHANGED: \b osMailFree shall be consistent in every CMSIS-RTOS.
+* @note   Wakes the highest priority task blocked in \ref osMailAlloc, if any.
 */
 osStatus osMailFree (osMailQId queue_id, void *mail)
 {
+  os_mail_block_t *block;
+  
+  
   if (queue_id == NULL) {
     return osErrorParameter;
   }
   
-  return osPoolFree(queue_id->pool, mail);
+  block = mailBlock(queue_id, mail);
+  if (block == NULL) {
+    return osErrorParameter;
+  }
+  
+  return mailPush(&queue_id->free, block, osMailBlockFree);
 }
 #endif  /* Use Mail Queues */
 
@@ -1676,6 +2036,66 @@ osStatus osMessageDelete (osMessageQId queue_id)
   return osOK; 
 }
 
+/**
+* @brief Put several Messages to a Queue.
+* @param  queue_id  message queue ID obtained with \ref osMessageCreate.
+* @param  info      array of count messages, each of the item size the queue was defined with.
+* @param  count     number of messages in info.
+* @param  millisec  timeout value or 0 in case of no time-out.
+* @retval number of messages put, which is less than count when the queue fills up.
+* @note   The messages are copied and waiting threads woken in one kernel call.
+*         Blocks for up to millisec only while the queue is full; from an ISR it never blocks.
+*/
+uint32_t osMessagePutMulti (osMessageQId queue_id, const void *info, uint32_t count, uint32_t millisec)
+{
+  portBASE_TYPE taskWoken = pdFALSE;
+  UBaseType_t put;
+  
+  if ((queue_id == NULL) || (info == NULL)) {
+    return 0;
+  }
+  
+  if (inHandlerMode()) {
+    put = xQueueSendMultipleFromISR(queue_id, info, count, &taskWoken);
+    portEND_SWITCHING_ISR(taskWoken);
+  }
+  else {
+    put = xQueueSendMultiple(queue_id, info, count, millisecToTicks(millisec));
+  }
+  
+  return put;
+}
+
+/**
+* @brief Get several Messages or Wait for a Message from a Queue.
+* @param  queue_id  message queue ID obtained with \ref osMessageCreate.
+* @param  info      buffer for up to count messages, each of the item size the queue was defined with.
+* @param  count     maximum number of messages to get.
+* @param  millisec  timeout value or 0 in case of no time-out.
+* @retval number of messages got, 0 when the queue stayed empty.
+* @note   Blocks for up to millisec only while the queue is empty, then returns what is queued.
+*         From an ISR it never blocks.
+*/
+uint32_t osMessageGetMulti (osMessageQId queue_id, void *info, uint32_t count, uint32_t millisec)
+{
+  portBASE_TYPE taskWoken = pdFALSE;
+  UBaseType_t got;
+  
+  if ((queue_id == NULL) || (info == NULL)) {
+    return 0;
+  }
+  
+  if (inHandlerMode()) {
+    got = xQueueReceiveMultipleFromISR(queue_id, info, count, &taskWoken);
+    portEND_SWITCHING_ISR(taskWoken);
+  }
+  else {
+    got = xQueueReceiveMultiple(queue_id, info, count, millisecToTicks(millisec));
+  }
+  
+  return got;
+}
+
 /**
 * @brief  Create and Initialize a Recursive Mutex
 * @param  mutex_def     mutex definition referenced with \ref osMutex.
@@ -1035,6 +1035,26 @@ uint32_t osMessageAvailableSpace(osMessageQId queue_id);
 */
 osStatus osMessageDelete (osMessageQId queue_id);
 
+/**
+* @brief Put several Messages to a Queue.
+* @param  queue_id  message queue ID obtained with \ref osMessageCreate.
+* @param  info      array of count messages, each of the item size the queue was defined with.
+* @param  count     number of messages in info.
+* @param  millisec  timeout value or 0 in case of no time-out.
+* @retval number of messages put, which is less than count when the queue fills up.
+*/
+uint32_t osMessagePutMulti (osMessageQId queue_id, const void *info, uint32_t count, uint32_t millisec);
+
+/**
+* @brief Get several Messages or Wait for a Message from a Queue.
+* @param  queue_id  message queue ID obtained with \ref osMessageCreate.
+* @param  info      buffer for up to count messages, each of the item size the queue was defined with.
+* @param  count     maximum number of messages to get.
+* @param  millisec  timeout value or 0 in case of no time-out.
+* @retval number of messages got, 0 when the queue stayed empty.
+*/
+uint32_t osMessageGetMulti (osMessageQId queue_id, void *info, uint32_t count, uint32_t millisec);
+
 /**
 * @brief  Create and Initialize a Recursive Mutex
 * @param  mutex_def     mutex definition referenced with \ref osMutex.
@@ -1064,6 +1084,24 @@ osStatus osRecursiveMutexWait (osMutexId mutex_id, uint32_t millisec);
 */
 uint32_t osSemaphoreGetCount(osSemaphoreId semaphore_id);
 
+#if (defined (osFeature_Pool)  &&  (osFeature_Pool != 0))
+/// Memory pool usage statistics, see \ref osPoolGetStats.
+typedef struct  {
+  uint32_t                  pool_sz;    ///< number of blocks in the pool
+  uint32_t                     used;    ///< number of blocks currently allocated
+  uint32_t                 max_used;    ///< high-water mark of used
+  uint32_t               alloc_fail;    ///< number of allocations that found the pool empty
+} osPoolStats_t;
+
+/**
+* @brief  Get the usage statistics of a memory pool.
+* @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
+* @param  stats         structure that receives the statistics.
+* @retval  status code that indicates the execution status of the function.
+*/
+osStatus osPoolGetStats (osPoolId pool_id, osPoolStats_t *stats);
+#endif
+
 #ifdef  __cplusplus
 }
 #endif
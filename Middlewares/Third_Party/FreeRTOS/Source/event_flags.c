@@ -0,0 +1,527 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_flags.h"
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to build event_flags.c
+#endif
+
+#if( ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error INCLUDE_xTaskGetCurrentTaskHandle or configUSE_MUTEXES must be set to 1 to build event_flags.c
+#endif
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Bits used in the ucFlags member of the event flags structure. */
+#define efFLAGS_WAIT_FOR_ALL_BITS			( ( uint8_t ) 1 )	/* Set if the waiting task waits for all of its bits. */
+#define efFLAGS_CLEAR_ON_EXIT				( ( uint8_t ) 2 )	/* Set if the bits of the waiting task are cleared when its condition is met. */
+#define efFLAGS_IS_STATICALLY_ALLOCATED		( ( uint8_t ) 4 )	/* Set if the event flags structure was statically allocated. */
+
+typedef struct xEVENT_FLAGS /*lint !e9058 Style convention uses tag. */
+{
+	volatile EventBits_t uxEventBits;
+	volatile TaskHandle_t xTaskWaitingForBits;	/* The task waiting for bits, or NULL if no task is waiting.  Set to NULL by the task or interrupt that meets the wait condition. */
+	EventBits_t uxBitsWaitedFor;				/* The bits the waiting task waits for. */
+	EventBits_t uxBitsOnUnblock;				/* The value of the bits when the wait condition was met, handed to the waiting task. */
+	uint8_t ucFlags;
+} EventFlags_t;
+
+/*
+ * Set bits, and if that meets the condition of the waiting task, clear its bits
+ * if it asked for them to be cleared and return its handle so it can be woken.
+ * Must be called with interrupts masked.
+ */
+static TaskHandle_t prvSetBits( EventFlags_t * const pxEventFlags, const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
+
+/*
+ * Test the bits set in uxCurrentEventBits to see if the wait condition is met,
+ * as event groups do.
+ */
+static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	EventFlagsHandle_t xEventFlagsCreate( void )
+	{
+	EventFlags_t *pxEventFlags;
+
+		pxEventFlags = ( EventFlags_t * ) pvPortMalloc( sizeof( EventFlags_t ) );
+
+		if( pxEventFlags != NULL )
+		{
+			memset( ( void * ) pxEventFlags, 0x00, sizeof( EventFlags_t ) );
+			traceEVENT_FLAGS_CREATE( pxEventFlags );
+		}
+		else
+		{
+			traceEVENT_FLAGS_CREATE_FAILED();
+		}
+
+		return ( EventFlagsHandle_t ) pxEventFlags;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	EventFlagsHandle_t xEventFlagsCreateStatic( StaticEventFlags_t *pxEventFlagsBuffer )
+	{
+	EventFlags_t *pxEventFlags = ( EventFlags_t * ) pxEventFlagsBuffer; /*lint !e740 EventFlags_t and StaticEventFlags_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+		configASSERT( pxEventFlagsBuffer );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticEventFlags_t equals the size of the real
+			event flags structure. */
+			volatile size_t xSize = sizeof( StaticEventFlags_t );
+			configASSERT( xSize == sizeof( EventFlags_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
+
+		if( pxEventFlags != NULL )
+		{
+			memset( ( void * ) pxEventFlags, 0x00, sizeof( EventFlags_t ) );
+			pxEventFlags->ucFlags = efFLAGS_IS_STATICALLY_ALLOCATED;
+			traceEVENT_FLAGS_CREATE( pxEventFlags );
+		}
+		else
+		{
+			traceEVENT_FLAGS_CREATE_FAILED();
+		}
+
+		return ( EventFlagsHandle_t ) pxEventFlags;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+EventBits_t xEventFlagsWaitBits( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToWaitFor, const BaseType_t xClearOnExit, const BaseType_t xWaitForAllBits, TickType_t xTicksToWait )
+{
+EventFlags_t * const pxEventFlags = ( EventFlags_t * ) xEventFlags;
+EventBits_t uxReturn = 0;
+BaseType_t xWaiting = pdFALSE, xDone = pdFALSE, xTimeoutOccurred = pdFALSE;
+TaskHandle_t xCurrentTask = NULL;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxEventFlags );
+	configASSERT( uxBitsToWaitFor != 0 );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	vTaskSetTimeOutState( &xTimeOut );
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( xWaiting != pdFALSE ) && ( pxEventFlags->xTaskWaitingForBits == NULL ) )
+			{
+				/* A task or interrupt met the wait condition while this task
+				was waiting, and already cleared the bits if requested. */
+				uxReturn = pxEventFlags->uxBitsOnUnblock;
+				xDone = pdTRUE;
+			}
+			else if( prvTestWaitCondition( pxEventFlags->uxEventBits, uxBitsToWaitFor, xWaitForAllBits ) != pdFALSE )
+			{
+				uxReturn = pxEventFlags->uxEventBits;
+				xDone = pdTRUE;
+
+				if( xClearOnExit != pdFALSE )
+				{
+					pxEventFlags->uxEventBits &= ~uxBitsToWaitFor;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* The wait condition was not met in time, just return the
+				current value. */
+				uxReturn = pxEventFlags->uxEventBits;
+				xTimeoutOccurred = xWaiting;
+				xDone = pdTRUE;
+			}
+			else if( xWaiting == pdFALSE )
+			{
+				/* Only one task can wait on event flags. */
+				configASSERT( pxEventFlags->xTaskWaitingForBits == NULL );
+
+				/* Store what the task waits for, so whoever sets the bits can
+				test the condition and clear the bits without this task
+				running.  Clear the notification state first, so only a
+				notification sent from now on ends the wait below. */
+				( void ) xTaskNotifyStateClear( NULL );
+				pxEventFlags->uxBitsWaitedFor = uxBitsToWaitFor;
+				pxEventFlags->ucFlags &= efFLAGS_IS_STATICALLY_ALLOCATED;
+
+				if( xWaitForAllBits != pdFALSE )
+				{
+					pxEventFlags->ucFlags |= efFLAGS_WAIT_FOR_ALL_BITS;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xClearOnExit != pdFALSE )
+				{
+					pxEventFlags->ucFlags |= efFLAGS_CLEAR_ON_EXIT;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xCurrentTask = xTaskGetCurrentTaskHandle();
+				pxEventFlags->xTaskWaitingForBits = xCurrentTask;
+				xWaiting = pdTRUE;
+			}
+			else
+			{
+				/* Woken by an unrelated notification, wait again. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* A task that returns is no longer waiting, unless a task or
+			interrupt that met its condition already took it off. */
+			if( ( xDone != pdFALSE ) && ( pxEventFlags->xTaskWaitingForBits == xCurrentTask ) )
+			{
+				pxEventFlags->xTaskWaitingForBits = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xDone != pdFALSE )
+		{
+			break;
+		}
+
+		traceEVENT_FLAGS_WAIT_BITS_BLOCK( xEventFlags, uxBitsToWaitFor );
+		( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+		{
+			xTicksToWait = ( TickType_t ) 0;
+		}
+	}
+
+	traceEVENT_FLAGS_WAIT_BITS_END( xEventFlags, uxBitsToWaitFor, xTimeoutOccurred );
+
+	/* Prevent compiler warnings when trace macros are not used. */
+	( void ) xTimeoutOccurred;
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+EventBits_t xEventFlagsSetBits( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToSet )
+{
+EventFlags_t * const pxEventFlags = ( EventFlags_t * ) xEventFlags;
+TaskHandle_t xTaskToUnblock;
+EventBits_t uxReturn;
+
+	configASSERT( pxEventFlags );
+
+	traceEVENT_FLAGS_SET_BITS( xEventFlags, uxBitsToSet );
+
+	taskENTER_CRITICAL();
+	{
+		xTaskToUnblock = prvSetBits( pxEventFlags, uxBitsToSet );
+		uxReturn = pxEventFlags->uxEventBits;
+	}
+	taskEXIT_CRITICAL();
+
+	if( xTaskToUnblock != NULL )
+	{
+		( void ) xTaskNotify( xTaskToUnblock, ( uint32_t ) 0, eNoAction );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+EventBits_t xEventFlagsSetBitsFromISR( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
+{
+EventFlags_t * const pxEventFlags = ( EventFlags_t * ) xEventFlags;
+TaskHandle_t xTaskToUnblock;
+EventBits_t uxReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxEventFlags );
+
+	traceEVENT_FLAGS_SET_BITS_FROM_ISR( xEventFlags, uxBitsToSet );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		xTaskToUnblock = prvSetBits( pxEventFlags, uxBitsToSet );
+		uxReturn = pxEventFlags->uxEventBits;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	/* The task is no longer registered as waiting, so nothing else can wake it
+	before this notification does. */
+	if( xTaskToUnblock != NULL )
+	{
+		( void ) xTaskNotifyFromISR( xTaskToUnblock, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+EventBits_t xEventFlagsClearBits( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToClear )
+{
+EventFlags_t * const pxEventFlags = ( EventFlags_t * ) xEventFlags;
+EventBits_t uxReturn;
+
+	configASSERT( pxEventFlags );
+
+	traceEVENT_FLAGS_CLEAR_BITS( xEventFlags, uxBitsToClear );
+
+	taskENTER_CRITICAL();
+	{
+		/* The value returned is the value before the bits are cleared. */
+		uxReturn = pxEventFlags->uxEventBits;
+		pxEventFlags->uxEventBits &= ~uxBitsToClear;
+	}
+	taskEXIT_CRITICAL();
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+EventBits_t xEventFlagsClearBitsFromISR( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToClear )
+{
+EventFlags_t * const pxEventFlags = ( EventFlags_t * ) xEventFlags;
+EventBits_t uxReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxEventFlags );
+
+	traceEVENT_FLAGS_CLEAR_BITS_FROM_ISR( xEventFlags, uxBitsToClear );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxReturn = pxEventFlags->uxEventBits;
+		pxEventFlags->uxEventBits &= ~uxBitsToClear;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vEventFlagsDelete( EventFlagsHandle_t xEventFlags )
+{
+EventFlags_t * const pxEventFlags = ( EventFlags_t * ) xEventFlags;
+
+	configASSERT( pxEventFlags );
+	configASSERT( pxEventFlags->xTaskWaitingForBits == NULL );
+
+	traceEVENT_FLAGS_DELETE( xEventFlags );
+
+	if( ( pxEventFlags->ucFlags & efFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+	{
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			vPortFree( ( void * ) pxEventFlags );
+		}
+		#else
+		{
+			/* Should not be possible to get here, ucFlags must be corrupt.
+			Force an assert. */
+			configASSERT( xEventFlags == ( EventFlagsHandle_t ) ~0 );
+		}
+		#endif
+	}
+	else
+	{
+		/* The structure was not allocated dynamically and cannot be freed -
+		just scrub it so future use will assert. */
+		memset( ( void * ) pxEventFlags, 0x00, sizeof( EventFlags_t ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TaskHandle_t prvSetBits( EventFlags_t * const pxEventFlags, const EventBits_t uxBitsToSet )
+{
+TaskHandle_t xTaskToUnblock = NULL;
+EventBits_t uxBitsWaitedFor;
+
+	pxEventFlags->uxEventBits |= uxBitsToSet;
+
+	/* There is at most one waiting task, so the work done here does not depend
+	on how many tasks use the event flags. */
+	if( pxEventFlags->xTaskWaitingForBits != NULL )
+	{
+		uxBitsWaitedFor = pxEventFlags->uxBitsWaitedFor;
+
+		if( prvTestWaitCondition( pxEventFlags->uxEventBits, uxBitsWaitedFor, ( ( pxEventFlags->ucFlags & efFLAGS_WAIT_FOR_ALL_BITS ) != ( uint8_t ) 0 ) ? pdTRUE : pdFALSE ) != pdFALSE )
+		{
+			/* Hand the value that met the condition over to the task, and
+			clear its bits now, as an event group would, so they cannot meet
+			the condition twice. */
+			pxEventFlags->uxBitsOnUnblock = pxEventFlags->uxEventBits;
+
+			if( ( pxEventFlags->ucFlags & efFLAGS_CLEAR_ON_EXIT ) != ( uint8_t ) 0 )
+			{
+				pxEventFlags->uxEventBits &= ~uxBitsWaitedFor;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xTaskToUnblock = pxEventFlags->xTaskWaitingForBits;
+			pxEventFlags->xTaskWaitingForBits = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xTaskToUnblock;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits )
+{
+BaseType_t xWaitConditionMet = pdFALSE;
+
+	if( xWaitForAllBits == pdFALSE )
+	{
+		/* Any of the bits will do. */
+		if( ( uxCurrentEventBits & uxBitsToWaitFor ) != ( EventBits_t ) 0 )
+		{
+			xWaitConditionMet = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* All the bits have to be set. */
+		if( ( uxCurrentEventBits & uxBitsToWaitFor ) == uxBitsToWaitFor )
+		{
+			xWaitConditionMet = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xWaitConditionMet;
+}
+/*-----------------------------------------------------------*/
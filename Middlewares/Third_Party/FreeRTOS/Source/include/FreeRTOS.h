@@ -296,6 +296,48 @@ extern "C" {
 
 #endif /* configUSE_TIMERS */
 
+#ifndef configUSE_TIMER_WHEEL
+	/* Set to 1 to keep the active software timers in a hierarchical timer
+	wheel, which makes starting, stopping and resetting a timer O(1), rather
+	than in a list sorted by expiry time. */
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configTIMER_WHEEL_SLOT_BITS
+	/* Each level of the timer wheel has 2^configTIMER_WHEEL_SLOT_BITS slots. */
+	#define configTIMER_WHEEL_SLOT_BITS 4
+#endif
+
+#ifndef configTIMER_WHEEL_LEVELS
+	#define configTIMER_WHEEL_LEVELS 4
+#endif
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	#if ( configTIMER_WHEEL_SLOT_BITS < 1 ) || ( configTIMER_WHEEL_SLOT_BITS > 5 )
+		#error configTIMER_WHEEL_SLOT_BITS must be between 1 and 5.
+	#endif
+
+	#if ( configTIMER_WHEEL_LEVELS < 1 )
+		#error configTIMER_WHEEL_LEVELS must be at least 1.
+	#endif
+
+	#if ( configUSE_16_BIT_TICKS == 1 ) && ( ( configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS ) > 16 )
+		#error The timer wheel cannot cover more than 16 bits of tick count when configUSE_16_BIT_TICKS is 1.
+	#endif
+
+	#if ( configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS ) > 32
+		#error The timer wheel cannot cover more than 32 bits of tick count.
+	#endif
+
+#endif /* configUSE_TIMER_WHEEL */
+
+#ifndef configTIMER_COMMAND_BATCH_LENGTH
+	/* The maximum number of commands the timer service task receives from the
+	timer queue at once.  The receive buffer is on the timer task stack. */
+	#define configTIMER_COMMAND_BATCH_LENGTH 1
+#endif
+
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
 	#define portSET_INTERRUPT_MASK_FROM_ISR() 0
 #endif
@@ -658,6 +700,94 @@ extern "C" {
 	#define traceTASK_NOTIFY_GIVE_FROM_ISR()
 #endif
 
+#ifndef traceEVENT_FLAGS_CREATE
+	#define traceEVENT_FLAGS_CREATE( xEventFlags )
+#endif
+
+#ifndef traceEVENT_FLAGS_CREATE_FAILED
+	#define traceEVENT_FLAGS_CREATE_FAILED()
+#endif
+
+#ifndef traceEVENT_FLAGS_DELETE
+	#define traceEVENT_FLAGS_DELETE( xEventFlags )
+#endif
+
+#ifndef traceEVENT_FLAGS_SET_BITS
+	#define traceEVENT_FLAGS_SET_BITS( xEventFlags, uxBitsToSet )
+#endif
+
+#ifndef traceEVENT_FLAGS_SET_BITS_FROM_ISR
+	#define traceEVENT_FLAGS_SET_BITS_FROM_ISR( xEventFlags, uxBitsToSet )
+#endif
+
+#ifndef traceEVENT_FLAGS_CLEAR_BITS
+	#define traceEVENT_FLAGS_CLEAR_BITS( xEventFlags, uxBitsToClear )
+#endif
+
+#ifndef traceEVENT_FLAGS_CLEAR_BITS_FROM_ISR
+	#define traceEVENT_FLAGS_CLEAR_BITS_FROM_ISR( xEventFlags, uxBitsToClear )
+#endif
+
+#ifndef traceEVENT_FLAGS_WAIT_BITS_BLOCK
+	#define traceEVENT_FLAGS_WAIT_BITS_BLOCK( xEventFlags, uxBitsToWaitFor )
+#endif
+
+#ifndef traceEVENT_FLAGS_WAIT_BITS_END
+	#define traceEVENT_FLAGS_WAIT_BITS_END( xEventFlags, uxBitsToWaitFor, xTimeoutOccurred )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE_FAILED
+	#define traceSTREAM_BUFFER_CREATE_FAILED( xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE_STATIC_FAILED
+	#define traceSTREAM_BUFFER_CREATE_STATIC_FAILED( xReturn, xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE
+	#define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_DELETE
+	#define traceSTREAM_BUFFER_DELETE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RESET
+	#define traceSTREAM_BUFFER_RESET( xStreamBuffer )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_SEND
+	#define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND
+	#define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FAILED
+	#define traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FROM_ISR
+	#define traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_RECEIVE
+	#define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE
+	#define traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FAILED
+	#define traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FROM_ISR
+	#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
 	#define configGENERATE_RUN_TIME_STATS 0
 #endif
@@ -768,6 +898,10 @@ extern "C" {
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configMESSAGE_BUFFER_LENGTH_TYPE
+	#define configMESSAGE_BUFFER_LENGTH_TYPE size_t
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
 	#define portTICK_TYPE_IS_ATOMIC 0
 #endif
@@ -1055,6 +1189,49 @@ typedef struct xSTATIC_TIMER
 
 } StaticTimer_t;
 
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the stream buffer structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a stream buffer then the size of the stream buffer object needs to be
+ * known.  The StaticStreamBuffer_t structure below is provided for this
+ * purpose.  Its size and alignment requirements are guaranteed to match those
+ * of the genuine structure, no matter which architecture is being used, and no
+ * matter how the values in FreeRTOSConfig.h are set.  Its contents are somewhat
+ * obfuscated in the hope users will recognise that it would be unwise to make
+ * direct use of the structure members.
+ */
+typedef struct xSTATIC_STREAM_BUFFER
+{
+	size_t uxDummy1[ 4 ];
+	void * pvDummy2[ 3 ];
+	uint8_t ucDummy3;
+	#if( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxDummy4;
+	#endif
+} StaticStreamBuffer_t;
+
+/* Message buffers are built on stream buffers. */
+typedef StaticStreamBuffer_t StaticMessageBuffer_t;
+
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the event flags structure used internally by FreeRTOS
+ * is not accessible to application code.  The StaticEventFlags_t structure
+ * below has the size and alignment of the genuine structure, so the
+ * application can provide the memory of event flags created with
+ * xEventFlagsCreateStatic().
+ */
+typedef struct xSTATIC_EVENT_FLAGS
+{
+	TickType_t xDummy1;
+	void *pvDummy2;
+	TickType_t xDummy3[ 2 ];
+	uint8_t ucDummy4;
+} StaticEventFlags_t;
+
 #ifdef __cplusplus
 }
 #endif
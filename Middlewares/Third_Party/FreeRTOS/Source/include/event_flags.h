@@ -0,0 +1,337 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Event flags are a light weight alternative to event groups for signalling
+ * one task from interrupts.  Any number of tasks and interrupts can set and
+ * clear the bits, but only one task at a time can wait on an event flags
+ * object.
+ *
+ * An event group wakes its waiting tasks by walking the list of them with the
+ * scheduler suspended, which cannot be done from an interrupt, so
+ * xEventGroupSetBitsFromISR() defers the operation to the timer service task.
+ * Setting event flags from an interrupt instead tests the condition of the one
+ * waiting task and, if it is met, wakes the task directly with a task
+ * notification - a constant amount of work in the interrupt, and no timer
+ * service task in between.
+ *
+ * The waiting task is woken with a direct to task notification that carries no
+ * value (eNoAction), so the notification value of the task is not altered.
+ * All the bits of an EventBits_t can be used, none are reserved by the kernel.
+ *
+ * ***NOTE***:  Event flags use the direct to task notification of the waiting
+ * task, of which there is only one per task.  xEventFlagsWaitBits() clears the
+ * notification state of the calling task before it blocks, and takes any
+ * notification received while it is blocked.  A notification sent to the task
+ * by other means (xTaskNotify(), xTaskNotifyGive(), a stream buffer, etc.)
+ * before or during the wait is therefore lost, and a task that waits on event
+ * flags must not rely on the notification state for anything else.  The
+ * notification value itself is left unchanged.
+ *
+ * \defgroup EventFlags
+ */
+
+#ifndef EVENT_FLAGS_H
+#define EVENT_FLAGS_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include event_flags.h"
+#endif
+
+/* EventBits_t is shared with event groups. */
+#include "event_groups.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/**
+ * Type by which event flags are referenced.  For example, a call to
+ * xEventFlagsCreate() returns an EventFlagsHandle_t variable that can then be
+ * used as a parameter to xEventFlagsSetBits(), xEventFlagsWaitBits(), etc.
+ */
+typedef void * EventFlagsHandle_t;
+
+/**
+ * event_flags.h
+ *
+<pre>
+EventFlagsHandle_t xEventFlagsCreate( void );
+</pre>
+ *
+ * Creates a new event flags object, with all bits clear, using dynamically
+ * allocated memory.  configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 (or
+ * left undefined) in FreeRTOSConfig.h for xEventFlagsCreate() to be available.
+ *
+ * @return If the event flags were created then a handle to them is returned.
+ * If there was insufficient FreeRTOS heap available then NULL is returned.
+ *
+ * \defgroup xEventFlagsCreate xEventFlagsCreate
+ * \ingroup EventFlags
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	EventFlagsHandle_t xEventFlagsCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * event_flags.h
+ *
+<pre>
+EventFlagsHandle_t xEventFlagsCreateStatic( StaticEventFlags_t *pxEventFlagsBuffer );
+</pre>
+ *
+ * Creates a new event flags object, with all bits clear, in memory provided by
+ * the application.  configSUPPORT_STATIC_ALLOCATION must be set to 1 in
+ * FreeRTOSConfig.h for xEventFlagsCreateStatic() to be available.
+ *
+ * @param pxEventFlagsBuffer Must point to a variable of type
+ * StaticEventFlags_t, which will be used to hold the event flags' data
+ * structure.
+ *
+ * @return If pxEventFlagsBuffer is not NULL then a handle to the event flags
+ * is returned, otherwise NULL is returned.
+ *
+ * \defgroup xEventFlagsCreateStatic xEventFlagsCreateStatic
+ * \ingroup EventFlags
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	EventFlagsHandle_t xEventFlagsCreateStatic( StaticEventFlags_t *pxEventFlagsBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * event_flags.h
+ *
+<pre>
+EventBits_t xEventFlagsWaitBits( EventFlagsHandle_t xEventFlags,
+                                 const EventBits_t uxBitsToWaitFor,
+                                 const BaseType_t xClearOnExit,
+                                 const BaseType_t xWaitForAllBits,
+                                 TickType_t xTicksToWait );
+</pre>
+ *
+ * Waits, in the Blocked state if need be, for any or all of uxBitsToWaitFor to
+ * be set, exactly as xEventGroupWaitBits() does.  Only one task at a time may
+ * wait on an event flags object.  Must not be called from an interrupt.
+ *
+ * If the calling task has to enter the Blocked state, it blocks on its
+ * direct to task notification: a notification pending when the function is
+ * called, or received while it blocks, is consumed by the function and not
+ * seen by the task.  See the note at the top of this file.
+ *
+ * @param xEventFlags The event flags in which the bits are being tested.
+ *
+ * @param uxBitsToWaitFor A bitwise value that indicates the bit or bits to test
+ * inside the event flags.  uxBitsToWaitFor must not be set to 0.
+ *
+ * @param xClearOnExit If xClearOnExit is set to pdTRUE then the bits of
+ * uxBitsToWaitFor are cleared when the wait condition is met, atomically with
+ * the test of the condition - by the task or interrupt that set the last bit
+ * if the calling task was blocked.  The bits are not cleared if the call times
+ * out.
+ *
+ * @param xWaitForAllBits If xWaitForAllBits is set to pdTRUE then the call
+ * returns when all the bits in uxBitsToWaitFor are set, if it is set to pdFALSE
+ * then the call returns when any of the bits in uxBitsToWaitFor is set, or, in
+ * both cases, when the block time expires.
+ *
+ * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
+ * for the wait condition to be met.
+ *
+ * @return The value of the event flags at the time the wait condition was met,
+ * before any bits were cleared, or the value when the block time expired.  Test
+ * the returned value to know which bits were set.
+ *
+ * \defgroup xEventFlagsWaitBits xEventFlagsWaitBits
+ * \ingroup EventFlags
+ */
+EventBits_t xEventFlagsWaitBits( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToWaitFor, const BaseType_t xClearOnExit, const BaseType_t xWaitForAllBits, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_flags.h
+ *
+<pre>
+EventBits_t xEventFlagsSetBits( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToSet );
+</pre>
+ *
+ * Sets bits within the event flags, unblocking the waiting task if its wait
+ * condition is now met.  Use xEventFlagsSetBitsFromISR() from an interrupt.
+ *
+ * @param xEventFlags The event flags in which the bits are to be set.
+ *
+ * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
+ *
+ * @return The value of the event flags once the bits were set, and the bits of
+ * the unblocked task cleared if it asked for them to be.
+ *
+ * \defgroup xEventFlagsSetBits xEventFlagsSetBits
+ * \ingroup EventFlags
+ */
+EventBits_t xEventFlagsSetBits( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_flags.h
+ *
+<pre>
+EventBits_t xEventFlagsSetBitsFromISR( EventFlagsHandle_t xEventFlags,
+                                       const EventBits_t uxBitsToSet,
+                                       BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * A version of xEventFlagsSetBits() that can be called from an interrupt.  The
+ * waiting task is woken from the interrupt itself, unlike
+ * xEventGroupSetBitsFromISR(), which defers to the timer service task.
+ *
+ * @param xEventFlags The event flags in which the bits are to be set.
+ *
+ * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if setting the bits unblocked
+ * a task that has a priority above the task that was interrupted, in which
+ * case a context switch should be requested before the interrupt exits.
+ *
+ * @return As for xEventFlagsSetBits().
+ *
+ * \defgroup xEventFlagsSetBitsFromISR xEventFlagsSetBitsFromISR
+ * \ingroup EventFlags
+ */
+EventBits_t xEventFlagsSetBitsFromISR( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_flags.h
+ *
+<pre>
+EventBits_t xEventFlagsClearBits( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToClear );
+</pre>
+ *
+ * Clears bits within the event flags.  Use xEventFlagsClearBitsFromISR() from
+ * an interrupt.
+ *
+ * @param xEventFlags The event flags in which the bits are to be cleared.
+ *
+ * @param uxBitsToClear A bitwise value that indicates the bit or bits to clear.
+ *
+ * @return The value of the event flags before the bits were cleared.
+ *
+ * \defgroup xEventFlagsClearBits xEventFlagsClearBits
+ * \ingroup EventFlags
+ */
+EventBits_t xEventFlagsClearBits( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToClear ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_flags.h
+ *
+<pre>
+EventBits_t xEventFlagsClearBitsFromISR( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToClear );
+</pre>
+ *
+ * A version of xEventFlagsClearBits() that can be called from an interrupt.
+ *
+ * \defgroup xEventFlagsClearBitsFromISR xEventFlagsClearBitsFromISR
+ * \ingroup EventFlags
+ */
+EventBits_t xEventFlagsClearBitsFromISR( EventFlagsHandle_t xEventFlags, const EventBits_t uxBitsToClear ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_flags.h
+ *
+<pre>
+EventBits_t xEventFlagsGetBits( EventFlagsHandle_t xEventFlags );
+EventBits_t xEventFlagsGetBitsFromISR( EventFlagsHandle_t xEventFlags );
+</pre>
+ *
+ * Returns the current value of the bits in the event flags.
+ *
+ * \defgroup xEventFlagsGetBits xEventFlagsGetBits
+ * \ingroup EventFlags
+ */
+#define xEventFlagsGetBits( xEventFlags ) xEventFlagsClearBits( xEventFlags, 0 )
+#define xEventFlagsGetBitsFromISR( xEventFlags ) xEventFlagsClearBitsFromISR( xEventFlags, 0 )
+
+/**
+ * event_flags.h
+ *
+<pre>
+void vEventFlagsDelete( EventFlagsHandle_t xEventFlags );
+</pre>
+ *
+ * Deletes event flags that were created with xEventFlagsCreate() or
+ * xEventFlagsCreateStatic().  No task may be waiting on the event flags.
+ *
+ * @param xEventFlags The event flags being deleted.
+ *
+ * \defgroup vEventFlagsDelete vEventFlagsDelete
+ * \ingroup EventFlags
+ */
+void vEventFlagsDelete( EventFlagsHandle_t xEventFlags ) PRIVILEGED_FUNCTION;
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif	/* !defined( EVENT_FLAGS_H ) */
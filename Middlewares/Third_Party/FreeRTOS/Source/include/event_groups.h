@@ -541,6 +541,9 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * When only one task waits for the bits, event flags (event_flags.h) avoid the
+ * timer task: xEventFlagsSetBitsFromISR() wakes the waiting task directly.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -164,6 +164,62 @@ typedef struct HeapRegion
  */
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
+/* Used by heap_6.c to report on one size class of blocks.  Class n > 0 holds
+the blocks of xBlockSizeMin up to twice xBlockSizeMin bytes, class 0 the blocks
+smaller than the xBlockSizeMin of class 1.  Block sizes include the block
+header. */
+typedef struct xHEAP_CLASS_STATS
+{
+	size_t xBlockSizeMin;		/*<< The smallest block size that belongs to this class. */
+	size_t xFreeBlocks;			/*<< The number of free blocks in this class. */
+	size_t xFreeBytes;			/*<< The total size of the free blocks in this class. */
+	size_t xUsedBlocks;			/*<< The number of allocated blocks in this class. */
+	size_t xUsedBytes;			/*<< The total size of the allocated blocks in this class. */
+	size_t xAllocations;		/*<< The number of successful allocations that returned a block of this class. */
+	size_t xFailedAllocations;	/*<< The number of failed allocations that asked for a block of this class. */
+} HeapClassStats_t;
+
+/* Filled in by xPortGetHeapReport() with the state of the whole heap. */
+typedef struct xHEAP_REPORT
+{
+	size_t xHeapSize;					/*<< The total size of all the blocks, free or allocated. */
+	size_t xFreeBytes;					/*<< The total size of the free blocks. */
+	size_t xFreeBlocks;					/*<< The number of free blocks. */
+	size_t xLargestFreeBlock;			/*<< The size of the largest free block. */
+	size_t xSmallestFreeBlock;			/*<< The size of the smallest free block, 0 if there is none. */
+	size_t xUsedBytes;					/*<< The total size of the allocated blocks. */
+	size_t xUsedBlocks;					/*<< The number of allocated blocks. */
+	size_t xMinimumEverFreeBytes;		/*<< The lowest xFreeBytes has been since the heap was initialised. */
+	size_t xAllocations;				/*<< The number of successful calls to pvPortMalloc(). */
+	size_t xFrees;						/*<< The number of calls to vPortFree() that freed a block. */
+	size_t xFailedAllocations;			/*<< The number of calls to pvPortMalloc() that returned NULL. */
+	UBaseType_t uxFragmentationPercent;	/*<< The percentage of the free bytes that are not in the largest free block. */
+} HeapReport_t;
+
+/* Called by xPortHeapWalk() for each block in the heap, in address order.
+pvBlock and xSize give the memory the application can use, not counting the
+block header.  The scheduler is suspended while the walk runs, so the function
+must not block or call the heap itself. */
+typedef void (*HeapWalkCallbackFunction_t)( void *pvBlock, size_t xSize, BaseType_t xIsFree, void *pvParameter );
+
+/*
+ * Statistics and heap walking functions provided by heap_6.c.
+ *
+ * uxPortGetHeapClassStats() copies the statistics of up to uxArraySize size
+ * classes into pxClassStats, smallest class first, and returns the number of
+ * classes the heap has.
+ *
+ * xPortHeapWalk() calls pxCallback for every block in the heap, and
+ * xPortGetHeapReport() fills in pxReport from the same walk.  Both check the
+ * block headers as they go and return pdFAIL if the heap is found to be
+ * corrupt, pdPASS otherwise.  The time they take grows with the number of
+ * blocks, unlike pvPortMalloc() and vPortFree(), so they are meant for
+ * diagnostics rather than for time critical code.
+ */
+UBaseType_t uxPortGetHeapClassStats( HeapClassStats_t * const pxClassStats, const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+BaseType_t xPortHeapWalk( HeapWalkCallbackFunction_t pxCallback, void *pvParameter ) PRIVILEGED_FUNCTION;
+BaseType_t xPortGetHeapReport( HeapReport_t * const pxReport ) PRIVILEGED_FUNCTION;
+
 
 /*
  * Map to the memory management routines required for the port.
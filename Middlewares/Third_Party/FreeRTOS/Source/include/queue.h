@@ -1529,6 +1529,128 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherP
  */
 BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueSendMultiple(
+								QueueHandle_t xQueue,
+								const void *pvItemsToQueue,
+								UBaseType_t uxItemCount,
+								TickType_t xTicksToWait
+							);
+ * </pre>
+ *
+ * Post up to uxItemCount items to the back of a queue.  The items are taken
+ * from consecutive locations starting at pvItemsToQueue and are copied into
+ * the queue under a single critical section, so posting a block of samples
+ * costs one kernel round trip instead of one per item.  Tasks blocked on the
+ * queue are unblocked once per call rather than once per item.
+ *
+ * As many items as there is space for are posted.  The calling task only
+ * blocks while the queue is completely full, so the return value can be less
+ * than uxItemCount even when xTicksToWait is not zero.  Must not be used on
+ * semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to the first of the items to post.
+ *
+ * @param uxItemCount The number of items at pvItemsToQueue.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.
+ *
+ * @return The number of items posted, 0 if the queue stayed full for
+ * xTicksToWait.
+ *
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, UBaseType_t uxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueSendMultipleFromISR(
+										QueueHandle_t xQueue,
+										const void *pvItemsToQueue,
+										UBaseType_t uxItemCount,
+										BaseType_t *pxHigherPriorityTaskWoken
+									);
+ * </pre>
+ *
+ * Version of xQueueSendMultiple() that can be called from an interrupt
+ * service routine.  It never blocks and posts as many items as there is space
+ * for.  *pxHigherPriorityTaskWoken is set to pdTRUE if posting unblocked a
+ * task with a priority higher than the interrupted task.
+ *
+ * @return The number of items posted.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueReceiveMultiple(
+									QueueHandle_t xQueue,
+									void *pvBuffer,
+									UBaseType_t uxMaxItems,
+									TickType_t xTicksToWait
+								);
+ * </pre>
+ *
+ * Receive up to uxMaxItems items from the front of a queue into consecutive
+ * locations starting at pvBuffer, under a single critical section.  Draining
+ * a queue of 64 ADC samples is therefore one call instead of 64.
+ *
+ * The calling task only blocks while the queue is empty.  Once at least one
+ * item is available, whatever is there (up to uxMaxItems) is returned.  Must
+ * not be used on semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer with room for uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty.
+ *
+ * @return The number of items received, 0 if the queue stayed empty for
+ * xTicksToWait.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, UBaseType_t uxMaxItems, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueReceiveMultipleFromISR(
+										QueueHandle_t xQueue,
+										void *pvBuffer,
+										UBaseType_t uxMaxItems,
+										BaseType_t *pxHigherPriorityTaskWoken
+									);
+ * </pre>
+ *
+ * Version of xQueueReceiveMultiple() that can be called from an interrupt
+ * service routine.  It never blocks.  *pxHigherPriorityTaskWoken is set to
+ * pdTRUE if making space unblocked a task with a priority higher than the
+ * interrupted task.
+ *
+ * @return The number of items received.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, UBaseType_t uxMaxItems, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
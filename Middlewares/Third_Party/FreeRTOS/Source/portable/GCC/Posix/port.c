@@ -0,0 +1,594 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX port.
+ *
+ * Every task runs in a pthread of its own, but only the thread of the task
+ * the scheduler has selected is allowed to run - all the others wait on a
+ * condition variable - so the kernel behaves as it does on a single core.
+ * The tick is the SIGALRM of an interval timer, and interrupts are disabled
+ * by blocking that signal in the thread that is running.
+ *----------------------------------------------------------*/
+
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if( INCLUDE_xTaskGetCurrentTaskHandle == 0 )
+	#error The POSIX port requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1 in FreeRTOSConfig.h
+#endif
+
+/* The signal that plays the part of the tick interrupt. */
+#define portTICK_SIGNAL			SIGALRM
+
+/* A binary semaphore built from a mutex and a condition variable, used to
+wake one thread up from another. */
+typedef struct THREAD_EVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCondition;
+	BaseType_t xSignalled;
+} ThreadEvent_t;
+
+/* The thread of a task.  It is kept at the top of the task stack, which is
+otherwise unused as the thread runs on a stack of its own, so the pxTopOfStack
+member at the start of the TCB points to it. */
+typedef struct THREAD
+{
+	pthread_t xThread;			/*<< The thread running the task. */
+	TaskFunction_t pxCode;		/*<< The function that implements the task. */
+	void *pvParameters;			/*<< The parameter passed to pxCode. */
+	ThreadEvent_t xResume;		/*<< Signalled when the task is switched in. */
+	volatile BaseType_t xDying;	/*<< Set when the task has been deleted. */
+} Thread_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The function each thread starts in.  It waits for the task to be switched
+ * in for the first time before calling the task function.
+ */
+static void *prvThreadStart( void *pvParameters );
+
+/*
+ * Used to catch tasks that attempt to return from their implementing function.
+ */
+static void prvTaskExitError( void );
+
+/*
+ * Let the thread of the task being switched in run, and make the calling
+ * thread wait until its own task is switched in again.
+ */
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+
+/*
+ * Select the next task to run and switch to its thread.  Must be called with
+ * interrupts disabled.
+ */
+static void prvSwitchContext( void );
+
+/*
+ * Run the handler of a simulated interrupt and perform any context switch it
+ * asks for.  Must be called with interrupts disabled.
+ */
+static void prvProcessInterrupt( uint32_t ulInterruptNumber );
+
+/*
+ * The handler of the tick signal, and the default handler of the simulated
+ * tick interrupt it generates.
+ */
+static void prvTickSignalHandler( int iSignal );
+static uint32_t prvProcessTickInterrupt( void );
+
+/*
+ * Wait for, and signal, a thread event.
+ */
+static void prvEventInit( ThreadEvent_t *pxEvent );
+static void prvEventDelete( ThreadEvent_t *pxEvent );
+static void prvEventWait( ThreadEvent_t *pxEvent );
+static void prvEventSignal( ThreadEvent_t *pxEvent );
+
+/*-----------------------------------------------------------*/
+
+/* Returns the thread of a task from its handle. */
+#define prvGetThread( xTask )	( *( ( Thread_t ** ) ( xTask ) ) )
+
+/* Each task maintains its own critical nesting count, which is saved while the
+task is not running. */
+static UBaseType_t uxCriticalNesting = 0;
+
+/* Non-zero while a simulated interrupt handler is running, and set when the
+handler asks for a context switch to happen when it returns. */
+static volatile UBaseType_t uxInterruptNesting = 0;
+static volatile BaseType_t xSwitchPending = pdFALSE;
+
+/* The handlers of the simulated interrupts. */
+static uint32_t (*pvInterruptHandlers[ portMAX_INTERRUPTS ])( void ) = { NULL };
+
+/* The signal set that holds the tick signal. */
+static sigset_t xTickSignal;
+
+/* The number of times the tick signal was blocked, each a system call: the
+cost of a critical section on this port. */
+static volatile uint32_t ulInterruptMaskCount = 0;
+
+/* Set while the scheduler is running.  The thread that started the scheduler
+waits on xSchedulerEnd until it is stopped again. */
+static volatile BaseType_t xSchedulerStarted = pdFALSE;
+static ThreadEvent_t xSchedulerEnd;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+sigset_t xOldSignals;
+int iReturn;
+
+	/* Place the thread structure at the top of the stack, correctly aligned. */
+	pxThread = ( Thread_t * ) ( ( ( size_t ) ( pxTopOfStack + 1 ) - sizeof( Thread_t ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) );
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xDying = pdFALSE;
+	prvEventInit( &( pxThread->xResume ) );
+
+	/* The new thread inherits the signal mask, so create it with the tick
+	blocked.  It is unblocked when the task first runs.  This also stops the
+	tick from switching threads while the C library is creating the thread. */
+	sigemptyset( &xTickSignal );
+	sigaddset( &xTickSignal, portTICK_SIGNAL );
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignal, &xOldSignals );
+	iReturn = pthread_create( &( pxThread->xThread ), NULL, prvThreadStart, pxThread );
+	( void ) pthread_sigmask( SIG_SETMASK, &xOldSignals, NULL );
+
+	configASSERT( iReturn == 0 );
+	( void ) iReturn;
+
+	return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadStart( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	/* Wait until the scheduler selects the task for the first time. */
+	prvEventWait( &( pxThread->xResume ) );
+
+	if( pxThread->xDying == pdFALSE )
+	{
+		/* The task starts outside of any critical section. */
+		uxCriticalNesting = 0;
+		vPortEnableInterrupts();
+
+		pxThread->pxCode( pxThread->pvParameters );
+
+		prvTaskExitError();
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskExitError( void )
+{
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ).
+
+	Artificially force an assert() to be triggered if configASSERT() is
+	defined, then stop here so application writers can catch the error. */
+	configASSERT( uxCriticalNesting == ~0UL );
+	portDISABLE_INTERRUPTS();
+	for( ;; );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+struct sigaction xAction;
+struct itimerval xTimer;
+
+	/* The tick stays blocked in this thread, which does nothing but wait for
+	the scheduler to be stopped. */
+	sigemptyset( &xTickSignal );
+	sigaddset( &xTickSignal, portTICK_SIGNAL );
+	vPortDisableInterrupts();
+
+	prvEventInit( &xSchedulerEnd );
+
+	if( pvInterruptHandlers[ portINTERRUPT_TICK ] == NULL )
+	{
+		pvInterruptHandlers[ portINTERRUPT_TICK ] = prvProcessTickInterrupt;
+	}
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvTickSignalHandler;
+	xAction.sa_flags = SA_RESTART;
+	sigemptyset( &( xAction.sa_mask ) );
+	( void ) sigaction( portTICK_SIGNAL, &xAction, NULL );
+
+	/* Start the timer that generates the tick interrupt. */
+	xTimer.it_interval.tv_sec = 0;
+	xTimer.it_interval.tv_usec = 1000000L / configTICK_RATE_HZ;
+	xTimer.it_value = xTimer.it_interval;
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	xSchedulerStarted = pdTRUE;
+
+	/* Start the first task. */
+	prvEventSignal( &( prvGetThread( xTaskGetCurrentTaskHandle() )->xResume ) );
+
+	prvEventWait( &xSchedulerEnd );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+Thread_t *pxThread = prvGetThread( xTaskGetCurrentTaskHandle() );
+
+	memset( &xTimer, 0, sizeof( xTimer ) );
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	xSchedulerStarted = pdFALSE;
+
+	/* Return from xPortStartScheduler() in the thread that started the
+	scheduler.  The calling task never runs again. */
+	vPortDisableInterrupts();
+	prvEventSignal( &xSchedulerEnd );
+
+	for( ;; )
+	{
+		prvEventWait( &( pxThread->xResume ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	vPortEnterCritical();
+	prvSwitchContext();
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+	if( uxInterruptNesting != 0 )
+	{
+		/* Switch when the interrupt handler returns. */
+		xSwitchPending = pdTRUE;
+	}
+	else
+	{
+		vPortYield();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignal, NULL );
+	ulInterruptMaskCount++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_UNBLOCK, &xTickSignal, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+sigset_t xOldSignals;
+
+	( void ) pthread_sigmask( SIG_BLOCK, &xTickSignal, &xOldSignals );
+	ulInterruptMaskCount++;
+
+	/* Return whether interrupts were already disabled. */
+	return ( sigismember( &xOldSignals, portTICK_SIGNAL ) == 1 ) ? ( UBaseType_t ) pdTRUE : ( UBaseType_t ) pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxSavedInterruptStatus )
+{
+	if( uxSavedInterruptStatus == ( UBaseType_t ) pdFALSE )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	if( uxCriticalNesting == 0 )
+	{
+		vPortDisableInterrupts();
+	}
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void *pvTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+	( void ) pxPendYield;
+
+	/* The task is deleting itself.  Its thread ends when it next switches to
+	another task, see prvSwitchThread(). */
+	prvGetThread( pvTaskToDelete )->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpThread( void *pvTaskToDelete )
+{
+Thread_t *pxThread = prvGetThread( pvTaskToDelete );
+
+	/* Wake the thread so it sees it is dying and ends, unless it has done so
+	already, then wait for it before the stack it is using is freed. */
+	pxThread->xDying = pdTRUE;
+	prvEventSignal( &( pxThread->xResume ) );
+	( void ) pthread_join( pxThread->xThread, NULL );
+
+	prvEventDelete( &( pxThread->xResume ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber, uint32_t (*pvHandler)( void ) )
+{
+	configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+	if( ulInterruptNumber < portMAX_INTERRUPTS )
+	{
+		pvInterruptHandlers[ ulInterruptNumber ] = pvHandler;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+	configASSERT( pvInterruptHandlers[ ulInterruptNumber ] != NULL );
+
+	if( ( ulInterruptNumber < portMAX_INTERRUPTS ) && ( pvInterruptHandlers[ ulInterruptNumber ] != NULL ) )
+	{
+		uxSavedInterruptStatus = uxPortSetInterruptMask();
+		prvProcessInterrupt( ulInterruptNumber );
+		vPortClearInterruptMask( uxSavedInterruptStatus );
+	}
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetInterruptMaskCount( void )
+{
+	return ulInterruptMaskCount;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortInHandlerMode( void )
+{
+	return ( uxInterruptNesting != 0 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void xPortSysTickHandler( void )
+{
+	/* The tick interrupt, called from the tick signal handler with the tick
+	signal blocked. */
+	prvProcessInterrupt( portINTERRUPT_TICK );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickSignalHandler( int iSignal )
+{
+	( void ) iSignal;
+
+	/* The signal is process wide, so it can only arrive in the thread of the
+	running task - all the other threads have it blocked. */
+	if( xSchedulerStarted != pdFALSE )
+	{
+		xPortSysTickHandler();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvProcessTickInterrupt( void )
+{
+	/* Increment the RTOS tick, and ask for a context switch if that unblocked
+	a task. */
+	return ( uint32_t ) xTaskIncrementTick();
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessInterrupt( uint32_t ulInterruptNumber )
+{
+	uxInterruptNesting++;
+
+	if( pvInterruptHandlers[ ulInterruptNumber ]() != pdFALSE )
+	{
+		xSwitchPending = pdTRUE;
+	}
+
+	uxInterruptNesting--;
+
+	/* Perform any context switch asked for once the outermost handler has
+	returned, as PendSV would on a Cortex-M. */
+	if( ( uxInterruptNesting == 0 ) && ( xSwitchPending != pdFALSE ) && ( xSchedulerStarted != pdFALSE ) )
+	{
+		xSwitchPending = pdFALSE;
+		prvSwitchContext();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+Thread_t *pxThreadToSuspend = prvGetThread( xTaskGetCurrentTaskHandle() );
+
+	vTaskSwitchContext();
+	prvSwitchThread( prvGetThread( xTaskGetCurrentTaskHandle() ), pxThreadToSuspend );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToResume != pxThreadToSuspend )
+	{
+		/* The critical nesting count belongs to the task being switched out,
+		so keep it here until the task runs again. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+
+		prvEventSignal( &( pxThreadToResume->xResume ) );
+
+		/* A task that deleted itself ends here, as soon as the next task has
+		been switched in. */
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			pthread_exit( NULL );
+		}
+
+		prvEventWait( &( pxThreadToSuspend->xResume ) );
+
+		/* The task may have been deleted by another while it was switched
+		out. */
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			pthread_exit( NULL );
+		}
+
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( ThreadEvent_t *pxEvent )
+{
+	( void ) pthread_mutex_init( &( pxEvent->xMutex ), NULL );
+	( void ) pthread_cond_init( &( pxEvent->xCondition ), NULL );
+	pxEvent->xSignalled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventDelete( ThreadEvent_t *pxEvent )
+{
+	( void ) pthread_cond_destroy( &( pxEvent->xCondition ) );
+	( void ) pthread_mutex_destroy( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( ThreadEvent_t *pxEvent )
+{
+	( void ) pthread_mutex_lock( &( pxEvent->xMutex ) );
+
+	while( pxEvent->xSignalled == pdFALSE )
+	{
+		( void ) pthread_cond_wait( &( pxEvent->xCondition ), &( pxEvent->xMutex ) );
+	}
+
+	pxEvent->xSignalled = pdFALSE;
+	( void ) pthread_mutex_unlock( &( pxEvent->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( ThreadEvent_t *pxEvent )
+{
+	( void ) pthread_mutex_lock( &( pxEvent->xMutex ) );
+	pxEvent->xSignalled = pdTRUE;
+	( void ) pthread_cond_signal( &( pxEvent->xCondition ) );
+	( void ) pthread_mutex_unlock( &( pxEvent->xMutex ) );
+}
+
@@ -0,0 +1,909 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() whose execution
+ * time does not depend on the number or the layout of the blocks in the heap.
+ *
+ * Free blocks are kept in segregated lists using the two level segregated fit
+ * (TLSF) scheme.  The first level divides block sizes into power of two
+ * classes, the second level divides each class linearly into
+ * heapSL_INDEX_COUNT lists.  A bitmap per level records which lists are not
+ * empty, so pvPortMalloc() finds a block that is large enough with a couple of
+ * bit scans instead of walking a list, and vPortFree() merges a block with its
+ * physical neighbours through a pointer to the block below it in memory.
+ * Both therefore run in bounded time with the scheduler suspended, however
+ * fragmented the heap is.  The price is that a request may be served from a
+ * block up to one second level step larger than strictly needed, the excess
+ * being split off and returned to the free lists when it is big enough.
+ *
+ * Like heap_4.c the heap is the ucHeap array of configTOTAL_HEAP_SIZE bytes.
+ * Per size class statistics are available from uxPortGetHeapClassStats(), and
+ * xPortHeapWalk() and xPortGetHeapReport() walk the whole heap to visit every
+ * block or to report on fragmentation, checking the block headers as they go.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* The low bits of a block size are always zero because of the alignment, so
+they are free to hold the block flags. */
+#if( portBYTE_ALIGNMENT == 32 )
+	#define heapALIGNMENT_LOG2		( 5 )
+#elif( portBYTE_ALIGNMENT == 16 )
+	#define heapALIGNMENT_LOG2		( 4 )
+#elif( portBYTE_ALIGNMENT == 8 )
+	#define heapALIGNMENT_LOG2		( 3 )
+#elif( portBYTE_ALIGNMENT == 4 )
+	#define heapALIGNMENT_LOG2		( 2 )
+#else
+	#error heap_6.c requires portBYTE_ALIGNMENT to be at least 4
+#endif
+
+/* Set in the size of a block that is in the free lists. */
+#define heapBLOCK_FREE_BIT		( ( size_t ) 1 )
+#define heapBLOCK_FLAGS_MASK	( ( size_t ) portBYTE_ALIGNMENT_MASK )
+
+/* Each first level class is split into 2 ^ heapSL_INDEX_COUNT_LOG2 lists. */
+#define heapSL_INDEX_COUNT_LOG2	( 3 )
+#define heapSL_INDEX_COUNT		( 1U << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE all go in first level class 0,
+which is split linearly in steps of portBYTE_ALIGNMENT bytes. */
+#define heapFL_INDEX_SHIFT		( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE	( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* Blocks must be smaller than 2 ^ heapFL_INDEX_MAX bytes, which is far more
+RAM than any device this port runs on has. */
+#define heapFL_INDEX_MAX		( 24 )
+#define heapFL_INDEX_COUNT		( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 1 )
+#define heapMAXIMUM_BLOCK_SIZE	( ( size_t ) 1 << heapFL_INDEX_MAX )
+
+/* Block sizes must not get too small. */
+#define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( ( sizeof( BlockHeader_t ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) )
+
+/* Allocate the memory for the heap. */
+#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+	/* The application writer has already defined the array used for the RTOS
+	heap - probably so it can be placed in a special segment or address. */
+	extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* The header at the start of every block.  Blocks lie back to back in memory,
+so the block above this one starts xBlockSize bytes further on.  The two free
+list links are only used while the block is free - once it is allocated they
+are overwritten by the application data. */
+typedef struct A_BLOCK_HEADER
+{
+	struct A_BLOCK_HEADER *pxPrevPhysBlock;	/*<< The block immediately below this one in memory, NULL for the first block. */
+	size_t xBlockSize;						/*<< The size of the block, header included, with the flags in the low bits. */
+	struct A_BLOCK_HEADER *pxNextFreeBlock;	/*<< The next block in the same free list. */
+	struct A_BLOCK_HEADER *pxPrevFreeBlock;	/*<< The previous block in the same free list. */
+} BlockHeader_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void );
+
+/*
+ * Return the index of the most, or least, significant bit set in ulValue,
+ * which must not be 0.
+ */
+static UBaseType_t prvFindLastSet( uint32_t ulValue );
+static UBaseType_t prvFindFirstSet( uint32_t ulValue );
+
+/*
+ * Return the first and second level indexes of the free list that holds
+ * blocks of xBlockSize bytes.
+ */
+static void prvMapBlockSize( size_t xBlockSize, UBaseType_t *puxFL, UBaseType_t *puxSL );
+
+/*
+ * Return a free block of at least xWantedSize bytes, or NULL if there is none,
+ * without removing it from its free list.  The indexes of the list the block
+ * is in are returned through puxFL and puxSL.
+ */
+static BlockHeader_t *prvFindFreeBlock( size_t xWantedSize, UBaseType_t *puxFL, UBaseType_t *puxSL );
+
+/*
+ * Add a free block to, or take it out of, the free list for its size.
+ */
+static void prvInsertFreeBlock( BlockHeader_t *pxBlock );
+static void prvRemoveFreeBlock( BlockHeader_t *pxBlock, UBaseType_t uxFL, UBaseType_t uxSL );
+
+/*
+ * Walk the heap from the lowest address up, checking each block header, and
+ * call pxCallback for every block if it is not NULL.  Totals are accumulated
+ * in pxReport if that is not NULL.  Returns pdFAIL as soon as a block header
+ * is found to be corrupt.  Must be called with the scheduler suspended.
+ */
+static BaseType_t prvWalkHeap( HeapWalkCallbackFunction_t pxCallback, void *pvParameter, HeapReport_t *pxReport );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the header that stays in place while a block is
+allocated, rounded up so the memory that follows it is correctly aligned. */
+static const size_t xHeapStructSize	= ( offsetof( BlockHeader_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The first block in the heap, and the zero sized block that marks its end. */
+static BlockHeader_t *pxHeapStart = NULL, *pxHeapEnd = NULL;
+
+/* The heads of the free lists, and the bitmaps that say which are not empty.
+Bit n of ulFLBitmap is set when any bit of ulSLBitmap[ n ] is set. */
+static BlockHeader_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+static uint32_t ulFLBitmap = 0UL;
+static uint32_t ulSLBitmap[ heapFL_INDEX_COUNT ];
+
+/* Statistics per first level class, and for the heap as a whole. */
+static HeapClassStats_t xClassStats[ heapFL_INDEX_COUNT ];
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+static size_t xNumberOfAllocations = 0U;
+static size_t xNumberOfFrees = 0U;
+static size_t xNumberOfFailedAllocations = 0U;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockHeader_t *pxBlock, *pxRemainder;
+UBaseType_t uxFL, uxSL;
+size_t xBlockSize;
+void *pvReturn = NULL;
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the free lists. */
+		if( pxHeapEnd == NULL )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Requests that cannot fit in any size class are rejected before the
+		size is adjusted, so the adjustment cannot overflow. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize < heapMAXIMUM_BLOCK_SIZE ) )
+		{
+			/* The wanted size is increased so it can contain the block header
+			in addition to the requested amount of bytes, and rounded up so the
+			next block is aligned too. */
+			xBlockSize = xWantedSize + xHeapStructSize;
+
+			if( ( xBlockSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				xBlockSize += ( portBYTE_ALIGNMENT - ( xBlockSize & portBYTE_ALIGNMENT_MASK ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The block must be able to hold the free list links again once it
+			is freed. */
+			if( xBlockSize < heapMINIMUM_BLOCK_SIZE )
+			{
+				xBlockSize = heapMINIMUM_BLOCK_SIZE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxBlock = prvFindFreeBlock( xBlockSize, &uxFL, &uxSL );
+
+			if( pxBlock != NULL )
+			{
+				prvRemoveFreeBlock( pxBlock, uxFL, uxSL );
+
+				/* If the block is larger than required it can be split into
+				two, the top part going back into the free lists.  The void
+				cast is used to prevent byte alignment warnings from the
+				compiler. */
+				if( ( ( pxBlock->xBlockSize & ~heapBLOCK_FLAGS_MASK ) - xBlockSize ) >= heapMINIMUM_BLOCK_SIZE )
+				{
+					pxRemainder = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xBlockSize );
+					configASSERT( ( ( ( size_t ) pxRemainder ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+					pxRemainder->xBlockSize = ( ( pxBlock->xBlockSize & ~heapBLOCK_FLAGS_MASK ) - xBlockSize ) | heapBLOCK_FREE_BIT;
+					pxRemainder->pxPrevPhysBlock = pxBlock;
+					( ( BlockHeader_t * ) ( ( ( uint8_t * ) pxRemainder ) + ( pxRemainder->xBlockSize & ~heapBLOCK_FLAGS_MASK ) ) )->pxPrevPhysBlock = pxRemainder;
+					prvInsertFreeBlock( pxRemainder );
+				}
+				else
+				{
+					/* Too little is left over to make a block of its own, so
+					the application gets it too. */
+					xBlockSize = pxBlock->xBlockSize & ~heapBLOCK_FLAGS_MASK;
+				}
+
+				/* The block is being returned - it is allocated and owned by
+				the application, so the free bit is clear. */
+				pxBlock->xBlockSize = xBlockSize;
+
+				xFreeBytesRemaining -= xBlockSize;
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvMapBlockSize( xBlockSize, &uxFL, &uxSL );
+				xClassStats[ uxFL ].xUsedBlocks++;
+				xClassStats[ uxFL ].xUsedBytes += xBlockSize;
+				xClassStats[ uxFL ].xAllocations++;
+				xNumberOfAllocations++;
+
+				/* Return the memory space pointed to - jumping over the block
+				header at its start. */
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pvReturn == NULL )
+		{
+			/* Charge the failure to the class the request would have been
+			served from, requests too large for any class to the last one. */
+			if( xWantedSize < heapMAXIMUM_BLOCK_SIZE )
+			{
+				prvMapBlockSize( xWantedSize + xHeapStructSize, &uxFL, &uxSL );
+			}
+			else
+			{
+				uxFL = heapFL_INDEX_COUNT - 1;
+			}
+
+			xClassStats[ uxFL ].xFailedAllocations++;
+			xNumberOfFailedAllocations++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockHeader_t *pxBlock, *pxNeighbour;
+UBaseType_t uxFL, uxSL;
+size_t xBlockSize;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a block header immediately before
+		it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxBlock = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0 );
+		configASSERT( pxBlock->xBlockSize >= heapMINIMUM_BLOCK_SIZE );
+
+		if( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0 )
+		{
+			vTaskSuspendAll();
+			{
+				xBlockSize = pxBlock->xBlockSize;
+
+				xFreeBytesRemaining += xBlockSize;
+				xNumberOfFrees++;
+				prvMapBlockSize( xBlockSize, &uxFL, &uxSL );
+				xClassStats[ uxFL ].xUsedBlocks--;
+				xClassStats[ uxFL ].xUsedBytes -= xBlockSize;
+				traceFREE( pv, xBlockSize );
+
+				/* Merge with the block below if that is free. */
+				pxNeighbour = pxBlock->pxPrevPhysBlock;
+				if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0 ) )
+				{
+					prvMapBlockSize( pxNeighbour->xBlockSize & ~heapBLOCK_FLAGS_MASK, &uxFL, &uxSL );
+					prvRemoveFreeBlock( pxNeighbour, uxFL, uxSL );
+					xBlockSize += pxNeighbour->xBlockSize & ~heapBLOCK_FLAGS_MASK;
+					pxBlock = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Merge with the block above if that is free.  The end marker
+				is never free so this cannot run off the end of the heap. */
+				pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xBlockSize );
+				if( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0 )
+				{
+					prvMapBlockSize( pxNeighbour->xBlockSize & ~heapBLOCK_FLAGS_MASK, &uxFL, &uxSL );
+					prvRemoveFreeBlock( pxNeighbour, uxFL, uxSL );
+					xBlockSize += pxNeighbour->xBlockSize & ~heapBLOCK_FLAGS_MASK;
+					pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xBlockSize );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxBlock->xBlockSize = xBlockSize | heapBLOCK_FREE_BIT;
+				pxNeighbour->pxPrevPhysBlock = pxBlock;
+				prvInsertFreeBlock( pxBlock );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortGetHeapClassStats( HeapClassStats_t * const pxClassStats, const UBaseType_t uxArraySize )
+{
+UBaseType_t uxClass;
+
+	vTaskSuspendAll();
+	{
+		if( pxHeapEnd == NULL )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		for( uxClass = 0; ( uxClass < uxArraySize ) && ( uxClass < ( UBaseType_t ) heapFL_INDEX_COUNT ); uxClass++ )
+		{
+			pxClassStats[ uxClass ] = xClassStats[ uxClass ];
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return ( UBaseType_t ) heapFL_INDEX_COUNT;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortHeapWalk( HeapWalkCallbackFunction_t pxCallback, void *pvParameter )
+{
+BaseType_t xReturn;
+
+	vTaskSuspendAll();
+	{
+		if( pxHeapEnd == NULL )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xReturn = prvWalkHeap( pxCallback, pvParameter, NULL );
+	}
+	( void ) xTaskResumeAll();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortGetHeapReport( HeapReport_t * const pxReport )
+{
+BaseType_t xReturn;
+
+	pxReport->xHeapSize = 0U;
+	pxReport->xFreeBytes = 0U;
+	pxReport->xFreeBlocks = 0U;
+	pxReport->xLargestFreeBlock = 0U;
+	pxReport->xSmallestFreeBlock = 0U;
+	pxReport->xUsedBytes = 0U;
+	pxReport->xUsedBlocks = 0U;
+
+	vTaskSuspendAll();
+	{
+		if( pxHeapEnd == NULL )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xReturn = prvWalkHeap( NULL, NULL, pxReport );
+
+		pxReport->xMinimumEverFreeBytes = xMinimumEverFreeBytesRemaining;
+		pxReport->xAllocations = xNumberOfAllocations;
+		pxReport->xFrees = xNumberOfFrees;
+		pxReport->xFailedAllocations = xNumberOfFailedAllocations;
+	}
+	( void ) xTaskResumeAll();
+
+	/* The share of the free memory that a single allocation cannot get at
+	because it is not in the largest free block.  0 when all the free memory is
+	in one block, approaching 100 as it is scattered over many small ones. */
+	if( pxReport->xFreeBytes != 0U )
+	{
+		pxReport->uxFragmentationPercent = ( UBaseType_t ) ( ( ( pxReport->xFreeBytes - pxReport->xLargestFreeBlock ) * 100U ) / pxReport->xFreeBytes );
+	}
+	else
+	{
+		pxReport->uxFragmentationPercent = 0U;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+BlockHeader_t *pxFirstFreeBlock;
+uint8_t *pucAlignedHeap;
+size_t uxAddress;
+size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+UBaseType_t uxClass;
+
+	/* Ensure the heap starts on a correctly aligned boundary. */
+	uxAddress = ( size_t ) ucHeap;
+
+	if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		uxAddress += ( portBYTE_ALIGNMENT - 1 );
+		uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xTotalHeapSize -= uxAddress - ( size_t ) ucHeap;
+	}
+
+	pucAlignedHeap = ( uint8_t * ) uxAddress;
+
+	/* pxHeapEnd is a zero sized block at the end of the heap space.  It is
+	never free, so blocks below it never try to merge with it. */
+	uxAddress = ( ( size_t ) pucAlignedHeap ) + xTotalHeapSize;
+	uxAddress -= xHeapStructSize;
+	uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	pxHeapEnd = ( void * ) uxAddress;
+
+	/* To start with there is a single free block that is sized to take up the
+	entire heap space, minus the space taken by pxHeapEnd. */
+	pxFirstFreeBlock = ( void * ) pucAlignedHeap;
+	pxFirstFreeBlock->pxPrevPhysBlock = NULL;
+	pxFirstFreeBlock->xBlockSize = ( uxAddress - ( size_t ) pxFirstFreeBlock ) | heapBLOCK_FREE_BIT;
+	pxHeapStart = pxFirstFreeBlock;
+
+	pxHeapEnd->pxPrevPhysBlock = pxFirstFreeBlock;
+	pxHeapEnd->xBlockSize = 0;
+
+	/* The whole heap must fit in the largest size class. */
+	configASSERT( ( uxAddress - ( size_t ) pxFirstFreeBlock ) < heapMAXIMUM_BLOCK_SIZE );
+
+	for( uxClass = 0; uxClass < ( UBaseType_t ) heapFL_INDEX_COUNT; uxClass++ )
+	{
+		if( uxClass == 0 )
+		{
+			xClassStats[ uxClass ].xBlockSizeMin = heapMINIMUM_BLOCK_SIZE;
+		}
+		else
+		{
+			xClassStats[ uxClass ].xBlockSizeMin = ( size_t ) 1 << ( uxClass + heapFL_INDEX_SHIFT - 1 );
+		}
+	}
+
+	prvInsertFreeBlock( pxFirstFreeBlock );
+
+	/* Only one block exists - and it covers the entire usable heap space. */
+	xMinimumEverFreeBytesRemaining = uxAddress - ( size_t ) pxFirstFreeBlock;
+	xFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( uint32_t ulValue )
+{
+	#if defined( __GNUC__ )
+	{
+		return ( UBaseType_t ) ( 31 - __builtin_clz( ulValue ) );
+	}
+	#else
+	{
+	UBaseType_t uxBit = 0;
+
+		/* A binary search keeps this to five steps whatever the value. */
+		if( ( ulValue & 0xffff0000UL ) != 0UL )
+		{
+			ulValue >>= 16;
+			uxBit += 16;
+		}
+
+		if( ( ulValue & 0x0000ff00UL ) != 0UL )
+		{
+			ulValue >>= 8;
+			uxBit += 8;
+		}
+
+		if( ( ulValue & 0x000000f0UL ) != 0UL )
+		{
+			ulValue >>= 4;
+			uxBit += 4;
+		}
+
+		if( ( ulValue & 0x0000000cUL ) != 0UL )
+		{
+			ulValue >>= 2;
+			uxBit += 2;
+		}
+
+		if( ( ulValue & 0x00000002UL ) != 0UL )
+		{
+			uxBit += 1;
+		}
+
+		return uxBit;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindFirstSet( uint32_t ulValue )
+{
+	/* Isolate the lowest set bit. */
+	return prvFindLastSet( ulValue & ( ~ulValue + 1UL ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMapBlockSize( size_t xBlockSize, UBaseType_t *puxFL, UBaseType_t *puxSL )
+{
+UBaseType_t uxLastSet;
+
+	if( xBlockSize < heapSMALL_BLOCK_SIZE )
+	{
+		*puxFL = 0;
+		*puxSL = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+	}
+	else
+	{
+		uxLastSet = prvFindLastSet( ( uint32_t ) xBlockSize );
+		*puxFL = uxLastSet - ( heapFL_INDEX_SHIFT - 1 );
+		*puxSL = ( UBaseType_t ) ( xBlockSize >> ( uxLastSet - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BlockHeader_t *prvFindFreeBlock( size_t xWantedSize, UBaseType_t *puxFL, UBaseType_t *puxSL )
+{
+uint32_t ulMap;
+UBaseType_t uxFL, uxSL;
+
+	/* Round the size up to the start of the next list, so any block found in
+	the list it maps to is large enough without searching the list. */
+	if( xWantedSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xWantedSize += ( ( size_t ) 1 << ( prvFindLastSet( ( uint32_t ) xWantedSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMapBlockSize( xWantedSize, &uxFL, &uxSL );
+
+	if( uxFL >= ( UBaseType_t ) heapFL_INDEX_COUNT )
+	{
+		return NULL;
+	}
+
+	/* Look for a non-empty list in the same class first, then take the first
+	non-empty list of the smallest larger class. */
+	ulMap = ulSLBitmap[ uxFL ] & ( 0xffffffffUL << uxSL );
+
+	if( ulMap == 0UL )
+	{
+		ulMap = ulFLBitmap & ( 0xffffffffUL << ( uxFL + 1 ) );
+
+		if( ulMap == 0UL )
+		{
+			return NULL;
+		}
+
+		uxFL = prvFindFirstSet( ulMap );
+		ulMap = ulSLBitmap[ uxFL ];
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	uxSL = prvFindFirstSet( ulMap );
+
+	*puxFL = uxFL;
+	*puxSL = uxSL;
+
+	return pxFreeLists[ uxFL ][ uxSL ];
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( BlockHeader_t *pxBlock )
+{
+UBaseType_t uxFL, uxSL;
+size_t xBlockSize = pxBlock->xBlockSize & ~heapBLOCK_FLAGS_MASK;
+
+	prvMapBlockSize( xBlockSize, &uxFL, &uxSL );
+
+	pxBlock->pxPrevFreeBlock = NULL;
+	pxBlock->pxNextFreeBlock = pxFreeLists[ uxFL ][ uxSL ];
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFL ][ uxSL ] = pxBlock;
+	ulFLBitmap |= 1UL << uxFL;
+	ulSLBitmap[ uxFL ] |= 1UL << uxSL;
+
+	xClassStats[ uxFL ].xFreeBlocks++;
+	xClassStats[ uxFL ].xFreeBytes += xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( BlockHeader_t *pxBlock, UBaseType_t uxFL, UBaseType_t uxSL )
+{
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPrevFreeBlock != NULL )
+	{
+		pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was at the head of its list.  If the list is now empty its
+		bit is cleared, and the class bit too if that was the last list of the
+		class with blocks in it. */
+		pxFreeLists[ uxFL ][ uxSL ] = pxBlock->pxNextFreeBlock;
+
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			ulSLBitmap[ uxFL ] &= ~( 1UL << uxSL );
+
+			if( ulSLBitmap[ uxFL ] == 0UL )
+			{
+				ulFLBitmap &= ~( 1UL << uxFL );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	xClassStats[ uxFL ].xFreeBlocks--;
+	xClassStats[ uxFL ].xFreeBytes -= pxBlock->xBlockSize & ~heapBLOCK_FLAGS_MASK;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWalkHeap( HeapWalkCallbackFunction_t pxCallback, void *pvParameter, HeapReport_t *pxReport )
+{
+BlockHeader_t *pxBlock, *pxPrevBlock = NULL;
+size_t xBlockSize, xFreeBytes = 0U;
+BaseType_t xIsFree, xPrevIsFree = pdFALSE;
+
+	for( pxBlock = pxHeapStart; pxBlock != pxHeapEnd; pxBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xBlockSize ) )
+	{
+		xBlockSize = pxBlock->xBlockSize & ~heapBLOCK_FLAGS_MASK;
+		xIsFree = ( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) != 0 ) ? pdTRUE : pdFALSE;
+
+		/* A block must link back to the block below it, must not run past the
+		end of the heap, and two free blocks are never left side by side. */
+		if( ( pxBlock->pxPrevPhysBlock != pxPrevBlock ) ||
+			( xBlockSize < heapMINIMUM_BLOCK_SIZE ) ||
+			( xBlockSize > ( size_t ) ( ( uint8_t * ) pxHeapEnd - ( uint8_t * ) pxBlock ) ) ||
+			( ( xIsFree != pdFALSE ) && ( xPrevIsFree != pdFALSE ) ) )
+		{
+			return pdFAIL;
+		}
+
+		if( xIsFree != pdFALSE )
+		{
+			xFreeBytes += xBlockSize;
+		}
+
+		if( pxReport != NULL )
+		{
+			pxReport->xHeapSize += xBlockSize;
+
+			if( xIsFree != pdFALSE )
+			{
+				pxReport->xFreeBytes += xBlockSize;
+				pxReport->xFreeBlocks++;
+
+				if( xBlockSize > pxReport->xLargestFreeBlock )
+				{
+					pxReport->xLargestFreeBlock = xBlockSize;
+				}
+
+				if( ( pxReport->xSmallestFreeBlock == 0U ) || ( xBlockSize < pxReport->xSmallestFreeBlock ) )
+				{
+					pxReport->xSmallestFreeBlock = xBlockSize;
+				}
+			}
+			else
+			{
+				pxReport->xUsedBytes += xBlockSize;
+				pxReport->xUsedBlocks++;
+			}
+		}
+
+		if( pxCallback != NULL )
+		{
+			pxCallback( ( ( uint8_t * ) pxBlock ) + xHeapStructSize, xBlockSize - xHeapStructSize, xIsFree, pvParameter );
+		}
+
+		pxPrevBlock = pxBlock;
+		xPrevIsFree = xIsFree;
+	}
+
+	/* The end marker must link back to the last block, and the free blocks
+	found must add up to the running total. */
+	if( ( pxHeapEnd->pxPrevPhysBlock != pxPrevBlock ) || ( xFreeBytes != xFreeBytesRemaining ) )
+	{
+		return pdFAIL;
+	}
+
+	return pdPASS;
+}
+
@@ -93,6 +93,7 @@ privileged Vs unprivileged linkage and placement. */
 /* Constants used with the cRxLock and cTxLock structure members. */
 #define queueUNLOCKED					( ( int8_t ) -1 )
 #define queueLOCKED_UNMODIFIED			( ( int8_t ) 0 )
+#define queueLOCK_COUNT_MAX				( ( int8_t ) 127 )
 
 /* When the Queue_t structure is used to represent a base queue its pcHead and
 pcTail members are used as pointers into the queue storage area.  When the
@@ -232,6 +233,28 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copy uxItemCount items to the back of the queue, or out of the front of the
+ * queue, with at most two memcpy() calls.  The caller has checked there is
+ * enough space or data.
+ */
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const void *pvItemsToQueue, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock up to uxItemCount tasks from an event list, or post uxItemCount
+ * times to the queue set the queue belongs to.  Returns pdTRUE if a task of
+ * higher priority than the running task was unblocked.
+ */
+static BaseType_t prvUnblockTasks( List_t * const pxEventList, UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+static BaseType_t prvUnblockReceivers( Queue_t * const pxQueue, UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add uxItemCount to a cTxLock or cRxLock value, saturating at
+ * queueLOCK_COUNT_MAX.
+ */
+static int8_t prvIncrementLockCount( const int8_t cLock, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -1522,6 +1545,407 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 }
 /*-----------------------------------------------------------*/
 
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, UBaseType_t uxItemCount, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+UBaseType_t uxSpacesAvailable;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes have no items to copy. */
+	configASSERT( !( ( pvItemsToQueue == NULL ) && ( uxItemCount != ( UBaseType_t ) 0U ) ) );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( uxItemCount == ( UBaseType_t ) 0 )
+	{
+		return 0;
+	}
+
+	/* This follows xQueueGenericSend(), except that as many of the items as
+	fit are copied in one go and the task only blocks while the queue is
+	completely full. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxSpacesAvailable = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+			if( uxSpacesAvailable > ( UBaseType_t ) 0 )
+			{
+				if( uxItemCount > uxSpacesAvailable )
+				{
+					uxItemCount = uxSpacesAvailable;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceQUEUE_SEND( pxQueue );
+				prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxItemCount );
+
+				if( prvUnblockReceivers( pxQueue, uxItemCount ) != pdFALSE )
+				{
+					/* A task with a priority higher than our own was
+					unblocked so yield immediately.  Yes it is ok to do this
+					from within the critical section - the kernel takes care
+					of that. */
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return uxItemCount;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was full and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return 0;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The queue was full and a block time was specified so
+					configure the timeout structure. */
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* The timeout has expired. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			traceQUEUE_SEND_FAILED( pxQueue );
+			return 0;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxSavedInterruptStatus, uxSpacesAvailable;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes have no items to copy. */
+	configASSERT( !( ( pvItemsToQueue == NULL ) && ( uxItemCount != ( UBaseType_t ) 0U ) ) );
+
+	/* See the comment in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxSpacesAvailable = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+		if( uxItemCount > uxSpacesAvailable )
+		{
+			uxItemCount = uxSpacesAvailable;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( uxItemCount > ( UBaseType_t ) 0 )
+		{
+			const int8_t cTxLock = pxQueue->cTxLock;
+
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+			prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxItemCount );
+
+			/* The event list is not altered if the queue is locked.  This will
+			be done when the queue is unlocked later. */
+			if( cTxLock == queueUNLOCKED )
+			{
+				if( prvUnblockReceivers( pxQueue, uxItemCount ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Increment the lock count so the task that unlocks the queue
+				knows how much data was posted while it was locked. */
+				pxQueue->cTxLock = prvIncrementLockCount( cTxLock, uxItemCount );
+			}
+		}
+		else
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxItemCount;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, UBaseType_t uxMaxItems, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes have no items to copy. */
+	configASSERT( !( ( pvBuffer == NULL ) && ( uxMaxItems != ( UBaseType_t ) 0U ) ) );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( uxMaxItems == ( UBaseType_t ) 0 )
+	{
+		return 0;
+	}
+
+	/* This follows xQueueGenericReceive(), except that up to uxMaxItems items
+	are copied out in one go and the task only blocks while the queue is
+	empty. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				if( uxMaxItems > uxMessagesWaiting )
+				{
+					uxMaxItems = uxMessagesWaiting;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceQUEUE_RECEIVE( pxQueue );
+				prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxMaxItems );
+				pxQueue->uxMessagesWaiting = uxMessagesWaiting - uxMaxItems;
+
+				if( prvUnblockTasks( &( pxQueue->xTasksWaitingToSend ), uxMaxItems ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return uxMaxItems;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was empty and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return 0;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The queue was empty and a block time was specified so
+					configure the timeout structure. */
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, UBaseType_t uxMaxItems, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes have no items to copy. */
+	configASSERT( !( ( pvBuffer == NULL ) && ( uxMaxItems != ( UBaseType_t ) 0U ) ) );
+
+	/* See the comment in xQueueReceiveFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+		if( uxMaxItems > uxMessagesWaiting )
+		{
+			uxMaxItems = uxMessagesWaiting;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Cannot block in an ISR, so just take what is there. */
+		if( uxMaxItems > ( UBaseType_t ) 0 )
+		{
+			const int8_t cRxLock = pxQueue->cRxLock;
+
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+			prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxMaxItems );
+			pxQueue->uxMessagesWaiting = uxMessagesWaiting - uxMaxItems;
+
+			/* If the queue is locked the event list will not be modified.
+			Instead update the lock count so the task that unlocks the queue
+			will know how much data an ISR removed while the queue was
+			locked. */
+			if( cRxLock == queueUNLOCKED )
+			{
+				if( prvUnblockTasks( &( pxQueue->xTasksWaitingToSend ), uxMaxItems ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxQueue->cRxLock = prvIncrementLockCount( cRxLock, uxMaxItems );
+			}
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxMaxItems;
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
 {
 BaseType_t xReturn;
@@ -1791,6 +2215,173 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 }
 /*-----------------------------------------------------------*/
 
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const void *pvItemsToQueue, const UBaseType_t uxItemCount )
+{
+size_t xBytes, xFirstBytes;
+
+	/* This function is called from a critical section.  The items are
+	always placed at the back of the queue and the caller has already
+	checked they fit, so the copy is at most two memcpy() calls - one up to
+	the end of the storage area and one from its start. */
+	xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+	xFirstBytes = ( size_t ) ( pxQueue->pcTail - pxQueue->pcWriteTo ); /*lint !e946 MISRA exception justified as pointer subtraction is the cleanest solution. */
+
+	if( xFirstBytes > xBytes )
+	{
+		xFirstBytes = xBytes;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemsToQueue, xFirstBytes ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+	pxQueue->pcWriteTo += xFirstBytes;
+
+	if( xBytes > xFirstBytes )
+	{
+		( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) ( ( const int8_t * ) pvItemsToQueue + xFirstBytes ), xBytes - xFirstBytes ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytes - xFirstBytes );
+	}
+	else if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+	{
+		pxQueue->pcWriteTo = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting + uxItemCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxItemCount )
+{
+size_t xBytes, xFirstBytes;
+int8_t *pcReadFrom;
+
+	/* u.pcReadFrom points to the last item read, so the first item to copy
+	out is the one after it. */
+	pcReadFrom = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+	if( pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+	{
+		pcReadFrom = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+	xFirstBytes = ( size_t ) ( pxQueue->pcTail - pcReadFrom ); /*lint !e946 MISRA exception justified as pointer subtraction is the cleanest solution. */
+
+	if( xFirstBytes > xBytes )
+	{
+		xFirstBytes = xBytes;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xFirstBytes ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+
+	if( xBytes > xFirstBytes )
+	{
+		( void ) memcpy( ( void * ) ( ( int8_t * ) pvBuffer + xFirstBytes ), ( void * ) pxQueue->pcHead, xBytes - xFirstBytes ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		pxQueue->u.pcReadFrom = pxQueue->pcHead + ( xBytes - xFirstBytes ) - pxQueue->uxItemSize;
+	}
+	else
+	{
+		pxQueue->u.pcReadFrom = pcReadFrom + xBytes - pxQueue->uxItemSize;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockTasks( List_t * const pxEventList, UBaseType_t uxItemCount )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* Each item moved can satisfy one blocked task, so at most uxItemCount
+	tasks are removed from the event list.  With a single reader or writer,
+	the usual case, that is one wake up however many items were moved. */
+	while( ( uxItemCount > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+	{
+		if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+		{
+			xHigherPriorityTaskWoken = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		--uxItemCount;
+	}
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockReceivers( Queue_t * const pxQueue, UBaseType_t uxItemCount )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		if( pxQueue->pxQueueSetContainer != NULL )
+		{
+			/* The queue set holds one handle per item in its member queues,
+			so it is posted to once for every item added. */
+			while( uxItemCount > ( UBaseType_t ) 0 )
+			{
+				if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+				{
+					xHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				--uxItemCount;
+			}
+		}
+		else
+		{
+			xHigherPriorityTaskWoken = prvUnblockTasks( &( pxQueue->xTasksWaitingToReceive ), uxItemCount );
+		}
+	}
+	#else /* configUSE_QUEUE_SETS */
+	{
+		xHigherPriorityTaskWoken = prvUnblockTasks( &( pxQueue->xTasksWaitingToReceive ), uxItemCount );
+	}
+	#endif /* configUSE_QUEUE_SETS */
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+static int8_t prvIncrementLockCount( const int8_t cLock, const UBaseType_t uxItemCount )
+{
+int8_t cReturn;
+
+	/* The lock count is the number of tasks to unblock when the queue is
+	unlocked, so it saturates rather than wraps. */
+	if( uxItemCount >= ( UBaseType_t ) ( queueLOCK_COUNT_MAX - cLock ) )
+	{
+		cReturn = queueLOCK_COUNT_MAX;
+	}
+	else
+	{
+		cReturn = ( int8_t ) ( cLock + ( int8_t ) uxItemCount );
+	}
+
+	return cReturn;
+}
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -3253,6 +3253,13 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 			/* A yield was pended while the scheduler was suspended. */
 			eReturn = eAbortSleep;
 		}
+		else if( uxPendedTicks != ( UBaseType_t ) 0U )
+		{
+			/* A tick interrupt has already occurred but was held pending
+			because the scheduler is suspended.  The expected idle time was
+			worked out before it, so the sleep would be a tick too long. */
+			eReturn = eAbortSleep;
+		}
 		else
 		{
 			/* If all the tasks are in the suspended list (which might mean they
@@ -100,6 +100,15 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+	/* Level n of the timer wheel has tmrWHEEL_SLOTS slots, each covering
+	2^( n * tmrWHEEL_SLOT_BITS ) ticks. */
+	#define tmrWHEEL_SLOT_BITS	( ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOTS		( ( UBaseType_t ) 1U << tmrWHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK	( tmrWHEEL_SLOTS - ( UBaseType_t ) 1U )
+	#define tmrWHEEL_LEVELS		( ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+#endif
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -161,13 +170,34 @@ typedef struct tmrTimerQueueMessage
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* Active timers are stored in a hierarchical timer wheel.  A timer that
+	expires less than tmrWHEEL_SLOTS ticks after xTimerWheelTime is in the level
+	0 slot of its expiry tick, a timer that expires later is in the level n
+	slot that covers its expiry time, and is moved down (cascaded) when the
+	wheel time reaches the start of that slot.  Timers beyond the range of the
+	top level wait in xTimerWheelOverflow.  Slots are unsorted, so starting or
+	stopping a timer is O(1), and a bit map per level gives the next non-empty
+	slot without scanning.  Only the timer service task is allowed to access
+	the wheel. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ tmrWHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+	PRIVILEGED_DATA static List_t xTimerWheelOverflow;
+	PRIVILEGED_DATA static uint32_t ulTimerWheelMap[ tmrWHEEL_LEVELS ];
+	PRIVILEGED_DATA static TickType_t xTimerWheelTime = ( TickType_t ) 0U;
+	PRIVILEGED_DATA static UBaseType_t uxTimerWheelCount = ( UBaseType_t ) 0U;
+
+#else
+
+	/* The list in which active timers are stored.  Timers are referenced in expire
+	time order, with the nearest expiry time at the front of the list.  Only the
+	timer service task is allowed to access these lists. */
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -201,11 +231,21 @@ static void prvCheckForValidListAndQueue( void ) PRIVILEGED_FUNCTION;
 static void prvTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
 
 /*
- * Called by the timer service task to interpret and process a command it
- * received on the timer queue.
+ * Called by the timer service task to empty the timer queue, receiving up to
+ * configTIMER_COMMAND_BATCH_LENGTH commands at a time.
  */
 static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Interpret and process one command received on the timer queue.
+ */
+static void prvProcessCommand( const DaemonTaskMessage_t * const pxMessage ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove an active timer from the list or timer wheel slot it is in.
+ */
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
  * depending on if the expire time causes a timer counter overflow.
@@ -218,11 +258,34 @@ static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const Tic
  */
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/*
+	 * Insert the list item of a timer in the timer wheel slot that covers its
+	 * expiry time, relative to xTimerWheelTime.
+	 */
+	static void prvPlaceInTimerWheel( ListItem_t * const pxItem ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move the timer wheel to xTime, which must not be past the time of the
+	 * next non-empty slot, and cascade the slots that start at xTime.
+	 */
+	static void prvAdvanceTimerWheel( const TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the index of the lowest set bit of a non-zero slot map.
+	 */
+	static UBaseType_t prvLowestSetBit( const uint32_t ulMap ) PRIVILEGED_FUNCTION;
+
+#else
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -495,6 +558,61 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+{
+List_t *pxSlot;
+Timer_t *pxTimer;
+
+	( void ) xTimeNow;
+
+	/* xNextExpireTime is the time of the nearest non-empty slot.  Reaching it
+	may only cascade timers to the lower levels. */
+	if( xNextExpireTime != xTimerWheelTime )
+	{
+		prvAdvanceTimerWheel( xNextExpireTime );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Process one of the timers that expire now, as the list implementation
+	does, so the commands their callbacks send are processed in between. */
+	pxSlot = &( xTimerWheel[ 0 ][ xNextExpireTime & tmrWHEEL_SLOT_MASK ] );
+	if( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+	{
+		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+		prvRemoveTimerFromActiveList( pxTimer );
+		traceTIMER_EXPIRED( pxTimer );
+
+		/* An auto reload timer goes back into the wheel relative to the time
+		it expired at.  If that is already past, the wheel reaches it again
+		before blocking, which makes up for the missed periods as the list
+		implementation does. */
+		if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ) );
+			prvPlaceInTimerWheel( &( pxTimer->xTimerListItem ) );
+			uxTimerWheelCount++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Call the timer callback. */
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+
+#else
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
@@ -533,6 +651,8 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 	/* Call the timer callback. */
 	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvTimerTask( void *pvParameters )
@@ -571,6 +691,269 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+{
+TickType_t xTimeNow;
+
+	vTaskSuspendAll();
+	{
+		/* Times are compared relative to the wheel time, which never passes
+		the tick count, so an overflow of the tick count needs no special
+		handling. */
+		xTimeNow = xTaskGetTickCount();
+		if( ( xListWasEmpty == pdFALSE ) && ( ( TickType_t ) ( xNextExpireTime - xTimerWheelTime ) <= ( TickType_t ) ( xTimeNow - xTimerWheelTime ) ) )
+		{
+			( void ) xTaskResumeAll();
+			prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+		}
+		else
+		{
+			/* Block until the next slot is reached or a command is received,
+			indefinitely if there are no active timers. */
+			vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				/* Yield to wait for either a command to arrive, or the
+				block time to expire.  If a command arrived between the
+				critical section being exited and this yield then the yield
+				will not cause the task to block. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvLowestSetBit( const uint32_t ulMap )
+{
+static const uint8_t ucDeBruijn[ 32 ] =
+{
+	0U, 1U, 28U, 2U, 29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U, 8U,
+	31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U, 11U, 5U, 10U, 9U
+};
+
+	/* ulMap must not be zero. */
+	return ( UBaseType_t ) ucDeBruijn[ ( uint32_t ) ( ( ulMap & ( 0U - ulMap ) ) * 0x077CB531UL ) >> 27 ];
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+{
+TickType_t xNextDelta = portMAX_DELAY, xDelta, xSlotStart;
+UBaseType_t uxLevel, uxShift, uxIndex, uxSteps;
+uint32_t ulMap;
+const uint32_t ulAllSlots = ( ( ( uint32_t ) 1U << ( tmrWHEEL_SLOTS - 1U ) ) << 1U ) - 1U;
+
+	/* The next expire time is the time of the nearest non-empty slot.  The
+	timers of a level 0 slot expire at that time, the timers of a higher level
+	slot are cascaded to the lower levels at that time.  If there are no
+	active timers then just set the next expire time to 0, the timer task
+	then blocks until it receives a command. */
+	*pxListWasEmpty = ( uxTimerWheelCount == ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+	if( *pxListWasEmpty != pdFALSE )
+	{
+		return ( TickType_t ) 0U;
+	}
+
+	for( uxLevel = 0U; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+	{
+		ulMap = ulTimerWheelMap[ uxLevel ];
+		if( ulMap != 0U )
+		{
+			uxShift = tmrWHEEL_SLOT_BITS * uxLevel;
+			uxIndex = ( UBaseType_t ) ( xTimerWheelTime >> uxShift ) & tmrWHEEL_SLOT_MASK;
+
+			/* Rotate the map so that bit 0 is the slot of the wheel time. */
+			if( uxIndex != 0U )
+			{
+				ulMap = ( ( ulMap >> uxIndex ) | ( ulMap << ( tmrWHEEL_SLOTS - uxIndex ) ) ) & ulAllSlots;
+			}
+
+			if( uxLevel == 0U )
+			{
+				xDelta = ( TickType_t ) prvLowestSetBit( ulMap );
+			}
+			else
+			{
+				/* The slot of the wheel time in a higher level has already
+				been cascaded, the timers in it are one turn ahead. */
+				ulMap &= ~( uint32_t ) 1U;
+				uxSteps = ( ulMap != 0U ) ? prvLowestSetBit( ulMap ) : tmrWHEEL_SLOTS;
+				xSlotStart = ( TickType_t ) ( ( TickType_t ) ( ( TickType_t ) ( xTimerWheelTime >> uxShift ) + ( TickType_t ) uxSteps ) << uxShift );
+				xDelta = ( TickType_t ) ( xSlotStart - xTimerWheelTime );
+			}
+
+			if( xDelta < xNextDelta )
+			{
+				xNextDelta = xDelta;
+			}
+		}
+	}
+
+	/* Timers beyond the top level are checked each time the wheel time
+	reaches the start of a top level slot. */
+	if( listLIST_IS_EMPTY( &xTimerWheelOverflow ) == pdFALSE )
+	{
+		uxShift = tmrWHEEL_SLOT_BITS * ( tmrWHEEL_LEVELS - 1U );
+		xSlotStart = ( TickType_t ) ( ( TickType_t ) ( ( TickType_t ) ( xTimerWheelTime >> uxShift ) + ( TickType_t ) 1U ) << uxShift );
+		xDelta = ( TickType_t ) ( xSlotStart - xTimerWheelTime );
+
+		if( xDelta < xNextDelta )
+		{
+			xNextDelta = xDelta;
+		}
+	}
+
+	return ( TickType_t ) ( xTimerWheelTime + xNextDelta );
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+{
+	/* The timer wheel has no lists to switch when the tick count overflows. */
+	*pxTimerListsWereSwitched = pdFALSE;
+
+	return xTaskGetTickCount();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+{
+BaseType_t xProcessTimerNow = pdFALSE;
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+	/* Has the expiry time elapsed between the command to start/reset a
+	timer was issued, and the time the command was processed? */
+	if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	{
+		xProcessTimerNow = pdTRUE;
+	}
+	else
+	{
+		/* With no active timer there is nothing the wheel could miss, so it
+		can be moved to the current time.  This keeps the expiry times within
+		range of the wheel time after the timer task blocked indefinitely. */
+		if( uxTimerWheelCount == ( UBaseType_t ) 0U )
+		{
+			xTimerWheelTime = xTimeNow;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		prvPlaceInTimerWheel( &( pxTimer->xTimerListItem ) );
+		uxTimerWheelCount++;
+	}
+
+	return xProcessTimerNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPlaceInTimerWheel( ListItem_t * const pxItem )
+{
+const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( pxItem );
+const TickType_t xDelta = ( TickType_t ) ( xExpiryTime - xTimerWheelTime );
+UBaseType_t uxLevel = 0U, uxIndex;
+
+	/* Find the lowest level whose range covers the expiry time. */
+	while( ( uxLevel < tmrWHEEL_LEVELS ) && ( ( ( TickType_t ) ( xDelta >> ( tmrWHEEL_SLOT_BITS * uxLevel ) ) ) >= ( TickType_t ) tmrWHEEL_SLOTS ) )
+	{
+		uxLevel++;
+	}
+
+	if( uxLevel < tmrWHEEL_LEVELS )
+	{
+		uxIndex = ( UBaseType_t ) ( xExpiryTime >> ( tmrWHEEL_SLOT_BITS * uxLevel ) ) & tmrWHEEL_SLOT_MASK;
+		vListInsertEnd( &( xTimerWheel[ uxLevel ][ uxIndex ] ), pxItem );
+		ulTimerWheelMap[ uxLevel ] |= ( uint32_t ) 1U << uxIndex;
+	}
+	else
+	{
+		vListInsertEnd( &xTimerWheelOverflow, pxItem );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvAdvanceTimerWheel( const TickType_t xTime )
+{
+UBaseType_t uxLevel, uxShift, uxIndex;
+List_t *pxSlot;
+ListItem_t *pxItem, *pxNextItem;
+
+	xTimerWheelTime = xTime;
+
+	/* At the start of a top level slot, move the overflow timers that are now
+	within range into the wheel. */
+	uxShift = tmrWHEEL_SLOT_BITS * ( tmrWHEEL_LEVELS - 1U );
+	if( ( listLIST_IS_EMPTY( &xTimerWheelOverflow ) == pdFALSE ) && ( ( TickType_t ) ( xTime & ( TickType_t ) ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U ) )
+	{
+		pxItem = listGET_HEAD_ENTRY( &xTimerWheelOverflow );
+		while( pxItem != ( ListItem_t * ) listGET_END_MARKER( &xTimerWheelOverflow ) )
+		{
+			pxNextItem = listGET_NEXT( pxItem );
+			if( ( ( TickType_t ) ( ( TickType_t ) ( listGET_LIST_ITEM_VALUE( pxItem ) - xTime ) >> uxShift ) ) < ( TickType_t ) tmrWHEEL_SLOTS )
+			{
+				( void ) uxListRemove( pxItem );
+				prvPlaceInTimerWheel( pxItem );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			pxItem = pxNextItem;
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Cascade the higher level slots that start at xTime.  Their timers all
+	expire less than one slot of their level from now, so they only go to
+	lower levels. */
+	for( uxLevel = tmrWHEEL_LEVELS - 1U; uxLevel > 0U; uxLevel-- )
+	{
+		uxShift = tmrWHEEL_SLOT_BITS * uxLevel;
+		if( ( TickType_t ) ( xTime & ( TickType_t ) ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U )
+		{
+			uxIndex = ( UBaseType_t ) ( xTime >> uxShift ) & tmrWHEEL_SLOT_MASK;
+			if( ( ulTimerWheelMap[ uxLevel ] & ( ( uint32_t ) 1U << uxIndex ) ) != 0U )
+			{
+				ulTimerWheelMap[ uxLevel ] &= ~( ( uint32_t ) 1U << uxIndex );
+				pxSlot = &( xTimerWheel[ uxLevel ][ uxIndex ] );
+
+				while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+				{
+					pxItem = listGET_HEAD_ENTRY( pxSlot );
+					( void ) uxListRemove( pxItem );
+					prvPlaceInTimerWheel( pxItem );
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+#else
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
@@ -719,155 +1102,205 @@ BaseType_t xProcessTimerNow = pdFALSE;
 
 	return xProcessTimerNow;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void	prvProcessReceivedCommands( void )
 {
+#if ( configTIMER_COMMAND_BATCH_LENGTH > 1 )
+DaemonTaskMessage_t xMessages[ configTIMER_COMMAND_BATCH_LENGTH ];
+UBaseType_t uxReceived, uxMessage;
+
+	/* Receive the commands a batch at a time, which takes the queue lock
+	once per batch rather than once per command. */
+	while( ( uxReceived = xQueueReceiveMultiple( xTimerQueue, &( xMessages[ 0 ] ), ( UBaseType_t ) configTIMER_COMMAND_BATCH_LENGTH, tmrNO_DELAY ) ) != ( UBaseType_t ) 0U )
+	{
+		for( uxMessage = 0U; uxMessage < uxReceived; uxMessage++ )
+		{
+			prvProcessCommand( &( xMessages[ uxMessage ] ) );
+		}
+	}
+#else
 DaemonTaskMessage_t xMessage;
+
+	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+	{
+		prvProcessCommand( &xMessage );
+	}
+#endif /* configTIMER_COMMAND_BATCH_LENGTH */
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessCommand( const DaemonTaskMessage_t * const pxMessage )
+{
 Timer_t *pxTimer;
 BaseType_t xTimerListsWereSwitched, xResult;
 TickType_t xTimeNow;
 
-	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+	#if ( INCLUDE_xTimerPendFunctionCall == 1 )
 	{
-		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+		/* Negative commands are pended function calls rather than timer
+		commands. */
+		if( pxMessage->xMessageID < ( BaseType_t ) 0 )
 		{
-			/* Negative commands are pended function calls rather than timer
-			commands. */
-			if( xMessage.xMessageID < ( BaseType_t ) 0 )
-			{
-				const CallbackParameters_t * const pxCallback = &( xMessage.u.xCallbackParameters );
+			const CallbackParameters_t * const pxCallback = &( pxMessage->u.xCallbackParameters );
 
-				/* The timer uses the xCallbackParameters member to request a
-				callback be executed.  Check the callback is not NULL. */
-				configASSERT( pxCallback );
+			/* The timer uses the xCallbackParameters member to request a
+			callback be executed.  Check the callback is not NULL. */
+			configASSERT( pxCallback );
 
-				/* Call the function. */
-				pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			/* Call the function. */
+			pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
 		}
-		#endif /* INCLUDE_xTimerPendFunctionCall */
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* INCLUDE_xTimerPendFunctionCall */
+
+	/* Commands that are positive are timer commands rather than pended
+	function calls. */
+	if( pxMessage->xMessageID >= ( BaseType_t ) 0 )
+	{
+		/* The messages uses the xTimerParameters member to work on a
+		software timer. */
+		pxTimer = pxMessage->u.xTimerParameters.pxTimer;
 
-		/* Commands that are positive are timer commands rather than pended
-		function calls. */
-		if( xMessage.xMessageID >= ( BaseType_t ) 0 )
+		if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+		{
+			/* The timer is in a list, remove it. */
+			prvRemoveTimerFromActiveList( pxTimer );
+		}
+		else
 		{
-			/* The messages uses the xTimerParameters member to work on a
-			software timer. */
-			pxTimer = xMessage.u.xTimerParameters.pxTimer;
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
-			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+		traceTIMER_COMMAND_RECEIVED( pxTimer, pxMessage->xMessageID, pxMessage->u.xTimerParameters.xMessageValue );
 
-			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+		/* In this case the xTimerListsWereSwitched parameter is not used, but
+		it must be present in the function call.  prvSampleTimeNow() must be
+		called after the message is received from xTimerQueue so there is no
+		possibility of a higher priority task adding a message to the message
+		queue with a time that is ahead of the timer daemon task (because it
+		pre-empted the timer daemon task after the xTimeNow value was set). */
+		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
 
-			/* In this case the xTimerListsWereSwitched parameter is not used, but
-			it must be present in the function call.  prvSampleTimeNow() must be
-			called after the message is received from xTimerQueue so there is no
-			possibility of a higher priority task adding a message to the message
-			queue with a time that is ahead of the timer daemon task (because it
-			pre-empted the timer daemon task after the xTimeNow value was set). */
-			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+		switch( pxMessage->xMessageID )
+		{
+			case tmrCOMMAND_START :
+		    case tmrCOMMAND_START_FROM_ISR :
+		    case tmrCOMMAND_RESET :
+		    case tmrCOMMAND_RESET_FROM_ISR :
+			case tmrCOMMAND_START_DONT_TRACE :
+				/* Start or restart a timer. */
+				if( prvInsertTimerInActiveList( pxTimer,  pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, pxMessage->u.xTimerParameters.xMessageValue ) != pdFALSE )
+				{
+					/* The timer expired before it was added to the active
+					timer list.  Process it now. */
+					pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+					traceTIMER_EXPIRED( pxTimer );
 
-			switch( xMessage.xMessageID )
-			{
-				case tmrCOMMAND_START :
-			    case tmrCOMMAND_START_FROM_ISR :
-			    case tmrCOMMAND_RESET :
-			    case tmrCOMMAND_RESET_FROM_ISR :
-				case tmrCOMMAND_START_DONT_TRACE :
-					/* Start or restart a timer. */
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
+					if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
 					{
-						/* The timer expired before it was added to the active
-						timer list.  Process it now. */
-						pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-						traceTIMER_EXPIRED( pxTimer );
-
-						if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
-						{
-							xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
-							configASSERT( xResult );
-							( void ) xResult;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
+						configASSERT( xResult );
+						( void ) xResult;
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
-					break;
-
-				case tmrCOMMAND_STOP :
-				case tmrCOMMAND_STOP_FROM_ISR :
-					/* The timer has already been removed from the active list.
-					There is nothing to do here. */
-					break;
-
-				case tmrCOMMAND_CHANGE_PERIOD :
-				case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
-					pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-					configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
-
-					/* The new period does not really have a reference, and can
-					be longer or shorter than the old one.  The command time is
-					therefore set to the current time, and as the period cannot
-					be zero the next expiry time can only be in the future,
-					meaning (unlike for the xTimerStart() case above) there is
-					no fail case that needs to be handled here. */
-					( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-					break;
-
-				case tmrCOMMAND_DELETE :
-					/* The timer has already been removed from the active list,
-					just free up the memory if the memory was dynamically
-					allocated. */
-					#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				break;
+
+			case tmrCOMMAND_STOP :
+			case tmrCOMMAND_STOP_FROM_ISR :
+				/* The timer has already been removed from the active list.
+				There is nothing to do here. */
+				break;
+
+			case tmrCOMMAND_CHANGE_PERIOD :
+			case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+				pxTimer->xTimerPeriodInTicks = pxMessage->u.xTimerParameters.xMessageValue;
+				configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+				/* The new period does not really have a reference, and can
+				be longer or shorter than the old one.  The command time is
+				therefore set to the current time, and as the period cannot
+				be zero the next expiry time can only be in the future,
+				meaning (unlike for the xTimerStart() case above) there is
+				no fail case that needs to be handled here. */
+				( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+				break;
+
+			case tmrCOMMAND_DELETE :
+				/* The timer has already been removed from the active list,
+				just free up the memory if the memory was dynamically
+				allocated. */
+				#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+				{
+					/* The timer can only have been allocated dynamically -
+					free it again. */
+					vPortFree( pxTimer );
+				}
+				#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+				{
+					/* The timer could have been allocated statically or
+					dynamically, so check before attempting to free the
+					memory. */
+					if( pxTimer->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
 					{
-						/* The timer can only have been allocated dynamically -
-						free it again. */
 						vPortFree( pxTimer );
 					}
-					#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+					else
 					{
-						/* The timer could have been allocated statically or
-						dynamically, so check before attempting to free the
-						memory. */
-						if( pxTimer->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
-						{
-							vPortFree( pxTimer );
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						mtCOVERAGE_TEST_MARKER();
 					}
-					#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-					break;
+				}
+				#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+				break;
 
-				default	:
-					/* Don't expect to get here. */
-					break;
-			}
+			default	:
+				/* Don't expect to get here. */
+				break;
 		}
 	}
 }
 /*-----------------------------------------------------------*/
 
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer )
+{
+#if ( configUSE_TIMER_WHEEL == 1 )
+List_t * const pxList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+UBaseType_t uxSlot;
+
+	/* Clear the bit of a wheel slot that becomes empty. */
+	if( ( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0U ) && ( pxList != &xTimerWheelOverflow ) )
+	{
+		uxSlot = ( UBaseType_t ) ( pxList - &( xTimerWheel[ 0 ][ 0 ] ) );
+		ulTimerWheelMap[ uxSlot >> tmrWHEEL_SLOT_BITS ] &= ~( ( uint32_t ) 1U << ( uxSlot & tmrWHEEL_SLOT_MASK ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	uxTimerWheelCount--;
+#else
+	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+#endif /* configUSE_TIMER_WHEEL */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -925,6 +1358,8 @@ BaseType_t xResult;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -936,10 +1371,27 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if ( configUSE_TIMER_WHEEL == 1 )
+			{
+			UBaseType_t uxLevel, uxIndex;
+
+				for( uxLevel = 0U; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+				{
+					for( uxIndex = 0U; uxIndex < tmrWHEEL_SLOTS; uxIndex++ )
+					{
+						vListInitialise( &( xTimerWheel[ uxLevel ][ uxIndex ] ) );
+					}
+				}
+				vListInitialise( &xTimerWheelOverflow );
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOS\FreeRTOS_LowPower\Host\FreeRTOS.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in for the FreeRTOS definitions used by
+  *          low_power_tick_management.c, configured as FreeRTOSConfig.h.
+  *          configTICK_RATE_HZ can be set on the command line.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2016 STMicroelectronics International N.V. 
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without 
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other 
+  *    contributors to this software may be used to endorse or promote products 
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this 
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under 
+  *    this license is void and will automatically terminate your rights under 
+  *    this license. 
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS" 
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT 
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT 
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, 
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef long BaseType_t;
+typedef uint32_t TickType_t;
+
+/* Exported constants --------------------------------------------------------*/
+/* SystemCoreClock once SystemClock_Config() has run */
+#define configCPU_CLOCK_HZ                        72000000U
+#ifndef configTICK_RATE_HZ
+#define configTICK_RATE_HZ                        ( ( TickType_t ) 1000 )
+#endif
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY   15
+
+/* Exported macro ------------------------------------------------------------*/
+#define configPRE_SLEEP_PROCESSING( x )           ( void ) ( x )
+#define configPOST_SLEEP_PROCESSING( x )          ( void ) ( x )
+
+#endif /* INC_FREERTOS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
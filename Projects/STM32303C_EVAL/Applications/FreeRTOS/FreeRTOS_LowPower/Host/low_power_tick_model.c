@@ -0,0 +1,674 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOS\FreeRTOS_LowPower\Host\low_power_tick_model.c
+  * @author  MCD Application Team
+  * @brief   Host time model of SysTick and the RTC for the tickless idle of
+  *          low_power_tick_management.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2016 STMicroelectronics International N.V. 
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without 
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other 
+  *    contributors to this software may be used to endorse or promote products 
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this 
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under 
+  *    this license is void and will automatically terminate your rights under 
+  *    this license. 
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS" 
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT 
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT 
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, 
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+This program runs on the host. It builds low_power_tick_management.c as it
+is, against the stand-in headers of this directory, and runs its
+vPortSuppressTicksAndSleep() on a model of the time of the board:
+   + The CPU clock and the LSE are free running, with a random phase between
+     them. Every register access takes a few CPU cycles, so the code sees the
+     RTC counter change while it polls it, as on the target.
+   + SysTick counts CPU cycles, reloads one cycle after reaching 0 and pends
+     its interrupt while interrupts are disabled.
+   + The RTC calendar starts 10 seconds before the hour wraps around. The
+     wakeup timer starts up to one RTC count late and its first period is
+     short by up to one period.
+   + Sleep and Stop modes end at the wakeup timer or, once in 8 sleeps, at an
+     earlier interrupt. Stop mode adds an exit latency of up to
+     LPTICK_STOP_EXIT_LATENCY_US.
+
+The kernel tick k is due T0 + k * SysTickCountsPerTick cycles after SysTick
+first started, T0, shifted by the time between each RTC edge and the access
+that stopped or restarted SysTick after it: the time slept is counted from
+edge to edge, and the polling latencies are what a real board would lose
+too. Every SysTick interrupt is checked against this grid, so the tick count
+and the SysTickRemainder carry are checked to the cycle (zero drift). The
+model also checks that vTaskStepTick() never steps past the next timeout,
+that the timeout is never processed more than one RTC count late and that
+SysTick is never stopped for a time not given back to the kernel.
+
+Build and run:
+      gcc -O2 -I. -I../Inc -o low_power_tick_model low_power_tick_model.c
+      ./low_power_tick_model [sleeps [seed]]
+
+The default is 20000 sleeps. The program returns 0 when all checks pass.
+Other tick rates are modelled with e.g. -DconfigTICK_RATE_HZ=1024.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+/* The code under test */
+#include "../Src/low_power_tick_management.c"
+
+/* Private define ------------------------------------------------------------*/
+#define MODEL_CPU_HZ                   ((uint64_t)configCPU_CLOCK_HZ)
+#define MODEL_RTC_HZ                   ((uint64_t)LPTICK_RTC_HZ)
+#define MODEL_RTC_START                (3590U * MODEL_RTC_HZ)
+#define MODEL_SLEEPS                   20000U
+#define MODEL_SEED                     0x4C505449U
+
+/* Cost of a register access, plus 0 to 3 cycles */
+#define MODEL_ACCESS_CYCLES            4U
+
+/* Stop mode exit latency, restart of the clocks included */
+#define MODEL_STOP_LATENCY_MIN_US      1000U
+#define MODEL_STOP_LATENCY_MAX_US      LPTICK_STOP_EXIT_LATENCY_US
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint64_t Now;                 /* CPU cycles since the start */
+  uint64_t Phase;               /* LSE phase, in 1/MODEL_RTC_HZ cycle */
+  uint32_t Seed;
+  uint32_t IrqEnabled;
+  Model_RegistersTypeDef Seen;  /* registers as left by the last access */
+
+  /* SysTick */
+  uint32_t Pending;             /* tick interrupt pending */
+  uint64_t PendingTime;         /* when it was pended */
+  int64_t PendingShift;         /* shift of the grid then */
+  uint32_t Cleared;             /* VAL written since SysTick stopped */
+  uint64_t StopTime;            /* when SysTick stopped */
+  int64_t StopEdge;             /* last RTC edge before, in 1/MODEL_RTC_HZ cycle */
+
+  /* RTC wakeup timer, in RTC counts */
+  uint32_t WutRunning;
+  uint64_t WutExpiry;
+  uint64_t WutPeriod;
+
+  /* Kernel */
+  TickType_t Ticks;
+  TickType_t IdleTicks;         /* tick count when the idle task decided to sleep */
+  TickType_t Deadline;          /* next timeout */
+
+  /* Tick k is due at T0 + k * SysTickCountsPerTick + Shift / MODEL_RTC_HZ */
+  uint64_t T0;
+  int64_t Shift;
+  int64_t MaxError;             /* in 1/MODEL_RTC_HZ cycle */
+  int64_t LastError;
+  int64_t MaxLate;              /* timeout processed late, in 1/MODEL_RTC_HZ cycle */
+  uint64_t PausedCycles;        /* SysTick stopped and restarted without sleeping */
+  uint32_t Pauses;
+  uint32_t LostTicks;
+  uint32_t EarlyWakeups;
+  uint32_t Failures;
+} Model_StateTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+Model_RegistersTypeDef ModelRegisters;
+static Model_StateTypeDef Model;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Model_Random(uint32_t Range);
+static uint64_t Model_RtcCount(uint64_t Time);
+static int64_t Model_RtcEdge(uint64_t Count);
+static void Model_Run(uint64_t Cycles);
+static void Model_Advance(uint64_t Cycles);
+static void Model_TickFire(void);
+static void Model_TickHandler(uint64_t Time, int64_t Shift);
+static void Model_TickCount(TickType_t Ticks);
+static void Model_ApplyWrites(void);
+static void Model_Refresh(void);
+static void Model_WaitForInterrupt(uint32_t StopMode);
+static void Model_Fail(const char *What);
+
+/* Private functions ---------------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+  uint32_t sleeps = MODEL_SLEEPS;
+  uint32_t i;
+  TickType_t expected;
+  LowPowerTick_StatsTypeDef stats;
+
+  Model.Seed = MODEL_SEED;
+  Model.MaxLate = INT64_MIN;
+  if (argc > 1)
+  {
+    sleeps = (uint32_t)strtoul(argv[1], NULL, 0);
+  }
+  if (argc > 2)
+  {
+    Model.Seed = (uint32_t)strtoul(argv[2], NULL, 0) | 1U;
+  }
+  Model.Phase = Model_Random((uint32_t)MODEL_CPU_HZ);
+
+  LowPowerTick_Init();
+
+  /* The kernel starts SysTick and the scheduler */
+  ModelRegisters.SysTickTimer.LOAD = SysTickCountsPerTick - 1U;
+  ModelRegisters.SysTickTimer.VAL = 0U;
+  ModelRegisters.SysTickTimer.CTRL = SysTick_CTRL_ENABLE_Msk;
+  Model.Seen.SysTickTimer = ModelRegisters.SysTickTimer;
+  Model.T0 = Model.Now;
+  Model.IrqEnabled = 1U;
+
+  for (i = 0U; i < sleeps; i++)
+  {
+    /* A quarter of the time with a budget too small for Stop mode */
+    if ((i % 1000U) == 0U)
+    {
+      LowPowerTick_SetWakeLatencyBudget((((i / 1000U) % 4U) == 3U) ? 0U : LPTICK_WAKE_LATENCY_BUDGET_US);
+    }
+
+    /* The tasks run for up to 3 ticks, then the kernel is idle until a
+       timeout a few ticks away or beyond the longest sleep */
+    Model_Run(Model_Random(3U * SysTickCountsPerTick));
+    if (Model_Random(4U) == 0U)
+    {
+      expected = 2U + Model_Random(20U);
+    }
+    else
+    {
+      expected = 2U + Model_Random(MaximumSuppressedTicks + (MaximumSuppressedTicks / 4U));
+    }
+    Model.IdleTicks = Model.Ticks;
+    Model.Deadline = Model.Ticks + ((expected > MaximumSuppressedTicks) ? MaximumSuppressedTicks : expected);
+
+    vPortSuppressTicksAndSleep(expected);
+  }
+
+  /* Let the last ticks be checked */
+  Model_Run(10U * SysTickCountsPerTick);
+
+  LowPowerTick_GetStats(&stats);
+
+  if (Model.MaxError > (int64_t)MODEL_RTC_HZ)
+  {
+    Model_Fail("tick grid error above one cycle");
+  }
+  if (Model.MaxLate > (int64_t)(MODEL_CPU_HZ * MODEL_RTC_HZ / LPTICK_RTC_HZ))
+  {
+    Model_Fail("timeout processed more than one RTC count late");
+  }
+  if (Model.LostTicks != 0U)
+  {
+    Model_Fail("tick interrupt lost");
+  }
+  if (Model.Pauses != 0U)
+  {
+    Model_Fail("SysTick stopped for time not given back to the kernel");
+  }
+  if (stats.SleepModeCount + stats.StopModeCount == 0U)
+  {
+    Model_Fail("tick never suppressed");
+  }
+
+  printf("sleeps:            %lu (%lu in Sleep mode, %lu in Stop mode, %lu ended by an interrupt)\n",
+         (unsigned long)sleeps, (unsigned long)stats.SleepModeCount,
+         (unsigned long)stats.StopModeCount, (unsigned long)Model.EarlyWakeups);
+  printf("time:              %.3f s, %lu ticks, %lu suppressed\n",
+         (double)Model.Now / (double)MODEL_CPU_HZ, (unsigned long)Model.Ticks,
+         (unsigned long)stats.SuppressedTicks);
+  printf("tick grid error:   %.3f cycles at most, %.3f at the end\n",
+         (double)Model.MaxError / (double)MODEL_RTC_HZ, (double)Model.LastError / (double)MODEL_RTC_HZ);
+  printf("edge latencies:    %.3f us shift of the grid\n",
+         (double)Model.Shift * 1e6 / (double)(MODEL_CPU_HZ * MODEL_RTC_HZ));
+  printf("paused SysTick:    %lu cycles in %lu sleeps given up\n",
+         (unsigned long)Model.PausedCycles, (unsigned long)Model.Pauses);
+  printf("latest timeout:    %.1f us\n",
+         (double)Model.MaxLate * 1e6 / (double)(MODEL_CPU_HZ * MODEL_RTC_HZ));
+  printf("Stop exit latency: %lu us estimated\n", (unsigned long)stats.StopExitLatencyUs);
+  printf("%lu check(s) failed\n", (unsigned long)Model.Failures);
+
+  return (Model.Failures == 0U) ? 0 : 1;
+}
+
+/**
+  * @brief  Access a register of the model.
+  * @note   The writes of the code since the last access take effect, then
+  *         time passes.
+  * @param  None
+  * @retval None
+  */
+void Model_Access(void)
+{
+  Model_Run(MODEL_ACCESS_CYCLES + Model_Random(4U));
+}
+
+void __disable_irq(void)
+{
+  Model_Run(1U);
+  Model.IrqEnabled = 0U;
+}
+
+void __enable_irq(void)
+{
+  Model_Run(1U);
+  Model.IrqEnabled = 1U;
+  if (Model.Pending != 0U)
+  {
+    Model.Pending = 0U;
+    Model_TickHandler(Model.PendingTime, Model.PendingShift);
+  }
+}
+
+void HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry)
+{
+  (void)Regulator;
+  (void)SLEEPEntry;
+  Model_WaitForInterrupt(0U);
+}
+
+void HAL_PWR_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry)
+{
+  (void)Regulator;
+  (void)STOPEntry;
+  Model_WaitForInterrupt(1U);
+}
+
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct)
+{
+  (void)RCC_OscInitStruct;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit)
+{
+  (void)PeriphClkInit;
+  return HAL_OK;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  (void)IRQn;
+  (void)PreemptPriority;
+  (void)SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  (void)IRQn;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+  (void)IRQn;
+}
+
+void HAL_SuspendTick(void)
+{
+}
+
+void HAL_ResumeTick(void)
+{
+}
+
+void SystemClock_Config(void)
+{
+}
+
+eSleepModeStatus eTaskConfirmSleepModeStatus(void)
+{
+  /* A tick was held pending since the idle task decided to sleep, or once in
+     a while a task was made ready by an interrupt */
+  if ((Model.Ticks != Model.IdleTicks) || (Model_Random(64U) == 0U))
+  {
+    return eAbortSleep;
+  }
+  return eStandardSleep;
+}
+
+void vTaskStepTick(const TickType_t xTicksToJump)
+{
+  if ((Model.Ticks + xTicksToJump) > Model.Deadline)
+  {
+    Model_Fail("tick count stepped past the next timeout");
+  }
+  Model_TickCount(xTicksToJump);
+}
+
+BaseType_t xTaskIncrementTick(void)
+{
+  Model_TickCount(1U);
+  return 0;
+}
+
+/**
+  * @brief  Draw a pseudo-random number (xorshift32).
+  * @param  Range: Number of values
+  * @retval Number from 0 to Range - 1
+  */
+static uint32_t Model_Random(uint32_t Range)
+{
+  Model.Seed ^= Model.Seed << 13;
+  Model.Seed ^= Model.Seed >> 17;
+  Model.Seed ^= Model.Seed << 5;
+  return (Range != 0U) ? (Model.Seed % Range) : 0U;
+}
+
+/**
+  * @brief  RTC count at a time.
+  * @param  Time: CPU cycles since the start
+  * @retval RTC counts since the calendar was at 00:00
+  */
+static uint64_t Model_RtcCount(uint64_t Time)
+{
+  return MODEL_RTC_START + (((Time * MODEL_RTC_HZ) + Model.Phase) / MODEL_CPU_HZ);
+}
+
+/**
+  * @brief  Exact time of an RTC edge.
+  * @param  Count: RTC count the edge starts
+  * @retval Time of the edge, in 1/MODEL_RTC_HZ cycle
+  */
+static int64_t Model_RtcEdge(uint64_t Count)
+{
+  return (int64_t)((Count - MODEL_RTC_START) * MODEL_CPU_HZ) - (int64_t)Model.Phase;
+}
+
+/**
+  * @brief  Let time pass.
+  * @param  Cycles: CPU cycles
+  * @retval None
+  */
+static void Model_Run(uint64_t Cycles)
+{
+  Model_ApplyWrites();
+  Model_Advance(Cycles);
+  Model_Refresh();
+  Model.Seen = ModelRegisters;
+}
+
+/**
+  * @brief  Count SysTick down as time passes.
+  * @note   SysTick reloads one cycle after reaching 0, and its interrupt is
+  *         due when it reaches 0.
+  * @param  Cycles: CPU cycles
+  * @retval None
+  */
+static void Model_Advance(uint64_t Cycles)
+{
+  uint64_t end = Model.Now + Cycles;
+  uint64_t step;
+
+  while (Model.Now < end)
+  {
+    if ((ModelRegisters.SysTickTimer.CTRL & SysTick_CTRL_ENABLE_Msk) == 0U)
+    {
+      Model.Now = end;
+    }
+    else if (ModelRegisters.SysTickTimer.VAL == 0U)
+    {
+      Model.Now++;
+      ModelRegisters.SysTickTimer.VAL = ModelRegisters.SysTickTimer.LOAD;
+    }
+    else
+    {
+      step = end - Model.Now;
+      if (step > ModelRegisters.SysTickTimer.VAL)
+      {
+        step = ModelRegisters.SysTickTimer.VAL;
+      }
+      Model.Now += step;
+      ModelRegisters.SysTickTimer.VAL -= (uint32_t)step;
+      if (ModelRegisters.SysTickTimer.VAL == 0U)
+      {
+        Model_TickFire();
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Take or pend a SysTick interrupt.
+  * @param  None
+  * @retval None
+  */
+static void Model_TickFire(void)
+{
+  if (Model.IrqEnabled != 0U)
+  {
+    Model_TickHandler(Model.Now, Model.Shift);
+  }
+  else if (Model.Pending == 0U)
+  {
+    Model.Pending = 1U;
+    Model.PendingTime = Model.Now;
+    Model.PendingShift = Model.Shift;
+  }
+  else
+  {
+    Model.LostTicks++;
+  }
+}
+
+/**
+  * @brief  The SysTick handler.
+  * @note   The tick it counts must have been due when SysTick reached 0.
+  * @param  Time: When SysTick reached 0
+  * @param  Shift: Shift of the tick grid then
+  * @retval None
+  */
+static void Model_TickHandler(uint64_t Time, int64_t Shift)
+{
+  uint64_t tick = (uint64_t)Model.Ticks + 1U;
+  int64_t error;
+
+  error = (int64_t)(Time * MODEL_RTC_HZ)
+        - ((int64_t)((Model.T0 + (tick * SysTickCountsPerTick)) * MODEL_RTC_HZ) + Shift);
+  Model.LastError = error;
+  error = (error < 0) ? -error : error;
+  if (error > Model.MaxError)
+  {
+    Model.MaxError = error;
+  }
+
+  (void)xTaskIncrementTick();
+}
+
+/**
+  * @brief  Count ticks, and how late the next timeout is processed.
+  * @param  Ticks: Number of ticks
+  * @retval None
+  */
+static void Model_TickCount(TickType_t Ticks)
+{
+  int64_t late;
+
+  if ((Model.Ticks < Model.Deadline) && ((Model.Ticks + Ticks) >= Model.Deadline))
+  {
+    late = (int64_t)(Model.Now * MODEL_RTC_HZ)
+         - ((int64_t)((Model.T0 + ((uint64_t)Model.Deadline * SysTickCountsPerTick)) * MODEL_RTC_HZ) + Model.Shift);
+    if (late > Model.MaxLate)
+    {
+      Model.MaxLate = late;
+    }
+  }
+  Model.Ticks += Ticks;
+}
+
+/**
+  * @brief  Apply the writes of the code since the last access.
+  * @param  None
+  * @retval None
+  */
+static void Model_ApplyWrites(void)
+{
+  SysTick_Type *systick = &ModelRegisters.SysTickTimer;
+  RTC_TypeDef *rtc = &ModelRegisters.Rtc;
+  uint64_t count = Model_RtcCount(Model.Now);
+
+  /* Any write clears the SysTick counter. Writing 0 to a counter stopped
+     at 0 is not seen, but SysTick reloads from 0 alike */
+  if (systick->VAL != Model.Seen.SysTickTimer.VAL)
+  {
+    systick->VAL = 0U;
+  }
+  if ((systick->VAL == 0U) && ((Model.Seen.SysTickTimer.CTRL & SysTick_CTRL_ENABLE_Msk) == 0U))
+  {
+    Model.Cleared = 1U;
+  }
+
+  if (((systick->CTRL ^ Model.Seen.SysTickTimer.CTRL) & SysTick_CTRL_ENABLE_Msk) != 0U)
+  {
+    if ((systick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0U)
+    {
+      Model.StopTime = Model.Now;
+      Model.StopEdge = Model_RtcEdge(count);
+      Model.Cleared = 0U;
+    }
+    else if (Model.Cleared != 0U)
+    {
+      /* Restarted for the time slept from edge to edge: the grid moves by
+         the difference of the latencies after the two edges */
+      Model.Shift += ((int64_t)(Model.Now * MODEL_RTC_HZ) - Model_RtcEdge(count))
+                   - ((int64_t)(Model.StopTime * MODEL_RTC_HZ) - Model.StopEdge);
+    }
+    else
+    {
+      /* Restarted where it stopped */
+      Model.Shift += (int64_t)((Model.Now - Model.StopTime) * MODEL_RTC_HZ);
+      Model.PausedCycles += Model.Now - Model.StopTime;
+      Model.Pauses++;
+    }
+  }
+
+  if (((rtc->CR ^ Model.Seen.Rtc.CR) & RTC_CR_WUTE) != 0U)
+  {
+    Model.WutRunning = ((rtc->CR & RTC_CR_WUTE) != 0U) ? 1U : 0U;
+    if (Model.WutRunning != 0U)
+    {
+      /* Up to one count to start, then a first period of 1 to 16 counts */
+      Model.WutPeriod = ((uint64_t)(rtc->WUTR & 0xFFFFU) + 1U) * LPTICK_WUT_DIVIDER;
+      Model.WutExpiry = count + Model_Random(2U) + 1U + Model_Random(LPTICK_WUT_DIVIDER)
+                      + ((uint64_t)(rtc->WUTR & 0xFFFFU) * LPTICK_WUT_DIVIDER);
+    }
+  }
+
+  /* A pended tick interrupt is cleared by writing PENDSTCLR */
+  if ((ModelRegisters.Scb.ICSR != Model.Seen.Scb.ICSR) &&
+      ((ModelRegisters.Scb.ICSR & SCB_ICSR_PENDSTCLR_Msk) != 0U))
+  {
+    Model.Pending = 0U;
+  }
+
+  /* WUTF is cleared by writing 0 */
+  if (rtc->ISR != Model.Seen.Rtc.ISR)
+  {
+    rtc->ISR &= ~RTC_ISR_WUTF | Model.Seen.Rtc.ISR;
+  }
+}
+
+/**
+  * @brief  Update the registers the hardware sets.
+  * @param  None
+  * @retval None
+  */
+static void Model_Refresh(void)
+{
+  RTC_TypeDef *rtc = &ModelRegisters.Rtc;
+  uint64_t count = Model_RtcCount(Model.Now);
+  uint32_t seconds = (uint32_t)((count / MODEL_RTC_HZ) % 3600U);
+
+  rtc->SSR = LPTICK_RTC_SYNCH_PREDIV - (uint32_t)(count % MODEL_RTC_HZ);
+  rtc->TR = (((seconds / 600U) << RTC_TR_MNT_Pos) | (((seconds / 60U) % 10U) << RTC_TR_MNU_Pos)
+          | (((seconds % 60U) / 10U) << RTC_TR_ST_Pos) | ((seconds % 10U) << RTC_TR_SU_Pos));
+
+  rtc->ISR &= ~(RTC_ISR_INITF | RTC_ISR_WUTWF);
+  rtc->ISR |= ((rtc->ISR & RTC_ISR_INIT) != 0U) ? RTC_ISR_INITF : 0U;
+  rtc->ISR |= (Model.WutRunning == 0U) ? RTC_ISR_WUTWF : 0U;
+  while ((Model.WutRunning != 0U) && (count >= Model.WutExpiry))
+  {
+    rtc->ISR |= RTC_ISR_WUTF;
+    Model.WutExpiry += Model.WutPeriod;
+  }
+
+  ModelRegisters.Scb.ICSR = (Model.Pending != 0U) ? SCB_ICSR_PENDSTSET_Msk : 0U;
+}
+
+/**
+  * @brief  Wait for an interrupt in Sleep or Stop mode.
+  * @note   Ends at the wakeup timer, or at another interrupt once in 8 sleeps.
+  * @param  StopMode: 1 for Stop mode
+  * @retval None
+  */
+static void Model_WaitForInterrupt(uint32_t StopMode)
+{
+  uint64_t wakeup;
+
+  Model_Run(0U);
+  if ((Model.Pending != 0U) || (Model.WutRunning == 0U) ||
+      ((ModelRegisters.Rtc.CR & RTC_CR_WUTIE) == 0U))
+  {
+    if (Model.Pending == 0U)
+    {
+      Model_Fail("sleep without a wakeup source");
+    }
+    return;
+  }
+
+  wakeup = (uint64_t)((Model_RtcEdge(Model.WutExpiry) + (int64_t)MODEL_RTC_HZ - 1) / (int64_t)MODEL_RTC_HZ);
+  if (Model_Random(8U) == 0U)
+  {
+    wakeup = Model.Now + Model_Random((uint32_t)(wakeup - Model.Now));
+    Model.EarlyWakeups++;
+  }
+  Model_Run(wakeup - Model.Now);
+
+  if (StopMode != 0U)
+  {
+    Model_Run((MODEL_CPU_HZ / 1000000U) * (MODEL_STOP_LATENCY_MIN_US
+              + Model_Random(MODEL_STOP_LATENCY_MAX_US - MODEL_STOP_LATENCY_MIN_US + 1U)));
+  }
+}
+
+/**
+  * @brief  Report a failed check.
+  * @param  What: Description of the check
+  * @retval None
+  */
+static void Model_Fail(const char *What)
+{
+  printf("FAILED at %.6f s: %s\n", (double)Model.Now / (double)MODEL_CPU_HZ, What);
+  Model.Failures++;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
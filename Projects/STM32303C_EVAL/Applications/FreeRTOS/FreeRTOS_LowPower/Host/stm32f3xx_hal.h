@@ -0,0 +1,207 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOS\FreeRTOS_LowPower\Host\stm32f3xx_hal.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in for the HAL and CMSIS definitions used by
+  *          low_power_tick_management.c. The RTC, SysTick and SCB registers
+  *          are those of the time model of low_power_tick_model.c: every
+  *          access goes through Model_Access(), which lets time pass.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2016 STMicroelectronics International N.V. 
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without 
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other 
+  *    contributors to this software may be used to endorse or promote products 
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this 
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under 
+  *    this license is void and will automatically terminate your rights under 
+  *    this license. 
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS" 
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT 
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT 
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, 
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F3xx_HAL_H
+#define __STM32F3xx_HAL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U
+} HAL_StatusTypeDef;
+
+typedef struct
+{
+  uint32_t PLLState;
+} RCC_PLLInitTypeDef;
+
+typedef struct
+{
+  uint32_t OscillatorType;
+  uint32_t LSEState;
+  RCC_PLLInitTypeDef PLL;
+} RCC_OscInitTypeDef;
+
+typedef struct
+{
+  uint32_t PeriphClockSelection;
+  uint32_t RTCClockSelection;
+} RCC_PeriphCLKInitTypeDef;
+
+typedef struct
+{
+  uint32_t TR;
+  uint32_t CR;
+  uint32_t ISR;
+  uint32_t PRER;
+  uint32_t WUTR;
+  uint32_t WPR;
+  uint32_t SSR;
+} RTC_TypeDef;
+
+typedef struct
+{
+  uint32_t CTRL;
+  uint32_t LOAD;
+  uint32_t VAL;
+} SysTick_Type;
+
+typedef struct
+{
+  uint32_t ICSR;
+} SCB_Type;
+
+typedef struct
+{
+  uint32_t IMR;
+  uint32_t RTSR;
+  uint32_t PR;
+} EXTI_TypeDef;
+
+typedef enum
+{
+  RTC_WKUP_IRQn = 3
+} IRQn_Type;
+
+/* The registers of the time model */
+typedef struct
+{
+  RTC_TypeDef Rtc;
+  SysTick_Type SysTickTimer;
+  SCB_Type Scb;
+  EXTI_TypeDef Exti;
+} Model_RegistersTypeDef;
+
+extern Model_RegistersTypeDef ModelRegisters;
+
+/* Exported constants --------------------------------------------------------*/
+#define LSE_VALUE                     32768U
+
+#define RCC_OSCILLATORTYPE_LSE        0x00000004U
+#define RCC_LSE_ON                    0x00000001U
+#define RCC_PLL_NONE                  0x00000000U
+#define RCC_PERIPHCLK_RTC             0x00010000U
+#define RCC_RTCCLKSOURCE_LSE          0x00000100U
+
+#define PWR_MAINREGULATOR_ON          0x00000000U
+#define PWR_LOWPOWERREGULATOR_ON      0x00000001U
+#define PWR_SLEEPENTRY_WFI            0x01U
+#define PWR_STOPENTRY_WFI             0x01U
+
+#define RTC_TR_SU_Pos                 (0U)
+#define RTC_TR_SU                     (0xFU << RTC_TR_SU_Pos)
+#define RTC_TR_ST_Pos                 (4U)
+#define RTC_TR_ST                     (0x7U << RTC_TR_ST_Pos)
+#define RTC_TR_MNU_Pos                (8U)
+#define RTC_TR_MNU                    (0xFU << RTC_TR_MNU_Pos)
+#define RTC_TR_MNT_Pos                (12U)
+#define RTC_TR_MNT                    (0x7U << RTC_TR_MNT_Pos)
+#define RTC_CR_WUCKSEL                (0x7U << 0U)
+#define RTC_CR_BYPSHAD                (0x1U << 5U)
+#define RTC_CR_FMT                    (0x1U << 6U)
+#define RTC_CR_WUTE                   (0x1U << 10U)
+#define RTC_CR_WUTIE                  (0x1U << 14U)
+#define RTC_ISR_WUTWF                 (0x1U << 2U)
+#define RTC_ISR_INITF                 (0x1U << 6U)
+#define RTC_ISR_INIT                  (0x1U << 7U)
+#define RTC_ISR_WUTF                  (0x1U << 10U)
+#define RTC_PRER_PREDIV_A_Pos         (16U)
+#define RTC_SSR_SS                    (0xFFFFU << 0U)
+
+#define EXTI_IMR_MR20                 (0x1U << 20U)
+#define EXTI_RTSR_TR20                (0x1U << 20U)
+#define EXTI_PR_PR20                  (0x1U << 20U)
+
+#define SysTick_CTRL_ENABLE_Msk       (1UL)
+#define SCB_ICSR_PENDSTCLR_Msk        (1UL << 25U)
+#define SCB_ICSR_PENDSTSET_Msk        (1UL << 26U)
+
+/* Exported macro ------------------------------------------------------------*/
+#define RTC                           (Model_Access(), &ModelRegisters.Rtc)
+#define SysTick                       (Model_Access(), &ModelRegisters.SysTickTimer)
+#define SCB                           (Model_Access(), &ModelRegisters.Scb)
+#define EXTI                          (&ModelRegisters.Exti)
+
+#define __HAL_RCC_RTC_ENABLE()        do { } while (0)
+#define __DSB()                       do { } while (0)
+#define __ISB()                       do { } while (0)
+
+/* Exported functions ------------------------------------------------------- */
+/* Time model, see low_power_tick_model.c */
+void Model_Access(void);
+void __disable_irq(void);
+void __enable_irq(void);
+void HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry);
+void HAL_PWR_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry);
+
+/* Without effect on the model */
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+void HAL_SuspendTick(void);
+void HAL_ResumeTick(void);
+void SystemClock_Config(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F3xx_HAL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
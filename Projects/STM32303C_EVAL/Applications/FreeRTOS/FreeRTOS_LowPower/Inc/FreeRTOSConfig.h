@@ -88,7 +88,7 @@
 #define configUSE_PREEMPTION                    1
 #define configUSE_IDLE_HOOK                     0
 #define configUSE_TICK_HOOK                     0
-#define configUSE_TICKLESS_IDLE                 1
+#define configUSE_TICKLESS_IDLE                 2
 #define configCPU_CLOCK_HZ                      ( SystemCoreClock )
 #define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES                    ( 7 )
@@ -170,11 +170,14 @@ void PostSleepProcessing(uint32_t * ulExpectedIdleTime);
 /* The configPRE_SLEEP_PROCESSING() and configPOST_SLEEP_PROCESSING() macros
 allow the application writer to add additional code before and after the MCU is
 placed into the low power state respectively.  The empty implementations
-provided in this demo can be extended to save even more power. */
-#if configUSE_TICKLESS_IDLE == 1 
+provided in this demo can be extended to save even more power.
+configUSE_TICKLESS_IDLE is set to 2 as the application provides its own
+vPortSuppressTicksAndSleep(), in low_power_tick_management.c, which times the
+low power state with the RTC wakeup timer instead of SysTick. */
+#if configUSE_TICKLESS_IDLE != 0
 #define configPRE_SLEEP_PROCESSING                        PreSleepProcessing
 #define configPOST_SLEEP_PROCESSING                       PostSleepProcessing
-#endif /* configUSE_TICKLESS_IDLE == 1 */
+#endif /* configUSE_TICKLESS_IDLE != 0 */
 
 /* IMPORTANT: This define MUST be commented when used with STM32Cube firmware,
               to prevent overwriting SysTick_Handler defined within STM32Cube HAL */
@@ -60,6 +60,7 @@ extern "C" {
 /* Exported constants --------------------------------------------------------*/
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
+void SystemClock_Config(void);
 
 #ifdef __cplusplus
 }
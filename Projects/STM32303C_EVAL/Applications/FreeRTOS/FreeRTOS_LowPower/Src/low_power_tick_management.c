@@ -0,0 +1,494 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOS\FreeRTOS_LowPower\Src\low_power_tick_management.c
+  * @author  MCD Application Team
+  * @brief   FreeRTOS tickless idle based on the RTC wakeup timer.
+  *
+  *          The kernel tick is generated by SysTick while tasks run. When the
+  *          idle task finds nothing to do for configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+  *          ticks or more, vPortSuppressTicksAndSleep() stops SysTick, programs
+  *          the RTC wakeup timer for the next kernel timeout and enters Sleep
+  *          or Stop mode:
+  *           + The RTC runs from the LSE in both modes, so one sleep can last
+  *             up to 32 seconds whatever the tick rate.
+  *           + The time actually slept is read from the RTC calendar and
+  *             sub-second counter, and the part of a SysTick count it does not
+  *             fill is carried to the next sleep, so the tick count does not
+  *             drift however often the tick is suppressed.
+  *           + Stop mode is only used when its wakeup latency, restart of the
+  *             HSE and PLL included, fits in the budget given to
+  *             LowPowerTick_SetWakeLatencyBudget() and the kernel is idle long
+  *             enough for it to pay off. Sleep mode is used otherwise.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2016 STMicroelectronics International N.V. 
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without 
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice, 
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other 
+  *    contributors to this software may be used to endorse or promote products 
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this 
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under 
+  *    this license is void and will automatically terminate your rights under 
+  *    this license. 
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS" 
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT 
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT 
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, 
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF 
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "low_power_tick_management.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* The RTC counts the LSE with the asynchronous prescaler bypassed, so the
+   sub-second counter has a resolution of one LSE period and the calendar
+   still advances once per second */
+#define LPTICK_RTC_HZ                  LSE_VALUE
+#define LPTICK_RTC_ASYNCH_PREDIV       0U
+#define LPTICK_RTC_SYNCH_PREDIV        (LPTICK_RTC_HZ - 1U)
+
+/* RTC time stamps are taken modulo one hour of the calendar */
+#define LPTICK_RTC_WRAP                (3600U * LPTICK_RTC_HZ)
+
+/* The wakeup timer counts RTCCLK/16 periods, 65536 of them at most */
+#define LPTICK_WUT_DIVIDER             16U
+#define LPTICK_WUT_MAX_PERIODS         0x10000U
+
+/* Wakeup latency of Stop mode, restart of the HSE and PLL included. This is
+   the initial estimate, raised whenever a longer one is measured */
+#define LPTICK_STOP_EXIT_LATENCY_US    2500U
+
+/* Shortest time in Stop mode that saves more than restarting the clocks costs */
+#define LPTICK_STOP_MIN_RESIDENCY_US   2000U
+
+/* Wake latency budget until LowPowerTick_SetWakeLatencyBudget() is called */
+#define LPTICK_WAKE_LATENCY_BUDGET_US  5000U
+
+/* Shortest first SysTick period after a sleep, in SysTick counts: SysTick
+   must not reach 0 before its reload is set back to a whole tick, a few
+   instructions after it restarts */
+#define LPTICK_SYSTICK_MIN_RELOAD      32U
+
+/* Private macro -------------------------------------------------------------*/
+#define LPTICK_US_TO_RTC(__US__)       ((uint32_t)(((uint64_t)(__US__) * LPTICK_RTC_HZ) / 1000000U))
+#define LPTICK_RTC_TO_US(__RTC__)      ((uint32_t)(((uint64_t)(__RTC__) * 1000000U) / LPTICK_RTC_HZ))
+
+/* Private variables ---------------------------------------------------------*/
+/* SysTick counts in one tick, and per second */
+static uint32_t SysTickCountsPerTick = 0;
+static uint32_t SysTickHz = 0;
+
+/* The longest sleep the wakeup timer can time, in ticks */
+static TickType_t MaximumSuppressedTicks = 0;
+
+/* Time slept that did not make a whole SysTick count yet, in 1/LPTICK_RTC_HZ
+   of a count */
+static uint32_t SysTickRemainder = 0;
+
+/* Wake latency budget, Stop mode latency and residency, in RTC counts */
+static volatile uint32_t WakeLatencyBudget = 0;
+static uint32_t StopExitLatency = 0;
+static uint32_t StopMinResidency = 0;
+
+static LowPowerTick_StatsTypeDef LowPowerTickStats;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t RTC_ReadCounter(void);
+static uint32_t RTC_WaitCounterEdge(void);
+static void RTC_StopWakeUpTimer(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Configure the RTC for the low power tick.
+  * @note   The LSE is started and selected as RTC clock. The wakeup timer
+  *         interrupt is routed to EXTI line 20 so that it also ends Stop mode.
+  *         To be called once the system clock is configured and before the
+  *         scheduler is started.
+  * @param  None
+  * @retval None
+  */
+void LowPowerTick_Init(void)
+{
+  RCC_OscInitTypeDef        RCC_OscInitStruct;
+  RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
+
+  /* Start the LSE and select it as RTC clock source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSE;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+  RCC_OscInitStruct.LSEState = RCC_LSE_ON;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    /* Initialization Error */
+    while(1);
+  }
+
+  PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+  PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSE;
+  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct) != HAL_OK)
+  {
+    /* Initialization Error */
+    while(1);
+  }
+  __HAL_RCC_RTC_ENABLE();
+
+  /* Disable the write protection for RTC registers */
+  RTC->WPR = 0xCAU;
+  RTC->WPR = 0x53U;
+
+  /* Set the prescalers in initialization mode: the synchronous one first,
+     then the asynchronous one, in two separate writes */
+  RTC->ISR |= RTC_ISR_INIT;
+  while ((RTC->ISR & RTC_ISR_INITF) == 0U)
+  {
+  }
+  RTC->PRER = LPTICK_RTC_SYNCH_PREDIV;
+  RTC->PRER |= (LPTICK_RTC_ASYNCH_PREDIV << RTC_PRER_PREDIV_A_Pos);
+
+  /* 24 hour format, and calendar read straight from the counters, as the
+     shadow registers are not updated in Stop mode */
+  RTC->CR &= ~RTC_CR_FMT;
+  RTC->CR |= RTC_CR_BYPSHAD;
+  RTC->ISR &= ~RTC_ISR_INIT;
+
+  /* The wakeup timer counts RTCCLK/16 periods */
+  RTC->CR &= ~(RTC_CR_WUTE | RTC_CR_WUTIE);
+  while ((RTC->ISR & RTC_ISR_WUTWF) == 0U)
+  {
+  }
+  RTC->CR &= ~RTC_CR_WUCKSEL;
+
+  /* Enable the write protection for RTC registers */
+  RTC->WPR = 0xFFU;
+
+  /* RTC wakeup timer interrupt through EXTI line 20, rising edge */
+  EXTI->IMR |= EXTI_IMR_MR20;
+  EXTI->RTSR |= EXTI_RTSR_TR20;
+  HAL_NVIC_SetPriority(RTC_WKUP_IRQn, configLIBRARY_LOWEST_INTERRUPT_PRIORITY, 0U);
+  HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+
+  /* SysTick is set up by the kernel with the same clock and reload */
+  SysTickCountsPerTick = configCPU_CLOCK_HZ / configTICK_RATE_HZ;
+  /* Not SysTickCountsPerTick * configTICK_RATE_HZ, which is less when the
+     tick rate does not divide the clock */
+  SysTickHz = configCPU_CLOCK_HZ;
+
+  /* Keep two wakeup timer periods of margin, see vPortSuppressTicksAndSleep() */
+  MaximumSuppressedTicks = (TickType_t)((((uint64_t)(LPTICK_WUT_MAX_PERIODS - 2U) * LPTICK_WUT_DIVIDER) * configTICK_RATE_HZ) / LPTICK_RTC_HZ);
+
+  WakeLatencyBudget = LPTICK_US_TO_RTC(LPTICK_WAKE_LATENCY_BUDGET_US);
+  StopExitLatency = LPTICK_US_TO_RTC(LPTICK_STOP_EXIT_LATENCY_US);
+  StopMinResidency = LPTICK_US_TO_RTC(LPTICK_STOP_MIN_RESIDENCY_US);
+}
+
+/**
+  * @brief  Set the wake latency budget.
+  * @note   This is the longest time the application accepts between an
+  *         interrupt and its handler running while the kernel sleeps. Stop
+  *         mode is not used while its wakeup latency is above the budget, so
+  *         a budget of 0 restricts the low power tick to Sleep mode.
+  * @param  WakeLatencyBudgetUs: Wake latency budget, in microseconds
+  * @retval None
+  */
+void LowPowerTick_SetWakeLatencyBudget(uint32_t WakeLatencyBudgetUs)
+{
+  WakeLatencyBudget = LPTICK_US_TO_RTC(WakeLatencyBudgetUs);
+}
+
+/**
+  * @brief  Get the low power tick statistics.
+  * @param  Stats: Pointer to the structure to fill
+  * @retval None
+  */
+void LowPowerTick_GetStats(LowPowerTick_StatsTypeDef *Stats)
+{
+  taskENTER_CRITICAL();
+  *Stats = LowPowerTickStats;
+  Stats->StopExitLatencyUs = LPTICK_RTC_TO_US(StopExitLatency);
+  taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Handle the RTC wakeup timer interrupt.
+  * @note   To be called from RTC_WKUP_IRQHandler(). vPortSuppressTicksAndSleep()
+  *         normally clears the interrupt itself before it is taken.
+  * @param  None
+  * @retval None
+  */
+void LowPowerTick_WakeUpIRQHandler(void)
+{
+  RTC_StopWakeUpTimer();
+}
+
+/**
+  * @brief  Suppress the kernel tick and sleep.
+  * @note   Called by the idle task, with the scheduler suspended, when the
+  *         kernel has nothing to do for xExpectedIdleTime ticks.
+  *         configUSE_TICKLESS_IDLE is set to 2 so that this function replaces
+  *         the SysTick based one of the port.
+  * @param  xExpectedIdleTime: Number of ticks until the next kernel timeout
+  * @retval None
+  */
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+  TickType_t xModifiableIdleTime, xCompleteTicks;
+  uint32_t start, end, wakeup, periods, elapsedInTick, reload, remainder;
+  uint64_t counts;
+  uint8_t stopmode;
+
+  if (xExpectedIdleTime > MaximumSuppressedTicks)
+  {
+    xExpectedIdleTime = MaximumSuppressedTicks;
+  }
+
+  __disable_irq();
+  __DSB();
+  __ISB();
+
+  /* A context switch may have been requested, or a task made ready, since
+     the idle task decided to sleep */
+  if (eTaskConfirmSleepModeStatus() == eAbortSleep)
+  {
+    __enable_irq();
+    return;
+  }
+
+  /* Get the wakeup timer ready to be started, which takes up to two RTCCLK
+     periods, then stop SysTick on an edge of the RTC counter so that the
+     time slept is known to the RTC count */
+  RTC_StopWakeUpTimer();
+  start = RTC_WaitCounterEdge();
+  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+  /* SysTick reloads one count after reaching 0, when the tick falls due */
+  reload = SysTick->VAL;
+  elapsedInTick = SysTickCountsPerTick - reload;
+  if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)
+  {
+    /* A tick fell due while waiting for the edge: it is counted with the
+       time slept rather than by the SysTick handler, so that SysTick never
+       stops for a time that is not given back to the kernel */
+    SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+    if (reload != 0U)
+    {
+      elapsedInTick += SysTickCountsPerTick;
+    }
+  }
+
+  /* Time to the next kernel timeout, in RTC counts, rounded down */
+  counts = ((uint64_t)xExpectedIdleTime * SysTickCountsPerTick) - elapsedInTick;
+  wakeup = (uint32_t)((counts * LPTICK_RTC_HZ) / SysTickHz);
+
+  /* Shorter than the wakeup timer can time, at a high tick rate, SysTick is
+     just restarted on the next edge */
+  if (wakeup >= (2U * LPTICK_WUT_DIVIDER))
+  {
+    /* Stop mode when its wakeup latency is within budget and the kernel is
+       idle long enough, in which case the MCU is woken that much earlier so
+       that the timeout is still met */
+    stopmode = ((StopExitLatency <= WakeLatencyBudget) && (wakeup >= (StopExitLatency + StopMinResidency))) ? 1U : 0U;
+    if (stopmode != 0U)
+    {
+      wakeup -= StopExitLatency;
+    }
+
+    /* The timer may start up to one RTC count after the edge, and its first
+       period may be short by up to one period, so program one period less
+       than fits */
+    periods = (wakeup - 2U) / LPTICK_WUT_DIVIDER;
+    periods = (periods > 2U) ? (periods - 2U) : 0U;
+    RTC->WPR = 0xCAU;
+    RTC->WPR = 0x53U;
+    RTC->WUTR = periods;
+    RTC->CR |= (RTC_CR_WUTE | RTC_CR_WUTIE);
+    RTC->WPR = 0xFFU;
+
+    HAL_SuspendTick();
+
+    /* configPRE_SLEEP_PROCESSING() can set xModifiableIdleTime to 0 if it
+       puts the MCU to sleep itself */
+    xModifiableIdleTime = xExpectedIdleTime;
+    configPRE_SLEEP_PROCESSING(&xModifiableIdleTime);
+    if (xModifiableIdleTime > 0U)
+    {
+      if (stopmode != 0U)
+      {
+        HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+        /* The MCU runs from the HSI when leaving Stop mode */
+        SystemClock_Config();
+      }
+      else
+      {
+        HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+      }
+    }
+    configPOST_SLEEP_PROCESSING(&xExpectedIdleTime);
+
+    if (stopmode != 0U)
+    {
+      if ((RTC->ISR & RTC_ISR_WUTF) != 0U)
+      {
+        /* Woken by the timer: measure the latency from the earliest time the
+           timer can have expired, which errs on the safe side */
+        end = RTC_ReadCounter();
+        wakeup = ((end + LPTICK_RTC_WRAP - start) % LPTICK_RTC_WRAP) - (periods * LPTICK_WUT_DIVIDER);
+        if ((wakeup > StopExitLatency) && (wakeup < LPTICK_RTC_HZ))
+        {
+          StopExitLatency = wakeup;
+        }
+      }
+      LowPowerTickStats.StopModeCount++;
+    }
+    else
+    {
+      LowPowerTickStats.SleepModeCount++;
+    }
+    RTC_StopWakeUpTimer();
+    HAL_ResumeTick();
+  }
+
+  /* Restart SysTick on an edge of the RTC counter too, so that it was
+     stopped for a whole number of RTC counts. Its reload is worked out ahead
+     for the next edge, and again should that edge be missed */
+  do
+  {
+    end = (RTC_ReadCounter() + 1U) % LPTICK_RTC_WRAP;
+
+    /* Time slept in SysTick counts, the fraction of a count carried over */
+    counts = ((uint64_t)((end + LPTICK_RTC_WRAP - start) % LPTICK_RTC_WRAP) * SysTickHz) + SysTickRemainder;
+    remainder = (uint32_t)(counts % LPTICK_RTC_HZ);
+    counts = (counts / LPTICK_RTC_HZ) + elapsedInTick;
+
+    /* Whole ticks elapsed, and SysTick counts to the next tick */
+    xCompleteTicks = (TickType_t)(counts / SysTickCountsPerTick);
+    reload = SysTickCountsPerTick - (uint32_t)(counts % SysTickCountsPerTick);
+    if (reload < LPTICK_SYSTICK_MIN_RELOAD)
+    {
+      /* Too close to the tick to let SysTick count it: count it now and let
+         SysTick count to the next one */
+      xCompleteTicks++;
+      reload += SysTickCountsPerTick;
+    }
+
+    SysTick->LOAD = reload - 1U;
+    SysTick->VAL = 0U;
+  } while (RTC_WaitCounterEdge() != end);
+
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = SysTickCountsPerTick - 1U;
+  SysTickRemainder = remainder;
+
+  /* Step the tick count up to the tick before the timeout: the ticks from
+     there on must go through xTaskIncrementTick() for the tasks due to be
+     unblocked. With the scheduler suspended they are pended and processed
+     when the idle task resumes it */
+  LowPowerTickStats.SuppressedTicks += xCompleteTicks;
+  if (xCompleteTicks >= xExpectedIdleTime)
+  {
+    vTaskStepTick(xExpectedIdleTime - 1U);
+    xCompleteTicks -= (xExpectedIdleTime - 1U);
+    while (xCompleteTicks > 0U)
+    {
+      (void)xTaskIncrementTick();
+      xCompleteTicks--;
+    }
+  }
+  else
+  {
+    vTaskStepTick(xCompleteTicks);
+  }
+
+  __enable_irq();
+}
+
+/**
+  * @brief  Read the RTC counter.
+  * @note   The minutes, seconds and sub-seconds are read twice, as they are
+  *         read straight from the counters, until both reads agree.
+  * @param  None
+  * @retval Time in the hour, in RTC counts
+  */
+static uint32_t RTC_ReadCounter(void)
+{
+  uint32_t ssr, tr, seconds;
+
+  do
+  {
+    ssr = RTC->SSR;
+    tr = RTC->TR;
+  } while ((ssr != RTC->SSR) || (tr != RTC->TR));
+
+  seconds = ((((tr & RTC_TR_MNT) >> RTC_TR_MNT_Pos) * 10U) + ((tr & RTC_TR_MNU) >> RTC_TR_MNU_Pos)) * 60U;
+  seconds += (((tr & RTC_TR_ST) >> RTC_TR_ST_Pos) * 10U) + ((tr & RTC_TR_SU) >> RTC_TR_SU_Pos);
+
+  /* The sub-second counter counts down */
+  return (seconds * LPTICK_RTC_HZ) + (LPTICK_RTC_SYNCH_PREDIV - (ssr & RTC_SSR_SS));
+}
+
+/**
+  * @brief  Wait for the RTC counter to change.
+  * @param  None
+  * @retval Time in the hour, in RTC counts, just after the edge
+  */
+static uint32_t RTC_WaitCounterEdge(void)
+{
+  uint32_t now, then;
+
+  now = RTC_ReadCounter();
+  do
+  {
+    then = RTC_ReadCounter();
+  } while (then == now);
+
+  return then;
+}
+
+/**
+  * @brief  Stop the RTC wakeup timer and clear its interrupt.
+  * @note   Returns once the timer can be programmed again.
+  * @param  None
+  * @retval None
+  */
+static void RTC_StopWakeUpTimer(void)
+{
+  RTC->WPR = 0xCAU;
+  RTC->WPR = 0x53U;
+  RTC->CR &= ~(RTC_CR_WUTE | RTC_CR_WUTIE);
+  while ((RTC->ISR & RTC_ISR_WUTWF) == 0U)
+  {
+  }
+  RTC->ISR = (~(RTC_ISR_WUTF | RTC_ISR_INIT)) | (RTC->ISR & RTC_ISR_INIT);
+  RTC->WPR = 0xFFU;
+
+  EXTI->PR = EXTI_PR_PR20;
+  NVIC_ClearPendingIRQ(RTC_WKUP_IRQn);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
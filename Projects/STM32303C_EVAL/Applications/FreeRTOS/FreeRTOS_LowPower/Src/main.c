@@ -46,6 +46,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "cmsis_os.h"
+#include "low_power_tick_management.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -75,7 +76,6 @@ much. */
 static void QueueReceiveThread(const void *argument);
 static void QueueSendThread(const void *argument);
 static void GPIO_ConfigAN(void);
-void SystemClock_Config(void);
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -107,6 +107,9 @@ int main(void)
   /* Initialize LED */
   BSP_LED_Init(LED1);
 
+  /* Configure the RTC wakeup timer that times the tick suppressed periods */
+  LowPowerTick_Init();
+
   /* Create the queue used by the two threads */
   osMessageQDef(osqueue, QUEUE_LENGTH, uint16_t);
   osQueue = osMessageCreate(osMessageQ(osqueue), NULL);
@@ -189,17 +192,13 @@ void PreSleepProcessing(uint32_t * ulExpectedIdleTime)
   NOTE:  Additional actions can be taken here to get the power consumption
   even lower.  For example, peripherals can be turned off here, and then back
   on again in the post sleep processing function.  For maximum power saving
-  ensure all unused pins are in their lowest power state. */
+  ensure all unused pins are in their lowest power state.
 
-  /* 
-    (*ulExpectedIdleTime) is set to 0 to indicate that PreSleepProcessing contains
-    its own wait for interrupt or wait for event instruction and so the kernel vPortSuppressTicksAndSleep 
-    function does not need to execute the wfi instruction  
-  */
-  *ulExpectedIdleTime = 0;
-  
-  /*Enter to sleep Mode using the HAL function HAL_PWR_EnterSLEEPMode with WFI instruction*/
-  HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);  
+  vPortSuppressTicksAndSleep() then enters Sleep or Stop mode itself, unless
+  (*ulExpectedIdleTime) is set to 0 here. */
+
+  /* Avoid compiler warnings about the unused parameter. */
+  (void) ulExpectedIdleTime;
 }
 
 /**
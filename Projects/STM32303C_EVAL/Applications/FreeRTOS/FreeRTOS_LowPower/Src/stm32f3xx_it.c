@@ -39,6 +39,7 @@
 #include "main.h"
 #include "stm32f3xx_it.h"
 #include "cmsis_os.h"
+#include "low_power_tick_management.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -137,6 +138,16 @@ void SysTick_Handler(void)
 /*  file (startup_stm32f3xx.s).                                               */
 /******************************************************************************/
 
+/**
+  * @brief  This function handles RTC wakeup timer interrupt request.
+  * @param  None
+  * @retval None
+  */
+void RTC_WKUP_IRQHandler(void)
+{
+  LowPowerTick_WakeUpIRQHandler();
+}
+
 /**
   * @brief  This function handles PPP interrupt request.
   * @param  None
@@ -0,0 +1,645 @@
+/**
+  ******************************************************************************
+  * @file    cpu_trace_decode.c
+  * @author  MCD Application Team
+  * @brief   Host decoder for the dumps of the cpu_trace recorder
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2016 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */ 
+
+/********************** NOTES **********************************************
+This program runs on the host. It reads a raw dump of the CPU_Trace variable
+of cpu_trace.c and prints the per-task and per-interrupt CPU usage, the
+distribution of the run segments and of the ready-to-run latencies, and with
+-t the timeline of all the records.
+
+Build and run:
+      gcc -O2 -o cpu_trace_decode cpu_trace_decode.c
+      ./cpu_trace_decode [-t] trace.bin
+
+The dump is made with the debugger once the recorder is stopped, e.g. with
+GDB: dump binary value trace.bin CPU_Trace
+
+Only the records still in the ring buffer are decoded. The timestamps are
+unwrapped assuming no two consecutive records are more than 2^32 cycles
+apart; the SYNC record written every CPU_TRACE_SYNC_PERIOD ticks guarantees
+it while the kernel tick runs.
+
+cpu_trace_model.c builds this file with CPU_TRACE_DECODE_NO_MAIN defined and
+checks what Decode() finds against the accounting of the recorder.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define MAGIC                 0x54555043U
+#define HEADER_SIZE           80U
+#define TASK_ENTRY_SIZE       32U
+#define NAME_LEN              16U
+#define MAX_TASKS             256U
+#define MAX_NESTING           16U
+#define HIST_BUCKETS          24U
+#define EXCEPTIONS            256U
+
+/* Record types, see cpu_trace.h */
+#define EVT_TASK_SWITCH_IN      0x01U
+#define EVT_TASK_CREATE         0x02U
+#define EVT_TASK_DELETE         0x03U
+#define EVT_TASK_READY          0x04U
+#define EVT_TASK_DELAY          0x05U
+#define EVT_QUEUE_CREATE        0x10U
+#define EVT_QUEUE_SEND          0x11U
+#define EVT_QUEUE_SEND_FAILED   0x12U
+#define EVT_QUEUE_RECEIVE       0x13U
+#define EVT_QUEUE_RECEIVE_FAILED 0x14U
+#define EVT_QUEUE_PEEK          0x15U
+#define EVT_QUEUE_SEND_ISR      0x16U
+#define EVT_QUEUE_RECEIVE_ISR   0x17U
+#define EVT_QUEUE_BLOCK_SEND    0x18U
+#define EVT_QUEUE_BLOCK_RECEIVE 0x19U
+#define EVT_ISR_ENTER           0x20U
+#define EVT_ISR_EXIT            0x21U
+#define EVT_SYNC                0x30U
+#define EVT_USER                0x31U
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Count;
+  uint32_t Bucket[HIST_BUCKETS];        /* Bucket b: [2^(b-1), 2^b) us, 0: < 1 us */
+  uint64_t Max;                         /* Cycles */
+} Histogram;
+
+typedef struct
+{
+  char     Name[NAME_LEN + 1U];
+  uint32_t TcbNumber;
+  uint32_t TargetSwitches;
+  uint64_t TargetCycles;
+  uint64_t Cycles;                      /* Decoded, ISRs excluded */
+  uint32_t Switches;
+  uint64_t SegmentStart;
+  uint64_t SegmentIsr;                  /* ISR cycles inside the current segment */
+  uint64_t ReadyTime;
+  int      Ready;
+  Histogram Run;
+  Histogram Latency;
+} TaskInfo;
+
+typedef struct
+{
+  uint32_t Count;
+  uint64_t Cycles;                      /* Nested interrupts excluded */
+  Histogram Duration;                   /* Nested interrupts included */
+} IsrInfo;
+
+/* Private variables ---------------------------------------------------------*/
+static TaskInfo Tasks[MAX_TASKS];
+static IsrInfo  Isrs[EXCEPTIONS];
+static uint32_t TaskCount;
+static double   CyclesPerUs;
+static uint64_t DecodedIsr;             /* Outermost interrupts, nesting included */
+static uint64_t DecodedKernel;          /* Outside tasks and interrupts */
+
+static const char *QueueTypes[] =
+{
+  "queue", "mutex", "counting semaphore", "binary semaphore", "recursive mutex"
+};
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t Get16(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t Get32(const uint8_t *p)
+{
+  return Get16(p) | (Get16(p + 2) << 16);
+}
+
+static uint64_t Get64(const uint8_t *p)
+{
+  return (uint64_t)Get32(p) | ((uint64_t)Get32(p + 4) << 32);
+}
+
+static double ToUs(uint64_t Cycles)
+{
+  return (double)Cycles / CyclesPerUs;
+}
+
+static void HistogramAdd(Histogram *pHist, uint64_t Cycles)
+{
+  double us = ToUs(Cycles);
+  uint32_t bucket = 0U;
+
+  while((us >= 1.0) && (bucket < (HIST_BUCKETS - 1U)))
+  {
+    us /= 2.0;
+    bucket++;
+  }
+  pHist->Bucket[bucket]++;
+  pHist->Count++;
+  if(Cycles > pHist->Max)
+  {
+    pHist->Max = Cycles;
+  }
+}
+
+static void HistogramPrint(const char *pTitle, const Histogram *pHist)
+{
+  uint32_t bucket;
+  uint32_t peak = 0U;
+  uint32_t bar;
+
+  if(pHist->Count == 0U)
+  {
+    return;
+  }
+  for(bucket = 0U; bucket < HIST_BUCKETS; bucket++)
+  {
+    if(pHist->Bucket[bucket] > peak)
+    {
+      peak = pHist->Bucket[bucket];
+    }
+  }
+
+  printf("    %s: %u samples, max %.1f us\n", pTitle, pHist->Count, ToUs(pHist->Max));
+  for(bucket = 0U; bucket < HIST_BUCKETS; bucket++)
+  {
+    if(pHist->Bucket[bucket] == 0U)
+    {
+      continue;
+    }
+    if(bucket == 0U)
+    {
+      printf("      %9s < %7u us %8u ", "", 1U, pHist->Bucket[bucket]);
+    }
+    else
+    {
+      printf("      %7u .. %7u us %8u ", 1U << (bucket - 1U), 1U << bucket,
+             pHist->Bucket[bucket]);
+    }
+    for(bar = 0U; bar < ((pHist->Bucket[bucket] * 40U + peak - 1U) / peak); bar++)
+    {
+      putchar('#');
+    }
+    putchar('\n');
+  }
+}
+
+static const char *TaskName(uint32_t Slot)
+{
+  static char name[24];
+
+  if((Slot < TaskCount) && (Tasks[Slot].TcbNumber != 0U))
+  {
+    return Tasks[Slot].Name;
+  }
+  snprintf(name, sizeof(name), "task#%u", Slot);
+  return name;
+}
+
+static const char *EventName(uint32_t Type)
+{
+  switch(Type)
+  {
+    case EVT_TASK_SWITCH_IN:       return "switch in";
+    case EVT_TASK_CREATE:          return "create";
+    case EVT_TASK_DELETE:          return "delete";
+    case EVT_TASK_READY:           return "ready";
+    case EVT_TASK_DELAY:           return "delay";
+    case EVT_QUEUE_CREATE:         return "create";
+    case EVT_QUEUE_SEND:           return "send";
+    case EVT_QUEUE_SEND_FAILED:    return "send failed";
+    case EVT_QUEUE_RECEIVE:        return "receive";
+    case EVT_QUEUE_RECEIVE_FAILED: return "receive failed";
+    case EVT_QUEUE_PEEK:           return "peek";
+    case EVT_QUEUE_SEND_ISR:       return "send from ISR";
+    case EVT_QUEUE_RECEIVE_ISR:    return "receive from ISR";
+    case EVT_QUEUE_BLOCK_SEND:     return "block on send";
+    case EVT_QUEUE_BLOCK_RECEIVE:  return "block on receive";
+    case EVT_ISR_ENTER:            return "enter";
+    case EVT_ISR_EXIT:             return "exit";
+    case EVT_SYNC:                 return "sync";
+    case EVT_USER:                 return "user";
+    default:                       return NULL;
+  }
+}
+
+static void PrintRecord(uint64_t Time, const char *pContext, uint32_t Type,
+                        uint32_t Id, uint32_t Param)
+{
+  const char *event = EventName(Type);
+
+  printf("%14.3f  %-16s ", ToUs(Time), pContext);
+  if(event == NULL)
+  {
+    printf("unknown record 0x%02x id %u param %u\n", Type, Id, Param);
+  }
+  else if(Type < EVT_QUEUE_CREATE)
+  {
+    printf("task %s %s", TaskName(Id), event);
+    if(Type == EVT_TASK_CREATE)
+    {
+      printf(", priority %u", Param);
+    }
+    putchar('\n');
+  }
+  else if(Type < EVT_ISR_ENTER)
+  {
+    printf("%s %u %s\n", (Id < 5U) ? QueueTypes[Id] : "queue", Param, event);
+  }
+  else if(Type < EVT_SYNC)
+  {
+    if(Id >= 16U)
+    {
+      printf("IRQ %u %s\n", Id - 16U, event);
+    }
+    else
+    {
+      printf("exception %u %s\n", Id, event);
+    }
+  }
+  else if(Type == EVT_SYNC)
+  {
+    printf("tick %u (low 16 bits)\n", Param);
+  }
+  else
+  {
+    printf("user channel %u value %u\n", Id, Param);
+  }
+}
+
+/**
+  * @brief  Decode a dump held in memory and print the report
+  * @param  pDump: the raw CPU_Trace variable
+  * @param  Size: size of the dump in bytes
+  * @param  pPath: name of the dump in the messages
+  * @param  Timeline: non-zero to print every record
+  * @retval 0, or 1 if the dump cannot be decoded
+  */
+static int Decode(const uint8_t *pDump, long Size, const char *pPath, int Timeline)
+{
+  uint32_t recordSize, bufferSize, maxTasks, taskOffset, bufferOffset;
+  uint32_t clockHz, head, recordCycles, retries, count, first, k, slot;
+  uint64_t isrCycles, kernelCycles;
+  uint64_t time = 0U, start = 0U, last32 = 0U, end;
+  uint64_t kernelStart = 0U, total;
+  uint64_t targetTotal;
+  uint32_t isrStack[MAX_NESTING];
+  uint64_t isrEnter[MAX_NESTING];
+  uint64_t isrChild[MAX_NESTING];
+  uint32_t nesting = 0U;
+  int current = -1;
+  char context[32];
+
+  memset(Tasks, 0, sizeof(Tasks));
+  memset(Isrs, 0, sizeof(Isrs));
+  DecodedIsr = 0U;
+  DecodedKernel = 0U;
+
+  if((Size < (long)HEADER_SIZE) || (Get32(pDump) != MAGIC))
+  {
+    fprintf(stderr, "%s: not a cpu_trace dump\n", pPath);
+    return 1;
+  }
+  recordSize   = Get16(pDump + 6);
+  bufferSize   = Get32(pDump + 8);
+  maxTasks     = Get32(pDump + 12);
+  taskOffset   = Get32(pDump + 16);
+  bufferOffset = Get32(pDump + 20);
+  clockHz      = Get32(pDump + 24);
+  head         = Get32(pDump + 32);
+  recordCycles = Get32(pDump + 36);
+  retries      = Get32(pDump + 40);
+  isrCycles    = Get64(pDump + 64);
+  kernelCycles = Get64(pDump + 72);
+  if((Get16(pDump + 4) != 1U) || (recordSize != 8U) || (maxTasks > MAX_TASKS) ||
+     (bufferSize == 0U) || ((bufferSize & (bufferSize - 1U)) != 0U) ||
+     ((uint64_t)taskOffset + (uint64_t)maxTasks * TASK_ENTRY_SIZE > (uint64_t)Size) ||
+     ((uint64_t)bufferOffset + (uint64_t)bufferSize * recordSize > (uint64_t)Size) ||
+     (clockHz == 0U))
+  {
+    fprintf(stderr, "%s: unsupported or truncated dump\n", pPath);
+    return 1;
+  }
+  CyclesPerUs = clockHz / 1e6;
+
+  TaskCount = maxTasks;
+  targetTotal = isrCycles + kernelCycles;
+  for(slot = 0U; slot < maxTasks; slot++)
+  {
+    const uint8_t *entry = pDump + taskOffset + slot * TASK_ENTRY_SIZE;
+
+    memcpy(Tasks[slot].Name, entry, NAME_LEN);
+    Tasks[slot].Name[NAME_LEN] = '\0';
+    Tasks[slot].TcbNumber      = Get32(entry + 16);
+    Tasks[slot].TargetSwitches = Get32(entry + 20);
+    Tasks[slot].TargetCycles   = Get64(entry + 24);
+    targetTotal += Tasks[slot].TargetCycles;
+  }
+
+  count = (head < bufferSize) ? head : bufferSize;
+  first = head - count;
+  if(count == 0U)
+  {
+    printf("empty trace\n");
+    return 0;
+  }
+
+  if(Timeline != 0)
+  {
+    printf("%14s  %-16s event\n", "time (us)", "context");
+  }
+
+  for(k = 0U; k < count; k++)
+  {
+    const uint8_t *record = pDump + bufferOffset + ((first + k) & (bufferSize - 1U)) * recordSize;
+    uint32_t timestamp = Get32(record);
+    uint32_t type = record[4];
+    uint32_t id = record[5];
+    uint32_t param = Get16(record + 6);
+
+    /* Unwrap the 32-bit cycle counter */
+    if(k == 0U)
+    {
+      time = start = kernelStart = timestamp;
+    }
+    else
+    {
+      time += (uint32_t)(timestamp - (uint32_t)last32);
+    }
+    last32 = timestamp;
+
+    if(Timeline != 0)
+    {
+      if(nesting != 0U)
+      {
+        if(isrStack[nesting - 1U] >= 16U)
+        {
+          snprintf(context, sizeof(context), "IRQ %u", isrStack[nesting - 1U] - 16U);
+        }
+        else
+        {
+          snprintf(context, sizeof(context), "exception %u", isrStack[nesting - 1U]);
+        }
+      }
+      else if(current >= 0)
+      {
+        snprintf(context, sizeof(context), "%s", TaskName((uint32_t)current));
+      }
+      else
+      {
+        snprintf(context, sizeof(context), "-");
+      }
+      PrintRecord(time - start, context, type, id, param);
+    }
+
+    switch(type)
+    {
+      case EVT_TASK_SWITCH_IN:
+        if(id >= maxTasks)
+        {
+          break;
+        }
+        if(current >= 0)
+        {
+          TaskInfo *pTask = &Tasks[current];
+          uint64_t run = time - pTask->SegmentStart - pTask->SegmentIsr;
+
+          pTask->Cycles += run;
+          HistogramAdd(&pTask->Run, run);
+        }
+        else
+        {
+          DecodedKernel += time - kernelStart;
+        }
+        current = (int)id;
+        Tasks[id].Switches++;
+        Tasks[id].SegmentStart = time;
+        Tasks[id].SegmentIsr = 0U;
+        if(Tasks[id].Ready != 0)
+        {
+          HistogramAdd(&Tasks[id].Latency, time - Tasks[id].ReadyTime);
+          Tasks[id].Ready = 0;
+        }
+        break;
+
+      case EVT_TASK_READY:
+        if((id < maxTasks) && ((int)id != current) && (Tasks[id].Ready == 0))
+        {
+          Tasks[id].Ready = 1;
+          Tasks[id].ReadyTime = time;
+        }
+        break;
+
+      case EVT_ISR_ENTER:
+        if(nesting < MAX_NESTING)
+        {
+          isrStack[nesting] = id;
+          isrEnter[nesting] = time;
+          isrChild[nesting] = 0U;
+        }
+        nesting++;
+        break;
+
+      case EVT_ISR_EXIT:
+        if(nesting == 0U)
+        {
+          /* Entered before the oldest record */
+          break;
+        }
+        nesting--;
+        if(nesting < MAX_NESTING)
+        {
+          uint64_t inclusive = time - isrEnter[nesting];
+          IsrInfo *pIsr = &Isrs[isrStack[nesting]];
+
+          pIsr->Count++;
+          pIsr->Cycles += inclusive - isrChild[nesting];
+          HistogramAdd(&pIsr->Duration, inclusive);
+          if(nesting != 0U)
+          {
+            isrChild[nesting - 1U] += inclusive;
+          }
+          else
+          {
+            DecodedIsr += inclusive;
+            if(current >= 0)
+            {
+              Tasks[current].SegmentIsr += inclusive;
+            }
+            else
+            {
+              kernelStart += inclusive;
+            }
+          }
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  /* Close the last segment at the last record */
+  end = time;
+  if(current >= 0)
+  {
+    Tasks[current].Cycles += end - Tasks[current].SegmentStart - Tasks[current].SegmentIsr;
+  }
+  else
+  {
+    DecodedKernel += end - kernelStart;
+  }
+  total = end - start;
+
+  printf("\ncpu_trace dump %s: %u records, %u lost, %u in the buffer\n", pPath,
+         head, head - count, count);
+  printf("  clock %.3f MHz, %.3f ms decoded\n", clockHz / 1e6, ToUs(total) / 1000.0);
+  printf("  recorder: %u cycles per hook, %u retries, %.3f%% of the CPU over the decoded records\n",
+         recordCycles, retries,
+         (total != 0U) ? (100.0 * (double)count * recordCycles / (double)total) : 0.0);
+
+  printf("\n  %-16s %12s %7s %9s | %12s %7s %9s\n", "task", "decoded us", "cpu %",
+         "switches", "target us", "cpu %", "switches");
+  for(slot = 0U; slot < maxTasks; slot++)
+  {
+    if((Tasks[slot].TcbNumber == 0U) && (Tasks[slot].Switches == 0U))
+    {
+      continue;
+    }
+    printf("  %-16s %12.1f %7.2f %9u | %12.1f %7.2f %9u\n", TaskName(slot),
+           ToUs(Tasks[slot].Cycles),
+           (total != 0U) ? (100.0 * (double)Tasks[slot].Cycles / (double)total) : 0.0,
+           Tasks[slot].Switches, ToUs(Tasks[slot].TargetCycles),
+           (targetTotal != 0U) ? (100.0 * (double)Tasks[slot].TargetCycles / (double)targetTotal) : 0.0,
+           Tasks[slot].TargetSwitches);
+  }
+  printf("  %-16s %12.1f %7.2f %9s | %12.1f %7.2f\n", "(interrupts)", ToUs(DecodedIsr),
+         (total != 0U) ? (100.0 * (double)DecodedIsr / (double)total) : 0.0, "",
+         ToUs(isrCycles),
+         (targetTotal != 0U) ? (100.0 * (double)isrCycles / (double)targetTotal) : 0.0);
+  printf("  %-16s %12.1f %7.2f %9s | %12.1f %7.2f\n", "(kernel)", ToUs(DecodedKernel),
+         (total != 0U) ? (100.0 * (double)DecodedKernel / (double)total) : 0.0, "",
+         ToUs(kernelCycles),
+         (targetTotal != 0U) ? (100.0 * (double)kernelCycles / (double)targetTotal) : 0.0);
+
+  for(slot = 0U; slot < maxTasks; slot++)
+  {
+    if((Tasks[slot].Run.Count == 0U) && (Tasks[slot].Latency.Count == 0U))
+    {
+      continue;
+    }
+    printf("\n  task %s\n", TaskName(slot));
+    HistogramPrint("run segments", &Tasks[slot].Run);
+    HistogramPrint("ready to running latency", &Tasks[slot].Latency);
+  }
+
+  for(k = 0U; k < EXCEPTIONS; k++)
+  {
+    if(Isrs[k].Count == 0U)
+    {
+      continue;
+    }
+    if(k >= 16U)
+    {
+      printf("\n  IRQ %u: %u calls, %.1f us (%.2f%%)\n", k - 16U, Isrs[k].Count,
+             ToUs(Isrs[k].Cycles), 100.0 * (double)Isrs[k].Cycles / (double)total);
+    }
+    else
+    {
+      printf("\n  exception %u: %u calls, %.1f us (%.2f%%)\n", k, Isrs[k].Count,
+             ToUs(Isrs[k].Cycles), 100.0 * (double)Isrs[k].Cycles / (double)total);
+    }
+    HistogramPrint("duration", &Isrs[k].Duration);
+  }
+
+  return 0;
+}
+
+#ifndef CPU_TRACE_DECODE_NO_MAIN
+/**
+  * @brief  Decode a dump file
+  */
+int main(int argc, char *argv[])
+{
+  const char *path = NULL;
+  int timeline = 0;
+  FILE *file;
+  uint8_t *dump;
+  long size;
+  int argi;
+  int status;
+
+  for(argi = 1; argi < argc; argi++)
+  {
+    if(strcmp(argv[argi], "-t") == 0)
+    {
+      timeline = 1;
+    }
+    else
+    {
+      path = argv[argi];
+    }
+  }
+  if(path == NULL)
+  {
+    fprintf(stderr, "usage: %s [-t] trace.bin\n", argv[0]);
+    return 2;
+  }
+
+  file = fopen(path, "rb");
+  if(file == NULL)
+  {
+    perror(path);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  dump = malloc((size_t)size + 1U);
+  if((dump == NULL) || (fread(dump, 1, (size_t)size, file) != (size_t)size))
+  {
+    fprintf(stderr, "%s: read error\n", path);
+    return 1;
+  }
+  fclose(file);
+
+  status = Decode(dump, size, path, timeline);
+
+  free(dump);
+  return status;
+}
+#endif /* CPU_TRACE_DECODE_NO_MAIN */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,527 @@
+/**
+  ******************************************************************************
+  * @file    cpu_trace_model.c
+  * @author  MCD Application Team
+  * @brief   Host model of the CPU running under the cpu_trace recorder, which
+  *          checks the accounting of the recorder against the decoder
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2016 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+This program runs on the host. It builds ../cpu_trace.c as it is, against the
+stand-in main.h of this directory, and drives its hooks from a model of the
+CPU:
+   + The DWT cycle counter only moves when the model lets time pass, never
+     inside a hook, so every hook costs nothing. It starts 2^20 cycles before
+     it wraps around and wraps many times: runs of up to 2^32 + 2^30 cycles
+     have a SYNC record every 2^30 cycles, like the kernel tick does.
+   + Random task switches, task and queue events and interrupts nested up to
+     MODEL_NESTING deep, some of them in between the switch out and switch in
+     hooks. The kernel picks the next task in no time, since the decoder,
+     which has no switch out record, gives that time to the task switched
+     out.
+   + LDREX/STREX follow the exclusive monitor: an interrupt raised between
+     the two clears it, so the STREX fails and the record is retried.
+
+The model keeps the cycles of each task, of the interrupts and of the kernel
+itself, and checks that the recorder accounted the same, that
+cpu_trace_decode.c decodes the same from the CPU_Trace variable, and that
+every record retried was preempted.
+
+Build and run:
+      gcc -O2 -I. -o cpu_trace_model cpu_trace_model.c
+      ./cpu_trace_model [rounds [seed]]
+
+The default is 20000 rounds. The program returns 0 when all checks pass.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* The code under test, with a ring buffer that holds all the records */
+#define CPU_TRACE_BUFFER_SIZE          (1U << 18)
+#include "../cpu_trace.c"
+
+#define CPU_TRACE_DECODE_NO_MAIN
+#include "cpu_trace_decode.c"
+
+/* Private define ------------------------------------------------------------*/
+#define MODEL_ROUNDS                   20000U
+#define MODEL_SEED                     0x43505554U
+#define MODEL_CPU_HZ                   72000000U
+#define MODEL_CYCCNT_START             (0xFFFFFFFFU - (1U << 20) + 1U)
+
+#define MODEL_TASKS                    5U
+#define MODEL_IRQS                     4U
+#define MODEL_NESTING                  3U
+
+/* Longest run between two hooks, in a task or in an interrupt */
+#define MODEL_RUN_CYCLES               20000U
+#define MODEL_ISR_CYCLES               2000U
+
+/* Long runs: MODEL_LONG_CHUNKS chunks with a SYNC record in between */
+#define MODEL_LONG_CHUNK_CYCLES        (1ULL << 30)
+#define MODEL_LONG_CHUNKS              5U
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint64_t Now;                 /* Cycles since the recorder started */
+  uint32_t Seed;
+  uint32_t Primask;
+  uint32_t Ipsr;
+  uint32_t Exclusive;           /* Exclusive monitor open */
+  uint32_t Preempt;             /* Interrupt raised at the next STREX */
+  uint32_t Preemptions;
+  uint32_t Nesting;
+  int32_t  Task;                /* Running task slot, -1 for the kernel */
+  uint32_t Slots[MODEL_TASKS];
+  uint32_t Ticks;
+  uint32_t Wraps;
+  uint32_t LongRuns;
+
+  /* What ran, in cycles */
+  uint64_t TaskCycles[MODEL_TASKS];
+  uint32_t Switches[MODEL_TASKS];
+  uint64_t IsrCycles;
+  uint64_t KernelCycles;
+  uint32_t IsrCalls[EXCEPTIONS];
+  uint32_t MaxNesting;
+
+  uint32_t Failures;
+} Model_StateTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+CoreDebug_Type ModelCoreDebug;
+DWT_Type ModelDwt;
+uint32_t SystemCoreClock = MODEL_CPU_HZ;
+
+static Model_StateTypeDef Model;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Model_Random(uint32_t Range);
+static void Model_Run(uint64_t Cycles);
+static void Model_LongRun(void);
+static void Model_Interrupt(void);
+static void Model_Switch(uint32_t Task);
+static void Model_Event(void);
+static void Model_Check(void);
+static void Model_Fail(const char *What);
+
+/* Private functions ---------------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+  static const char *names[MODEL_TASKS] = { "Idle", "Ctrl", "Net", "Log", "Sensor" };
+  uint32_t rounds = MODEL_ROUNDS;
+  uint32_t round;
+  uint32_t task;
+
+  Model.Seed = MODEL_SEED;
+  if (argc > 1)
+  {
+    rounds = (uint32_t)strtoul(argv[1], NULL, 0);
+  }
+  if (argc > 2)
+  {
+    Model.Seed = (uint32_t)strtoul(argv[2], NULL, 0) | 1U;
+  }
+
+  /* Init clears the cycle counter, restart the recorder close to its wrap */
+  CPU_TRACE_Init();
+  ModelDwt.CYCCNT = MODEL_CYCCNT_START;
+  CPU_TRACE_Start();
+  Model.Task = -1;
+
+  for (task = 0U; task < MODEL_TASKS; task++)
+  {
+    Model.Slots[task] = CPU_TRACE_TaskCreate(task + 1U, names[task], task);
+  }
+  (void)CPU_TRACE_QueueCreate(0U);
+
+  /* The kernel starts, with interrupts, before the first task */
+  Model_Run(Model_Random(MODEL_RUN_CYCLES));
+  Model_Interrupt();
+  Model_Run(Model_Random(MODEL_RUN_CYCLES));
+  Model_Switch(0U);
+
+  for (round = 0U; round < rounds; round++)
+  {
+    switch (Model_Random(16U))
+    {
+      case 0U:
+      case 1U:
+      case 2U:
+        Model_Interrupt();
+        break;
+
+      case 3U:
+      case 4U:
+        Model_Switch(Model_Random(MODEL_TASKS));
+        break;
+
+      case 5U:
+      case 6U:
+        Model_Event();
+        break;
+
+      case 7U:
+        /* An interrupt preempts the next record */
+        Model.Preempt = 1U;
+        Model_Event();
+        break;
+
+      case 8U:
+        if (Model_Random(32U) == 0U)
+        {
+          Model_LongRun();
+          break;
+        }
+        /* Fall through */
+      default:
+        Model_Run(Model_Random(MODEL_RUN_CYCLES));
+        break;
+    }
+  }
+
+  /* The decoder stops at the last record */
+  CPU_TRACE_UserEvent(0U, 0U);
+  CPU_TRACE_Stop();
+
+  Model_Check();
+
+  printf("rounds:            %lu, %lu records, %lu retried\n", (unsigned long)rounds,
+         (unsigned long)CPU_Trace.Head, (unsigned long)CPU_Trace.Retries);
+  printf("time:              %.3f s, %lu counter wraps, %lu long runs\n",
+         (double)Model.Now / (double)MODEL_CPU_HZ, (unsigned long)Model.Wraps,
+         (unsigned long)Model.LongRuns);
+  printf("interrupts:        %.3f ms, nested up to %lu deep\n",
+         (double)Model.IsrCycles * 1e3 / (double)MODEL_CPU_HZ, (unsigned long)Model.MaxNesting);
+  printf("kernel:            %.3f ms\n", (double)Model.KernelCycles * 1e3 / (double)MODEL_CPU_HZ);
+  printf("%lu check(s) failed\n", (unsigned long)Model.Failures);
+
+  return (Model.Failures == 0U) ? 0 : 1;
+}
+
+/**
+  * @brief  Compare the model, the recorder and the decoder.
+  * @param  None
+  * @retval None
+  */
+static void Model_Check(void)
+{
+  CPU_TRACE_StatsTypeDef stats;
+  uint64_t isrCycles = 0U;
+  uint64_t longest = 0U;
+  uint32_t task;
+  uint32_t slot;
+  uint32_t k;
+
+  CPU_TRACE_GetStats(&stats);
+
+  if (stats.LostRecords != 0U)
+  {
+    Model_Fail("ring buffer too small for the rounds");
+  }
+  if (stats.TotalCycles != Model.Now)
+  {
+    Model_Fail("recorder total against the time run");
+  }
+  if (stats.Retries != Model.Preemptions)
+  {
+    Model_Fail("records retried against the records preempted");
+  }
+
+  /* The recorder against the model */
+  for (task = 0U; task < MODEL_TASKS; task++)
+  {
+    slot = Model.Slots[task];
+    if ((CPU_Trace.Tasks[slot].Cycles != Model.TaskCycles[task]) ||
+        (CPU_Trace.Tasks[slot].Switches != Model.Switches[task]))
+    {
+      Model_Fail("recorder task cycles or switches");
+    }
+    if (Model.TaskCycles[task] > longest)
+    {
+      longest = Model.TaskCycles[task];
+    }
+  }
+  if (CPU_Trace.IsrCycles != Model.IsrCycles)
+  {
+    Model_Fail("recorder interrupt cycles");
+  }
+  if (CPU_Trace.KernelCycles != Model.KernelCycles)
+  {
+    Model_Fail("recorder kernel cycles");
+  }
+
+  /* The decoder against the recorder, when it has all the records */
+  if (stats.LostRecords != 0U)
+  {
+    return;
+  }
+  if (Decode((const uint8_t *)&CPU_Trace, (long)sizeof(CPU_Trace), "CPU_Trace", 0) != 0)
+  {
+    Model_Fail("dump not decoded");
+    return;
+  }
+  for (slot = 0U; slot < CPU_TRACE_MAX_TASKS; slot++)
+  {
+    if ((Tasks[slot].Cycles != CPU_Trace.Tasks[slot].Cycles) ||
+        (Tasks[slot].Switches != CPU_Trace.Tasks[slot].Switches))
+    {
+      Model_Fail("decoded task cycles or switches");
+    }
+  }
+  if (DecodedIsr != CPU_Trace.IsrCycles)
+  {
+    Model_Fail("decoded interrupt cycles");
+  }
+  if (DecodedKernel != CPU_Trace.KernelCycles)
+  {
+    Model_Fail("decoded kernel cycles");
+  }
+  for (k = 0U; k < EXCEPTIONS; k++)
+  {
+    if (Isrs[k].Count != Model.IsrCalls[k])
+    {
+      Model_Fail("decoded interrupt calls");
+    }
+    isrCycles += Isrs[k].Cycles;
+  }
+  if (isrCycles != DecodedIsr)
+  {
+    Model_Fail("decoded cycles of each interrupt, nesting excluded");
+  }
+
+  /* What the run must have covered */
+  if ((Model.Wraps < 2U) || (longest <= 0xFFFFFFFFU))
+  {
+    Model_Fail("cycle counter wrap not covered");
+  }
+  if ((Model.MaxNesting < MODEL_NESTING) || (Model.Preemptions == 0U))
+  {
+    Model_Fail("nested or preempting interrupts not covered");
+  }
+}
+
+/**
+  * @brief  Let the running context run.
+  * @param  Cycles: Time to pass
+  * @retval None
+  */
+static void Model_Run(uint64_t Cycles)
+{
+  uint32_t before = ModelDwt.CYCCNT;
+
+  if (Model.Nesting != 0U)
+  {
+    Model.IsrCycles += Cycles;
+  }
+  else if (Model.Task >= 0)
+  {
+    Model.TaskCycles[Model.Task] += Cycles;
+  }
+  else
+  {
+    Model.KernelCycles += Cycles;
+  }
+  Model.Now += Cycles;
+  ModelDwt.CYCCNT = before + (uint32_t)Cycles;
+  Model.Wraps += (uint32_t)((before + Cycles) >> 32);
+}
+
+/**
+  * @brief  Run for longer than the cycle counter wraps around, with the SYNC
+  *         records of the kernel tick in between.
+  * @param  None
+  * @retval None
+  */
+static void Model_LongRun(void)
+{
+  uint32_t chunk;
+
+  Model.LongRuns++;
+  for (chunk = 0U; chunk < MODEL_LONG_CHUNKS; chunk++)
+  {
+    Model_Run(MODEL_LONG_CHUNK_CYCLES);
+    Model.Ticks += CPU_TRACE_SYNC_PERIOD;
+    CPU_TRACE_Sync(Model.Ticks);
+  }
+}
+
+/**
+  * @brief  Raise an interrupt, which may be preempted by another.
+  * @param  None
+  * @retval None
+  */
+static void Model_Interrupt(void)
+{
+  uint32_t ipsr = Model.Ipsr;
+  uint32_t number = 16U + Model_Random(MODEL_IRQS);
+
+  /* Exception entry and return clear the exclusive monitor */
+  Model.Exclusive = 0U;
+  Model.Ipsr = number;
+  Model.IsrCalls[number]++;
+  if (++Model.Nesting > Model.MaxNesting)
+  {
+    Model.MaxNesting = Model.Nesting;
+  }
+
+  CPU_TRACE_ISR_ENTER();
+  Model_Run(Model_Random(MODEL_ISR_CYCLES));
+  if ((Model.Nesting < MODEL_NESTING) && (Model_Random(3U) == 0U))
+  {
+    Model_Interrupt();
+    Model_Run(Model_Random(MODEL_ISR_CYCLES));
+  }
+  if (Model_Random(8U) == 0U)
+  {
+    Model.Preempt = 1U;
+  }
+  CPU_TRACE_ISR_EXIT();
+
+  Model.Nesting--;
+  Model.Ipsr = ipsr;
+  Model.Exclusive = 0U;
+}
+
+/**
+  * @brief  Switch to a task, as vTaskSwitchContext() does.
+  * @param  Task: Task to run next
+  * @retval None
+  */
+static void Model_Switch(uint32_t Task)
+{
+  CPU_TRACE_TaskSwitchedOut();
+  Model.Task = -1;
+  if (Model_Random(8U) == 0U)
+  {
+    Model_Interrupt();
+  }
+  CPU_TRACE_TaskEvent(CPU_TRACE_EVT_TASK_READY, Model.Slots[Task]);
+  CPU_TRACE_TaskSwitchedIn(Model.Slots[Task]);
+  Model.Task = (int32_t)Task;
+  Model.Switches[Task]++;
+}
+
+/**
+  * @brief  A task or a queue event of the running task.
+  * @param  None
+  * @retval None
+  */
+static void Model_Event(void)
+{
+  switch (Model_Random(3U))
+  {
+    case 0U:
+      CPU_TRACE_TaskEvent(CPU_TRACE_EVT_TASK_READY, Model.Slots[Model_Random(MODEL_TASKS)]);
+      break;
+
+    case 1U:
+      CPU_TRACE_QueueEvent(CPU_TRACE_EVT_QUEUE_SEND, 0U, 1U);
+      break;
+
+    default:
+      CPU_TRACE_UserEvent(1U, (uint16_t)Model_Random(0x10000U));
+      break;
+  }
+}
+
+/**
+  * @brief  Pseudo random numbers, the same on every host.
+  * @param  Range: Numbers are below Range
+  * @retval Number
+  */
+static uint32_t Model_Random(uint32_t Range)
+{
+  Model.Seed = (Model.Seed * 1103515245U) + 12345U;
+  return (Range != 0U) ? ((Model.Seed >> 8) % Range) : 0U;
+}
+
+/**
+  * @brief  Report a failed check.
+  * @param  What: Description of the check
+  * @retval None
+  */
+static void Model_Fail(const char *What)
+{
+  printf("FAILED: %s\n", What);
+  Model.Failures++;
+}
+
+/* Core registers of the model -----------------------------------------------*/
+uint32_t __get_PRIMASK(void)
+{
+  return Model.Primask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+  Model.Primask = priMask;
+}
+
+void __disable_irq(void)
+{
+  Model.Primask = 1U;
+}
+
+uint32_t __get_IPSR(void)
+{
+  return Model.Ipsr;
+}
+
+uint32_t __LDREXW(volatile uint32_t *addr)
+{
+  Model.Exclusive = 1U;
+  return *addr;
+}
+
+/* An interrupt raised before the store clears the monitor, the store fails */
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+  if ((Model.Preempt != 0U) && (Model.Primask == 0U) && (Model.Nesting < MODEL_NESTING))
+  {
+    Model.Preempt = 0U;
+    Model.Preemptions++;
+    Model_Interrupt();
+  }
+  if (Model.Exclusive == 0U)
+  {
+    return 1U;
+  }
+  *addr = value;
+  Model.Exclusive = 0U;
+  return 0U;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,598 @@
+/**
+  ******************************************************************************
+  * @file    cpu_trace.c
+  * @author  MCD Application Team
+  * @brief   Scheduler trace recorder and per-task CPU accounting for FreeRTOS
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2016 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */ 
+
+/********************** NOTES **********************************************
+This module records scheduler, queue and interrupt events into a ring buffer
+of 8-byte records time stamped with the DWT cycle counter, and accounts the
+cycles spent in each task, in the traced interrupts and in the kernel.
+
+To use this module, the following steps should be followed :
+
+1- in the _OS_Config.h file (ex. FreeRTOSConfig.h) :
+      - #define configUSE_TRACE_FACILITY   1
+      - include the module header at the end of the file, after the guard
+        that keeps C declarations away from the assembler:
+          #if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+           #include "cpu_trace.h"
+          #endif
+        cpu_trace.h then defines the traceTASK_xxx and traceQUEUE_xxx hooks.
+        The module cannot be used together with cpu_utils.c, which defines
+        its own traceTASK_SWITCHED_IN/OUT hooks.
+      - optionally, to get vTaskGetRunTimeStats() from the same counter:
+          #define configGENERATE_RUN_TIME_STATS             1
+          #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+          #define portGET_RUN_TIME_COUNTER_VALUE()          CPU_TRACE_GetCycles()
+        The kernel keeps 32-bit run time counters, which wrap after 2^32
+        cycles; the accounting of this module is 64-bit.
+
+2- call CPU_TRACE_Init() in main() before the first task is created, so that
+   the task names are recorded; recording starts immediately.
+
+3- in the interrupt handlers that should appear in the trace, call
+   CPU_TRACE_ISR_ENTER() first and CPU_TRACE_ISR_EXIT() last.
+
+4- read the accounting at run time with CPU_TRACE_GetStats() and
+   CPU_TRACE_GetTaskStats(), or stop the recorder with CPU_TRACE_Stop(), dump
+   the CPU_Trace variable to a file with the debugger (sizeof(CPU_Trace)
+   bytes) and decode it on the host with Host/cpu_trace_decode.c.
+
+Recording is lock-free: the slot of a record is reserved with LDREX/STREX on
+the head index, and an interrupt that records in between makes the STREX fail
+and the reservation retry with a new timestamp. A record therefore costs a
+fixed number of instructions plus one retry per preempting record. The cost
+of a hook is measured at CPU_TRACE_Init() and reported as RecordCycles.
+
+Host/cpu_trace_model.c runs this module on the host, against a model of the
+cycle counter and of the interrupts, and checks its accounting and what
+Host/cpu_trace_decode.c decodes from it.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "main.h"
+#include "cpu_trace.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if ((CPU_TRACE_BUFFER_SIZE & (CPU_TRACE_BUFFER_SIZE - 1U)) != 0U)
+#error "CPU_TRACE_BUFFER_SIZE must be a power of two"
+#endif
+
+/* Accounting slot of the time spent outside any task */
+#define CPU_TRACE_KERNEL            CPU_TRACE_MAX_TASKS
+
+#define CPU_TRACE_CALIBRATION_RUNS  8U
+
+/* Private macro -------------------------------------------------------------*/
+#ifndef CPU_TRACE_TIMESTAMP
+#define CPU_TRACE_TIMESTAMP()       (DWT->CYCCNT)
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+CPU_TRACE_TypeDef CPU_Trace;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t CPU_TRACE_Record(uint8_t Type, uint8_t Id, uint16_t Param);
+static void CPU_TRACE_CloseSegment(uint32_t Now);
+static void CPU_TRACE_Calibrate(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Enable the cycle counter, measure the cost of the hooks and start
+  *         recording.
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_Init(void)
+{
+  uint32_t slot;
+
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  CPU_Trace.Running         = 0U;
+  CPU_Trace.Magic           = CPU_TRACE_MAGIC;
+  CPU_Trace.Version         = CPU_TRACE_VERSION;
+  CPU_Trace.RecordSize      = sizeof(CPU_TRACE_RecordTypeDef);
+  CPU_Trace.BufferSize      = CPU_TRACE_BUFFER_SIZE;
+  CPU_Trace.MaxTasks        = CPU_TRACE_MAX_TASKS;
+  CPU_Trace.TaskTableOffset = offsetof(CPU_TRACE_TypeDef, Tasks);
+  CPU_Trace.BufferOffset    = offsetof(CPU_TRACE_TypeDef, Buffer);
+  CPU_Trace.CpuClockHz      = SystemCoreClock;
+
+  /* Tasks created before this call keep their slot */
+  for(slot = 0U; slot < CPU_TRACE_MAX_TASKS; slot++)
+  {
+    CPU_Trace.Tasks[slot].Switches = 0U;
+    CPU_Trace.Tasks[slot].Cycles   = 0U;
+  }
+
+  CPU_TRACE_Calibrate();
+  CPU_TRACE_Start();
+}
+
+/**
+  * @brief  Clear the ring buffer and the accounting and start recording.
+  *         The time until the next context switch is accounted to the kernel.
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_Start(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t slot;
+
+  __disable_irq();
+
+  for(slot = 0U; slot < CPU_TRACE_MAX_TASKS; slot++)
+  {
+    CPU_Trace.Tasks[slot].Switches = 0U;
+    CPU_Trace.Tasks[slot].Cycles   = 0U;
+  }
+  CPU_Trace.Head         = 0U;
+  CPU_Trace.Retries      = 0U;
+  CPU_Trace.IsrNesting   = 0U;
+  CPU_Trace.IsrCycles    = 0U;
+  CPU_Trace.KernelCycles = 0U;
+  CPU_Trace.CurrentTask  = CPU_TRACE_KERNEL;
+  CPU_Trace.SegmentStart = CPU_TRACE_TIMESTAMP();
+  CPU_Trace.Running      = 1U;
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Stop recording. The buffer and the accounting are kept.
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_Stop(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_Trace.Running = 0U;
+    if(CPU_Trace.IsrNesting == 0U)
+    {
+      CPU_TRACE_CloseSegment(CPU_TRACE_TIMESTAMP());
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Current value of the cycle counter, for the kernel run time stats
+  * @param  None
+  * @retval Cycle counter
+  */
+uint32_t CPU_TRACE_GetCycles(void)
+{
+  return CPU_TRACE_TIMESTAMP();
+}
+
+/**
+  * @brief  Get the whole-system accounting
+  * @param  pStats: filled with the figures since the last start
+  * @retval None
+  */
+void CPU_TRACE_GetStats(CPU_TRACE_StatsTypeDef *pStats)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t slot;
+
+  __disable_irq();
+
+  pStats->IsrCycles    = CPU_Trace.IsrCycles;
+  pStats->KernelCycles = CPU_Trace.KernelCycles;
+  pStats->TotalCycles  = CPU_Trace.IsrCycles + CPU_Trace.KernelCycles;
+  for(slot = 0U; slot < CPU_TRACE_MAX_TASKS; slot++)
+  {
+    pStats->TotalCycles += CPU_Trace.Tasks[slot].Cycles;
+  }
+  pStats->Records      = CPU_Trace.Head;
+  pStats->LostRecords  = (CPU_Trace.Head > CPU_TRACE_BUFFER_SIZE) ?
+                         (CPU_Trace.Head - CPU_TRACE_BUFFER_SIZE) : 0U;
+  pStats->RecordCycles = CPU_Trace.RecordCycles;
+  pStats->Retries      = CPU_Trace.Retries;
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Get the per-task accounting
+  * @param  pTasks: array filled with the used task slots
+  * @param  MaxTasks: number of entries in pTasks
+  * @retval Number of entries filled
+  */
+uint32_t CPU_TRACE_GetTaskStats(CPU_TRACE_TaskTypeDef *pTasks, uint32_t MaxTasks)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t slot;
+  uint32_t count = 0U;
+
+  __disable_irq();
+
+  for(slot = 0U; (slot < CPU_TRACE_MAX_TASKS) && (count < MaxTasks); slot++)
+  {
+    if(CPU_Trace.Tasks[slot].TcbNumber != 0U)
+    {
+      pTasks[count++] = CPU_Trace.Tasks[slot];
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return count;
+}
+
+/**
+  * @brief  Record an application event
+  * @param  Channel: application defined channel
+  * @param  Value: application defined value
+  * @retval None
+  */
+void CPU_TRACE_UserEvent(uint8_t Channel, uint16_t Value)
+{
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_TRACE_Record(CPU_TRACE_EVT_USER, Channel, Value);
+  }
+}
+
+/**
+  * @brief  traceTASK_CREATE hook, called from a kernel critical section
+  * @param  TcbNumber: unique number of the new task
+  * @param  pName: name of the new task
+  * @param  Priority: priority of the new task
+  * @retval Slot of the task, stored in its TCB
+  */
+uint32_t CPU_TRACE_TaskCreate(uint32_t TcbNumber, const char *pName, uint32_t Priority)
+{
+  static const char other[] = "(other)";
+  CPU_TRACE_TaskTypeDef *pTask;
+  uint32_t slot;
+  uint32_t i;
+
+  /* Slots are not reused, so that the records of a deleted task can still be
+     named by the decoder. Tasks that do not fit share the last slot. */
+  for(slot = 0U; slot < (CPU_TRACE_MAX_TASKS - 1U); slot++)
+  {
+    if(CPU_Trace.Tasks[slot].TcbNumber == 0U)
+    {
+      break;
+    }
+  }
+  pTask = &CPU_Trace.Tasks[slot];
+
+  if(pTask->TcbNumber != 0U)
+  {
+    pName = other;
+  }
+  for(i = 0U; (i < (CPU_TRACE_NAME_LEN - 1U)) && (pName[i] != '\0'); i++)
+  {
+    pTask->Name[i] = pName[i];
+  }
+  pTask->Name[i] = '\0';
+  pTask->TcbNumber = TcbNumber;
+
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_TRACE_Record(CPU_TRACE_EVT_TASK_CREATE, (uint8_t)slot, (uint16_t)Priority);
+  }
+
+  return slot;
+}
+
+/**
+  * @brief  traceTASK_SWITCHED_IN hook
+  * @param  Slot: slot of the task that starts running
+  * @retval None
+  */
+void CPU_TRACE_TaskSwitchedIn(uint32_t Slot)
+{
+  uint32_t primask;
+
+  if(CPU_Trace.Running != 0U)
+  {
+    if(Slot >= CPU_TRACE_MAX_TASKS)
+    {
+      Slot = CPU_TRACE_MAX_TASKS - 1U;
+    }
+    CPU_TRACE_Record(CPU_TRACE_EVT_TASK_SWITCH_IN, (uint8_t)Slot, 0U);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if(CPU_Trace.IsrNesting == 0U)
+    {
+      CPU_TRACE_CloseSegment(CPU_TRACE_TIMESTAMP());
+    }
+    CPU_Trace.CurrentTask = Slot;
+    CPU_Trace.Tasks[Slot].Switches++;
+    __set_PRIMASK(primask);
+  }
+}
+
+/**
+  * @brief  traceTASK_SWITCHED_OUT hook. The switch itself is accounted to the
+  *         kernel, the decoder uses the next SWITCH_IN record.
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_TaskSwitchedOut(void)
+{
+  uint32_t primask;
+
+  if(CPU_Trace.Running != 0U)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if(CPU_Trace.IsrNesting == 0U)
+    {
+      CPU_TRACE_CloseSegment(CPU_TRACE_TIMESTAMP());
+    }
+    CPU_Trace.CurrentTask = CPU_TRACE_KERNEL;
+    __set_PRIMASK(primask);
+  }
+}
+
+/**
+  * @brief  Task state change hook
+  * @param  Type: CPU_TRACE_EVT_TASK_xxx
+  * @param  Slot: slot of the task
+  * @retval None
+  */
+void CPU_TRACE_TaskEvent(uint8_t Type, uint32_t Slot)
+{
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_TRACE_Record(Type, (uint8_t)Slot, 0U);
+  }
+}
+
+/**
+  * @brief  traceQUEUE_CREATE hook
+  * @param  QueueType: queue, mutex or semaphore
+  * @retval Number of the queue, stored in the queue structure
+  */
+uint32_t CPU_TRACE_QueueCreate(uint8_t QueueType)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t number;
+
+  __disable_irq();
+  number = ++CPU_Trace.QueueCount;
+  __set_PRIMASK(primask);
+
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_TRACE_Record(CPU_TRACE_EVT_QUEUE_CREATE, QueueType, (uint16_t)number);
+  }
+
+  return number;
+}
+
+/**
+  * @brief  Queue operation hook
+  * @param  Type: CPU_TRACE_EVT_QUEUE_xxx
+  * @param  QueueType: queue, mutex or semaphore
+  * @param  QueueNumber: number given by CPU_TRACE_QueueCreate()
+  * @retval None
+  */
+void CPU_TRACE_QueueEvent(uint8_t Type, uint8_t QueueType, uint32_t QueueNumber)
+{
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_TRACE_Record(Type, QueueType, (uint16_t)QueueNumber);
+  }
+}
+
+/**
+  * @brief  traceTASK_INCREMENT_TICK hook, called every CPU_TRACE_SYNC_PERIOD
+  *         ticks. The accounting segment is closed too, so that no segment
+  *         is longer than the 32-bit cycle counter can measure.
+  * @param  TickCount: new tick count
+  * @retval None
+  */
+void CPU_TRACE_Sync(uint32_t TickCount)
+{
+  uint32_t primask;
+
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_TRACE_Record(CPU_TRACE_EVT_SYNC, 0U, (uint16_t)TickCount);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if(CPU_Trace.IsrNesting == 0U)
+    {
+      CPU_TRACE_CloseSegment(CPU_TRACE_TIMESTAMP());
+    }
+    __set_PRIMASK(primask);
+  }
+}
+
+/**
+  * @brief  Interrupt entry hook
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_IsrEnter(void)
+{
+  uint32_t primask;
+
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_TRACE_Record(CPU_TRACE_EVT_ISR_ENTER, (uint8_t)__get_IPSR(), 0U);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if(CPU_Trace.IsrNesting++ == 0U)
+    {
+      CPU_TRACE_CloseSegment(CPU_TRACE_TIMESTAMP());
+    }
+    __set_PRIMASK(primask);
+  }
+}
+
+/**
+  * @brief  Interrupt exit hook
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_IsrExit(void)
+{
+  uint32_t primask;
+  uint32_t now;
+
+  if(CPU_Trace.Running != 0U)
+  {
+    CPU_TRACE_Record(CPU_TRACE_EVT_ISR_EXIT, (uint8_t)__get_IPSR(), 0U);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if((CPU_Trace.IsrNesting != 0U) && (--CPU_Trace.IsrNesting == 0U))
+    {
+      now = CPU_TRACE_TIMESTAMP();
+      CPU_Trace.IsrCycles += now - CPU_Trace.SegmentStart;
+      CPU_Trace.SegmentStart = now;
+    }
+    __set_PRIMASK(primask);
+  }
+}
+
+/**
+  * @brief  Write one record
+  * @param  Type: CPU_TRACE_EVT_xxx
+  * @param  Id: record Id field
+  * @param  Param: record Param field
+  * @retval Timestamp of the record
+  */
+static uint32_t CPU_TRACE_Record(uint8_t Type, uint8_t Id, uint16_t Param)
+{
+  CPU_TRACE_RecordTypeDef *pRecord;
+  uint32_t index;
+  uint32_t timestamp;
+
+  /* The timestamp is taken inside the exclusive access, so records are in
+     time order even when an interrupt records in between: exception entry
+     clears the exclusive monitor and the STREX fails. */
+  for(;;)
+  {
+    index = __LDREXW(&CPU_Trace.Head);
+    timestamp = CPU_TRACE_TIMESTAMP();
+    if(__STREXW(index + 1U, &CPU_Trace.Head) == 0U)
+    {
+      break;
+    }
+    CPU_Trace.Retries++;
+  }
+
+  pRecord = &CPU_Trace.Buffer[index & (CPU_TRACE_BUFFER_SIZE - 1U)];
+  pRecord->Timestamp = timestamp;
+  pRecord->Type      = Type;
+  pRecord->Id        = Id;
+  pRecord->Param     = Param;
+
+  return timestamp;
+}
+
+/**
+  * @brief  Account the cycles since the start of the segment to the running
+  *         task or to the kernel. Called with interrupts disabled.
+  * @param  Now: end of the segment
+  * @retval None
+  */
+static void CPU_TRACE_CloseSegment(uint32_t Now)
+{
+  uint32_t elapsed = Now - CPU_Trace.SegmentStart;
+
+  if(CPU_Trace.CurrentTask < CPU_TRACE_MAX_TASKS)
+  {
+    CPU_Trace.Tasks[CPU_Trace.CurrentTask].Cycles += elapsed;
+  }
+  else
+  {
+    CPU_Trace.KernelCycles += elapsed;
+  }
+  CPU_Trace.SegmentStart = Now;
+}
+
+/**
+  * @brief  Measure the cost of a hook: the smallest duration of an ISR
+  *         enter/exit pair, the heaviest hooks, minus the cost of reading the
+  *         cycle counter, halved.
+  * @param  None
+  * @retval None
+  */
+static void CPU_TRACE_Calibrate(void)
+{
+  uint32_t empty = 0xFFFFFFFFU;
+  uint32_t pair = 0xFFFFFFFFU;
+  uint32_t start;
+  uint32_t end;
+  uint32_t run;
+
+  CPU_Trace.Running = 1U;
+  for(run = 0U; run < CPU_TRACE_CALIBRATION_RUNS; run++)
+  {
+    start = CPU_TRACE_TIMESTAMP();
+    end = CPU_TRACE_TIMESTAMP();
+    if((end - start) < empty)
+    {
+      empty = end - start;
+    }
+
+    start = CPU_TRACE_TIMESTAMP();
+    CPU_TRACE_IsrEnter();
+    CPU_TRACE_IsrExit();
+    end = CPU_TRACE_TIMESTAMP();
+    if((end - start) < pair)
+    {
+      pair = end - start;
+    }
+  }
+  CPU_Trace.Running = 0U;
+
+  CPU_Trace.RecordCycles = (pair > empty) ? ((pair - empty) / 2U) : 0U;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
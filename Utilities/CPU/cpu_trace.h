@@ -0,0 +1,242 @@
+/**
+  ******************************************************************************
+  * @file    cpu_trace.h
+  * @author  MCD Application Team
+  * @brief   Header for cpu_trace module
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2016 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */ 
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CPU_TRACE_H__
+#define _CPU_TRACE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+/* This header is included at the end of FreeRTOSConfig.h, so it must not pull
+   in the kernel or the device headers. */
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* Number of records in the ring buffer, must be a power of two */
+#ifndef CPU_TRACE_BUFFER_SIZE
+#define CPU_TRACE_BUFFER_SIZE       1024U
+#endif
+
+/* Number of task slots; tasks created once the table is full share the
+   last slot */
+#ifndef CPU_TRACE_MAX_TASKS
+#define CPU_TRACE_MAX_TASKS         16U
+#endif
+
+/* A SYNC record is written every CPU_TRACE_SYNC_PERIOD kernel ticks so that
+   the decoder can unwrap the 32-bit cycle counter even when nothing else
+   happens for a long time. Must be a power of two. */
+#ifndef CPU_TRACE_SYNC_PERIOD
+#define CPU_TRACE_SYNC_PERIOD       1024U
+#endif
+
+#define CPU_TRACE_NAME_LEN          16U
+#define CPU_TRACE_MAGIC             0x54555043U   /* "CPUT" */
+#define CPU_TRACE_VERSION           1U
+
+/* Record types */
+#define CPU_TRACE_EVT_TASK_SWITCH_IN      0x01U   /* Id: task slot */
+#define CPU_TRACE_EVT_TASK_CREATE         0x02U   /* Id: task slot, Param: priority */
+#define CPU_TRACE_EVT_TASK_DELETE         0x03U   /* Id: task slot */
+#define CPU_TRACE_EVT_TASK_READY          0x04U   /* Id: task slot */
+#define CPU_TRACE_EVT_TASK_DELAY          0x05U   /* Id: task slot */
+#define CPU_TRACE_EVT_QUEUE_CREATE        0x10U   /* Id: queue type, Param: queue number */
+#define CPU_TRACE_EVT_QUEUE_SEND          0x11U
+#define CPU_TRACE_EVT_QUEUE_SEND_FAILED   0x12U
+#define CPU_TRACE_EVT_QUEUE_RECEIVE       0x13U
+#define CPU_TRACE_EVT_QUEUE_RECEIVE_FAILED 0x14U
+#define CPU_TRACE_EVT_QUEUE_PEEK          0x15U
+#define CPU_TRACE_EVT_QUEUE_SEND_ISR      0x16U
+#define CPU_TRACE_EVT_QUEUE_RECEIVE_ISR   0x17U
+#define CPU_TRACE_EVT_QUEUE_BLOCK_SEND    0x18U
+#define CPU_TRACE_EVT_QUEUE_BLOCK_RECEIVE 0x19U
+#define CPU_TRACE_EVT_ISR_ENTER           0x20U   /* Id: exception number */
+#define CPU_TRACE_EVT_ISR_EXIT            0x21U   /* Id: exception number */
+#define CPU_TRACE_EVT_SYNC                0x30U   /* Param: low 16 bits of the tick count */
+#define CPU_TRACE_EVT_USER                0x31U   /* Id: channel, Param: value */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  One trace record, 8 bytes
+  */
+typedef struct
+{
+  uint32_t Timestamp;                   /* DWT cycle counter */
+  uint8_t  Type;                        /* CPU_TRACE_EVT_xxx */
+  uint8_t  Id;
+  uint16_t Param;
+} CPU_TRACE_RecordTypeDef;
+
+/**
+  * @brief  Per-task accounting, 32 bytes
+  */
+typedef struct
+{
+  char     Name[CPU_TRACE_NAME_LEN];
+  uint32_t TcbNumber;                   /* 0 if the slot is free */
+  uint32_t Switches;                    /* Number of times switched in */
+  uint64_t Cycles;                      /* Cycles spent running, ISRs excluded */
+} CPU_TRACE_TaskTypeDef;
+
+/**
+  * @brief  Trace control block. It is laid out so that a raw memory dump of
+  *         CPU_Trace is all the host decoder needs: the header gives the
+  *         offsets of the task table and of the ring buffer.
+  */
+typedef struct
+{
+  uint32_t Magic;                       /* CPU_TRACE_MAGIC */
+  uint16_t Version;                     /* CPU_TRACE_VERSION */
+  uint16_t RecordSize;                  /* sizeof(CPU_TRACE_RecordTypeDef) */
+  uint32_t BufferSize;                  /* Records in the ring buffer */
+  uint32_t MaxTasks;                    /* Entries in the task table */
+  uint32_t TaskTableOffset;             /* Offset of Tasks[] from &Magic */
+  uint32_t BufferOffset;                /* Offset of Buffer[] from &Magic */
+  uint32_t CpuClockHz;                  /* Cycle counter frequency */
+  volatile uint32_t Running;            /* Recording enabled */
+  volatile uint32_t Head;               /* Records reserved since start */
+  uint32_t RecordCycles;                /* Measured cost of one record */
+  volatile uint32_t Retries;            /* Reservations retried after preemption */
+  uint32_t IsrNesting;
+  uint32_t CurrentTask;                 /* Running task slot */
+  uint32_t SegmentStart;                /* Start of the current accounting segment */
+  uint32_t QueueCount;                  /* Queue numbers handed out */
+  uint32_t Reserved;                    /* Keeps the 64-bit counters aligned */
+  uint64_t IsrCycles;                   /* Cycles spent in traced ISRs */
+  uint64_t KernelCycles;                /* Cycles outside tasks and traced ISRs */
+  CPU_TRACE_TaskTypeDef   Tasks[CPU_TRACE_MAX_TASKS];
+  CPU_TRACE_RecordTypeDef Buffer[CPU_TRACE_BUFFER_SIZE];
+} CPU_TRACE_TypeDef;
+
+/**
+  * @brief  Whole-system figures returned by CPU_TRACE_GetStats()
+  */
+typedef struct
+{
+  uint64_t TotalCycles;                 /* Tasks + ISRs + kernel */
+  uint64_t IsrCycles;
+  uint64_t KernelCycles;
+  uint32_t Records;                     /* Records written since start */
+  uint32_t LostRecords;                 /* Records overwritten in the ring */
+  uint32_t RecordCycles;                /* Cost of one record */
+  uint32_t Retries;
+} CPU_TRACE_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+extern CPU_TRACE_TypeDef CPU_Trace;
+
+/* Exported macro ------------------------------------------------------------*/
+/* FreeRTOS trace hooks. They are expanded inside tasks.c and queue.c, where
+   the TCB and queue structures are visible; the slot of a task and the number
+   of a queue are kept in the uxTaskNumber and uxQueueNumber fields that the
+   kernel reserves for trace code. */
+#ifndef CPU_TRACE_NO_KERNEL_HOOKS
+
+#if defined(configUSE_TRACE_FACILITY) && (configUSE_TRACE_FACILITY != 1)
+#error "cpu_trace requires configUSE_TRACE_FACILITY to be set to 1"
+#endif
+
+#define traceTASK_CREATE(pxNewTCB)                                             \
+          (pxNewTCB)->uxTaskNumber = CPU_TRACE_TaskCreate((pxNewTCB)->uxTCBNumber, \
+                                       (pxNewTCB)->pcTaskName, (pxNewTCB)->uxPriority)
+#define traceTASK_DELETE(pxTaskToDelete)                                       \
+          CPU_TRACE_TaskEvent(CPU_TRACE_EVT_TASK_DELETE, (pxTaskToDelete)->uxTaskNumber)
+#define traceTASK_SWITCHED_IN()       CPU_TRACE_TaskSwitchedIn(pxCurrentTCB->uxTaskNumber)
+#define traceTASK_SWITCHED_OUT()      CPU_TRACE_TaskSwitchedOut()
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)                                  \
+          CPU_TRACE_TaskEvent(CPU_TRACE_EVT_TASK_READY, (pxTCB)->uxTaskNumber)
+#define traceTASK_DELAY()                                                      \
+          CPU_TRACE_TaskEvent(CPU_TRACE_EVT_TASK_DELAY, pxCurrentTCB->uxTaskNumber)
+#define traceTASK_DELAY_UNTIL(x)                                               \
+          CPU_TRACE_TaskEvent(CPU_TRACE_EVT_TASK_DELAY, pxCurrentTCB->uxTaskNumber)
+#define traceTASK_INCREMENT_TICK(xTickCount)                                   \
+          do                                                                   \
+          {                                                                    \
+            if((((xTickCount) + 1U) & (CPU_TRACE_SYNC_PERIOD - 1U)) == 0U)     \
+            {                                                                  \
+              CPU_TRACE_Sync((uint32_t)(xTickCount) + 1U);                     \
+            }                                                                  \
+          } while(0)
+
+#define traceQUEUE_CREATE(pxNewQueue)                                          \
+          (pxNewQueue)->uxQueueNumber = CPU_TRACE_QueueCreate((pxNewQueue)->ucQueueType)
+#define CPU_TRACE_QUEUE(Type, pxQueue)                                         \
+          CPU_TRACE_QueueEvent((Type), (pxQueue)->ucQueueType, (pxQueue)->uxQueueNumber)
+#define traceQUEUE_SEND(pxQueue)           CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_SEND, pxQueue)
+#define traceQUEUE_SEND_FAILED(pxQueue)    CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_SEND_FAILED, pxQueue)
+#define traceQUEUE_RECEIVE(pxQueue)        CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_RECEIVE, pxQueue)
+#define traceQUEUE_RECEIVE_FAILED(pxQueue) CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_RECEIVE_FAILED, pxQueue)
+#define traceQUEUE_PEEK(pxQueue)           CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_PEEK, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)  CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_SEND_ISR, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue) CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_RECEIVE_ISR, pxQueue)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue) CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_BLOCK_SEND, pxQueue)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) CPU_TRACE_QUEUE(CPU_TRACE_EVT_QUEUE_BLOCK_RECEIVE, pxQueue)
+
+#endif /* CPU_TRACE_NO_KERNEL_HOOKS */
+
+/* Interrupt hooks: FreeRTOS has no ISR trace macro, so handlers that should
+   appear in the trace call these on entry and exit. */
+#define CPU_TRACE_ISR_ENTER()         CPU_TRACE_IsrEnter()
+#define CPU_TRACE_ISR_EXIT()          CPU_TRACE_IsrExit()
+
+/* Exported functions ------------------------------------------------------- */
+void     CPU_TRACE_Init(void);
+void     CPU_TRACE_Start(void);
+void     CPU_TRACE_Stop(void);
+uint32_t CPU_TRACE_GetCycles(void);
+void     CPU_TRACE_GetStats(CPU_TRACE_StatsTypeDef *pStats);
+uint32_t CPU_TRACE_GetTaskStats(CPU_TRACE_TaskTypeDef *pTasks, uint32_t MaxTasks);
+void     CPU_TRACE_UserEvent(uint8_t Channel, uint16_t Value);
+
+/* Called from the kernel hooks above */
+uint32_t CPU_TRACE_TaskCreate(uint32_t TcbNumber, const char *pName, uint32_t Priority);
+void     CPU_TRACE_TaskSwitchedIn(uint32_t Slot);
+void     CPU_TRACE_TaskSwitchedOut(void);
+void     CPU_TRACE_TaskEvent(uint8_t Type, uint32_t Slot);
+uint32_t CPU_TRACE_QueueCreate(uint8_t QueueType);
+void     CPU_TRACE_QueueEvent(uint8_t Type, uint8_t QueueType, uint32_t QueueNumber);
+void     CPU_TRACE_Sync(uint32_t TickCount);
+void     CPU_TRACE_IsrEnter(void);
+void     CPU_TRACE_IsrExit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CPU_TRACE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/